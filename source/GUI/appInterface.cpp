@@ -263,23 +263,13 @@ void appInterface::loadStructs() {
 		return;
 	}
 	
-	// fetch mask data
-	QStringList maskNames;	
-	QDirIterator files (parent->data->gui_location+"/database/mask/", {QString(name)+".*.egsphant.gz"},
-						QDir::NoFilter, QDirIterator::Subdirectories);
-	
-	while(files.hasNext()) {
-		files.next();
-		maskNames << files.fileName();
-	}
+	// fetch mask structure names
+	masks.loadMaskFiles(parent->data->gui_location+"/database/mask/", name, true);
+	QVector <QString> maskNames = masks.structs;
 	
-	QString tempName;
 	for (int i = 0; i < maskNames.size() && i < STRUCT_COUNT; i++) {
-		tempName = maskNames[i];
-		contourFileName[i] = tempName;
-		tempName = tempName.left(tempName.size()-17);
-		tempName = tempName.right(tempName.size()-name.size()-1);
-		contourNameLabel[i]->setText(tempName);
+		contourFileName[i] = name;
+		contourNameLabel[i]->setText(maskNames[i]);
 		
 		contourNameLabel[i]->setDisabled(false);
 		loadMetricBox[i]->setDisabled(false);
@@ -409,6 +399,24 @@ void appInterface::outputCSV() {
 		tempName = tempName.left(tempName.size()-5);
 	
 	QFile(tempPath+tempName+".log").copy(path+"/phantom/"+tempName+".log"); // Get egsphant log
+	QFile(tempPath+tempName+".egsstats").copy(path+"/phantom/"+tempName+".egsstats"); // Get media stats
+	
+	// Output the media composition from the stats sidecar, if there is one
+	EGSPhantStats stats;
+	if (!stats.loadStatsFile(tempPath+tempName+".egsstats")) {
+		QFile mediaFile(path+"/phantom/"+tempName+"_media.csv");
+		if (mediaFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+			QTextStream mediaOut(&mediaFile);
+			mediaOut << "medium, voxels, volume / cm^3, mass / g, mean density / g cm^-3\n";
+			QVector <int> present = stats.presentMedia();
+			for (int i = 0; i < present.size(); i++)
+				mediaOut << stats.media[present[i]] << "," << stats.count[present[i]] << ","
+						 << QString::number(stats.volume[present[i]]) << ","
+						 << QString::number(stats.mass[present[i]]) << ","
+						 << QString::number(stats.mass[present[i]]/stats.volume[present[i]]) << "\n";
+		}
+		mediaFile.close();
+	}
 	
 	// Copy transformation
 	tempPath = parent->data->localDirTransforms[iT];
@@ -438,9 +446,7 @@ void appInterface::outputCSV() {
 	QVector <QVector <DV> > data;
 	QVector <double> volume;
 	QVector <QString> Dx, Dcc, Vx, pD;
-	for (int i = 0; i < masks.size(); i++)
-		delete masks[i];
-	masks.clear();
+	QVector <int> structs;
 	
 	int structCount; // Get structure count
 	for (structCount = 0; structCount < STRUCT_COUNT; structCount++)
@@ -449,7 +455,7 @@ void appInterface::outputCSV() {
 	
 	data.resize(structCount);
 	volume.resize(structCount);
-	masks.resize(structCount);
+	structs.resize(structCount);
 	Dx.resize(structCount);
 	Dcc.resize(structCount);
 	Vx.resize(structCount);
@@ -471,9 +477,9 @@ void appInterface::outputCSV() {
 	
 	int j;
 	parent->progLabel->setText("Loading masks file");
+	masks.loadMaskFiles(tempPath, tempName);
 	for (int i = 0; i < structCount; i++) {
-		masks[i] = new EGSPhant();
-		masks[i]->loadgzEGSPhantFile(tempPath+tempName+"."+contourNameLabel[i]->text()+".mask.egsphant.gz");
+		structs[i] = masks.structs.indexOf(contourNameLabel[i]->text());
 		j      = loadMetricBox[i]->currentIndex();
 		Dx[i]  = parent->data->metricDx[j];
 		Dcc[i] = parent->data->metricDcc[j];
@@ -483,7 +489,7 @@ void appInterface::outputCSV() {
 	}
 	
 	parent->progLabel->setText("Filtering data");
-	doseData.getDVs(&data,&masks,&volume);
+	doseData.getDVs(&data,&masks,&structs,&volume);
 	
 	int histoCount = 2; // Count metrics as 2, I guess
 	for (int i = 0; i < structCount; i++) {
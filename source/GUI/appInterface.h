@@ -68,7 +68,7 @@ public:
 	QComboBox *dose;
 	
 	// Data
-	QVector <EGSPhant*>  masks;
+	EGSMask              masks;
 	Dose*                results;
 	
 	// Metrics
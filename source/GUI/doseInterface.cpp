@@ -83,6 +83,7 @@ doseInterface::~doseInterface() {
 	delete isoDoses[0];
 	
 	delete histPhant;
+	delete histStats;
 	delete histMask;
 	
 	for (int i = 0; i < histDoses.size(); i++)
@@ -415,6 +416,7 @@ void doseInterface::createLayout() {
 	// Phantom selection
 	histPhantLabel  = new QLabel("Virtual patient model");
 	histPhant       = new EGSPhant();
+	histStats       = new EGSPhantStats();
 	histPhantSelect = new QComboBox();
 	histPhantSelect->addItem("none");
 	ttt = tr("The VPM used to select structures and media for filtering dose data.");
@@ -437,7 +439,7 @@ void doseInterface::createLayout() {
 	histMaskLabel    = new QLabel("Structure");
 	histMaskSelect   = new QComboBox();
 	histMaskSelect->addItem("none");
-	histMask         = new EGSPhant();
+	histMask         = new EGSMask();
 	ttt = tr("Ignore all dose data not within the selected structure.  This list "
 			 "is populated when generating the egsphant using the metrics option.");
 	histMaskLabel->setToolTip(ttt);
@@ -1426,12 +1428,21 @@ void doseInterface::loadEgsphant() {
 	connect(phant, SIGNAL(madeProgress(double)),
 			parent, SLOT(updateProgress(double)));
 		
-	if (file.endsWith(".egsphant.gz"))
-		phant->loadgzEGSPhantFilePlus(file);
-	else if (file.endsWith(".begsphant"))
-		phant->loadbEGSPhantFilePlus(file);
-	else if (file.endsWith(".egsphant"))
-		phant->loadEGSPhantFilePlus(file);
+	// Prefer the chunked copy, whose slabs are only read as they are viewed
+	bool chunked = phant->loadChunkedSidecar(file);
+	
+	if (file.endsWith(".egsphant.gz")) {
+		if (!chunked)
+			phant->loadgzEGSPhantFilePlus(file);
+	}
+	else if (file.endsWith(".begsphant")) {
+		if (!chunked)
+			phant->loadbEGSPhantFilePlus(file);
+	}
+	else if (file.endsWith(".egsphant")) {
+		if (!chunked)
+			phant->loadEGSPhantFilePlus(file);
+	}
 	else {
 		QMessageBox::warning(0, "File error",
 		tr("Selected file is not of type egsphant.gz, begsphant, or egsphant.  Aborting"));
@@ -2093,7 +2104,7 @@ void doseInterface::histoRefresh() {
 
 void doseInterface::loadFilterEgsphant() {
 	localNameMasks.clear();
-	localDirMasks.clear();
+	histMaskPhant = "";
 	histMediumView->clear();
 	histMaskSelect->clear();
 	histMaskSelect->addItem("none");
@@ -2108,22 +2119,29 @@ void doseInterface::loadFilterEgsphant() {
 	}
 	
 	QString file = parent->data->localDirPhants[i]+parent->data->localNamePhants[i]; // Get file location
+	QString path = file;
 	
 	// Connect the progress bar
 	parent->resetProgress("Loading egsphant file");
 	connect(histPhant, SIGNAL(madeProgress(double)),
 			parent, SLOT(updateProgress(double)));
 		
+	// Prefer the chunked copy, whose slabs are only read as they are needed
+	bool chunked = histPhant->loadChunkedSidecar(file);
+	
 	if (file.endsWith(".egsphant.gz")) {
-		histPhant->loadgzEGSPhantFile(file);
+		if (!chunked)
+			histPhant->loadgzEGSPhantFile(file);
 		file = file.left(file.size()-12).split("/").last();
 	}
 	else if (file.endsWith(".begsphant")) {
-		histPhant->loadbEGSPhantFile(file);
+		if (!chunked)
+			histPhant->loadbEGSPhantFile(file);
 		file = file.left(file.size()-10).split("/").last();
 	}
 	else if (file.endsWith(".egsphant")) {
-		histPhant->loadEGSPhantFile(file);
+		if (!chunked)
+			histPhant->loadEGSPhantFile(file);
 		file = file.left(file.size()-9).split("/").last();
 	}
 	else {
@@ -2133,22 +2151,35 @@ void doseInterface::loadFilterEgsphant() {
 		return;		
 	}
 	
-	// media data	
+	// media data, only listing the media actually present using the stats sidecar
+	// if it is up to date and tallying (and saving) them otherwise
+	if (!histStats->loadStatsSidecar(path, histPhant))
+		if (!histStats->compute(histPhant))
+			histStats->saveStatsFile(EGSPhantStats::statsPath(path));
+	
+	QVector <int> present = histStats->presentMedia();
+	if (present.isEmpty())
+		for (int i = 0; i < histPhant->media.size(); i++)
+			present << i;
+	
+	QString allMedia = EGSPHANT_CHARS;
 	histMediumView->clear();
-	for (int i = 0; i < histPhant->media.size(); i++)
-		histMediumView->addItem(histPhant->media[i]);
+	for (int i = 0; i < present.size(); i++) {
+		QListWidgetItem* item = new QListWidgetItem(histPhant->media[present[i]]);
+		item->setData(Qt::UserRole, allMedia.at(present[i])); // The medium's egsphant char
+		if (present[i] < histStats->count.size() && histStats->count[present[i]])
+			item->setToolTip(QString::number(histStats->volume[present[i]],'g',4)+" cm^3, "+
+							 QString::number(histStats->mass[present[i]],'g',4)+" g");
+		histMediumView->addItem(item);
+	}
 	
-	// local mask data	
+	// local mask data, only the structure names until one is selected
 	localNameMasks.clear();
-	localDirMasks.clear();
+	histMaskPhant = file;
 	
-	QDirIterator files (parent->data->gui_location+"/database/mask/", {QString(file)+".*.egsphant.gz"},
-						QDir::NoFilter, QDirIterator::Subdirectories);
-	while(files.hasNext()) {
-		files.next();
-		localNameMasks << files.fileName();
-		localDirMasks << files.path();
-	}
+	histMask->loadMaskFiles(parent->data->gui_location+"/database/mask/", histMaskPhant, true);
+	for (int i = 0; i < histMask->structs.size(); i++)
+		localNameMasks << histMask->structs[i];
 	
 	histMaskSelect->clear();
 	histMaskSelect->addItem("none");
@@ -2162,38 +2193,28 @@ void doseInterface::loadMaskEgsphant() {
 	int i = histMaskSelect->currentIndex()-1;
 	if (i < 0) {return;} // Exit if none is selected or box is empty in setup
 	
-	if (i >= localDirMasks.size()) {
+	if (i >= localNameMasks.size()) {
 		QMessageBox::warning(0, "Index error",
 		tr("Somehow the selected mask index is larger than the local VPM count.  Aborting"));		
 		return;
 	}
 	
-	QString file = localDirMasks[i]+localNameMasks[i]; // Get file location
+	// All structures share the one label volume, so only load it once per VPM
+	if (histMask->label.size())
+		return;
 	
 	// Connect the progress bar
 	parent->resetProgress("Loading mask file");
 	connect(histMask, SIGNAL(madeProgress(double)),
 			parent, SLOT(updateProgress(double)));
-		
-	if (file.endsWith(".egsphant.gz")) {
-		histMask->loadgzEGSPhantFile(file);
-		file = file.left(file.size()-12).split("/").last();
-	}
-	else if (file.endsWith(".begsphant")) {
-		histMask->loadbEGSPhantFile(file);
-		file = file.left(file.size()-10).split("/").last();
-	}
-	else if (file.endsWith(".egsphant")) {
-		histMask->loadEGSPhantFile(file);
-		file = file.left(file.size()-9).split("/").last();
-	}
-	else {
+	
+	if (histMask->loadMaskFiles(parent->data->gui_location+"/database/mask/", histMaskPhant)) {
 		QMessageBox::warning(0, "File error",
-		tr("Selected file is not of type egsphant.gz, begsphant, or egsphant.  Aborting"));
-		parent->finishedProgress();
-		return;		
+		tr("Could not load the structure masks of ") + histMaskPhant + tr(".  Aborting"));
 	}
 	
+	disconnect(histMask, SIGNAL(madeProgress(double)),
+			   parent, SLOT(updateProgress(double)));
 	parent->finishedProgress();
 }
 	
@@ -2271,11 +2292,11 @@ void doseInterface::histoRender() {
 		filterInfo += 1;
 	
 	QList <QListWidgetItem*> selectedMedia = histMediumView->selectedItems();
-	QString allowedMedia = "", allMedia = EGSPHANT_CHARS;
+	QString allowedMedia = "";
 	if (selectedMedia.size()) {
 		filterInfo += 2;
 		for (int i = 0; i < selectedMedia.size(); i++)
-			allowedMedia += allMedia[histMediumView->row(selectedMedia[i])];
+			allowedMedia += selectedMedia[i]->data(Qt::UserRole).toChar();
 	}
 	
 	double minDose = histDoseMinEdit->text().toDouble(), maxDose = histDoseMaxEdit->text().toDouble();
@@ -2303,25 +2324,25 @@ void doseInterface::histoRender() {
 		parent->nameProgress("Filtering data");
 		switch (filterInfo) {
 			case 1: // Mask with no media
-				histDoses[i]->getDV(&data, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 2: // Media with no mask
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, count);
 				break;
 			case 3: // Media and mask
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 4: // Dose ranges
 				histDoses[i]->getDV(&data, &volume, minDose, maxDose, count);
 				break;
 			case 5: // Mask with no media and dose ranges
-				histDoses[i]->getDV(&data, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			case 6: // Media with no mask and dose ranges
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, minDose, maxDose, count);
 				break;
 			case 7: // Media and mask and dose ranges
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			default: // #nofilter #nomakeup
 				histDoses[i]->getDV(&data, &volume, count);
@@ -2455,11 +2476,11 @@ void doseInterface::calcMetrics() {
 		filterInfo += 1;
 	
 	QList <QListWidgetItem*> selectedMedia = histMediumView->selectedItems();
-	QString allowedMedia = "", allMedia = EGSPHANT_CHARS;
+	QString allowedMedia = "";
 	if (selectedMedia.size()) {
 		filterInfo += 2;
 		for (int i = 0; i < selectedMedia.size(); i++)
-			allowedMedia += allMedia[histMediumView->row(selectedMedia[i])];
+			allowedMedia += selectedMedia[i]->data(Qt::UserRole).toChar();
 	}
 	
 	double minDose = histDoseMinEdit->text().toDouble(), maxDose = histDoseMaxEdit->text().toDouble();
@@ -2515,25 +2536,25 @@ void doseInterface::calcMetrics() {
 		data.clear(); volume = 0;
 		switch (filterInfo) {
 			case 1: // Mask with no media
-				histDoses[i]->getDV(&data, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 2: // Media with no mask
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, count);
 				break;
 			case 3: // Media and mask
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 4: // Dose ranges
 				histDoses[i]->getDV(&data, &volume, minDose, maxDose, count);
 				break;
 			case 5: // Mask with no media and dose ranges
-				histDoses[i]->getDV(&data, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			case 6: // Media with no mask and dose ranges
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, minDose, maxDose, count);
 				break;
 			case 7: // Media and mask and dose ranges
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			default: // #nofilter #nomakeup
 				histDoses[i]->getDV(&data, &volume, count);
@@ -2662,12 +2683,12 @@ void doseInterface::outputMetrics() {
 	}
 	
 	QList <QListWidgetItem*> selectedMedia = histMediumView->selectedItems();
-	QString allowedMedia = "", allMedia = EGSPHANT_CHARS;
+	QString allowedMedia = "";
 	if (selectedMedia.size()) {
 		filterInfo += 2;
 		text += QString("Data filtered to only include doses within ")+histPhantSelect->currentText()+" VPM voxels containing:,";
 		for (int i = 0; i < selectedMedia.size(); i++) {
-			allowedMedia += allMedia[histMediumView->row(selectedMedia[i])];
+			allowedMedia += selectedMedia[i]->data(Qt::UserRole).toChar();
 			text += selectedMedia[i]->text()+",";
 		}
 		text += QString("\n");
@@ -2731,25 +2752,25 @@ void doseInterface::outputMetrics() {
 		data.clear(); volume = 0;
 		switch (filterInfo) {
 			case 1: // Mask with no media
-				histDoses[i]->getDV(&data, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 2: // Media with no mask
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, count);
 				break;
 			case 3: // Media and mask
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 4: // Dose ranges
 				histDoses[i]->getDV(&data, &volume, minDose, maxDose, count);
 				break;
 			case 5: // Mask with no media and dose ranges
-				histDoses[i]->getDV(&data, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			case 6: // Media with no mask and dose ranges
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, minDose, maxDose, count);
 				break;
 			case 7: // Media and mask and dose ranges
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			default: // #nofilter #nomakeup
 				histDoses[i]->getDV(&data, &volume, count);
@@ -2878,12 +2899,12 @@ void doseInterface::outputRawData() {// Return
 	}
 	
 	QList <QListWidgetItem*> selectedMedia = histMediumView->selectedItems();
-	QString allowedMedia = "", allMedia = EGSPHANT_CHARS;
+	QString allowedMedia = "";
 	if (selectedMedia.size()) {
 		filterInfo += 2;
 		text += QString("Data filtered to only include doses within ")+histPhantSelect->currentText()+" VPM voxels containing:,";
 		for (int i = 0; i < selectedMedia.size(); i++) {
-			allowedMedia += allMedia[histMediumView->row(selectedMedia[i])];
+			allowedMedia += selectedMedia[i]->data(Qt::UserRole).toChar();
 			text += selectedMedia[i]->text()+",";
 		}
 		text += QString("\n");
@@ -2915,25 +2936,25 @@ void doseInterface::outputRawData() {// Return
 		data.clear(); volume = 0;
 		switch (filterInfo) {
 			case 1: // Mask with no media
-				histDoses[i]->getDV(&data, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 2: // Media with no mask
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, count);
 				break;
 			case 3: // Media and mask
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, count);
 				break;
 			case 4: // Dose ranges
 				histDoses[i]->getDV(&data, &volume, minDose, maxDose, count);
 				break;
 			case 5: // Mask with no media and dose ranges
-				histDoses[i]->getDV(&data, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			case 6: // Media with no mask and dose ranges
 				histDoses[i]->getDV(&data, histPhant, allowedMedia, &volume, minDose, maxDose, count);
 				break;
 			case 7: // Media and mask and dose ranges
-				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, &volume, minDose, maxDose, count);
+				histDoses[i]->getDV(&data, histPhant, allowedMedia, histMask, histMaskSelect->currentIndex()-1, &volume, minDose, maxDose, count);
 				break;
 			default: // #nofilter #nomakeup
 				histDoses[i]->getDV(&data, &volume, count);
@@ -3110,16 +3131,22 @@ void doseInterface::loadPreviewEgsphant() {
 	connect(profPhant, SIGNAL(madeProgress(double)),
 			parent, SLOT(updateProgress(double)));
 	
+	// Prefer the chunked copy, whose slabs are only read as they are needed
+	bool chunked = profPhant->loadChunkedSidecar(file);
+	
 	if (file.endsWith(".egsphant.gz")) {
-		profPhant->loadgzEGSPhantFilePlus(file);
+		if (!chunked)
+			profPhant->loadgzEGSPhantFilePlus(file);
 		file = file.left(file.size()-12).split("/").last();
 	}
 	else if (file.endsWith(".begsphant")) {
-		profPhant->loadbEGSPhantFilePlus(file);
+		if (!chunked)
+			profPhant->loadbEGSPhantFilePlus(file);
 		file = file.left(file.size()-10).split("/").last();
 	}
 	else if (file.endsWith(".egsphant")) {
-		profPhant->loadEGSPhantFilePlus(file);
+		if (!chunked)
+			profPhant->loadEGSPhantFilePlus(file);
 		file = file.left(file.size()-9).split("/").last();
 	}
 	else {
@@ -3243,49 +3270,13 @@ void doseInterface::showPreviewEgsphant() {
 	
 	// Draw mini-image
 	QImage* pic = new QImage(200,200,QImage::Format_ARGB32_Premultiplied);
-	if (profMediaButton->isChecked()) {
-		int cInc = 255.0/double(profPhant->media.size()+1), c;
-		double h, w;
-		char med;
-		QString indeces("123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-		for (int i = 0; i < 200; i++)
-			for (int j = 0; j < 200; j++) {
-				w = horStart+double(i)/density;
-				h = verStart+double(j)/density;
-				
-				if (!axis.compare("x axis"))
-					med = profPhant->getMedia(depth, h, w);
-				else if (!axis.compare("y axis"))
-					med = profPhant->getMedia(h, depth, w);
-				else if (!axis.compare("z axis"))
-					med = profPhant->getMedia(h, w, depth);
-				
-				c = (indeces.indexOf(med)+1)*cInc;
-
-				pic->setPixel(i, 199-j, qRgb(c, c, c));
-			}
-	}
-	else {
-		int cInc = 255.0/double(profPhant->maxDensity), c;
-		double h, w;
-		for (int i = 0; i < 200; i++)
-			for (int j = 0; j < 200; j++) {
-				w = horStart+double(i)/density;
-				h = verStart+double(j)/density;
-				
-				if (!axis.compare("x axis"))
-					c = profPhant->getDensity(depth, h, w);
-				else if (!axis.compare("y axis"))
-					c = profPhant->getDensity(h, depth, w);
-				else if (!axis.compare("z axis"))
-					c = profPhant->getDensity(h, w, depth);
-				else
-					c = 0;
-				c *= cInc;
-
-				pic->setPixel(i, 199-j, qRgb(c, c, c));
-			}
-	}
+	// Rows are drawn bottom up, so sample the vertical axis flipped
+	if (profMediaButton->isChecked())
+		*pic = profPhant->getEGSPhantPic(axis, verStart, horStart, 1.0/density, 200, 200,
+										 depth, false, 0, 0, true);
+	else
+		*pic = profPhant->getEGSPhantPic(axis, verStart, horStart, 1.0/density, 200, 200,
+										 depth, true, 0, profPhant->maxDensity, true);
 	
 	// Draw line
 	QPainter paint(pic);
@@ -192,6 +192,7 @@ public:
 	// Phantom selection
 	QLabel      *histPhantLabel;
 	EGSPhant	*histPhant;
+	EGSPhantStats *histStats;
 	QComboBox   *histPhantSelect;
 	
 	QFrame      *histPhantFrame;
@@ -202,10 +203,10 @@ public:
 	
 	QLabel      *histMaskLabel;
 	QComboBox   *histMaskSelect;
-	EGSPhant	*histMask;
+	EGSMask		*histMask;
 	
 	QStringList localNameMasks;
-	QStringList localDirMasks;
+	QString     histMaskPhant;
 	
 	QLabel      *histMediumLabel;
 	QListWidget *histMediumView;
@@ -180,6 +180,35 @@ void phantInterface::createLayout() {
 	truncEdit->setDisabled(true);
 	truncEdit->setValidator(&allowedNums);
 	
+	partialLabel = new QLabel(tr("Mask partial volumes"));
+	partialBox   = new QComboBox();
+	partialBox->addItem(tr("off (voxel centres)"));
+	partialBox->addItem("2x2");
+	partialBox->addItem("3x3");
+	partialBox->addItem("4x4");
+	ttt = tr("Structure masks can also store how much of each edge voxel a contour covers,\n"
+			 "sampling each voxel with this many rows, which DVHs and metrics then use as\n"
+			 "voxel weights.  Media are still assigned using voxel centres.");
+	partialLabel->setToolTip(ttt);
+	partialBox->setToolTip(ttt);
+	
+	resampleLabel = new QLabel(tr("Downsample voxels"));
+	resampleBox   = new QComboBox();
+	resampleBox->addItem(tr("off"));
+	resampleBox->addItem("2x2x2");
+	resampleBox->addItem("3x3x3");
+	resampleBox->addItem("4x4x4");
+	resampleBox->addItem(tr("to size (cm)"));
+	resampleEdit  = new QLineEdit("0.2");
+	ttt = tr("The virtual patient model and its masks can be made coarser by merging voxels,\n"
+			 "either a fixed number along each axis or as close as possible to a voxel size.\n"
+			 "Merged voxels take the medium with the most mass and their total mass.");
+	resampleLabel->setToolTip(ttt);
+	resampleBox->setToolTip(ttt);
+	resampleEdit->setToolTip(ttt);
+	resampleEdit->setDisabled(true);
+	resampleEdit->setValidator(&allowedNums);
+	
 	ttt = tr("The default TAS will be used to assign media everywhere in the virtual patient,\n"
              "unless otherwise specified in the contour specific TAS selection below.");
 	defaultTASLabel->setToolTip(ttt);
@@ -212,7 +241,12 @@ void phantInterface::createLayout() {
 	contourGrid->addWidget(truncBox          , 2, 0, 1, 1);
 	contourGrid->addWidget(truncLabel        , 2, 1, 1, 1);
 	contourGrid->addWidget(truncEdit         , 2, 2, 1, 1);
-	contourGrid->addWidget(contourScrollArea , 3, 0, 1, 3);
+	contourGrid->addWidget(partialLabel      , 3, 0, 1, 1);
+	contourGrid->addWidget(partialBox        , 3, 1, 1, 2);
+	contourGrid->addWidget(resampleLabel     , 4, 0, 1, 1);
+	contourGrid->addWidget(resampleBox       , 4, 1, 1, 1);
+	contourGrid->addWidget(resampleEdit      , 4, 2, 1, 1);
+	contourGrid->addWidget(contourScrollArea , 5, 0, 1, 3);
 	
 	for (int i = 0; i < STRUCT_COUNT; i++) {
 		contourTASMask.append(new QCheckBox());
@@ -381,6 +415,8 @@ void phantInterface::connectLayout() {
 			
 	connect(truncBox, SIGNAL(stateChanged(int)),
 			this, SLOT(refresh()));
+	connect(resampleBox, SIGNAL(currentIndexChanged(int)),
+			this, SLOT(refresh()));
 			
 	connect(ctImportFiles, SIGNAL(released()),
 			this, SLOT(loadCTFiles()));
@@ -443,6 +479,13 @@ void phantInterface::createEGSphant() {
 		return;		
 	}
 	
+	// Check the voxel size to downsample to
+	if (resampleBox->currentIndex() == 4 && resampleEdit->text().toDouble() <= 0) {
+		QMessageBox::warning(0, "Creating egsphant error",
+		tr("The voxel size to downsample to must be greater than 0. Aborting."));
+		return;
+	}
+	
 	QString fileName = phantNameEdit->text().trimmed().replace(" ", "_");
 	QList <QListWidgetItem*> matchingNames = parent->phantomListView->findItems(fileName+".egsphant.gz",Qt::MatchExactly);
 	
@@ -454,6 +497,8 @@ void phantInterface::createEGSphant() {
 			
 			// Delete all associated files
 			QFile(parent->data->localDirPhants[i]+fileName+".egsphant.gz").remove();
+			QFile(parent->data->localDirPhants[i]+fileName+".egschunk").remove();
+			QFile(parent->data->localDirPhants[i]+fileName+".egsstats").remove();
 			QFile(parent->data->localDirPhants[i]+fileName+".log").remove();
 			QFile(parent->data->localDirPhants[i]+fileName+".tg43.geom").remove();
 			
@@ -462,6 +507,7 @@ void phantInterface::createEGSphant() {
 			parent->data->localDirPhants.removeAt(i);
 			
 			// Delete all the masks
+			QFile(parent->data->gui_location+"/database/mask/"+fileName+".egsmask.gz").remove();
 			QDirIterator files (parent->data->gui_location+"/database/mask/", {QString(fileName)+".*.egsphant.gz"},
 								QDir::NoFilter, QDirIterator::Subdirectories);
 			
@@ -495,6 +541,9 @@ void phantInterface::createEGSphant() {
 		}
 	}
 	
+	// Pass the partial volume sampling to data, the index is the sub-rows less one
+	parent->data->partialSamples = partialBox->currentIndex()+1;
+	
 	// Set the default tas
 	int defaultTAS = -1;
 	for (int i = 0; i < parent->data->TAS_names.size(); i++) {
@@ -509,7 +558,7 @@ void phantInterface::createEGSphant() {
 	
 	// Set the contour specific arrays
 	QVector <int> structIndex(prioView->count()), tasIndex(prioView->count());
-	QVector <EGSPhant*> makeMasks;
+	EGSMask masks;
 	parent->data->marContourInd = -1;
 	
 	for (int j = 0; j < prioView->count(); j++) {
@@ -535,13 +584,44 @@ void phantInterface::createEGSphant() {
 	QString textLog;
 	int err;
 	
+	// Unless it is downsampled afterwards, the egsphant is written out while it is built
+	QString phantPath = parent->data->gui_location+"/database/egsphant/"+fileName+".egsphant.gz";
+	EGSPhantWriter writer(phantPath);
+	EGSPhantWriter* streamTo = resampleBox->currentIndex() > 0 ? 0 : &writer;
+	
+	setEnabled(false); // The build keeps the GUI responsive, so don't allow another one to start
 	if (truncBox->isChecked()) {
 		err = parent->data->buildEgsphant(&phantom, &textLog, structIndex.size(), defaultTAS,
-										  &structIndex, &tasIndex, &makeMasks, truncEdit->text().toDouble());
+										  &structIndex, &tasIndex, &masks, truncEdit->text().toDouble(), streamTo);
 	}
 	else {
 		err = parent->data->buildEgsphant(&phantom, &textLog, structIndex.size(), defaultTAS,
-										  &structIndex, &tasIndex, &makeMasks);
+										  &structIndex, &tasIndex, &masks, -1, streamTo);
+	}
+	setEnabled(true);
+	if (err) // Don't keep what was built so far
+		parent->data->clearBuildCache();
+	
+	if (err == 0 && resampleBox->currentIndex() > 0) {
+		// Merge the voxels of the phantom and its masks the same way
+		// Either a number of voxels to merge or a voxel size, never both
+		int factor = 1;
+		double size = 0;
+		if (resampleBox->currentIndex() == 4)
+			size = resampleEdit->text().toDouble();
+		else
+			factor = resampleBox->currentIndex()+1;
+		QVector <int> ix = EGSPhant::mergedBounds(phantom.x, factor, size);
+		QVector <int> iy = EGSPhant::mergedBounds(phantom.y, factor, size);
+		QVector <int> iz = EGSPhant::mergedBounds(phantom.z, factor, size);
+		
+		parent->nameProgress("Downsampling");
+		phantom.resample(ix, iy, iz);
+		if (masks.resample(ix, iy, iz))
+			err = 210;
+		
+		textLog += "Downsampled to " + QString::number(phantom.nx) + "x" + QString::number(phantom.ny) + "x" +
+				   QString::number(phantom.nz) + " voxels\n";
 	}
 	
 	if (err == 0) {
@@ -550,17 +630,31 @@ void phantInterface::createEGSphant() {
 		connect(&phantom, SIGNAL(madeProgress(double)),
 				parent, SLOT(updateProgress(double)));
 		
-		// Output egsphant file
-		phantom.savegzEGSPhantFilePlus(parent->data->gui_location+"/database/egsphant/"+fileName+".egsphant.gz");
+		// Output egsphant file, if it was not already written during the build
+		if (!streamTo || writer.finish())
+			phantom.savegzEGSPhantFilePlus(phantPath);
+		
+		// Output the chunked copy used for quick viewing and analysis in the GUI
+		phantom.saveChunkedEGSPhantFile(parent->data->gui_location+"/database/egsphant/"+fileName+".egschunk");
+		
+		// Output the media composition summary
+		EGSPhantStats stats;
+		if (!stats.compute(&phantom))
+			stats.saveStatsFile(parent->data->gui_location+"/database/egsphant/"+fileName+".egsstats");
+		
 		parent->data->localNamePhants << fileName+".egsphant.gz";
 		parent->data->localDirPhants << parent->data->gui_location+"/database/egsphant/";
 		parent->phantomRepopulate();
 		
-		// Output and delete masks
-		for (int i = 0; i < structIndex.size(); i++) {
+		// Output the checked masks as a single structure label volume
+		QVector <int> keepStructs;
+		for (int i = 0; i < structIndex.size(); i++)
 			if (contourTASMask[i]->isChecked())
-				makeMasks[i]->savegzEGSPhantFile(parent->data->gui_location+"/database/mask/"+fileName+"."+contourTASLabel[i]->text()+".mask.egsphant.gz");
-			delete makeMasks[i];
+				keepStructs << i;
+		
+		if (keepStructs.size()) {
+			masks.keepStructs(keepStructs);
+			masks.saveEGSMaskFile(parent->data->gui_location+"/database/mask/"+fileName+".egsmask.gz");
 		}
 		
 		// Output log file
@@ -602,6 +696,15 @@ void phantInterface::createEGSphant() {
 	else if (err == 208)
 		QMessageBox::warning(0, "DICOM error",
         tr("Could not find field ") + "HU values (7fe0,0010)" + tr (" in CT DICOM file.  Aborting"));
+	else if (err == 209)
+		QMessageBox::warning(0, "DICOM error",
+        tr("CT slices do not all have the same number of rows and columns.  Aborting"));
+	else if (err == 210)
+		QMessageBox::warning(0, "Structure error",
+        tr("The contours overlap in more than 65535 different combinations, which the masks cannot label.  Aborting"));
+	else if (err == 300)
+		QMessageBox::information(0, "Creating VPM cancelled",
+        tr("The egsphant build was cancelled, nothing was saved."));
 		
 	parent->finishedProgress();
 }
@@ -614,47 +717,15 @@ void phantInterface::loadCTFiles() {
 	if (paths.isEmpty()) // If you didn't get any files, quit
 		return;
 	
-	double increment = 100.0/paths.size();
     parent->resetProgress("Loading DICOM files");
 	
-	for (int i = 0; i < paths.size(); i++) {
-		parent->data->CT_data.append(new DICOM(&parent->data->tag_data));
-		
-		// Check if it is a proper CT DICOM file
-		if (parent->data->CT_data.last()->parse(paths[i])) {
-			failedFiles.append(paths[i].split("/").last() + tr(" is not DICOM format"));
-			delete parent->data->CT_data.last();
-			parent->data->CT_data.removeLast();
-		}
-		else {
-			Attribute* tempAtt;
-			
-			tempAtt = parent->data->CT_data.last()->getEntry(0x0008, 0x0060); // Get att closest to (0008,0060)
-			if (tempAtt->tag[0] != 0x0008 && tempAtt->tag[1] != 0x0060) { // See if it is (0008,0060)
-				failedFiles.append(paths[i].split("/").last() + tr(" did not have DICOM modality field (0008,0060)"));
-				delete parent->data->CT_data.last();
-				parent->data->CT_data.removeLast();
-			}
-			else {
-				QString temp = "";
-				for (unsigned int s = 0; s < tempAtt->vl; s++) {
-					temp.append(tempAtt->vf[s]);
-				}
-				
-				if (temp.trimmed().compare("CT")) { // See if the field contains CT
-					failedFiles.append(paths[i].split("/").last() + tr(" is not CT modality"));
-					delete parent->data->CT_data.last();
-					parent->data->CT_data.removeLast();
-				}
-			}
-		}
-		parent->updateProgress(increment);
-	}
+	loadCTSeries(paths, &failedFiles, 100.0);
 	
 	// Get patient name for the egsphant label
 	Attribute* tempAtt;
-	tempAtt = parent->data->CT_data.first()->getEntry(0x0010, 0x0010); // Get att closest to (0010,0010)
-	if (tempAtt->tag[0] == 0x0010 && tempAtt->tag[1] == 0x0010) {
+	if (parent->data->CT_data.size())
+		tempAtt = parent->data->CT_data.first()->getEntry(0x0010, 0x0010); // Get att closest to (0010,0010)
+	if (parent->data->CT_data.size() && tempAtt->tag[0] == 0x0010 && tempAtt->tag[1] == 0x0010) {
 		QString temp = "";
 		for (unsigned int s = 0; s < tempAtt->vl; s++) {
 			temp.append(tempAtt->vf[s]);
@@ -689,59 +760,117 @@ void phantInterface::loadCTDir() { // Very similar to CT files with an extra ste
 	QStringList paths;
 	QStringList failedFiles;
 	
-	double increment = 60.0/paths.size();
+	if (path.isEmpty()) // If you didn't get a directory, quit
+		return;
+	
     parent->resetProgress("Loading DICOM files");
 	
-	// Get all files in subdirectories
-	QDirIterator dirIt (path, QDirIterator::Subdirectories);
+	// Get all files in subdirectories, and check them against what was found the
+	// last time this directory was opened
+	DICOMIndex index;
+	QString indexFile = DICOMIndex::indexPath(parent->data->gui_location, path);
+	if (index.loadIndex(indexFile) || QDir(index.dir) != QDir(path))
+		index.files.clear();
+	index.dir = path;
+	
+	QStringList stale;
+	QDirIterator dirIt (path, QDir::Files, QDirIterator::Subdirectories);
 	while (dirIt.hasNext()) {
-		paths.append(dirIt.next());
-		if (paths.last().split("/").last().compare(".") == 0 ||
-			paths.last().split("/").last().compare("..") == 0)
-			paths.removeLast();
+		paths.append(QFileInfo(dirIt.next()).absoluteFilePath());
+		if (!index.isCurrent(paths.last(), dirIt.fileInfo()))
+			stale.append(paths.last());
 	}
 	
-	if (paths.isEmpty()) // If you didn't get any files, quit
+	if (paths.isEmpty()) { // If you didn't get any files, quit
+		parent->finishedProgress();
 		return;
-
+	}
+	
+	// Forget about files that are gone
+	QSet <QString> present;
+	for (int i = 0; i < paths.size(); i++)
+		present.insert(paths[i]);
+	QMap <QString, DICOMIndexEntry>::iterator it = index.files.begin();
+	while (it != index.files.end()) {
+		if (present.contains(it.key()))
+			++it;
+		else
+			it = index.files.erase(it);
+	}
+	
+	// Parse only the new or changed files, keeping the CT slices around in case
+	// they are part of the series that gets picked
+	QMap <QString, DICOM*> parsed;
+	QVector <CTSlice> slices = scanCTFiles(stale, 60.0*stale.size()/paths.size());
+	for (int i = 0; i < slices.size(); i++) {
+		index.files[stale[i]] = slices[i].entry;
+		if (slices[i].dicom)
+			parsed[stale[i]] = slices[i].dicom;
+	}
+	index.saveIndex(indexFile);
+	
+	// Group the CT files by series, and let the user pick one if there are several
+	QMap <QString, QStringList> series;
 	for (int i = 0; i < paths.size(); i++) {
-		parent->data->CT_data.append(new DICOM(&parent->data->tag_data));
+		const DICOMIndexEntry &entry = index.files[paths[i]];
+		if (entry.error.size())
+			failedFiles.append(paths[i].split("/").last() + entry.error);
+		else
+			series[entry.seriesUID].append(paths[i]);
+	}
+	
+	QString picked = series.size() ? series.firstKey() : "";
+	if (series.size() > 1) {
+		QStringList choices;
+		for (QMap <QString, QStringList>::const_iterator it = series.constBegin(); it != series.constEnd(); ++it)
+			choices << it.key() + " (" + QString::number(it.value().size()) + " slices)";
 		
-		// Check if it is a proper CT DICOM file
-		if (parent->data->CT_data.last()->parse(paths[i])) {
-			failedFiles.append(paths[i].split("/").last() + tr(" is not DICOM format"));
-			delete parent->data->CT_data.last();
-			parent->data->CT_data.removeLast();
-		}
-		else {
-			Attribute* tempAtt;
-			
-			tempAtt = parent->data->CT_data.last()->getEntry(0x0008, 0x0060); // Get att closest to (0008,0060)
-			if (tempAtt->tag[0] != 0x0008 && tempAtt->tag[1] != 0x0060) { // See if it is (0008,0060)
-				failedFiles.append(paths[i].split("/").last() + tr(" did not have DICOM modality field (0008,0060)"));
-				delete parent->data->CT_data.last();
-				parent->data->CT_data.removeLast();
-			}
-			else {
-				QString temp = "";
-				for (unsigned int s = 0; s < tempAtt->vl; s++) {
-					temp.append(tempAtt->vf[s]);
-				}
-				
-				if (temp.trimmed().compare("CT")) { // See if the field contains CT
-					failedFiles.append(paths[i].split("/").last() + tr(" is not CT modality"));
-					delete parent->data->CT_data.last();
-					parent->data->CT_data.removeLast();
-				}
-			}
+		bool ok;
+		QString choice = QInputDialog::getItem(this, tr("DICOM CT series"),
+			tr("The directory contains more than one CT series, select the one to load:"),
+			choices, 0, false, &ok);
+		if (!ok) {
+			for (QMap <QString, DICOM*>::iterator it = parsed.begin(); it != parsed.end(); ++it)
+				delete it.value();
+			parent->finishedProgress();
+			return;
 		}
-		parent->updateProgress(increment);
+		picked = series.keys()[choices.indexOf(choice)];
 	}
 	
+	// Order the picked series by the indexed z, so it doesn't need sorting again
+	// once it is parsed
+	std::stable_sort(series[picked].begin(), series[picked].end(), [&](const QString &a, const QString &b) {
+		return index.files[a].z < index.files[b].z;
+	});
+	
+	// Parse the rest of the picked series, which the index says are CT slices
+	QStringList cached;
+	for (int i = 0; i < series[picked].size(); i++)
+		if (!parsed.contains(series[picked][i]))
+			cached.append(series[picked][i]);
+	slices = scanCTFiles(cached, 60.0*(paths.size()-stale.size())/paths.size());
+	for (int i = 0; i < slices.size(); i++) {
+		if (slices[i].dicom)
+			parsed[cached[i]] = slices[i].dicom;
+		else
+			failedFiles.append(slices[i].error);
+	}
+	
+	// Keep the picked series, in z order
+	parent->data->clearBuildCache();
+	bool merge = parent->data->CT_data.size(); // With slices loaded before
+	for (int i = 0; i < series[picked].size(); i++)
+		if (parsed.contains(series[picked][i]))
+			parent->data->CT_data.append(parsed.take(series[picked][i]));
+	for (QMap <QString, DICOM*>::iterator it = parsed.begin(); it != parsed.end(); ++it)
+		delete it.value();
+	
 	// Get patient name for the egsphant label
 	Attribute* tempAtt;
-	tempAtt = parent->data->CT_data.first()->getEntry(0x0010, 0x0010); // Get att closest to (0010,0010)
-	if (tempAtt->tag[0] == 0x0010 && tempAtt->tag[1] == 0x0010 && tempAtt->vl) {
+	if (parent->data->CT_data.size())
+		tempAtt = parent->data->CT_data.first()->getEntry(0x0010, 0x0010); // Get att closest to (0010,0010)
+	if (parent->data->CT_data.size() && tempAtt->tag[0] == 0x0010 && tempAtt->tag[1] == 0x0010 && tempAtt->vl) {
 		QString temp = "";
 		for (unsigned int s = 0; s < tempAtt->vl; s++) {
 			temp.append(tempAtt->vf[s]);
@@ -753,8 +882,9 @@ void phantInterface::loadCTDir() { // Very similar to CT files with an extra ste
 		phantNameEdit->setText("DICOM_VPM");
 	}
 	
-	// Sort all CT slices by z height
-	mergeSort(parent->data->CT_data,parent->data->CT_data.size());
+	// Sort all CT slices by z height, if there are others to fit it in with
+	if (merge)
+		mergeSort(parent->data->CT_data,parent->data->CT_data.size());
 	parent->updateProgress(40);
 	
 	parent->finishedProgress();
@@ -772,6 +902,110 @@ void phantInterface::loadCTDir() { // Very similar to CT files with an extra ste
 	repopulateCT();
 }
 
+// Parses and checks one CT file, this runs on the thread pool
+struct CTParser {
+	typedef CTSlice result_type;
+	
+	database *lib;
+	QThread *gui; // Accepted slices are handed over to the GUI thread
+	
+	CTSlice operator()(const QString &path) const {
+		CTSlice slice;
+		slice.dicom = new DICOM(lib);
+		
+		// Check if it is a proper CT DICOM file, the pixels are only read in
+		// when the phantom gets built
+		bool parsed = false;
+		if (slice.dicom->parse(path, true)) {
+			slice.error = phantInterface::tr(" is not DICOM format");
+		}
+		else {
+			Attribute* tempAtt;
+			parsed = true;
+			
+			tempAtt = slice.dicom->getEntry(0x0008, 0x0060); // Get att closest to (0008,0060)
+			if (tempAtt->tag[0] != 0x0008 && tempAtt->tag[1] != 0x0060) { // See if it is (0008,0060)
+				slice.error = phantInterface::tr(" did not have DICOM modality field (0008,0060)");
+			}
+			else {
+				QString temp = "";
+				for (unsigned int s = 0; s < tempAtt->vl; s++) {
+					temp.append(tempAtt->vf[s]);
+				}
+				
+				if (temp.trimmed().compare("CT")) { // See if the field contains CT
+					slice.error = phantInterface::tr(" is not CT modality");
+				}
+			}
+		}
+		
+		// Remember what was found for the directory index, which stores the
+		// reason without the file name
+		slice.entry = DICOMIndex::makeEntry(path, parsed ? slice.dicom : NULL, slice.error);
+		if (slice.error.size())
+			slice.error = path.split("/").last() + slice.error;
+		
+		if (slice.error.size()) {
+			delete slice.dicom;
+			slice.dicom = NULL;
+		}
+		else {
+			slice.dicom->moveToThread(gui);
+		}
+		
+		return slice;
+	}
+};
+
+QVector <CTSlice> phantInterface::scanCTFiles(QStringList paths, double percent) {
+	QVector <CTSlice> slices;
+	if (paths.isEmpty()) {
+		parent->updateProgress(percent);
+		return slices;
+	}
+	
+	CTParser parser;
+	parser.lib = &parent->data->tag_data;
+	parser.gui = thread();
+	
+	// Parse the files on the thread pool, which bounds how many are in flight at
+	// once, while a local event loop keeps the GUI responsive
+	QFutureWatcher <CTSlice> watcher;
+	QEventLoop loop;
+	double increment = percent/paths.size();
+	int done = 0;
+	
+	connect(&watcher, &QFutureWatcherBase::progressValueChanged, this, [&](int n) {
+		parent->updateProgress(increment*(n-done));
+		done = n;
+	});
+	connect(&watcher, &QFutureWatcherBase::finished, &loop, &QEventLoop::quit);
+	
+	setEnabled(false); // Don't allow another load to start in the meantime
+	watcher.setFuture(QtConcurrent::mapped(paths, parser));
+	if (!watcher.isFinished())
+		loop.exec();
+	setEnabled(true);
+	
+	// Results are in path order no matter which thread finished first
+	for (int i = 0; i < paths.size(); i++)
+		slices.append(watcher.resultAt(i));
+	return slices;
+}
+
+void phantInterface::loadCTSeries(QStringList paths, QStringList *failedFiles, double percent) {
+	QVector <CTSlice> slices = scanCTFiles(paths, percent);
+	parent->data->clearBuildCache();
+	
+	// Keeping path order here makes the (stable) sort by z afterwards deterministic
+	for (int i = 0; i < slices.size(); i++) {
+		if (slices[i].dicom)
+			parent->data->CT_data.append(slices[i].dicom);
+		else
+			failedFiles->append(slices[i].error);
+	}
+}
+
 // Basically resets what the console shows to match what data has stored in memory
 // As long as mergeSort is called whenever new data is added, and the user isn't
 // allowed to move files around, it should always be sorted in ascending z order
@@ -795,6 +1029,7 @@ void phantInterface::deleteCT() {
 		delete parent->data->CT_data[ind[i]];
 		parent->data->CT_data.remove(ind[i]);
 	}
+	parent->data->clearBuildCache();
 	
 	// Repopulate CT list
 	repopulateCT();
@@ -805,6 +1040,7 @@ void phantInterface::deleteAllCT() {
 		delete parent->data->CT_data[i];
 		parent->data->CT_data.remove(i);
 	}
+	parent->data->clearBuildCache();
 	
 	// Repopulate CT list
 	repopulateCT();
@@ -821,6 +1057,7 @@ void phantInterface::loadStruct() {
 		parent->data->struct_loaded = false;
 		delete structFile;
 	}
+	parent->data->clearBuildCache();
 	
 	structFile = new DICOM(&parent->data->tag_data);
 	
@@ -860,19 +1097,15 @@ void phantInterface::loadStruct() {
 	QVector <double> structZTemp;
 	int structReferenceTemp;
 	
-	// Temp arrays needed for parsing
-	QVector <Attribute*> *att, *att2;
-	QByteArray tempData, tempData2;
-	QStringList pointData;
+	// Temp arrays needed for parsing, the sequence items are already parsed by DICOM::parse
+	QVector <Attribute*> *att, contours;
+	QVector <double> pointData; // Reused for every contour
 	
 	// Get structure names
 	tempAtt = structFile->getEntry(0x3006, 0x0020);
 	for (int k = 0; k < tempAtt->seq.items.size(); k++) {
-		tempData = QByteArray((char*)tempAtt->seq.items[k]->vf,tempAtt->seq.items[k]->vl);
-		QDataStream dataStream(tempData);
-		
-		att = new QVector <Attribute*>;
-		if (!structFile->parseSequence(&dataStream, att)) {
+		att = &tempAtt->seq.items[k]->att;
+		if (att->isEmpty()) {
 			QMessageBox::warning(0, "DICOM error",
 			tr("Failed to parse field in \"Structure Set ROI Sequence\" in DICOM file."));
 			delete structFile;
@@ -902,65 +1135,40 @@ void phantInterface::loadStruct() {
 		globalStructName.append(tempS.trimmed());
 		globalStructReference.append(tempI.toInt());
 		globalStructLookup[tempI.toInt()] = globalStructName.size()-1;
-		
-		for (int l = 0; l < att->size(); l++)
-			delete att->at(l);
-		delete att;
 	}
 	
 	// Get structure data
 	tempAtt = structFile->getEntry(0x3006, 0x0039);
 		
 	for (int k = 0; k < tempAtt->seq.items.size(); k++) {
-		tempData = QByteArray((char*)tempAtt->seq.items[k]->vf,tempAtt->seq.items[k]->vl);
-		QDataStream dataStream(tempData);
-		
-		att = new QVector <Attribute*>;
-		if (!structFile->parseSequence(&dataStream, att)) {
+		att = &tempAtt->seq.items[k]->att;
+		if (att->isEmpty()) {
 			QMessageBox::warning(0, "DICOM error",
 			tr("Failed to parse field in \"ROI Contour Sequence\" in DICOM file."));
 			delete structFile;
 			return;
 		}
 		
-		QString tempS = ""; // Get the contour, it's another nested sequence, so we must go deeper with parseSequence
 		structPosTemp.clear();
 		structZTemp.clear();
 		structReferenceTemp = -1;
 		
+		// Get the contours, Contour Sequence -> Contour Data within this ROI
+		contours = tempAtt->seq.items[k]->getPath("3006,0040/3006,0050");
+		for (int c = 0; c < contours.size(); c++) {
+			int count = contours[c]->readDS(&pointData); // Get the points
+			if (count < 3)
+				continue;
+			
+			structPosTemp.resize(structPosTemp.size()+1);
+			structPosTemp.last().reserve(count/3);
+			structZTemp.append(pointData[2]/10.0);
+			for (int m = 0; m+2 < count; m+=3)
+				structPosTemp.last() << QPointF(pointData[m]/10.0, pointData[m+1]/10.0);
+		}
+		
 		for (int l = 0; l < att->size(); l++) {
-			if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0040)
-			{
-				for (int k = 0; k < att->at(l)->seq.items.size(); k++) {
-					structPosTemp.resize(structPosTemp.size()+1);
-					tempData2 = QByteArray((char*)att->at(l)->seq.items[k]->vf,att->at(l)->seq.items[k]->vl);
-					QDataStream dataStream2(tempData2);
-					
-					att2 = new QVector <Attribute*>;
-					if (!structFile->parseSequence(&dataStream2, att2)) {
-						QMessageBox::warning(0, "DICOM error",
-						tr("Failed to parse field in \"Contour Sequence\" in DICOM file."));
-						delete structFile;
-						return;
-					}
-					
-					QString tempS = ""; // Get the points
-					for (int m = 0; m < att2->size(); m++)
-						if (att2->at(m)->tag[0] == 0x3006 && att2->at(m)->tag[1] == 0x0050)
-							for (unsigned int s = 0; s < att2->at(m)->vl; s++)
-								tempS.append(att2->at(m)->vf[s]);
-					
-					pointData = tempS.split('\\');
-					structZTemp.append(pointData[2].toDouble()/10.0);
-					for (int m = 0; m < pointData.size(); m+=3)
-						structPosTemp.last() << QPointF(pointData[m].toDouble()/10.0, pointData[m+1].toDouble()/10.0);
-					
-					for (int m = 0; m < att2->size(); m++)
-						delete att2->at(m);
-					delete att2;
-				}
-			}
-			else if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0084) {
+			if (att->at(l)->tag[0] == 0x3006 && att->at(l)->tag[1] == 0x0084) {
 				QString tempI = ""; // Get the number
 				for (unsigned int s = 0; s < att->at(l)->vl; s++)
 					tempI.append(att->at(l)->vf[s]);
@@ -973,10 +1181,6 @@ void phantInterface::loadStruct() {
 			structZ.append(structZTemp);
 			structPos.append(structPosTemp);
 		}
-							
-		for (int l = 0; l < att->size(); l++)
-			delete att->at(l);
-		delete att;
 	}
 	
 	// Build a local struct name array using local indices (instead of global indices
@@ -1081,6 +1285,8 @@ void phantInterface::refresh() {
 		truncEdit->setDisabled(true);
 	}
 	
+	resampleEdit->setDisabled(resampleBox->currentIndex() != 4); // Only for a voxel size
+	
 	if (marEnable->isChecked()) {
 		marLTLabel->setDisabled(false);
 		marTransLabel->setDisabled(false);
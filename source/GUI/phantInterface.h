@@ -40,6 +40,7 @@
 #define PHANTINTERFACE_H
 
 #include <QtGui>
+#include <QtConcurrent>
 #include <iostream>
 #include "../interface.h"
 
@@ -47,6 +48,13 @@
 class Interface;
 class logWindow;
 
+// Result of parsing one file of a CT series, dicom is NULL if the file was rejected
+struct CTSlice {
+	DICOM *dicom;
+	QString error;
+	DICOMIndexEntry entry; // What the directory index keeps about the file
+};
+
 // Declaration of the Main Window class, its variables and its methods
 class phantInterface : public QWidget {
 private:
@@ -100,6 +108,13 @@ public:
 	QLabel*              truncLabel;
 	QLineEdit*           truncEdit;
 	
+	QLabel*              partialLabel;
+	QComboBox*           partialBox;
+	
+	QLabel*              resampleLabel;
+	QComboBox*           resampleBox;
+	QLineEdit*           resampleEdit;
+	
 	QLabel*              contourTASMaskLabel;
 	QLabel*              contourTASLabelLabel;
 	QLabel*              contourTASBoxLabel;
@@ -164,6 +179,8 @@ public slots:
 	
 	void loadCTFiles(); // Load CT files into memory
 	void loadCTDir(); // Load CT file directory into memory
+	void loadCTSeries(QStringList paths, QStringList *failedFiles, double percent); // Parse CT files in parallel
+	QVector <CTSlice> scanCTFiles(QStringList paths, double percent);
 	void repopulateCT(); // Refill the CT item table
 	void deleteCT(); // Remove CT files from memory
 	void deleteAllCT(); // Remove all CT file from memory
@@ -326,6 +326,7 @@ void sourceInterface::parsePlan() {
 				out << QString(":stop transformation:\n");
 			}
 			transFile.close();
+			parent->data->seedTransform = fileName; // MAR can use seedPos directly for it
 		}
 		
 		parent->data->localNameTransforms << fileName;
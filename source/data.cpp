@@ -43,6 +43,276 @@
 #define ASSUME_PERMANENT_LDR // Used when there is no specification
 #define INTERPOLATE_CONTOURS // Used to create a new contour on slices between two contours from the same structure
 
+#if defined(__SSE2__)
+	#include <immintrin.h>
+#endif
+
+// Convert a slice of 16 bit pixels to (rescaled) HU, saturating to the range of a
+// short, with AVX2 or SSE2 when the compiler targets them and a scalar loop for
+// whatever is left; the rescale is done in double, clamped and then truncated
+static void pixelsToHU(const unsigned char *src, int count, bool bigEndian, bool isSigned,
+					   double m, double b, short int *dst) {
+	int p = 0;
+	
+#if defined(__AVX2__)
+	const __m256d vm = _mm256_set1_pd(m), vb = _mm256_set1_pd(b);
+	const __m256d vmin = _mm256_set1_pd(-32768), vmax = _mm256_set1_pd(32767);
+	for (; p+8 <= count; p += 8) {
+		__m128i raw = _mm_loadu_si128((const __m128i*)(src+2*p));
+		if (bigEndian)
+			raw = _mm_or_si128(_mm_slli_epi16(raw, 8), _mm_srli_epi16(raw, 8));
+		__m256i wide = isSigned ? _mm256_cvtepi16_epi32(raw) : _mm256_cvtepu16_epi32(raw);
+		
+		// Clamped before converting, as the conversion overflows to -32768 either way
+		__m128i lo = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(_mm256_add_pd(_mm256_mul_pd(
+					 _mm256_cvtepi32_pd(_mm256_castsi256_si128(wide)), vm), vb), vmin), vmax));
+		__m128i hi = _mm256_cvttpd_epi32(_mm256_min_pd(_mm256_max_pd(_mm256_add_pd(_mm256_mul_pd(
+					 _mm256_cvtepi32_pd(_mm256_extracti128_si256(wide, 1)), vm), vb), vmin), vmax));
+		_mm_storeu_si128((__m128i*)(dst+p), _mm_packs_epi32(lo, hi));
+	}
+#elif defined(__SSE2__)
+	const __m128d vm = _mm_set1_pd(m), vb = _mm_set1_pd(b);
+	const __m128d vmin = _mm_set1_pd(-32768), vmax = _mm_set1_pd(32767);
+	const __m128i zero = _mm_setzero_si128();
+	for (; p+8 <= count; p += 8) {
+		__m128i raw = _mm_loadu_si128((const __m128i*)(src+2*p));
+		if (bigEndian)
+			raw = _mm_or_si128(_mm_slli_epi16(raw, 8), _mm_srli_epi16(raw, 8));
+		__m128i wide[2];
+		wide[0] = isSigned ? _mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16) : _mm_unpacklo_epi16(raw, zero);
+		wide[1] = isSigned ? _mm_srai_epi32(_mm_unpackhi_epi16(raw, raw), 16) : _mm_unpackhi_epi16(raw, zero);
+		
+		// Two doubles at a time, clamped before converting as the conversion overflows to -32768 either way
+		__m128i out[2];
+		for (int h = 0; h < 2; h++) {
+			__m128i a = _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(_mm_add_pd(_mm_mul_pd(
+						_mm_cvtepi32_pd(wide[h]), vm), vb), vmin), vmax));
+			__m128i c = _mm_cvttpd_epi32(_mm_min_pd(_mm_max_pd(_mm_add_pd(_mm_mul_pd(
+						_mm_cvtepi32_pd(_mm_srli_si128(wide[h], 8)), vm), vb), vmin), vmax));
+			out[h] = _mm_unpacklo_epi64(a, c);
+		}
+		_mm_storeu_si128((__m128i*)(dst+p), _mm_packs_epi32(out[0], out[1]));
+	}
+#endif
+	
+	for (; p < count; p++) {
+		unsigned short int raw = bigEndian ? (src[2*p] << 8) | src[2*p+1] : src[2*p] | (src[2*p+1] << 8);
+		double v = (isSigned ? (short int)raw : raw)*m+b;
+		dst[p] = v <= -32768 ? -32768 : v >= 32767 ? 32767 : (short int)v;
+	}
+}
+
+// One contour edge that is not horizontal, oriented so that y1 < y2
+struct ScanEdge {
+	double x1, y1, x2, y2;
+};
+
+// Sorted edge table of a contour for even-odd scanline filling.  Edges are kept,
+// oriented and intersected exactly like QPolygonF::containsPoint does with
+// Qt::OddEvenFill, so a point of the scanline is inside the contour when an odd
+// number of its crossings are at or left of it
+class ScanPolygon {
+public:
+	QVector <ScanEdge> edges; // Sorted by y1
+	QVector <int> active; // Edges that may cross the current scanline
+	int next; // First edge of the table that is not active yet
+	double lastY;
+	
+	ScanPolygon() : next(0), lastY(0) {}
+	ScanPolygon(const QPolygonF &poly) : next(0), lastY(0) {
+		if (poly.isEmpty())
+			return;
+		
+		for (int i = 1; i < poly.size(); i++)
+			addEdge(poly[i-1], poly[i]);
+		if (poly.last() != poly.first()) // Implicitly closed
+			addEdge(poly.last(), poly.first());
+		
+		std::sort(edges.begin(), edges.end(), [](const ScanEdge &a, const ScanEdge &b) {
+			return a.y1 < b.y1;
+		});
+	}
+	
+	void addEdge(const QPointF &a, const QPointF &b) {
+		if (qFuzzyCompare(a.y(), b.y())) // Horizontal edges are skipped by the scan conversion rule
+			return;
+		if (b.y() < a.y())
+			edges.append({b.x(), b.y(), a.x(), a.y()});
+		else
+			edges.append({a.x(), a.y(), b.x(), b.y()});
+	}
+	
+	// Sorted x crossings of scanline y, cheapest when called with increasing y
+	void crossings(double y, QVector <double> *x) {
+		if (y < lastY) { // Start over
+			active.clear();
+			next = 0;
+		}
+		lastY = y;
+		
+		while (next < edges.size() && edges[next].y1 <= y)
+			active.append(next++);
+		
+		x->clear();
+		for (int a = 0; a < active.size();) {
+			const ScanEdge &e = edges[active[a]];
+			if (e.y2 <= y) { // Done with this edge
+				active[a] = active.last();
+				active.removeLast();
+				continue;
+			}
+			x->append(e.x1 + ((e.x2 - e.x1) / (e.y2 - e.y1)) * (y - e.y1));
+			a++;
+		}
+		std::sort(x->begin(), x->end());
+	}
+};
+
+// Turn the sorted crossings of a scanline into [start,end) spans of the voxels whose
+// centres xMid are inside, also keeping only the centres within [left,right]
+static void scanSpans(const QVector <double> &x, const QVector <double> &xMid, double left, double right,
+					  QVector <int> *spans) {
+	spans->clear();
+	int last = std::upper_bound(xMid.begin(), xMid.end(), right)-xMid.begin();
+	for (int c = 0; c < x.size(); c += 2) {
+		int start = std::lower_bound(xMid.begin(), xMid.end(), qMax(x[c], left))-xMid.begin();
+		int end = c+1 < x.size() ? std::lower_bound(xMid.begin(), xMid.end(), x[c+1])-xMid.begin() : xMid.size();
+		end = qMin(end, last);
+		if (start < end)
+			*spans << start << end;
+	}
+}
+
+// Add the part of [a,b] over each voxel of boundaries x to cover, in voxel widths
+// times weight, with the voxels fully covered added as a run (difference) to run
+// instead, and widen [lo,hi) to the voxels touched
+static void coverSpan(double a, double b, const QVector <double> &x, float weight,
+					  float *cover, float *run, int *lo, int *hi) {
+	int n = x.size()-1;
+	a = qMax(a, x[0]);
+	b = qMin(b, x[n]);
+	if (b <= a)
+		return;
+	
+	int ia = qMin(int(std::upper_bound(x.begin(), x.end(), a)-x.begin())-1, n-1);
+	int ib = qMin(int(std::upper_bound(x.begin(), x.end(), b)-x.begin())-1, n-1);
+	if (ia == ib) {
+		cover[ia] += weight*(b-a)/(x[ia+1]-x[ia]);
+	}
+	else {
+		cover[ia] += weight*(x[ia+1]-a)/(x[ia+1]-x[ia]);
+		cover[ib] += weight*(b-x[ib])/(x[ib+1]-x[ib]);
+		run[ia+1] += weight;
+		run[ib] -= weight;
+	}
+	*lo = qMin(*lo, ia);
+	*hi = qMax(*hi, ib+1);
+}
+
+// Exact squared Euclidean distance transform (Felzenszwalb and Huttenlocher) of the
+// n samples f at increasing positions pos into d, v and z being scratch space of
+// n and n+1 entries for the lower envelope of the parabolas
+static void distance1D(const double *f, const double *pos, int n, double *d, int *v, double *z) {
+	int k = 0;
+	double s;
+	v[0] = 0;
+	z[0] = -std::numeric_limits<double>::infinity();
+	z[1] = std::numeric_limits<double>::infinity();
+	
+	for (int q = 1; q < n; q++) {
+		// Drop the parabolas the new one hides
+		while (true) {
+			s = ((f[q]+pos[q]*pos[q])-(f[v[k]]+pos[v[k]]*pos[v[k]]))/(2*(pos[q]-pos[v[k]]));
+			if (s > z[k])
+				break;
+			k--;
+		}
+		k++;
+		v[k] = q;
+		z[k] = s;
+		z[k+1] = std::numeric_limits<double>::infinity();
+	}
+	
+	k = 0;
+	for (int q = 0; q < n; q++) {
+		while (z[k+1] < pos[q])
+			k++;
+		d[q] = (pos[q]-pos[v[k]])*(pos[q]-pos[v[k]])+f[v[k]];
+	}
+}
+
+// Signed distance from each pixel centre of a mask to the nearest pixel centre on
+// the other side of its boundary, negative inside, with the pixel centres at x
+// and y and inside indexed i+j*x.size()
+static QVector <float> signedDistance(const QVector <char> &inside, const QVector <double> &x, const QVector <double> &y) {
+	const double far = 1e20; // No pixel on the other side along the line
+	int w = x.size(), h = y.size(), n = qMax(w, h);
+	QVector <double> f(n), d(n), z(n+1), dist[2];
+	QVector <int> v(n);
+	
+	// Squared distance to the nearest inside pixel, then to the nearest outside one
+	for (int pass = 0; pass < 2; pass++) {
+		dist[pass].resize(w*h);
+		double *g = dist[pass].data();
+		
+		for (int i = 0; i < w; i++) { // Columns
+			for (int j = 0; j < h; j++)
+				f[j] = (inside[i+j*w] != 0) == (pass == 0) ? 0 : far;
+			distance1D(f.constData(), y.constData(), h, d.data(), v.data(), z.data());
+			for (int j = 0; j < h; j++)
+				g[i+j*w] = d[j];
+		}
+		
+		for (int j = 0; j < h; j++) { // Then rows
+			distance1D(g+j*w, x.constData(), w, d.data(), v.data(), z.data());
+			for (int i = 0; i < w; i++)
+				g[i+j*w] = d[i];
+		}
+	}
+	
+	QVector <float> field(w*h);
+	for (int p = 0; p < w*h; p++)
+		field[p] = sqrt(dist[0][p])-sqrt(dist[1][p]);
+	return field;
+}
+
+// A tissue assignment scheme compiled for media lookups.  A density gets the media
+// of the first threshold above it (the last media if there is none), so only the
+// thresholds higher than all those before them can ever be picked, which leaves
+// an increasing list to binary search
+struct CompiledTAS {
+	QVector <double> upper; // Kept thresholds, increasing
+	QVector <char> code; // Media character below each kept threshold, and above them all
+	QVector <int> medium; // Index of that media in the phantom media
+	
+	CompiledTAS() {}
+	CompiledTAS(const QVector <double> &threshold, const QVector <QString> &media,
+				const QMap <QString, QChar> &mediaIndex, const QString &medIdx) {
+		for (int n = 0; n < threshold.size()-1; n++)
+			if (upper.isEmpty() || threshold[n] > upper.last()) { // Otherwise it is dominated
+				upper << threshold[n];
+				addMedia(media[n], mediaIndex, medIdx);
+			}
+		addMedia(media[threshold.size()-1], mediaIndex, medIdx);
+	}
+	
+	void addMedia(const QString &name, const QMap <QString, QChar> &mediaIndex, const QString &medIdx) {
+		code << mediaIndex.value(name).toLatin1();
+		medium << medIdx.indexOf(mediaIndex.value(name));
+	}
+	
+	// Index into code and medium for density d, which is the number of kept
+	// thresholds at or below d, found with a fixed number of conditional moves
+	int band(double d) const {
+		if (upper.isEmpty())
+			return 0;
+		const double *t = upper.constData(), *base = t;
+		for (int n = upper.size(); n > 1; n -= n/2)
+			base = base[n/2] <= d ? base+n/2 : base;
+		return (base-t) + (*base <= d);
+	}
+};
+
 int Data::loadDefaults() {
 	QProcessEnvironment envVars = QProcessEnvironment::systemEnvironment();
 	if (!envVars.contains("EGS_HOME")) // No EGS_HOME defined
@@ -186,6 +456,9 @@ int Data::loadDefaults() {
 	if (!QDir(gui_location+"/database/dose/").exists())
 		QDir().mkdir(gui_location+"/database/dose/");
 	
+	if (!QDir(gui_location+"/database/dicom_index/").exists())
+		QDir().mkdir(gui_location+"/database/dicom_index/");
+	
 	files = new QDirIterator(gui_location+"/database/egsphant/", {"*.egsphant","*.egsphant.gz"}, QDir::NoFilter, QDirIterator::Subdirectories); // #nofilter #nomakeup //
 	while(files->hasNext()) {
 		files->next();
@@ -297,14 +570,27 @@ Data::~Data(){
 	if (plan_data) delete plan_data;
 }
 
+void Data::clearBuildCache() {
+	buildCache = BuildCache();
+}
+
 int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defaultTAS,
 					    QVector <int>* structIndex, QVector <int>* tasIndex,
-					    QVector <EGSPhant*>* makeMasks, double buffer) {
+					    EGSMask* mask, double buffer, EGSPhantWriter* writer) {
 	#if defined(DEBUG_BUILDEGSPHANT)
 		std::cout << "Building egsphant\n"; std::cout.flush();
 	#endif
 	
 	newProgress("Building egsphant");
+	cancelled.store(0);
+	emit cancellable(true);
+	
+	// Hide the cancel button again however the build returns
+	struct CancelDone {
+		Data* data;
+		~CancelDone() {emit data->cancellable(false);}
+	} cancelDone = {this};
+	phant->clearPicCache(); // Its voxels are written directly from here on
 	
 	QString medIdx = EGSPHANT_CHARS;
 	QMap <QString, QChar> mediaIndex;
@@ -420,18 +706,45 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 	file.close();
 	*log = *log + "-------------------------------------\n";
 	
+	if (HUMap.size() < 2) // Need at least one segment to interpolate on
+		return 101;
+	
+	// Get the density of a HU value, interpolating on the segment of HUMap it falls
+	// in and extrapolating on the first or last segment past either end
+	auto huToDensity = [&](int hu) {
+		int n;
+		for (n = 0; n < HUMap.size()-2; n++)
+			if (HUMap[n] <= hu && hu < HUMap[n+1])
+				break;
+		
+		if (hu < HUMap[0])
+			n = 0;
+		
+		double den = interp(hu,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
+		return den<=0?0.000001:den; // Set min density to 0.000001
+	};
+	
+	// CT values are shorts, so every possible density is worked out once here
+	// and looked up per voxel (indexed by HU+32768)
+	QVector <double> huDensity(65536);
+	for (int h = 0; h < 65536; h++)
+		huDensity[h] = huToDensity(h-32768);
+	
 	// Read CT data
 	// Sort out all the DICOM data into the following
 	double rescaleM = 1, rescaleB = 0, rescaleFlag;
-    QVector <QVector <QVector <short int> > > HU;
+    QVector <short int> &HU = buildCache.HU; // Contiguous, slice by slice
+	QVector <double> slope, intercept; // Per slice rescale, if it has both
+	QVector <bool> isSigned; // Pixel Representation (0028,0103)
     QVector <unsigned short int> xPix;
     QVector <unsigned short int> yPix;
     QVector <QVector <double> > imagePos;
     QVector <QVector <double> > xySpacing;
     QVector <double> zSpacing;
+	QVector <double> values; // Scratch space for reading DS fields
 	
 	*log = *log + "--- Parsing DICOM CT data ---\n";
-    double increment = 5./double(CT_data.size()); // First 10% is reading DICOM
+    double increment = 5./double(CT_data.size()); // First 10% is reading DICOM (5 more for the HU values)
 	emit newProgressName("Parsing DICOM data");
 	
 	for (int i = 0; i < CT_data.size(); i++) {
@@ -449,15 +762,8 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		tempAtt = CT_data[i]->getEntry(0x0028,0x0030);
 		if (tempAtt->tag[0] == 0x0028 && tempAtt->tag[1] == 0x0030) {
 			xySpacing.resize(xySpacing.size()+1);
-			xySpacing.last().resize(2);
-
-			QString temp = "";
-			for (unsigned int s = 0; s < tempAtt->vl; s++) {
-				temp.append(tempAtt->vf[s]);
-			}
-
-			xySpacing.last()[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-			xySpacing.last()[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
+			if (tempAtt->readDS(&xySpacing.last()) < 2)
+				return 201;
 		}
 		else
 			return 201;
@@ -465,12 +771,7 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		// Slice Thickness (Decimal String, in mm)
 		tempAtt = CT_data[i]->getEntry(0x0018,0x0050);
 		if (tempAtt->tag[0] == 0x0018 && tempAtt->tag[1] == 0x0050) {
-			QString temp = "";
-			for (unsigned int s = 0; s < tempAtt->vl; s++) {
-				temp.append(tempAtt->vf[s]);
-			}
-
-			zSpacing.append(temp.toDouble());
+			zSpacing.append(tempAtt->readDS(&values) ? values[0] : 0);
 		} 
 		else
 			return 202;
@@ -479,16 +780,8 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		tempAtt = CT_data[i]->getEntry(0x0020,0x0032);
 		if (tempAtt->tag[0] == 0x0020 && tempAtt->tag[1] == 0x0032) {
 			imagePos.resize(imagePos.size()+1);
-			imagePos.last().resize(3);
-
-			QString temp = "";
-			for (unsigned int s = 0; s < tempAtt->vl; s++) {
-				temp.append(tempAtt->vf[s]);
-			}
-
-			imagePos.last()[0] = (temp.split('\\',QString::SkipEmptyParts)[0]).toDouble();
-			imagePos.last()[1] = (temp.split('\\',QString::SkipEmptyParts)[1]).toDouble();
-			imagePos.last()[2] = (temp.split('\\',QString::SkipEmptyParts)[2]).toDouble();
+			if (tempAtt->readDS(&imagePos.last()) < 3)
+				return 203;
 		} 
 		else
 			return 203;
@@ -522,64 +815,111 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		// Rescale HU slope (assuming type is HU)
 		tempAtt = CT_data[i]->getEntry(0x0028,0x1053);
 		if (tempAtt->tag[0] == 0x0028 && tempAtt->tag[1] == 0x1053) {
-			QString temp = "";
-			for (unsigned int s = 0; s < tempAtt->vl; s++) {
-				temp.append(tempAtt->vf[s]);
-			}
-			
-			rescaleM = temp.toDouble();
+			rescaleM = tempAtt->readDS(&values) ? values[0] : 0;
 			rescaleFlag++;
 		}
 		
 		// Rescale HU intercept (assuming type is HU)
 		tempAtt = CT_data[i]->getEntry(0x0028,0x1052);
 		if (tempAtt->tag[0] == 0x0028 && tempAtt->tag[1] == 0x1052) {
-			QString temp = "";
-			for (unsigned int s = 0; s < tempAtt->vl; s++) {
-				temp.append(tempAtt->vf[s]);
-			}
-			
-			rescaleB = temp.toDouble();
+			rescaleB = tempAtt->readDS(&values) ? values[0] : 0;
 			rescaleFlag++;
 		}
 		
-		// HU values
-		tempAtt = CT_data[i]->getEntry(0x7FE0,0x0010);
-		if (tempAtt->tag[0] == 0x7FE0 && tempAtt->tag[1] == 0x0010) {
-			HU.resize(HU.size()+1);
-			if (HU.size() == xPix.size() && HU.size() == yPix.size()) {
-				HU.last().resize(yPix.last());
-				for (unsigned int k = 0; k < yPix.last(); k++) {
-					HU.last()[k].resize(xPix.last());
-				}
-				
-				short int temp;
-				if (CT_data[i]->isBigEndian)
-					for (unsigned int s = 0; s < tempAtt->vl; s+=2) {
-						temp  = (tempAtt->vf[s+1]);
-						temp += (short int)(tempAtt->vf[s]) << 8;
-						
-						HU.last()[int(int(s/2)/xPix.last())][int(s/2)%xPix.last()] =
-							rescaleFlag == 2 ? rescaleM*temp+rescaleB : temp;
-					}
-				else
-					for (unsigned int s = 0; s < tempAtt->vl; s+=2) {
-						temp  = (tempAtt->vf[s]);
-						temp += (short int)(tempAtt->vf[s+1]) << 8;
-						
-						HU.last()[int(int(s/2)/xPix.last())][int(s/2)%xPix.last()] =
-							rescaleFlag == 2 ? rescaleM*temp+rescaleB : temp;
-					}
-			}
-		}
-		else
-			return 208;
+		// Pixel Representation, signed unless it says otherwise
+		tempAtt = CT_data[i]->getEntry(0x0028,0x0103);
+		isSigned.append(!(tempAtt->tag[0] == 0x0028 && tempAtt->tag[1] == 0x0103 && tempAtt->vl >= 2 &&
+						  tempAtt->vf[0] == 0 && tempAtt->vf[1] == 0));
+		
+		slope.append(rescaleFlag == 2 ? rescaleM : 1);
+		intercept.append(rescaleFlag == 2 ? rescaleB : 0);
+		
+		// All slices go in one volume, so they have to match
+		if (xPix.last() != xPix[0] || yPix.last() != yPix[0])
+			return 209;
 		
 		#if defined(DEBUG_BUILDEGSPHANT)
 			std::cout << " parsed!\n"; std::cout.flush();
 		#endif
 		
     }
+	
+	// Stage keys, the HU values depend on the CT files and the densities on them and
+	// the HU to density conversion, nothing needs to be redone if they are unchanged
+	QByteArray huKey, densityKey;
+	{
+		QDataStream key(&huKey, QIODevice::WriteOnly);
+		for (int i = 0; i < CT_data.size(); i++) {
+			QFileInfo ct(CT_data[i]->path);
+			key << CT_data[i]->path << ct.size() << ct.lastModified();
+		}
+		key << slope << intercept << isSigned << xPix << yPix;
+	}
+	huKey = QCryptographicHash::hash(huKey, QCryptographicHash::Sha1);
+	{
+		QDataStream key(&densityKey, QIODevice::WriteOnly);
+		key << huKey << HUMap << denMap;
+	}
+	densityKey = QCryptographicHash::hash(densityKey, QCryptographicHash::Sha1);
+	
+	// When the egsphant is written out while it is built, neither stage is cached,
+	// so only the phantom itself is the size of the volume, and the HU of each
+	// slice is only kept until its densities are done
+	bool streamHU = writer != 0;
+	if (streamHU) {
+		buildCache.huKey.clear();
+		buildCache.HU.clear();
+		buildCache.HU.squeeze();
+		buildCache.densityKey.clear();
+		buildCache.density = Volume <double> ();
+	}
+	bool densityCached = buildCache.densityKey == densityKey;
+	bool finished = true;
+	
+	// HU values, each slice is read in from the file (if only the header was
+	// parsed), converted straight into the HU volume and released on the thread
+	// pool, which also bounds how many raw slices are in memory at once
+	int plane = xPix[0]*yPix[0];
+	QVector <int> sliceError(CT_data.size(), 0);
+	auto extractHU = [&](int i, short int *dst) {
+		if (CT_data[i]->loadPixelData()) {
+			sliceError[i] = 208;
+			return;
+		}
+		
+		Attribute* pixels = CT_data[i]->getEntry(0x7FE0,0x0010);
+		if (pixels->tag[0] != 0x7FE0 || pixels->tag[1] != 0x0010 || pixels->vf == NULL ||
+			pixels->vl/2 < (unsigned long int)plane) { // Missing, or too short to fill the slice
+			sliceError[i] = 208;
+		}
+		else {
+			pixelsToHU(pixels->vf, plane, CT_data[i]->isBigEndian, isSigned.at(i),
+					   slope.at(i), intercept.at(i), dst);
+		}
+		
+		CT_data[i]->releasePixelData(); // Only does something for header only parses
+	};
+	
+	emit newProgressName("Extracting HU values");
+	if (streamHU || densityCached || buildCache.huKey == huKey) {
+		emit madeProgress(5.0);
+	}
+	else {
+		buildCache.huKey.clear(); // Until it is complete
+		HU.resize(plane*CT_data.size());
+		short int *volume = HU.data();
+		finished = runSlices(CT_data.size(), 5.0, [&](int i) {
+			extractHU(i, volume+qint64(i)*plane);
+		});
+		if (!finished)
+			return 300;
+	
+		for (int i = 0; i < sliceError.size(); i++)
+			if (sliceError[i])
+				return sliceError[i];
+		buildCache.huKey = huKey;
+	}
+	
 	*log = *log + "Extracted all HU data for the " + QString::number(CT_data.size()) + " (" + QString::number(xPix[0]) + "x" + QString::number(yPix[0]) + ") slices\n";
 	*log = *log + "-----------------------------\n";
 	
@@ -626,21 +966,9 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 	}
 	phant->z.last() = nextZ/10.0;
 		
-	// Set up media array
-	{
-		QVector <char> mz(phant->nz, 0);
-		QVector <QVector <char> > my(phant->ny, mz);
-		QVector <QVector <QVector <char> > > mx(phant->nx, my);
-		phant->m = mx;
-	}
-		
-	// Setup density array
-	{
-		QVector <double> dz(phant->nz, 0);
-		QVector <QVector <double> > dy(phant->ny, dz);
-		QVector <QVector <QVector <double> > > dx(phant->nx, dy);
-		phant->d = dx;
-	}
+	// Set up media and density arrays
+	phant->m.resize(phant->nx, phant->ny, phant->nz, 0);
+	phant->d.resize(phant->nx, phant->ny, phant->nz, 0);
 		
 	// Get bounding rectangles over each struct
 	#if defined(DEBUG_BUILDEGSPHANT)
@@ -650,9 +978,11 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 	//*log = *log + "Struct boundaries\n";
 	
 	QVector <QVector <QRectF> > structRect;
+	QVector <QVector <ScanPolygon> > structScan; // Edge tables for filling the structs
 	
 	for (int i = 0; i < structPos.size(); i++) {
 		structRect.resize(i+1);
+		structScan.resize(i+1);
 		
 		#if defined(DEBUG_BUILDEGSPHANT)
 			std::cout << "  Struct: " + structName[i].toStdString() + "\n"; std::cout.flush();
@@ -663,6 +993,7 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		for (int j = 0; j < structPos[i].size(); j++) {
 			structRect[i].resize(j+1);
 			structRect[i][j] = structPos[i][j].boundingRect();
+			structScan[i] << ScanPolygon(structPos[i][j]);
 			
 			#if defined(DEBUG_BUILDEGSPHANT)
 				std::cout << "    z = " << structZ[i][j] << " : (";
@@ -703,40 +1034,59 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		std::cout << "Assigning density using HU\n"; std::cout.flush();
 	#endif
 	
-	QList<QPoint> zIndex, yIndex;
-	QList<QPoint>::iterator p;
-	double zMid, yMid, xMid, temp;
-	int tempHU = 0, n = 0, q = 0, inStruct = 0;
-	
-	// Convert HU to density and media
-    increment = 15.0/double(phant->nz); // 45% is making the egsphant (15 for density, 30 for media)
+	// Convert HU to density and media, one slice per task, unless the densities
+	// of the last build are still good
 	emit newProgressName("Building density arrays");
-	
-	for (int k = 0; k < phant->nz; k++) { // Z //
-		emit madeProgress(increment);
-		for (int j = 0; j < phant->ny; j++) { // Y //
-			for (int i = 0; i < phant->nx; i++) { // X //
-				
-				tempHU = HU[k][j][i];
-				
-				// Linear search because I don't think these arrays every get big
-				// get the right density
-				for (n = 0; n < HUMap.size()-1; n++)
-					if (HUMap[n] <= tempHU && tempHU < HUMap[n+1])
-						break;
-					
-				if (tempHU < HUMap[0])
-					n = 0;
+	if (densityCached) {
+		phant->d = buildCache.density; // Shared until written to
+		phant->maxDensity = buildCache.maxDensity;
+		emit madeProgress(15.0);
+	}
+	else {
+		QVector <double> sliceMax(phant->nz, 0); // Max density of each slice
+	
+		finished = runSlices(phant->nz, 15.0, [&](int k) { // Z // 45% is making the egsphant (15 for density, 30 for media)
+			QVector <short int> sliceHU;
+			const short int *hu;
+			if (streamHU) { // Read in just this slice
+				sliceHU.resize(plane);
+				extractHU(k, sliceHU.data());
+				if (sliceError[k])
+					return;
+				hu = sliceHU.constData();
+			}
+			else {
+				hu = HU.constData()+qint64(k)*plane;
+			}
+			const double *density = huDensity.constData()+32768;
+			double temp;
+			for (int j = 0; j < phant->ny; j++) { // Y //
+				for (int i = 0; i < phant->nx; i++) { // X //
 				
-				temp = interp(tempHU,HUMap[n],HUMap[n+1],denMap[n],denMap[n+1]);
-				temp = temp<=0?0.000001:temp; // Set min density to 0.000001
+					temp = density[hu[j*phant->nx+i]];
 				
-				if (temp > phant->maxDensity) // Track max density for images
-					phant->maxDensity = temp;
+					if (temp > sliceMax[k]) // Track max density for images
+						sliceMax[k] = temp;
 				
-				// Assign density
-				phant->d[i][j][k] = temp;
+					// Assign density
+					phant->d[i][j][k] = temp;
+				}
 			}
+		});
+		if (!finished)
+			return 300;
+		for (int k = 0; k < sliceError.size(); k++)
+			if (sliceError[k])
+				return sliceError[k];
+	
+		for (int k = 0; k < phant->nz; k++)
+			if (sliceMax[k] > phant->maxDensity)
+				phant->maxDensity = sliceMax[k];
+		
+		if (!streamHU) {
+			buildCache.density = phant->d;
+			buildCache.maxDensity = phant->maxDensity;
+			buildCache.densityKey = densityKey;
 		}
 	}
 	
@@ -757,30 +1107,81 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		*log = *log + "no MAR is requested\n";	
 	
 	if (do_MAR) {
-		// Input reading code
-		QFile file (gui_location+"/database/transformation/"+transformFile);
-		QString line;
-		
-		// Variables that will hold dimensions and fetched density
-		double xP, yP, zP, dens;
-		int minX, minY, minZ, maxX, maxY, maxZ;
-		bool inStruct;
-		
-		// A set (hash table) that we will append all unique values to
-		QSet <int> voxels;
+		// Seed positions, straight from the parsed plan if it was saved as the
+		// chosen transformation file, otherwise read from the file
+		QVector <QVector3D> seeds;
+		bool readSeeds = true;
+		if (transformFile == seedTransform && seedPos.size()) {
+			seeds = seedPos;
+		}
+		else {
+			QFile file (gui_location+"/database/transformation/"+transformFile);
+			QString line;
+			
+			if (file.open(QIODevice::ReadOnly)) {
+				QTextStream in (&file);
+				while(!in.atEnd()) {
+					
+					// Get the transformation lines from the text
+					line = in.readLine();
+					if (line.contains("translation =")) {
+						line = line.split("=")[1].trimmed();
+						seeds << QVector3D(line.split(" ")[0].trimmed().toDouble(),
+										   line.split(" ")[1].trimmed().toDouble(),
+										   line.split(" ")[2].trimmed().toDouble());
+					}
+				}
+			}
+			else {
+				readSeeds = false;
+			}
+		}
 		
-		if (file.open(QIODevice::ReadOnly)) {
-			QTextStream in (&file);
-			while(!in.atEnd()) {
+		if (readSeeds) {
+			// Voxel centres of the grid
+			QVector <double> xMid(phant->nx), yMid(phant->ny), zMid(phant->nz);
+			for (int i = 0; i < phant->nx; i++)
+				xMid[i] = (phant->x[i]+phant->x[i+1])/2.0;
+			for (int j = 0; j < phant->ny; j++)
+				yMid[j] = (phant->y[j]+phant->y[j+1])/2.0;
+			for (int k = 0; k < phant->nz; k++)
+				zMid[k] = (phant->z[k]+phant->z[k+1])/2.0;
+			
+			// Index range of the centres within [a,b] along an axis
+			auto centres = [](const QVector <double> &mid, double a, double b, int *first, int *last) {
+				*first = std::lower_bound(mid.begin(), mid.end(), a)-mid.begin();
+				*last = std::upper_bound(mid.begin(), mid.end(), b)-mid.begin();
+			};
+			
+			// The voxels near the seeds only depend on the grid, the seeds and the
+			// contour they have to be in, so they are kept between builds
+			QByteArray marKey;
+			{
+				QDataStream key(&marKey, QIODevice::WriteOnly);
+				key << phant->x << phant->y << phant->z << seeds << marRad;
+				if (contourNum > 0 && marContourInd != -1)
+					key << structZ[structIndex->at(marContourInd)] << structPos[structIndex->at(marContourInd)];
+			}
+			marKey = QCryptographicHash::hash(marKey, QCryptographicHash::Sha1);
+			
+			QBitArray voxels;
+			QString marLog;
+			if (buildCache.marKey == marKey) {
+				voxels = buildCache.marVoxels;
+				marLog = buildCache.marLog;
+			}
+			else {
+				// Set a bit for every voxel whose centre is within marRad of a seed
+				voxels.resize(phant->nx*phant->ny*phant->nz);
+				double xP, yP, zP, r2 = marRad*marRad, dz2, dy2, dx;
+				int minX, maxX, minY, maxY, minZ, maxZ;
+				bool inStruct;
+			
+				for (int s = 0; s < seeds.size(); s++) {
+					xP = seeds[s].x();
+					yP = seeds[s].y();
+					zP = seeds[s].z();
 				
-				// Get the transformation lines from the text
-				line = in.readLine();
-				if (line.contains("translation =")) {
-					line = line.split("=")[1].trimmed();
-					xP = line.split(" ")[0].trimmed().toDouble();
-					yP = line.split(" ")[1].trimmed().toDouble();
-					zP = line.split(" ")[2].trimmed().toDouble();
-					
 					inStruct = false;
 					if (contourNum > 0 && marContourInd != -1) {
 						for (int m = 0; m < structZ[structIndex->at(marContourInd)].size(); m++) {
@@ -793,56 +1194,64 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 					}
 					else
 						inStruct = true;
-					
-					if (inStruct) {
-						// Get the indices
-						minX = phant->getIndex("x axis",xP-marRad);
-						minY = phant->getIndex("y axis",yP-marRad);
-						minZ = phant->getIndex("z axis",zP-marRad);
-						maxX = phant->getIndex("x axis",xP+marRad)+1;
-						maxY = phant->getIndex("y axis",yP+marRad)+1;
-						maxZ = phant->getIndex("z axis",zP+marRad)+1;
-						if (minX < 0 || minY < 0 || minZ < 0 || maxX < 0 || maxY < 0 || maxZ < 0) {
-							*log = *log + QString("source position/radius out of bounds error for source [%1,%2,%3], skipping it\n").arg(xP).arg(yP).arg(zP);
-							inStruct = false;
-						}
-						
-						// Add all the voxels within marRad to the voxels set
-						if (inStruct) {
-							for (int k = minZ; k < maxZ; k++) {
-								for (int j = minY; j < maxY; j++) {
-									for (int i = minX; i < maxX; i++) {
-										voxels.insert(i+(j*phant->nx)+(k*phant->nx*phant->ny));
-									}
-								}
-							}
+				
+					if (!inStruct)
+						continue;
+				
+					centres(zMid, zP-marRad, zP+marRad, &minZ, &maxZ);
+					if (minZ >= maxZ) {
+						marLog = marLog + QString("source position/radius out of bounds error for source [%1,%2,%3], skipping it\n").arg(xP).arg(yP).arg(zP);
+						continue;
+					}
+				
+					// Only walk the voxels inside the sphere, row by row
+					for (int k = minZ; k < maxZ; k++) {
+						dz2 = (zMid[k]-zP)*(zMid[k]-zP);
+						centres(yMid, yP-sqrt(qMax(r2-dz2, 0.0)), yP+sqrt(qMax(r2-dz2, 0.0)), &minY, &maxY);
+						for (int j = minY; j < maxY; j++) {
+							dy2 = (yMid[j]-yP)*(yMid[j]-yP);
+							if (dz2+dy2 > r2)
+								continue;
+							dx = sqrt(r2-dz2-dy2);
+							centres(xMid, xP-dx, xP+dx, &minX, &maxX);
+							for (int i = minX; i < maxX; i++)
+								voxels.setBit(i+(j*phant->nx)+(k*phant->nx*phant->ny));
 						}
-						*log = *log + QString("    MAR performed at source position [%1,%2,%3]\n").arg(xP).arg(yP).arg(zP);
 					}
+					marLog = marLog + QString("    MAR performed at source position [%1,%2,%3]\n").arg(xP).arg(yP).arg(zP);
 				}
+				buildCache.marVoxels = voxels;
+				buildCache.marLog = marLog;
+				buildCache.marKey = marKey;
 			}
+			*log = *log + marLog;
 			
-			// Now do threshold replacement to all voxels in voxels set
-			QSet<int>::iterator it = voxels.begin();
-			int count = 0;
-			increment = 2.5/voxels.size(); // 2.5%
-			int i, j, k;
+			// Now do threshold replacement to all the set voxels, a slice per task
+			QVector <int> sliceCount(phant->nz, 0), sliceReplaced(phant->nz, 0);
+			phant->d.detach(); // From the cached densities
+			finished = runSlices(phant->nz, 5.0, [&](int k) { // 5%
+				int v = k*phant->nx*phant->ny;
+				double dens;
+				for (int j = 0; j < phant->ny; j++)
+					for (int i = 0; i < phant->nx; i++, v++)
+						if (voxels.testBit(v)) {
+							sliceCount[k]++;
+							dens = phant->d.at(i,j,k);
+							if (dens < lowerThresh || dens > upperThresh) {
+								phant->d[i][j][k] = marDen;
+								sliceReplaced[k]++;
+							}
+						}
+			});
+			if (!finished)
+				return 300;
 			
-			while (it != voxels.end()) {
-				i = *it;
-				k = int(i/phant->nx/phant->ny);
-				j = int(i/phant->nx)%phant->ny;
-				i = i%phant->nx;
-				
-				dens = phant->getDensity(i,j,k);
-				emit madeProgress(increment);
-				if (dens < lowerThresh || dens > upperThresh) {
-					phant->setDensity(i,j,k,marDen);
-					count++;
-				}
-				it++;
+			int count = 0, evaluated = 0;
+			for (int k = 0; k < phant->nz; k++) {
+				count += sliceReplaced[k];
+				evaluated += sliceCount[k];
 			}
-			*log = *log + "\nMAR applied to " + QString::number(count) + " of the " + QString::number(voxels.size()) + " evaluated voxels\n";	
+			*log = *log + "\nMAR applied to " + QString::number(count) + " of the " + QString::number(evaluated) + " evaluated voxels\n";	
 		}
 		else {
 			*log = *log + "failed to open transport file, MAR aborted\n";
@@ -877,27 +1286,211 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		*log = *log + "-----------------------------------\n";
 	}
 	
-	// Set up masks
+	// Set up the structure label volume holding all masks
 	#if defined(DEBUG_BUILDEGSPHANT)
 		std::cout << "Making masks\n"; std::cout.flush();
 	#endif
 	
-	for (int i = 0; i < contourNum; i++) {
-		EGSPhant* temp = new EGSPhant;
-		temp->makeMask(phant);
-		makeMasks->append(temp);
+	{
+		QVector <QString> names;
+		for (int i = 0; i < contourNum; i++)
+			names << structName[i];
+		mask->makeMask(phant, names);
 	}
 		
 	// Convert density to media
 	*log = *log + "--- Assigning the egsphant media ---\n";
 	emit newProgressName("Building media arrays");
-	increment = 30.0/double(phant->nz); // 30%
-	bool structAssigned = false;
 	
-	*log = *log + "Added slices z midpoints:\n\n";
+	// Voxel centres along x and y
+	QVector <double> xMids(phant->nx), yMids(phant->ny);
+	for (int i = 0; i < phant->nx; i++)
+		xMids[i] = (phant->x[i]+phant->x[i+1])/2.0;
+	for (int j = 0; j < phant->ny; j++)
+		yMids[j] = (phant->y[j]+phant->y[j+1])/2.0;
+	
+	// Which structures each voxel is in only depends on the (cropped) grid and the
+	// contours in priority order, so it is kept between builds that only change the
+	// TAS or the densities
+	QByteArray structKey;
+	{
+		QDataStream key(&structKey, QIODevice::WriteOnly);
+		key << phant->x << phant->y << phant->z << *structIndex << structName.size() << partialSamples;
+		for (int l = 0; l < contourNum; l++)
+			key << structZ[structIndex->at(l)] << structPos[structIndex->at(l)];
+	}
+	structKey = QCryptographicHash::hash(structKey, QCryptographicHash::Sha1);
+	bool structCached = buildCache.structKey == structKey;
+	if (structCached) {
+		emit madeProgress(25.0);
+	}
+	else {
+		buildCache.structKey.clear(); // Until it is complete
+		buildCache.labels.fill(0, phant->nx*phant->ny*phant->nz);
+		buildCache.sliceSets = QVector <QVector <QBitArray> > (phant->nz);
+		buildCache.sliceStructVol = QVector <QVector <int> > (phant->nz);
+		buildCache.slicePartial = QVector <QVector <QHash <int, unsigned char> > > (phant->nz);
+	}
+	
+	#if defined(INTERPOLATE_CONTOURS)
+	// Shape based interpolation of each structure on the slices between its contours,
+	// the signed distance fields of the contoured planes on either side are blended
+	// linearly in z and the voxels where the result is negative are inside
+	QVector <QMap <int, QVector <QVector <int> > > > interpSpans(structPos.size()); // Spans of each row, by struct and slice
+	emit newProgressName("Interpolating contours");
+	finished = structCached || runSlices(contourNum, 5.0, [&](int l) { // One struct per task
+		int s = structIndex->at(l);
+		const QVector <double> &zs = structZ[s];
+		
+		// Group the contours into planes of increasing z
+		QVector <int> order(zs.size());
+		for (int m = 0; m < order.size(); m++)
+			order[m] = m;
+		std::stable_sort(order.begin(), order.end(), [&](int a, int b) {return zs[a] < zs[b];});
+		
+		QVector <double> planeZ;
+		QVector <QVector <int> > planeContours;
+		for (int m = 0; m < order.size(); m++) {
+			if (planeZ.isEmpty() || zs[order[m]]-planeZ.last() > 0.0001) {
+				planeZ << zs[order[m]];
+				planeContours.resize(planeContours.size()+1);
+			}
+			planeContours.last() << order[m];
+		}
+		if (planeZ.size() < 2)
+			return;
+		
+		// The fields are only needed on the voxels around the struct, with a ring of
+		// outside voxels so that the distances inside are still exact
+		QRectF bound;
+		for (int m = 0; m < zs.size(); m++)
+			bound = bound.united(structRect[s][m]);
+		int i0 = qMax(int(std::lower_bound(xMids.begin(), xMids.end(), bound.left())-xMids.begin())-1, 0);
+		int i1 = qMin(int(std::upper_bound(xMids.begin(), xMids.end(), bound.right())-xMids.begin())+1, phant->nx);
+		int j0 = qMax(int(std::lower_bound(yMids.begin(), yMids.end(), bound.top())-yMids.begin())-1, 0);
+		int j1 = qMin(int(std::upper_bound(yMids.begin(), yMids.end(), bound.bottom())-yMids.begin())+1, phant->ny);
+		int w = i1-i0, h = j1-j0;
+		if (w <= 0 || h <= 0)
+			return;
+		QVector <double> boxX = xMids.mid(i0, w), boxY = yMids.mid(j0, h);
+		
+		// Rasterize all the contours of a plane the same way as the media pass does
+		auto planeField = [&](int plane) {
+			QVector <char> inside(w*h, 0);
+			QVector <double> crossings;
+			QVector <int> spans;
+			for (int c = 0; c < planeContours[plane].size(); c++) {
+				int m = planeContours[plane][c];
+				ScanPolygon poly = structScan[s][m]; // Own copy for its scanline state
+				for (int j = j0; j < j1; j++) {
+					if (yMids[j] < structRect[s][m].top() || structRect[s][m].bottom() < yMids[j])
+						continue;
+					poly.crossings(yMids[j], &crossings);
+					scanSpans(crossings, xMids, structRect[s][m].left(), structRect[s][m].right(), &spans);
+					for (int n = 0; n < spans.size(); n += 2)
+						for (int i = qMax(spans[n], i0); i < qMin(spans[n+1], i1); i++)
+							inside[i-i0+(j-j0)*w] = 1;
+				}
+			}
+			return signedDistance(inside, boxX, boxY);
+		};
+		
+		QMap <int, QVector <float> > fields; // Of the planes in use, by plane
+		QMap <int, QVector <QVector <int> > > &result = interpSpans[s];
+		for (int k = 0; k < phant->nz; k++) {
+			double zMid = (phant->z[k]+phant->z[k+1])/2.0;
+			
+			// Slices with a contour of their own are filled from it
+			bool contoured = false;
+			for (int m = 0; m < zs.size(); m++)
+				if (abs(zs[m] - zMid) < (phant->z[k+1]-phant->z[k])/2.0)
+					contoured = true;
+			if (contoured)
+				continue;
+			
+			// Otherwise it needs a plane above and below it
+			int a = std::upper_bound(planeZ.begin(), planeZ.end(), zMid)-planeZ.begin()-1, b = a+1;
+			if (a < 0 || b >= planeZ.size())
+				continue;
+			
+			// Slices go up in z, so the fields of planes below a are done with
+			while (fields.size() && fields.firstKey() < a)
+				fields.erase(fields.begin());
+			if (!fields.contains(a))
+				fields[a] = planeField(a);
+			if (!fields.contains(b))
+				fields[b] = planeField(b);
+			
+			const float *fa = fields[a].constData(), *fb = fields[b].constData();
+			double t = (zMid-planeZ[a])/(planeZ[b]-planeZ[a]);
+			QVector <QVector <int> > rows(phant->ny);
+			bool found = false;
+			for (int j = j0; j < j1; j++) {
+				int start = -1;
+				for (int i = i0; i <= i1; i++) {
+					int p = i-i0+(j-j0)*w;
+					bool in = i < i1 && (1-t)*fa[p]+t*fb[p] < 0;
+					if (in && start < 0) {
+						start = i;
+					}
+					else if (!in && start >= 0) {
+						rows[j] << start << i;
+						start = -1;
+						found = true;
+					}
+				}
+			}
+			if (found)
+				result[k] = rows;
+		}
+	});
+	if (!finished)
+		return 300;
+	#endif
+	
+	// What each slice found, merged in slice order afterwards so that the output
+	// does not depend on which thread did which slice
+	QVector <QVector <QBitArray> > &sliceSets = buildCache.sliceSets; // Structure sets of the slice's own labels
+	QVector <QVector <int> > &sliceStructVol = buildCache.sliceStructVol;
+	QVector <QVector <int> > sliceMedVol(phant->nz);
+	unsigned short *labels = buildCache.labels.data();
+	QAtomicInt tooManyLabels(0); // Set if a slice has more structure sets than labels
+	
+	emit newProgressName("Finding structures");
+	finished = structCached || runSlices(phant->nz, 20.0, [&](int k) { // Z // 20%, 5% for interpolation
+		QList<QPoint> zIndex, yIndex;
+		QList<QPoint>::iterator p;
+		double zMid, yMid;
+		int n;
+		bool structAssigned = false;
+		
+		// Scratch space of this slice
+		QBitArray voxelStructs(contourNum); // Structures holding the current voxel
+		QVector <QVector <ScanPolygon> > scan = structScan; // Shallow copy, the edge tables keep scanline state
+		QVector <double> crossings;
+		QVector <QVector <int> > spans; // The inside spans of each looked up contour on a row
+		QVector <int> cursor, inside;
+		#if defined(INTERPOLATE_CONTOURS)
+		const QVector <QMap <int, QVector <QVector <int> > > > &interp = interpSpans; // Read only here
+		#endif
+		
+		// Voxels are labelled with an index+1 into sets for now, 0 being no structure
+		QVector <QBitArray> &sets = sliceSets[k];
+		QHash <QBitArray, unsigned short> setLabel;
+		QVector <int> &structCount = sliceStructVol[k];
+		structCount.fill(0, structName.size());
+		
+		// Partial volumes, sub-rows being scanned on their own copy of the edge tables
+		QVector <QHash <int, unsigned char> > &partial = buildCache.slicePartial[k];
+		QVector <QVector <ScanPolygon> > subScan;
+		QVector <float> cover, run;
+		if (partialSamples > 1) {
+			partial = QVector <QHash <int, unsigned char> > (structName.size());
+			subScan = structScan;
+			cover.fill(0, phant->nx+1);
+			run.fill(0, phant->nx+1);
+		}
 		
-	for (int k = 0; k < phant->nz; k++) { // Z //
-		emit madeProgress(increment);
 		zMid = (phant->z[k]+phant->z[k+1])/2.0;
 			
 		// Preprocess step to check which structs to look up on this slices\n
@@ -915,30 +1508,10 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 								foundFlag = true;
 							}
 						}
-						// Or, if the struct has a z above and below it, transpose the nearest struct in z
-						if (!foundFlag) {
-							double below = -1000000, above = 1000000, diff; // Hopefully huge lower/upper bounds
-							int iBelow = -1, iAbove = -1;
-							for (int m = 0; m < structZ[structIndex->at(l)].size(); m++) {
-								diff = structZ[structIndex->at(l)][m] - zMid;
-								if (diff > 0 && diff < above) {
-									above = diff;
-									iAbove = m;
-								}
-								if (diff < 0 && diff > below) {
-									below = diff;
-									iBelow = m;
-								}
-							}
-							
-							// If there is a contour above and below this slice, assign the closest contour
-							if (below != -1000000 && above != 1000000) {
-								if (above < -below)
-									zIndex << QPoint(structIndex->at(l),iAbove); // Add it to lookup
-								else
-									zIndex << QPoint(structIndex->at(l),iBelow); // Add it to lookup
-							}
-						}
+						// Or, if the struct has a z above and below it, use its interpolated
+						// shape (marked by contour -1)
+						if (!foundFlag && interp[structIndex->at(l)].contains(k))
+							zIndex << QPoint(structIndex->at(l),-1); // Add it to lookup
 					#else //#elif
 						// Find the first struct within the voxel
 						for (int m = 0; m < structZ[structIndex->at(l)].size(); m++) {
@@ -963,11 +1536,17 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 		
 			// Preprocess step to check which structs to look up on this pixel column\n
 			// yIndex is going to have all indices of structPos that we need to look up
+			yIndex.clear(); // Reset lookup
 			if (zIndex.size() > 0) {
-				yIndex.clear(); // Reset lookup
 				for (p = zIndex.begin(); p != zIndex.end(); p++) {
 					// If column p->y() of struct p->x() is on the same column as slice k,j of the phantom
-					if (structRect[p->x()][p->y()].top() <= yMid && yMid <= structRect[p->x()][p->y()].bottom()) {
+					if (p->y() < 0) { // Interpolated, if it has spans on this row
+						#if defined(INTERPOLATE_CONTOURS)
+						if (interp[p->x()].value(k)[j].size())
+							yIndex << *p;
+						#endif
+					}
+					else if (structRect[p->x()][p->y()].top() <= yMid && yMid <= structRect[p->x()][p->y()].bottom()) {
 						yIndex << *p;
 					}
 				}
@@ -980,53 +1559,188 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 				}
 			#endif
 			
-			for (int i = 0; i < phant->nx; i++) { // X //
-				xMid = (phant->x[i]+phant->x[i+1])/2.0;
-				temp = phant->d[i][j][k];
-				structAssigned = false;
+			// Rasterize the contours on this row into spans of voxels whose centres are inside
+			spans.resize(yIndex.size());
+			n = 0;
+			for (p = yIndex.begin(); p != yIndex.end(); p++, n++) {
+				#if defined(INTERPOLATE_CONTOURS)
+				if (p->y() < 0) {
+					spans[n] = interp[p->x()].value(k)[j];
+					continue;
+				}
+				#endif
+				scan[p->x()][p->y()].crossings(yMid, &crossings);
+				scanSpans(crossings, xMids, structRect[p->x()][p->y()].left(), structRect[p->x()][p->y()].right(), &spans[n]);
+			}
+			cursor.fill(0, yIndex.size());
+			
+			// Then fill the row one segment at a time, where each segment is a run of
+			// voxels inside the same contours
+			for (int i = 0; i < phant->nx;) { // X //
+				int segEnd = phant->nx;
 				
 				// Check if we are in a structure
-				inStruct = -1;
-				if (yIndex.size() > 0) {
-					for (p = yIndex.begin(); p != yIndex.end(); p++) { // Check through each
-					// If row p->y() of struct p->x() on the same row as slice k,j,i of the phantom
-						if (structRect[p->x()][p->y()].left() <= xMid && xMid <= structRect[p->x()][p->y()].right())
-							if (structPos[p->x()][p->y()].containsPoint(QPointF(xMid,yMid), Qt::OddEvenFill)) {
-								if (!structAssigned) {
-									inStruct = p->x();
-									structAssigned = true; // Assign first struct found and quit, assumed highest priority
-								}
-								
-								// Count structure volume
-								structVol[structName[p->x()]]++;
-								
-								// Setup mask (revert structIndex to global index)
-								(*makeMasks)[p->x()]->m[i][j][k] = 50;
-							}
+				structAssigned = false;
+				inside.clear();
+				n = 0;
+				for (p = yIndex.begin(); p != yIndex.end(); p++, n++) { // Check through each
+					QVector <int> &span = spans[n];
+					while (cursor[n] < span.size() && span[cursor[n]+1] <= i)
+						cursor[n] += 2;
+					
+					if (cursor[n] == span.size()) // Past its last span
+						continue;
+					if (i < span[cursor[n]]) { // Before its next span
+						segEnd = qMin(segEnd, span[cursor[n]]);
+						continue;
 					}
+					segEnd = qMin(segEnd, span[cursor[n]+1]);
+					
+					structAssigned = true;
+					inside << p->x();
+					
+					// Add the structure to the voxel label (structIndex is the global index)
+					voxelStructs.setBit(p->x());
 				}
 				
-				q = defaultTAS; // Default tissue assignment scheme
+				// Count structure volume
+				for (int c = 0; c < inside.size(); c++)
+					structCount[inside[c]] += segEnd-i;
+				
+				// Label the voxels with every structure they are in
+				if (structAssigned && !setLabel.contains(voxelStructs) && sets.size() >= EGSMask::maxLabels-1) {
+					tooManyLabels.store(1);
+					structAssigned = false;
+					voxelStructs.fill(false);
+				}
+				if (structAssigned) {
+					if (!setLabel.contains(voxelStructs)) {
+						sets << voxelStructs;
+						setLabel[voxelStructs] = sets.size();
+					}
+					unsigned short label = setLabel[voxelStructs];
+					voxelStructs.fill(false);
 					
-				if (inStruct > -1) { // Change TAS if we are in structure
-					// Check to see if a TAS is assigned
-					if (structToTas.contains(inStruct))
-						q = structToTas[inStruct];
-				}		
-
+					for (; i < segEnd; i++)
+						labels[i+phant->nx*(j+phant->ny*k)] = label;
+				}
+				i = segEnd;
+			}
+			
+			// Find how much of each voxel of the row the structures cover from sub-rows
+			// across it, which are exact along x, and keep the fractions that differ from
+			// the voxel centre labels (interpolated structs only have their voxel centres)
+			if (partialSamples > 1) {
+				for (p = zIndex.begin(); p != zIndex.end();) {
+					int s = p->x(), lo = phant->nx, hi = 0;
+					for (; p != zIndex.end() && p->x() == s; p++) {
+						if (p->y() < 0 || structRect[s][p->y()].top() > phant->y[j+1] || structRect[s][p->y()].bottom() < phant->y[j])
+							continue;
+						
+						for (int b = 0; b < partialSamples; b++) {
+							double ySub = phant->y[j]+(b+0.5)*(phant->y[j+1]-phant->y[j])/partialSamples;
+							subScan[s][p->y()].crossings(ySub, &crossings);
+							for (int c = 0; c < crossings.size(); c += 2)
+								coverSpan(crossings[c], c+1 < crossings.size() ? crossings[c+1] : structRect[s][p->y()].right(),
+										  phant->x, 1.0f/partialSamples, cover.data(), run.data(), &lo, &hi);
+						}
+					}
+					
+					float full = 0;
+					for (int i = lo; i < hi; i++) {
+						full += run[i];
+						unsigned char frac = qRound(qBound(0.0f, cover[i]+full, 1.0f)*255);
+						cover[i] = run[i] = 0;
+						
+						int v = i+phant->nx*(j+phant->ny*k);
+						if (frac != (labels[v] && sets[labels[v]-1].testBit(s) ? 255 : 0))
+							partial[s].insert(v, frac);
+					}
+				}
+			}
+		}
+	});
+	if (!finished)
+		return 300;
+	if (tooManyLabels.load())
+		return 210;
+	buildCache.structKey = structKey;
+	
+	// Compile the schemes in use once, rather than searching them per voxel
+	QVector <CompiledTAS> tasTable(threshold.size());
+	tasTable[defaultTAS] = CompiledTAS(threshold[defaultTAS], media[defaultTAS], mediaIndex, medIdx);
+	for (QMap <int, int>::const_iterator it = structToTas.constBegin(); it != structToTas.constEnd(); ++it)
+		tasTable[it.value()] = CompiledTAS(threshold[it.value()], media[it.value()], mediaIndex, medIdx);
+	
+	// Then the media of every voxel, from its density and the TAS of the first
+	// (highest priority) structure holding it, each slice being final once it is done
+	if (writer && writer->begin(phant))
+		writer = 0; // Can't open it, so it is saved the usual way once built
+	emit newProgressName("Building media arrays");
+	finished = runSlices(phant->nz, 5.0, [&](int k) { // Z // 5%
+		const QVector <QBitArray> &sets = sliceSets.at(k);
+		QVector <const CompiledTAS*> labelTAS(sets.size()+1, &tasTable.at(defaultTAS)); // Default tissue assignment scheme
+		for (int label = 0; label < sets.size(); label++)
+			for (int l = 0; l < contourNum; l++)
+				if (sets[label].testBit(structIndex->at(l))) {
+					// Change TAS if it is assigned to the structure
+					if (structToTas.contains(structIndex->at(l)))
+						labelTAS[label+1] = &tasTable.at(structToTas.value(structIndex->at(l)));
+					break;
+				}
+		
+		QVector <int> &medCount = sliceMedVol[k];
+		medCount.fill(0, phant->media.size());
+		const unsigned short *label = labels+phant->nx*phant->ny*k;
+		int n;
+		
+		for (int j = 0; j < phant->ny; j++) { // Y //
+			for (int i = 0; i < phant->nx; i++) { // X //
+				const CompiledTAS &tas = *labelTAS[label[i+phant->nx*j]];
+				
 				// Find the right media in the right TAS
-				for (n = 0; n < threshold[q].size()-1; n++)
-					if (temp < threshold[q][n])
-						break;
+				n = tas.band(phant->d.at(i,j,k));
 				
 				// Assign that media
-				phant->m[i][j][k] = mediaIndex[media[q][n]].toLatin1();
+				phant->m[i][j][k] = tas.code[n];
 				
 				// Count media volume
-				medVol[media[q][n]]++;
+				medCount[tas.medium[n]]++;
 			}
 		}
-		*log = *log + QString::number(zMid) + " ";
+		
+		if (writer)
+			writer->addSlice(phant, k);
+	});
+	if (!finished)
+		return 300;
+	
+	// Swap the slice labels for ones in the mask, giving out new labels in the same
+	// order as filling the slices one after the other would
+	*log = *log + "Added slices z midpoints:\n\n";
+	for (int k = 0; k < phant->nz; k++) {
+		QVector <unsigned short> global(sliceSets[k].size()+1, 0);
+		for (int l = 0; l < sliceSets[k].size(); l++) {
+			int g = mask->addLabel(sliceSets[k][l]);
+			if (g < 0)
+				return 210;
+			global[l+1] = g;
+		}
+		
+		if (sliceSets[k].size())
+			for (int v = phant->nx*phant->ny*k; v < phant->nx*phant->ny*(k+1); v++)
+				mask->label[v] = global[labels[v]];
+		
+		const QVector <QHash <int, unsigned char> > &partial = buildCache.slicePartial[k];
+		for (int s = 0; s < partial.size(); s++)
+			mask->partial[s].unite(partial[s]);
+		
+		for (int s = 0; s < structName.size(); s++)
+			structVol[structName[s]] += sliceStructVol[k][s];
+		for (int m = 0; m < phant->media.size(); m++)
+			medVol[phant->media[m]] += sliceMedVol[k][m];
+		
+		*log = *log + QString::number((phant->z[k]+phant->z[k+1])/2.0) + " ";
 	}
 	
 	// Reverse y-axis - keep image "flipped" and just change the preview images to match to invert y
@@ -1049,6 +1763,7 @@ int Data::buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defau
 	//	emit madeProgress(increment);
 	//}	
 	
+	phant->clearPicCache(); // In case it was drawn while building
 	*log = *log + "\n\nEGSPhant building is complete\n";
 	
 	#if defined(DEBUG_BUILDEGSPHANT)
@@ -1079,14 +1794,45 @@ double Data::interp(double x, double x1, double x2, double y1, double y2) {
 	return (y2*(x-x1)+y1*(x2-x))/(x2-x1);
 }
 
+// The slices are worked on by the thread pool, while a local event loop adds up
+// their progress and keeps the GUI (and its cancel button) responsive
+bool Data::runSlices(int n, double percent, std::function<void(int)> work) {
+	QVector <int> slices(n);
+	for (int k = 0; k < n; k++)
+		slices[k] = k;
+	
+	QFutureWatcher <void> watcher;
+	QEventLoop loop;
+	double increment = n ? percent/n : 0;
+	int done = 0;
+	
+	connect(&watcher, &QFutureWatcherBase::progressValueChanged, this, [&](int value) {
+		emit madeProgress(increment*(value-done));
+		done = value;
+	});
+	connect(&watcher, &QFutureWatcherBase::finished, &loop, &QEventLoop::quit);
+	
+	watcher.setFuture(QtConcurrent::map(slices, [&](int k) {
+		if (!cancelled.load()) // Skip whatever is left once cancelled
+			work(k);
+	}));
+	if (!watcher.isFinished())
+		loop.exec();
+	
+	return !cancelled.load();
+}
+
+void Data::cancelProgress() {
+	cancelled.store(1);
+}
+
 int Data::parsePlan(QString* log) {
 	// This will hold and eventually return errors/information\n
 	*log = "";
 	
 	// Needed variables for parsing the data
-	QVector <Attribute *> *att, *att2, *att3;
-	QByteArray tempData, tempData2, tempData3;
-	QStringList pointData2;
+	QVector <Attribute *> *att, *att2, *att3; // Items are already parsed by DICOM::parse
+	QVector <double> values; // Scratch space for reading DS fields
 	QString treatDate = "", kermaDate = "";
 	QString treatTime = "", kermaTime = "";
 	
@@ -1095,6 +1841,7 @@ int Data::parsePlan(QString* log) {
 	treatmentTechnique = "UNKNOWN";
 	isotopeName = "UNKNOWN";
 	seedPos.clear();
+	seedTransform = ""; // Not saved yet
 	seedTime.clear();
 	seedInfo = "UNKNOWN";
 	airKerma = halfLife = -1;
@@ -1162,11 +1909,8 @@ int Data::parsePlan(QString* log) {
 	tempAtt = plan_data->getEntry(0x300A, 0x0210); // Get att closest to (300A,0210)
 	if (tempAtt->tag[0] == 0x300A && tempAtt->tag[1] == 0x0210) {
 		for (int k = 0; k < tempAtt->seq.items.size(); k++) {
-			tempData = QByteArray((char *)tempAtt->seq.items[k]->vf,tempAtt->seq.items[k]->vl);
-			QDataStream dataStream(tempData);
-
-			att = new QVector <Attribute *>;
-			if (!plan_data->parseSequence(&dataStream, att)) {
+			att = &tempAtt->seq.items[k]->att;
+			if (att->isEmpty()) {
 				return 103;
 			}
 
@@ -1225,11 +1969,6 @@ int Data::parsePlan(QString* log) {
 				kermaDate = tempD.trimmed();
 			if (kermaTime == "" && tempT != "")
 				kermaTime = tempT.trimmed();
-
-			for (int l = 0; l < att->size(); l++) {
-				delete att->at(l);
-			}
-			delete att;
 		}
 	}
 	
@@ -1302,23 +2041,17 @@ int Data::parsePlan(QString* log) {
 	tempAtt = plan_data->getEntry(0x300A, 0x0230); // Get att closest to (300A,0230)
 	if (tempAtt->tag[0] == 0x300A && tempAtt->tag[1] == 0x0230) {
 		for (int k = 0; k < tempAtt->seq.items.size(); k++) {
-			tempData = QByteArray((char*)tempAtt->seq.items[k]->vf, tempAtt->seq.items[k]->vl);
-			QDataStream dataStream(tempData);
-
-			att = new QVector <Attribute *>;
-			if (!plan_data->parseSequence(&dataStream, att)) {
+			att = &tempAtt->seq.items[k]->att;
+			if (att->isEmpty()) {
 				return 301;
 			}
 
-			QString tempS = ""; // Get the channel, it's another nested sequence, so we must go deeper with parseSequence
+			// Get the channel, it's another nested sequence
 			for (int l = 0; l < att->size(); l++) {
 				if (att->at(l)->tag[0] == 0x300A && att->at(l)->tag[1] == 0x0280) {
 					for (int k = 0; k < att->at(l)->seq.items.size(); k++) {
-						tempData2 = QByteArray((char*)att->at(l)->seq.items[k]->vf, att->at(l)->seq.items[k]->vl);
-						QDataStream dataStream2(tempData2);
-
-						att2 = new QVector <Attribute *>;
-						if (!plan_data->parseSequence(&dataStream2, att2)) {
+						att2 = &att->at(l)->seq.items[k]->att;
+						if (att2->isEmpty()) {
 							return 302;
 						}
 						
@@ -1326,7 +2059,7 @@ int Data::parsePlan(QString* log) {
 						// Average all the control points 3D positions and get cumulative time
 						// and fill dwell time and position as we go
 						
-						QString tempS = ""; // Get the brachy sequence, it's another nested sequence, so we must go deeper with parseSequence
+						// Get the brachy sequence, it's another nested sequence
 						for (int m = 0; m < att2->size(); m++) {
 							if (att2->at(m)->tag[0] == 0x300A && att2->at(m)->tag[1] == 0x02D0) { // Control sequence
 								tempDwellTimes.clear();
@@ -1334,44 +2067,27 @@ int Data::parsePlan(QString* log) {
 								tempTotalDwellTime = 0;
 					
 								for (int k2 = 0; k2 < att2->at(m)->seq.items.size(); k2++) {
-									tempData3 = QByteArray((char*)att2->at(m)->seq.items[k2]->vf, att2->at(m)->seq.items[k2]->vl);
-									QDataStream dataStream3(tempData3);
-
-									att3 = new QVector <Attribute *>;
-									if (!plan_data->parseSequence(&dataStream3, att3)) {
+									att3 = &att2->at(m)->seq.items[k2]->att;
+									if (att3->isEmpty()) {
 										return 303;
 									}
 
-									QString tempS = "";
-									QString tempT = "";
 									for (int n = 0; n < att3->size(); n++) {
 										if (att3->at(n)->tag[0] == 0x300A && att3->at(n)->tag[1] == 0x02D4) { // Seed position
-											for (unsigned int s = 0; s < att3->at(n)->vl; s++) {
-												tempS.append(att3->at(n)->vf[s]);
-											}
-
-											pointData2 = tempS.split('\\');
+											int count = att3->at(n)->readDS(&values);
 											
-											for (int p = 0; p < pointData2.size(); p+=3) {
-												tempPositions.append(QVector3D(pointData2[p].toDouble()/10.0,
-																			   pointData2[p+1].toDouble()/10.0,
-																			   pointData2[p+2].toDouble()/10.0));
+											for (int p = 0; p+2 < count; p+=3) {
+												tempPositions.append(QVector3D(values[p]/10.0,
+																			   values[p+1]/10.0,
+																			   values[p+2]/10.0));
 											}
 										}
 										else if (att3->at(n)->tag[0] == 0x300A && att3->at(n)->tag[1] == 0x02D6) { // Seed time weight
-
-											for (unsigned int s = 0; s < att3->at(n)->vl; s++) {
-												tempT.append(att3->at(n)->vf[s]);
-											}
-
-											tempDwellTimes.append(tempT.toDouble());
-											tempTotalDwellTime += tempT.toDouble();
+											double weight = att3->at(n)->readDS(&values) ? values[0] : 0;
+											tempDwellTimes.append(weight);
+											tempTotalDwellTime += weight;
 										}
 									}
-									for (int n = 0; n < att3->size(); n++) {
-										delete att3->at(n);
-									}
-									delete att3;
 								}
 							}
 						}
@@ -1400,10 +2116,6 @@ int Data::parsePlan(QString* log) {
 							treatmentTime += tempTotalDwellTime;
 						}
 						
-						for (int n = 0; n < att2->size(); n++) {
-							delete att2->at(n);
-						}
-						delete att2;
 					}
 				}
 			}
@@ -41,11 +41,32 @@
 
 #include <QtGui>
 #include <sstream>
+#include <functional>
 
 #include "data/DICOM.h"
+#include "data/dicomindex.h"
 #include "data/egsphant.h"
+#include "data/egsmask.h"
+#include "data/egsphantstats.h"
 #include "data/input.h"
 #include "data/dose.h"
+#include "data/egsphantwriter.h"
+
+// The results of the stages of the last egsphant build, each stored with a hash of
+// the inputs to its stage, so that a rebuild only redoes the stages that changed
+struct BuildCache {
+	QByteArray huKey, densityKey, marKey, structKey;
+	
+	QVector <short int> HU; // Contiguous, slice by slice
+	Volume <double> density; // Before MAR
+	double maxDensity;
+	QBitArray marVoxels; // Voxels within reach of a seed
+	QString marLog; // What was logged finding them
+	QVector <unsigned short> labels; // Per slice labels, indices+1 into sliceSets
+	QVector <QVector <QBitArray> > sliceSets; // Structure sets of each slice's labels
+	QVector <QVector <int> > sliceStructVol; // Voxel count of each structure per slice
+	QVector <QVector <QHash <int, unsigned char> > > slicePartial; // Partial volumes of each structure per slice
+};
 
 // This class holds all the back-end data available to the interface
 // and holds many of the backend members for data manipulation
@@ -117,6 +138,9 @@ public:
 	int marContourInd;
 	QString marContour, transformFile;
 	
+	// partial volume structure masks, the sub-rows sampled per voxel (1 for voxel centres only)
+	int partialSamples = 1;
+	
 	// metric extraction (name, prescription, Dx (%), Dx (cc), Vx (%))
 	QStringList metricNames, metricDp, metricDx, metricDcc, metricVx;
 	
@@ -155,16 +179,23 @@ public:
 
 	double treatmentTime, longestTime; // Total treatment time, longest seed time
 	QVector <QVector3D> seedPos; // Transformation file
+	QString seedTransform; // Name of the transformation file seedPos was saved as
 	QVector <double> seedTime; // All dwell times
 	
 public:
-	// Build egsphant
+	// Build egsphant, handing its slices to writer as they are finished if there is one
 	int buildEgsphant(EGSPhant* phant, QString* log, int contourNum, int defaultTAS,
 					  QVector <int>* structIndex, QVector <int>* tasIndex,
-					  QVector <EGSPhant*>* makeMasks, double buffer = -1);
+					  EGSMask* mask, double buffer = -1, EGSPhantWriter* writer = 0);
 	
 	double interp(double x, double x1, double x2, double y1, double y2);
 	
+	// Run work on every index 0..n-1 (slices, structs) on the thread pool, false if it was cancelled
+	bool runSlices(int n, double percent, std::function<void(int)> work);
+	QAtomicInt cancelled; // Set by cancelProgress, checked by long running jobs
+	BuildCache buildCache; // Stages of the last buildEgsphant
+	void clearBuildCache(); // Release it, whenever the CT or contours change
+	
 	// Parse plan file
 	int parsePlan(QString* log);
 	
@@ -177,5 +208,9 @@ signals:
 	void madeProgress(double percent);
 	void completedProgress();
 	void newProgressName(QString text);
+	void cancellable(bool allowed); // Whether the current job can be cancelled
+	
+public slots:
+	void cancelProgress();
 };
 #endif
@@ -37,6 +37,8 @@
 ################################################################################
 */
 #include "DICOM.h"
+#include <algorithm>
+#include <zlib.h>
 
 #define ALLOW_LOOSE_CUSTOM_TAGS true // This essentially allows to code to parse any tag
 									 // with a size of 0xFFFFFFFF (max) as a SQ, which
@@ -51,25 +53,72 @@
 
 Attribute::Attribute() {
     vf = NULL; // This stops seg faults when calling the destructor below
+	owned = true;
 }
 
 Attribute::~Attribute() {
-    if (vf != NULL) {
+    if (vf != NULL && owned) {
         delete[] vf;
     }
 }
 
-SequenceItem::SequenceItem(unsigned long int size, unsigned char *data) {
+int Attribute::readDS(QVector <double> *values) const {
+	const char *pos = (const char*)vf, *end = pos+(vf == NULL ? 0 : vl);
+	
+	// One more value than there are backslashes
+	int n = vl ? 1 : 0;
+	for (const char *c = pos; c < end; c++)
+		if (*c == '\\')
+			n++;
+	values->resize(n);
+	
+	double *out = values->data();
+	char token[32]; // DS values are at most 16 characters and IS 12, so this holds any valid one
+	for (int i = 0; i < n; i++) {
+		// Copy the token out without its padding, too long to be a number is garbage
+		int len = 0;
+		while (pos < end && *pos != '\\') {
+			if (*pos != ' ' && *pos != '\0' && len < int(sizeof(token)))
+				token[len++] = *pos;
+			pos++;
+		}
+		pos++;
+		
+		// Always a . for the decimal point, unlike strtod, and 0 on garbage
+		out[i] = len < int(sizeof(token)) ? QByteArray::fromRawData(token, len).toDouble() : 0;
+	}
+	
+	return n;
+}
+
+SequenceItem::SequenceItem(unsigned long int size, unsigned char *data, bool own) {
     vl = size;
     vf = data;
+	owned = own;
 }
 
 SequenceItem::~SequenceItem() {
-    if (vf != NULL) {
+	for (int i = 0; i < att.size(); i++) {
+		delete att[i];
+	}
+	att.clear();
+	
+    if (vf != NULL && owned) {
 		delete[] vf;
     }
 }
 
+Attribute* SequenceItem::getEntry(unsigned short int one, unsigned short int two) {
+	for (int i = 0; i < att.size(); i++)
+		if (att[i]->tag[0] == one && att[i]->tag[1] == two)
+			return att[i];
+	return NULL;
+}
+
+QVector <Attribute*> SequenceItem::getPath(QString path) {
+	return DICOM::findPath(&att, path);
+}
+
 Sequence::~Sequence() {
     for (int i = 0; i < items.size(); i++) {
         delete items[i];
@@ -80,10 +129,24 @@ Sequence::~Sequence() {
 DICOM::DICOM(database *l) {
     lib = l;
     isImplicit = isBigEndian = false;
+	isDeflated = isRLE = false;
+	mapFile = NULL;
+	headerOnly = false;
+	pixelOffset = -1;
+	pixelLength = 0;
+	missing.tag[0] = missing.tag[1] = 0;
+	missing.vl = 0;
 }
 
 DICOM::DICOM() {
     isImplicit = isBigEndian = false;
+	isDeflated = isRLE = false;
+	mapFile = NULL;
+	headerOnly = false;
+	pixelOffset = -1;
+	pixelLength = 0;
+	missing.tag[0] = missing.tag[1] = 0;
+	missing.vl = 0;
 }
 
 DICOM::~DICOM() {
@@ -91,15 +154,38 @@ DICOM::~DICOM() {
         delete data[i];
     }
     data.clear();
+	
+	delete mapFile; // Unmaps the file, after everything pointing into it is gone
 }
 
-int DICOM::parse(QString p) {
+int DICOM::parse(QString p, bool header) {
 	path = p;
-    QFile file(path);
+	headerOnly = header;
+	pixelOffset = -1;
+	isDeflated = isRLE = false;
+	delete mapFile;
+	mapFile = new QFile(path);
+	QFile &file = *mapFile;
     int k = 0, l = 0;
     if (file.open(QIODevice::ReadOnly)) {
         unsigned char *dat;
-        QDataStream in(&file);
+		
+		// Map the whole file (or read it in one go if that fails), the file
+		// itself can be closed once it is mapped
+		qint64 fileSize = file.size();
+		unsigned char *map = file.map(0, fileSize);
+		if (map == NULL) {
+			fileData = file.readAll();
+			map = (unsigned char*)fileData.data();
+		}
+		file.close();
+		
+		// Read through a buffer we hold on to, so it can be switched over to the
+		// inflated data set for the Deflated transfer syntax
+		QBuffer buffer;
+		buffer.setData(QByteArray::fromRawData((char*)map, fileSize));
+		buffer.open(QIODevice::ReadOnly);
+        QDataStream in(&buffer);
         in.setByteOrder(QDataStream::LittleEndian);
 
         /*============================================================================*/
@@ -137,6 +223,26 @@ int DICOM::parse(QString p) {
         QString VR;
         bool nested, readVR;
         while (!in.atEnd()) {
+			// Everything after the file meta information (group 0002) is deflated, so
+			// inflate the rest and carry on reading from that
+			if (isDeflated && inflatedData.isEmpty()) {
+				qint64 pos = buffer.pos();
+				if (pos+2 <= fileSize && (map[pos] | (map[pos+1] << 8)) != 0x0002) {
+					if (inflateRaw(map+pos, fileSize-pos, &inflatedData)) {
+						return 105;
+					}
+					
+					map = (unsigned char*)inflatedData.data();
+					fileSize = inflatedData.size();
+					buffer.close();
+					buffer.setData(QByteArray::fromRawData((char*)map, fileSize));
+					buffer.open(QIODevice::ReadOnly);
+					headerOnly = false; // Can't read the pixels back from the file later
+					if (in.atEnd())
+						break;
+				}
+			}
+			
             temp = new Attribute();
 			nested = readVR = false; // reset flags
 
@@ -179,10 +285,10 @@ int DICOM::parse(QString p) {
 			}
 			
 			// Find the closest tag in the database
-			Reference closest = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1);
+			const Reference *closest = lib->binSearch(temp->tag[0], temp->tag[1]);
             QString tempVR = QString(dat[0])+dat[1];
-			if (closest.tag[0] == temp->tag[0] && closest.tag[1] == temp->tag[1]) { // Found the tag
-                temp->desc = closest.title;
+			if (closest->tag[0] == temp->tag[0] && closest->tag[1] == temp->tag[1]) { // Found the tag
+                temp->desc = closest->title;
                 l++;
             }
             else { // Didn't find the tag
@@ -241,7 +347,7 @@ int DICOM::parse(QString p) {
 					#endif
 				}
 				else {
-					VR = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1).vr;
+					VR = lib->binSearch(temp->tag[0], temp->tag[1])->vr;
 					
 					#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
 						std::cout << VR.toStdString() << " (implicit) | Size ";
@@ -249,7 +355,7 @@ int DICOM::parse(QString p) {
 				}
 			} // We are using implicit VR, so all 4 bytes define size
             else {				
-                VR = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1).vr;
+                VR = lib->binSearch(temp->tag[0], temp->tag[1])->vr;
 				#if defined(OUTPUT_ALL) || defined(OUTPUT_TAG)
 					std::cout << VR.toStdString() << " (implicit) | Size ";
 				#endif
@@ -288,43 +394,53 @@ int DICOM::parse(QString p) {
                 std::cout << temp->desc.toStdString() << ": ";
 			#endif
 
+			// Encapsulated (compressed) pixel data, its fragments are stored like sequence items
+			if (temp->tag[0] == 0x7FE0 && temp->tag[1] == 0x0010 && temp->vl == (unsigned int)0xFFFFFFFF) {
+				if (headerOnly) { // Assume the fragments run to the end of the file
+					size = temp->vl = fileSize-in.device()->pos();
+					pixelLength = size;
+				}
+				else {
+					nested = true;
+					if (!readSequence(&in, temp, map)) {
+						return 210;
+					}
+				}
+			}
 			// We have a sequence, just lump all the subsequence data into vf for later parsing
-			if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
+			else if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
 				nested = true;
-				if (!readSequence(&in, temp)) {
+				if (!readSequence(&in, temp, map)) {
 					return 208;
 				}
 			}
 			else if (!VR.compare("SQ")) {
 				nested = true;
-				if (!readDefinedSequence(&in, temp, temp->vl)) {
+				if (!readDefinedSequence(&in, temp, temp->vl, map)) {
 					return 209;
 				}
 			}
 			
-			// We don't have a sequence, fill vf with actual data
+			// We don't have a sequence, point vf at the data in the mapped file
             if (!nested) {
-                temp->vf = new unsigned char[size];
-                if (size > 0 && size < (unsigned long int)INT_MAX) {
-                    if (in.readRawData((char*)temp->vf,size) != (long int)size) {
-                        // Not a DICOM file
-                        file.close();
-                        return 301;
-                    }
-                }
-                else if (size > 0) { // In case we need to read in more data
-                    // then the buffer can handle
-                    unsigned char *pt = temp->vf;
-                    for (int i = 0; (unsigned long int)i <
-                            size/((unsigned long int)INT_MAX); i++) {
-                        if (in.readRawData((char*)pt,INT_MAX) != INT_MAX) {
-                            // Not a DICOM file
-                            file.close();
-                            return 302;
-                        }
-                        pt += sizeof(char)*INT_MAX;
-                    }
-                }
+				qint64 pos = in.device()->pos();
+				if (pos+(qint64)size > fileSize) {
+                    // Not a DICOM file
+                    return 301;
+				}
+				// Leave the pixels in the file for now, loadPixelData fetches them
+				if (headerOnly && temp->tag[0] == 0x7FE0 && temp->tag[1] == 0x0010) {
+					pixelOffset = pos;
+					pixelLength = size;
+					temp->owned = false;
+					
+					data.append(temp);
+					break;
+				}
+				
+				temp->vf = map+pos;
+				temp->owned = false;
+				in.device()->seek(pos+size);
 
 				#ifdef OUTPUT_ALL
                     unsigned long int avoidWarning =
@@ -424,7 +540,8 @@ int DICOM::parse(QString p) {
 
                 // Save proper transfer syntax for farther parsing
                 if (temp->tag[0] == 0x0002 && temp->tag[1] == 0x0010) {
-                    QString TransSyntax((char*)temp->vf);
+					// vf is not null terminated, so strip the padding off explicitly
+                    QString TransSyntax = QString::fromLatin1((char*)temp->vf, temp->vl).remove(QChar('\0')).trimmed();
                     if (!TransSyntax.compare("1.2.840.10008.1.2.1")) {
                         isImplicit = false;
                         isBigEndian = false;
@@ -437,6 +554,16 @@ int DICOM::parse(QString p) {
                         isImplicit = true;
                         isBigEndian = false;
                     }
+                    else if (!TransSyntax.compare("1.2.840.10008.1.2.1.99")) { // Deflated
+                        isImplicit = false;
+                        isBigEndian = false;
+                        isDeflated = true;
+                    }
+                    else if (!TransSyntax.compare("1.2.840.10008.1.2.5")) { // RLE Lossless
+                        isImplicit = false;
+                        isBigEndian = false;
+                        isRLE = true;
+                    }
                     else {
                         std::cout << "Unknown transfer syntax, assuming explicit and little endian\n";
                         isImplicit = false;
@@ -463,13 +590,10 @@ int DICOM::parse(QString p) {
 				//	
 				//	z = tempS.toDouble();
 				//}
-				if (temp->tag[0] == 0x0020 && temp->tag[1] == 0x0032) {
-					QString tempS = "";
-					for (unsigned int s = 0; s < temp->vl; s++) { // Image Position Patient
-						tempS.append(temp->vf[s]);
-					}
-
-					z = tempS.split("\\").last().toDouble();
+				if (temp->tag[0] == 0x0020 && temp->tag[1] == 0x0032) { // Image Position Patient
+					QVector <double> pos;
+					if (temp->readDS(&pos))
+						z = pos.last();
 				}
             }
             else if (nested) {
@@ -490,21 +614,215 @@ int DICOM::parse(QString p) {
                 #endif
             }
 			
-			// Insert temp into the proper sorted index
-			int i = 0;
-			if (data.size())
-				i = binSearch(temp->tag[0],temp->tag[1],0,data.size()-1);
-			data.insert(i,temp);			
+			// Elements should already come in tag order, sortAttributes fixes it otherwise
+			data.append(temp);
             /*============================================================================*/
             /*REPEAT UNTIL EOF============================================================*/
         }
+		sortAttributes(&data);
+		
+		// Only hold on to the header, everything read so far is moved into a copy
+		// of it and the mapping is dropped
+		if (headerOnly) {
+			qint64 headerSize = pixelOffset < 0 ? fileSize : pixelOffset;
+			QByteArray headerData((char*)map, headerSize);
+			unsigned char *copy = (unsigned char*)headerData.data();
+			
+			for (int i = 0; i < data.size(); i++) {
+				if (data[i]->vf >= map && data[i]->vf < map+headerSize)
+					data[i]->vf = copy+(data[i]->vf-map);
+				for (int j = 0; j < data[i]->seq.items.size(); j++) {
+					SequenceItem *item = data[i]->seq.items[j];
+					if (item->vf >= map && item->vf < map+headerSize)
+						item->vf = copy+(item->vf-map);
+				}
+			}
+			
+			fileData = headerData;
+			delete mapFile;
+			mapFile = NULL;
+		}
+		
+		// Decompress the pixel data now unless it was left in the file
+		if (isRLE && !headerOnly && getEntry(0x7FE0, 0x0010)->seq.items.size()) {
+			if (decodeRLE()) {
+				return 211;
+			}
+		}
+		
+		// Parse the items of every sequence down to the bottom, they keep pointing
+		// into the same buffer as the top level attributes
+		for (int i = 0; i < data.size(); i++)
+			parseItems(data[i]);
+		
         file.close();
         return 0; // success
     }
     return 501;
 }
 
-int DICOM::readSequence(QDataStream *in, Attribute *att) {
+int DICOM::loadPixelData() {
+	if (!headerOnly)
+		return 0; // Already there
+	
+	if (pixelOffset < 0)
+		return 601; // No Pixel Data in this file
+	
+	Attribute *pixels = getEntry(0x7FE0, 0x0010);
+	if (pixels->vf != NULL)
+		return 0; // Already loaded
+	
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return 602;
+	
+	if (!file.seek(pixelOffset)) {
+		file.close();
+		return 603;
+	}
+	
+	pixelData = file.read(pixelLength);
+	file.close();
+	if ((unsigned long int)pixelData.size() != pixelLength) {
+		pixelData.clear();
+		return 604;
+	}
+	
+	pixels->vf = (unsigned char*)pixelData.data();
+	pixels->vl = pixelLength;
+	
+	// Split the compressed data into its fragments and decode them
+	if (isRLE) {
+		QDataStream in(QByteArray::fromRawData((char*)pixels->vf, pixels->vl));
+		if (!readSequence(&in, pixels, pixels->vf)) {
+			releasePixelData();
+			return 605;
+		}
+		
+		int err = decodeRLE();
+		if (err) {
+			releasePixelData();
+			return err;
+		}
+	}
+	
+	return 0;
+}
+
+void DICOM::releasePixelData() {
+	if (!headerOnly || pixelOffset < 0)
+		return;
+	
+	Attribute *pixels = getEntry(0x7FE0, 0x0010);
+	for (int i = 0; i < pixels->seq.items.size(); i++)
+		delete pixels->seq.items[i];
+	pixels->seq.items.clear();
+	pixels->vf = NULL;
+	pixelData.clear();
+}
+
+// Inflate raw deflate data (no zlib header), as used by the Deflated transfer syntax
+int DICOM::inflateRaw(const unsigned char *in, qint64 size, QByteArray *out) {
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
+	if (inflateInit2(&strm, -MAX_WBITS) != Z_OK)
+		return 1;
+	
+	strm.next_in = (Bytef*)in;
+	strm.avail_in = size;
+	out->resize(qMax(size*4, (qint64)4096));
+	
+	qint64 total = 0;
+	int ret;
+	do {
+		if (total == out->size()) // Out of room, double it
+			out->resize(out->size()*2);
+		strm.next_out = (Bytef*)out->data()+total;
+		strm.avail_out = out->size()-total;
+		ret = inflate(&strm, Z_NO_FLUSH);
+		total = out->size()-strm.avail_out;
+	} while (ret == Z_OK);
+	
+	inflateEnd(&strm);
+	out->resize(total);
+	return ret == Z_STREAM_END ? 0 : 1;
+}
+
+// Decode RLE Lossless pixel data (PS3.5 Annex G) into plain little endian pixels,
+// assuming a single frame as with CT slices; the fragments are dropped afterwards
+int DICOM::decodeRLE() {
+	Attribute *pixels = getEntry(0x7FE0, 0x0010);
+	if (pixels->seq.items.size() < 2) // Basic offset table and at least one fragment
+		return 701;
+	
+	// Fetch the image size from the header
+	unsigned int dim[4] = {0, 0, 0, 0};
+	unsigned short int tags[4] = {0x0010, 0x0011, 0x0100, 0x0002}; // Rows, Columns, Bits Allocated, Samples per Pixel
+	for (int i = 0; i < 4; i++) {
+		Attribute *att = getEntry(0x0028, tags[i]);
+		if (att->tag[0] == 0x0028 && att->tag[1] == tags[i] && att->vl >= 2)
+			dim[i] = (unsigned int)att->vf[0] + ((unsigned int)att->vf[1] << 8);
+	}
+	if (!dim[3])
+		dim[3] = 1;
+	
+	unsigned int bytes = dim[2]/8, samples = dim[3];
+	qint64 count = qint64(dim[0])*dim[1];
+	if (!count || !bytes || samples != 1)
+		return 702; // Only greyscale, as is the case for CT
+	
+	// A frame may be split over several fragments
+	QByteArray frame;
+	for (int i = 1; i < pixels->seq.items.size(); i++)
+		frame.append((char*)pixels->seq.items[i]->vf, pixels->seq.items[i]->vl);
+	const unsigned char *rle = (const unsigned char*)frame.constData();
+	if (frame.size() < 64)
+		return 703;
+	
+	// The header has the segment count and up to 15 offsets, one segment per byte
+	// of each sample, going from most to least significant
+	unsigned int header[16];
+	for (int i = 0; i < 16; i++)
+		header[i] = rle[4*i] + (rle[4*i+1] << 8) + (rle[4*i+2] << 16) + ((unsigned int)rle[4*i+3] << 24);
+	if (header[0] != bytes || header[0] > 15)
+		return 704;
+	
+	QByteArray decoded(count*bytes, 0);
+	unsigned char *out = (unsigned char*)decoded.data();
+	for (unsigned int seg = 0; seg < header[0]; seg++) {
+		qint64 pos = header[seg+1], end = seg+1 < header[0] ? header[seg+2] : frame.size();
+		if (pos > end || end > frame.size())
+			return 705;
+		
+		// PackBits, n >= 0 copies the next n+1 bytes and n < 0 repeats the next byte 1-n times
+		unsigned char *o = out+(bytes-1-seg);
+		qint64 i = 0;
+		while (pos < end && i < count) {
+			int n = (signed char)rle[pos++];
+			if (n >= 0) {
+				for (int j = 0; j <= n && pos < end && i < count; j++, i++)
+					o[i*bytes] = rle[pos++];
+			}
+			else if (n != -128 && pos < end) {
+				for (int j = 0; j <= -n && i < count; j++, i++)
+					o[i*bytes] = rle[pos];
+				pos++;
+			}
+		}
+	}
+	
+	for (int i = 0; i < pixels->seq.items.size(); i++)
+		delete pixels->seq.items[i];
+	pixels->seq.items.clear();
+	
+	pixelData = decoded;
+	pixels->vf = (unsigned char*)pixelData.data();
+	pixels->vl = pixelData.size();
+	pixels->owned = false;
+	return 0;
+}
+
+int DICOM::readSequence(QDataStream *in, Attribute *att, unsigned char *base) {
     bool flag = true;
 	int depth = 0;
     unsigned int *tag, size;
@@ -527,6 +845,18 @@ int DICOM::readSequence(QDataStream *in, Attribute *att) {
         }
         else if (size != (unsigned int)0xFFFFFFFF) {
             // sequence item with defined size
+			if (base != NULL) { // Point into the mapped file
+				qint64 pos = in->device()->pos();
+				if (pos+(qint64)size > in->device()->size()) {
+					// Not a DICOM file
+					delete tag;
+					return 0;
+				}
+				in->device()->seek(pos+size);
+				att->seq.items.append(new SequenceItem(size, base+pos, false));
+				delete tag;
+				continue;
+			}
             dat = new unsigned char[size];
 			
 			#if defined(OUTPUT_PARSE_SQ)
@@ -552,6 +882,7 @@ int DICOM::readSequence(QDataStream *in, Attribute *att) {
         else if (size == (unsigned int)0xFFFFFFFF) {
             // sequence item with undefined size
             QByteArray buffer;
+			qint64 start = in->device()->pos();
 			depth = 0;
             dat = new unsigned char[1];
 			
@@ -587,11 +918,11 @@ int DICOM::readSequence(QDataStream *in, Attribute *att) {
 						unsigned short int tag[2];
 						tag[0] = *(unsigned short int*)(buffer.right(8).left(2).data());
 						tag[1] = *(unsigned short int*)(buffer.right(6).left(2).data());
-						Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
+						const Reference *nearest = lib->binSearch(tag[0], tag[1]);
 						
 						// We found an actual tag here, check if the implicit VR is SQ
-						if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1]) {
-							if (!nearest.vr.compare("SQ")) {
+						if (nearest->tag[0] == tag[0] && nearest->tag[1] == tag[1]) {
+							if (!qstrcmp(nearest->vr, "SQ")) {
 								depth++; // Increase depth to skip delimiters until we exit subsequence								
 								
 								#if defined(OUTPUT_PARSE_SQ)
@@ -625,11 +956,16 @@ int DICOM::readSequence(QDataStream *in, Attribute *att) {
                         return 0;
                     }
                     delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
+					if (base != NULL) { // The item is contiguous in the mapped file
+						att->seq.items.append(new SequenceItem(buffer.size(), base+start, false));
+					}
+					else {
+						dat = new unsigned char[buffer.size()];
+						for (int i = 0; i < buffer.size(); i++) {
+							dat[i] = buffer[i];
+						}
+						att->seq.items.append(new SequenceItem(buffer.size(),dat));
+					}
 					
 					#if defined(OUTPUT_PARSE_SQ)
 						std::cout << "\tSequence successfully parsed and stored\n";
@@ -652,7 +988,7 @@ int DICOM::readSequence(QDataStream *in, Attribute *att) {
     return 1;
 }
 
-int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n) {
+int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n, unsigned char *base) {
 	int depth = 0;
     unsigned int *tag, size;
     unsigned char *dat;
@@ -672,6 +1008,19 @@ int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long in
 
         if (size != (unsigned int)0xFFFFFFFF) {
             // sequence item with defined size
+			if (base != NULL) { // Point into the mapped file
+				qint64 pos = in->device()->pos();
+				if (pos+(qint64)size > in->device()->size()) {
+					// Not a DICOM file
+					delete tag;
+					return 0;
+				}
+				in->device()->seek(pos+size);
+				att->seq.items.append(new SequenceItem(size, base+pos, false));
+				n-=size;
+				delete tag;
+				continue;
+			}
             dat = new unsigned char[size];
 			
 			#if defined(OUTPUT_PARSE_SQ)
@@ -690,6 +1039,7 @@ int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long in
         else if (size == (unsigned int)0xFFFFFFFF) {
             // sequence item with undefined size
             QByteArray buffer;
+			qint64 start = in->device()->pos();
             dat = new unsigned char[1];
 			
 			#if defined(OUTPUT_PARSE_SQ)
@@ -724,11 +1074,11 @@ int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long in
 						unsigned short int tag[2];
 						tag[0] = *(unsigned short int*)(buffer.right(8).left(2).data());
 						tag[1] = *(unsigned short int*)(buffer.right(6).left(2).data());
-						Reference nearest = lib->binSearch(tag[0], tag[1], 0, lib->lib.size()-1);
+						const Reference *nearest = lib->binSearch(tag[0], tag[1]);
 						
 						// We found an actual tag here, check if the implicit VR is SQ
-						if (nearest.tag[0] == tag[0] && nearest.tag[1] == tag[1]) {
-							if (!nearest.vr.compare("SQ")) {
+						if (nearest->tag[0] == tag[0] && nearest->tag[1] == tag[1]) {
+							if (!qstrcmp(nearest->vr, "SQ")) {
 								depth++; // Increase depth to skip delimiters until we exit subsequence								
 								
 								#if defined(OUTPUT_PARSE_SQ)
@@ -762,11 +1112,16 @@ int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long in
                         return 0;
                     }
                     delete[] dat;
-                    dat = new unsigned char[buffer.size()];
-                    for (int i = 0; i < buffer.size(); i++) {
-                        dat[i] = buffer[i];
-                    }
-                    att->seq.items.append(new SequenceItem(buffer.size(),dat));
+					if (base != NULL) { // The item is contiguous in the mapped file
+						att->seq.items.append(new SequenceItem(buffer.size(), base+start, false));
+					}
+					else {
+						dat = new unsigned char[buffer.size()];
+						for (int i = 0; i < buffer.size(); i++) {
+							dat[i] = buffer[i];
+						}
+						att->seq.items.append(new SequenceItem(buffer.size(),dat));
+					}
 					n-=buffer.size();
 					
 					#if defined(OUTPUT_PARSE_SQ)
@@ -790,7 +1145,7 @@ int DICOM::readDefinedSequence(QDataStream *in, Attribute *att, unsigned long in
     return 1;
 }
 
-int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
+int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att, unsigned char *base) {
 	unsigned char *dat;
 	in->setByteOrder(QDataStream::LittleEndian);
 	Attribute *temp;
@@ -810,6 +1165,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			// Not a DICOM file
 			delete[] dat;
 			delete temp;
+			sortAttributes(att);
 			return 1;
 		}
 		#if defined(OUTPUT_READ_SQ)
@@ -841,7 +1197,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			#endif
 		}
 		else {
-			VR = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1).vr;
+			VR = lib->binSearch(temp->tag[0], temp->tag[1])->vr;
 			#if defined(OUTPUT_READ_SQ)
 			    std::cout << VR.toStdString() << " (implicit) | Size ";  std::cout.flush();
 			#endif
@@ -863,7 +1219,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			// We have a sequence
 			if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
 				nested = true;
-				if (!readSequence(in, temp)) {
+				if (!readSequence(in, temp, base)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -871,7 +1227,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			}
 			else if (!VR.compare("SQ")) {
 				nested = true;
-				if (!readDefinedSequence(in, temp, temp->vl)) {
+				if (!readDefinedSequence(in, temp, temp->vl, base)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -899,7 +1255,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			// We have a sequence
 			if (!VR.compare("SQ") && temp->vl == (unsigned int)0xFFFFFFFF) {
 				nested = true;
-				if (!readSequence(in, temp)) {
+				if (!readSequence(in, temp, base)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -907,7 +1263,7 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 			}
 			else if (!VR.compare("SQ")) {
 				nested = true;
-				if (!readDefinedSequence(in, temp, temp->vl)) {
+				if (!readDefinedSequence(in, temp, temp->vl, base)) {
 					delete[] dat;
 					delete temp;
 					return 0;
@@ -924,16 +1280,27 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 		    std::cout << temp->vl << " -> " << std::dec << size << "\n";
 		#endif
 		
-		Reference closest = lib->binSearch(temp->tag[0], temp->tag[1], 0, lib->lib.size()-1);
-		if (closest.tag[0] == temp->tag[0] && closest.tag[1] == temp->tag[1])
-			temp->desc = closest.title;
+		const Reference *closest = lib->binSearch(temp->tag[0], temp->tag[1]);
+		if (closest->tag[0] == temp->tag[0] && closest->tag[1] == temp->tag[1])
+			temp->desc = closest->title;
 		else
 			temp->desc = "Unknown Tag";
 
 		delete[] dat;
 
 		// Get data
-		if (!nested) {
+		if (!nested && base != NULL) { // Point into the buffer the stream reads from
+			qint64 pos = in->device()->pos();
+			if (pos+(qint64)size > in->device()->size()) {
+				// Not a DICOM file
+				delete temp;
+				return 0;
+			}
+			temp->vf = base+pos;
+			temp->owned = false;
+			in->device()->seek(pos+size);
+		}
+		else if (!nested) {
 			temp->vf = new unsigned char[size];
 			if (size > 0 && size < (unsigned long int)INT_MAX) {
 				if (in->readRawData((char*)temp->vf,size) != (long int)size) {
@@ -972,63 +1339,96 @@ int DICOM::parseSequence(QDataStream *in, QVector <Attribute*> *att) {
 		    }
 		#endif
 		
-		// Insert temp into the proper sorted index
-		int i = 0;
-		if (att->size())
-			i = binSearch(att,temp->tag[0],temp->tag[1],0,att->size()-1);
-		att->insert(i,temp);
+		// Elements should already come in tag order, sortAttributes fixes it otherwise
+		att->append(temp);
 	}
+	sortAttributes(att);
 	return att->size();
 }
 	
-int DICOM::binSearch(unsigned short int one, unsigned short int two, int min, int max) {
-	if (min >= max) {
-        return min;
-    }
+// Elements are stored in tag order by the DICOM standard, but check anyway and
+// fall back to a stable sort for files that don't follow it
+void DICOM::sortAttributes(QVector <Attribute*> *att) {
+	for (int i = 1; i < att->size(); i++)
+		if (att->at(i)->compare(att->at(i-1)) < 0) {
+			std::stable_sort(att->begin(), att->end(), [](Attribute *a, Attribute *b) {
+				return a->compare(b) < 0;
+			});
+			return;
+		}
+}
+
+// Returns the index of the first attribute with the tag, or of the closest one
+// if it isn't there
+int DICOM::binSearch(QVector <Attribute*> *att, unsigned short int one, unsigned short int two) {
+	int min = 0, max = att->size()-1, mid;
 	
-	int mid = (max+min)/2;
+	while (min < max) {
+		mid = (min+max)/2;
+		
+		if (att->at(mid)->tag[0] < one || (att->at(mid)->tag[0] == one && att->at(mid)->tag[1] < two))
+			min = mid+1;
+		else
+			max = mid;
+	}
 	
-    if (data[mid]->tag[0] > one) {
-        return binSearch(one, two, min, mid-1);
-    }
-    else if (data[mid]->tag[0] < one) {
-        return binSearch(one, two, mid+1, max);
-    }
-    else {
-        if (data[mid]->tag[1] > two) {
-            return binSearch(one, two, min, mid-1);
-        }
-        else if (data[mid]->tag[1] < two) {
-            return binSearch(one, two, mid+1, max);
-        }
-        else {
-            return mid;
-        }
-    }
+	return min;
 }
 
-int DICOM::binSearch(QVector <Attribute*> *att, unsigned short int one, unsigned short int two, int min, int max) {
-    if (min >= max) {
-        return min;
-    }
+// Fill in the attributes of every item of a sequence, and recursively of any
+// sequences within them; items that don't parse are left empty
+void DICOM::parseItems(Attribute *sq) {
+	if (sq->tag[0] == 0x7FE0 && sq->tag[1] == 0x0010)
+		return; // Compressed pixel data fragments, not data set items
 	
-	int mid = (max+min)/2;
+	for (int i = 0; i < sq->seq.items.size(); i++) {
+		SequenceItem *item = sq->seq.items[i];
+		if (item->vf == NULL || !item->vl || item->att.size())
+			continue;
+		
+		QDataStream in(QByteArray::fromRawData((char*)item->vf, item->vl));
+		if (!parseSequence(&in, &item->att, item->vf)) {
+			for (int j = 0; j < item->att.size(); j++)
+				delete item->att[j];
+			item->att.clear();
+			continue;
+		}
+		
+		for (int j = 0; j < item->att.size(); j++)
+			parseItems(item->att[j]);
+	}
+}
 
-    if (att->at(mid)->tag[0] > one) {
-        return binSearch(att, one, two, min, mid-1);
-    }
-    else if (att->at(mid)->tag[0] < one) {
-        return binSearch(att, one, two, mid+1, max);
-    }
-    else {
-        if (att->at(mid)->tag[1] > two) {
-            return binSearch(att, one, two, min, mid-1);
-        }
-        else if (att->at(mid)->tag[1] < two) {
-            return binSearch(att, one, two, mid+1, max);
-        }
-        else {
-            return (max+min)/2;
-        }
-    }
-}
\ No newline at end of file
+// Walk down a path of tags such as "3006,0039/3006,0040/3006,0050", going into
+// every item of each sequence along the way, and return all the attributes found
+// at the end of it
+QVector <Attribute*> DICOM::findPath(QVector <Attribute*> *att, QString path) {
+	QVector <Attribute*> found;
+	QStringList tags = path.split('/', QString::SkipEmptyParts);
+	if (tags.isEmpty())
+		return found;
+	
+	QStringList tag = tags.takeFirst().split(',');
+	if (tag.size() != 2)
+		return found;
+	unsigned short int one = tag[0].toUShort(0, 16), two = tag[1].toUShort(0, 16);
+	
+	for (int i = 0; i < att->size(); i++) {
+		if (att->at(i)->tag[0] != one || att->at(i)->tag[1] != two)
+			continue;
+		
+		if (tags.isEmpty()) {
+			found.append(att->at(i));
+		}
+		else {
+			for (int j = 0; j < att->at(i)->seq.items.size(); j++)
+				found += findPath(&att->at(i)->seq.items[j]->att, tags.join('/'));
+		}
+	}
+	
+	return found;
+}
+
+QVector <Attribute*> DICOM::getPath(QString path) {
+	return findPath(&data, path);
+}
@@ -60,11 +60,16 @@ class SequenceItem {
 public:
     unsigned long int vl; // Value Length
     unsigned char *vf; // Value Field
+    bool owned; // False if vf points into a mapped file rather than its own memory
     Sequence seq; // Contains potential sequences
+	QVector <Attribute*> att; // The attributes within this item, parsed along with the file
 
-    SequenceItem(unsigned long int size, unsigned char *data);
+    SequenceItem(unsigned long int size, unsigned char *data, bool own = true);
     SequenceItem(unsigned long int size, Attribute *data);
     ~SequenceItem();
+	
+	Attribute* getEntry(unsigned short int one, unsigned short int two); // NULL if not there
+	QVector <Attribute*> getPath(QString path); // See DICOM::findPath
 };
 
 class Attribute {
@@ -74,11 +79,16 @@ public:
     unsigned short int vr; // Value Representation
     unsigned long int vl; // Value Length
     unsigned char *vf; // Value Field
+    bool owned; // False if vf points into a mapped file rather than its own memory
     Sequence seq; // Contains potential sequences
 
     Attribute();
     ~Attribute();
 	
+	// Read a backslash separated DS or IS value field into values, returns the
+	// count; the vector is reused so repeated calls don't reallocate
+	int readDS(QVector <double> *values) const;
+	
 	// Comparison to allow for sorted insertion
     int compare(const Attribute *a) {
 		if (tag[0] < a->tag[0]) return -1;
@@ -93,21 +103,20 @@ public:
 // hassle
 struct Reference {
     unsigned short int tag[2]; // Element Identifier
-    QString vr; // Element Identifier
-    QString title; // Title of element
+    const char *vr; // Value Representation
+    const char *title; // Title of element
 };
 
 class database : public QObject {
     Q_OBJECT
 
 public:
-    // Contains a list of known attribute entries
-    QVector <Reference *> lib;
     // Contains all the acceptable value representations
     QStringList validVR;
     QStringList implicitVR;
 	
-	Reference binSearch(unsigned short int one, unsigned short int two, int min, int max);
+	// Look up a tag in the static table of known attribute entries
+	const Reference *binSearch(unsigned short int one, unsigned short int two) const;
 
     database();
     ~database();
@@ -125,6 +134,8 @@ public:
 	
 	// Transfer syntax
     bool isImplicit, isBigEndian;
+	bool isDeflated, isRLE; // Compressed data set or pixel data
+	QByteArray inflatedData; // The data set after the file meta information, if deflated
 	
 	// z height (default to NaN, only change if slice height tag is found)
 	double z = std::nan("1");
@@ -134,28 +145,56 @@ public:
 
 	// file location for later lookup if needed
 	QString path;
+	
+	// The file is mapped into memory while this is alive, and value fields of the
+	// top level attributes and their sequence items point straight into it
+	QFile *mapFile;
+	QByteArray fileData; // Used instead when the file cannot be mapped
+	
+	// A header only parse stops at Pixel Data (7FE0,0010) and keeps just the bytes
+	// before it, the pixels are then read from pixelOffset when needed
+	bool headerOnly;
+	qint64 pixelOffset;
+	unsigned long int pixelLength; // Bytes from pixelOffset, before any decompression
+	QByteArray pixelData;
 
     DICOM(); // Shouldn't be invoked
     DICOM(database*);
     ~DICOM();
 
-    int parse(QString p);
-    int readSequence(QDataStream *in, Attribute *att);
-    int readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n = 0);
+    int parse(QString p, bool header = false);
+	int loadPixelData(); // Read in Pixel Data skipped by a header only parse
+	void releasePixelData(); // Free it again, only does something after a header only parse
 	
-	int parseSequence(QDataStream *in, QVector <Attribute*> *att);
+	static int inflateRaw(const unsigned char *in, qint64 size, QByteArray *out);
+	int decodeRLE();
+    int readSequence(QDataStream *in, Attribute *att, unsigned char *base = NULL);
+    int readDefinedSequence(QDataStream *in, Attribute *att, unsigned long int n = 0,
+							unsigned char *base = NULL); // Items point into base if given
 	
-	// functions for fetching top level data attributes once loaded in
-	int binSearch(unsigned short int one, unsigned short int two, int min, int max);
+	int parseSequence(QDataStream *in, QVector <Attribute*> *att,
+					  unsigned char *base = NULL); // Values point into base if given
+	void parseItems(Attribute *sq);
+	
+	// Fetch all attributes at the end of a path of tags through nested sequences
+	static QVector <Attribute*> findPath(QVector <Attribute*> *att, QString path);
+	QVector <Attribute*> getPath(QString path);
+	
+	// functions for fetching top level data attributes once loaded in, these
+	// return the closest attribute so check its tag
 	Attribute* getEntry(unsigned short int one, unsigned short int two) {
-		return data[binSearch(one, two, 0, data.size()-1)];
+		return data.isEmpty() ? &missing : data[binSearch(&data, one, two)];
 	};
 	
 	// functions for fetching sequence attributes the sequences have been parsed
-	int binSearch(QVector <Attribute*> *att, unsigned short int one, unsigned short int two, int min, int max);
 	Attribute* getSubEntry(QVector <Attribute*> *att, unsigned short int one, unsigned short int two) {
-		return (*att)[binSearch(one, two, 0, att->size()-1)];
+		return att->isEmpty() ? &missing : (*att)[binSearch(att, one, two)];
 	};
+	
+	int binSearch(QVector <Attribute*> *att, unsigned short int one, unsigned short int two);
+	void sortAttributes(QVector <Attribute*> *att);
+	
+	Attribute missing; // Returned by lookups on an empty list, its tag is (0000,0000)
 };
 
 #endif
\ No newline at end of file
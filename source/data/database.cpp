@@ -38,24735 +38,4165 @@
 */
 #include "DICOM.h"
 
-database::database() {
-    Reference *x;
+// The DICOM data dictionary, sorted by tag so that it can be binary searched
+// (entries with repeating group/element xx are commented out as they can't be)
+static constexpr Reference dictionary[] = {
+    {{0x0002,0x0000}, "UL", "File Meta Information Group Length"},
+    {{0x0002,0x0001}, "OB", "File Meta Information Version"},
+    {{0x0002,0x0002}, "UI", "Media Storage SOP Class UID"},
+    {{0x0002,0x0003}, "UI", "Media Storage SOP Instance UID"},
+    {{0x0002,0x0010}, "UI", "Transfer Syntax UID"},
+    {{0x0002,0x0012}, "UI", "Implementation Class UID"},
+    {{0x0002,0x0013}, "SH", "Implementation Version Name"},
+    {{0x0002,0x0016}, "AE", "Source Application Entity Title"},
+    {{0x0002,0x0017}, "AE", "Sending Application Entity Title"},
+    {{0x0002,0x0018}, "AE", "Receiving Application Entity Title"},
+    {{0x0002,0x0100}, "UI", "Private Information Creator UID"},
+    {{0x0002,0x0102}, "OB", "Private Information"},
+    {{0x0004,0x1130}, "CS", "File-set ID"},
+    {{0x0004,0x1141}, "CS", "File-set Descriptor File ID"},
+    {{0x0004,0x1142}, "CS", "Specific Character Set of File-set Descriptor File"},
+    {{0x0004,0x1200}, "UL", "Offset of the First Directory Record of the Root Directory Entity"},
+    {{0x0004,0x1202}, "UL", "Offset of the Last Directory Record of the Root Directory Entity"},
+    {{0x0004,0x1212}, "US", "File-set Consistency Flag"},
+    {{0x0004,0x1220}, "SQ", "Directory Record Sequence"},
+    {{0x0004,0x1400}, "UL", "Offset of the Next Directory Record"},
+    {{0x0004,0x1410}, "US", "Record In-use Flag"},
+    {{0x0004,0x1420}, "UL", "Offset of Referenced Lower-Level Directory Entity"},
+    {{0x0004,0x1430}, "CS", "Directory Record Type"},
+    {{0x0004,0x1432}, "UI", "Private Record UID"},
+    {{0x0004,0x1500}, "CS", "Referenced File ID"},
+    {{0x0004,0x1504}, "UL", "MRDR Directory Record Offset"},
+    {{0x0004,0x1510}, "UI", "Referenced SOP Class UID in File"},
+    {{0x0004,0x1511}, "UI", "Referenced SOP Instance UID in File"},
+    {{0x0004,0x1512}, "UI", "Referenced Transfer Syntax UID in File"},
+    {{0x0004,0x151A}, "UI", "Referenced Related General SOP Class UID in File"},
+    {{0x0004,0x1600}, "UL", "Number of References"},
+    {{0x0008,0x0001}, "UL", "Length to End"},
+    {{0x0008,0x0005}, "CS", "Specific Character Set"},
+    {{0x0008,0x0006}, "SQ", "Language Code Sequence"},
+    {{0x0008,0x0008}, "CS", "Image Type"},
+    {{0x0008,0x0010}, "SH", "Recognition Code"},
+    {{0x0008,0x0012}, "DA", "Instance Creation Date"},
+    {{0x0008,0x0013}, "TM", "Instance Creation Time"},
+    {{0x0008,0x0014}, "UI", "Instance Creator UID"},
+    {{0x0008,0x0015}, "DT", "Instance Coercion DateTime"},
+    {{0x0008,0x0016}, "UI", "SOP Class UID"},
+    {{0x0008,0x0018}, "UI", "SOP Instance UID"},
+    {{0x0008,0x001A}, "UI", "Related General SOP Class UID"},
+    {{0x0008,0x001B}, "UI", "Original Specialized SOP Class UID"},
+    {{0x0008,0x0020}, "DA", "Study Date"},
+    {{0x0008,0x0021}, "DA", "Series Date"},
+    {{0x0008,0x0022}, "DA", "Acquisition Date"},
+    {{0x0008,0x0023}, "DA", "Content Date"},
+    {{0x0008,0x0024}, "DA", "Overlay Date"},
+    {{0x0008,0x0025}, "DA", "Curve Date"},
+    {{0x0008,0x002A}, "DT", "Acquisition DateTime"},
+    {{0x0008,0x0030}, "TM", "Study Time"},
+    {{0x0008,0x0031}, "TM", "Series Time"},
+    {{0x0008,0x0032}, "TM", "Acquisition Time"},
+    {{0x0008,0x0033}, "TM", "Content Time"},
+    {{0x0008,0x0034}, "TM", "Overlay Time"},
+    {{0x0008,0x0035}, "TM", "Curve Time"},
+    {{0x0008,0x0040}, "US", "Data Set Type"},
+    {{0x0008,0x0041}, "LO", "Data Set Subtype"},
+    {{0x0008,0x0042}, "CS", "Nuclear Medicine Series Type"},
+    {{0x0008,0x0050}, "SH", "Accession Number"},
+    {{0x0008,0x0051}, "SQ", "Issuer of Accession Number Sequence"},
+    {{0x0008,0x0052}, "CS", "Query/Retrieve Level"},
+    {{0x0008,0x0053}, "CS", "Query/Retrieve View"},
+    {{0x0008,0x0054}, "AE", "Retrieve AE Title"},
+    {{0x0008,0x0055}, "AE", "Station AE Title"},
+    {{0x0008,0x0056}, "CS", "Instance Availability"},
+    {{0x0008,0x0058}, "UI", "Failed SOP Instance UID List"},
+    {{0x0008,0x0060}, "CS", "Modality"},
+    {{0x0008,0x0061}, "CS", "Modalities in Study"},
+    {{0x0008,0x0062}, "UI", "SOP Classes in Study"},
+    {{0x0008,0x0064}, "CS", "Conversion Type"},
+    {{0x0008,0x0068}, "CS", "Presentation Intent Type"},
+    {{0x0008,0x0070}, "LO", "Manufacturer"},
+    {{0x0008,0x0080}, "LO", "Institution Name"},
+    {{0x0008,0x0081}, "ST", "Institution Address"},
+    {{0x0008,0x0082}, "SQ", "Institution Code Sequence"},
+    {{0x0008,0x0090}, "PN", "Referring Physician's Name"},
+    {{0x0008,0x0092}, "ST", "Referring Physician's Address"},
+    {{0x0008,0x0094}, "SH", "Referring Physician's Telephone Numbers"},
+    {{0x0008,0x0096}, "SQ", "Referring Physician Identification Sequence"},
+    {{0x0008,0x009C}, "PN", "Consulting Physician's Name"},
+    {{0x0008,0x009D}, "SQ", "Consulting Physician Identification Sequence"},
+    {{0x0008,0x0100}, "SH", "Code Value"},
+    {{0x0008,0x0101}, "LO", "Extended Code Value"},
+    {{0x0008,0x0102}, "SH", "Coding Scheme Designator"},
+    {{0x0008,0x0103}, "SH", "Coding Scheme Version"},
+    {{0x0008,0x0104}, "LO", "Code Meaning"},
+    {{0x0008,0x0105}, "CS", "Mapping Resource"},
+    {{0x0008,0x0106}, "DT", "Context Group Version"},
+    {{0x0008,0x0107}, "DT", "Context Group Local Version"},
+    {{0x0008,0x0108}, "LT", "Extended Code Meaning"},
+    {{0x0008,0x010B}, "CS", "Context Group Extension Flag"},
+    {{0x0008,0x010C}, "UI", "Coding Scheme UID"},
+    {{0x0008,0x010D}, "UI", "Context Group Extension Creator UID"},
+    {{0x0008,0x010F}, "CS", "Context Identifier"},
+    {{0x0008,0x0110}, "SQ", "Coding Scheme Identification Sequence"},
+    {{0x0008,0x0112}, "LO", "Coding Scheme Registry"},
+    {{0x0008,0x0114}, "ST", "Coding Scheme External ID"},
+    {{0x0008,0x0115}, "ST", "Coding Scheme Name"},
+    {{0x0008,0x0116}, "ST", "Coding Scheme Responsible Organization"},
+    {{0x0008,0x0117}, "UI", "Context UID"},
+    {{0x0008,0x0118}, "UI", "Mapping Resource UID"},
+    {{0x0008,0x0119}, "UC", "Long Code Value"},
+    {{0x0008,0x0120}, "UR", "URN Code Value"},
+    {{0x0008,0x0121}, "SQ", "Equivalent Code Sequence"},
+    {{0x0008,0x0122}, "LO", "Mapping Resource Name"},
+    {{0x0008,0x0123}, "SQ", "Context Group Identification Sequence"},
+    {{0x0008,0x0124}, "SQ", "Mapping Resource Identification Sequence"},
+    {{0x0008,0x0201}, "SH", "Timezone Offset From UTC"},
+    {{0x0008,0x0300}, "SQ", "Private Data Element Characteristics Sequence"},
+    {{0x0008,0x0301}, "US", "Private Group Reference"},
+    {{0x0008,0x0302}, "LO", "Private Creator Reference"},
+    {{0x0008,0x0303}, "CS", "Block Identifying Information Status"},
+    {{0x0008,0x0304}, "US", "Nonidentifying Private Elements"},
+    {{0x0008,0x0305}, "SQ", "Deidentification Action Sequence"},
+    {{0x0008,0x0306}, "US", "Identifying Private Elements"},
+    {{0x0008,0x0307}, "CS", "Deidentification Action"},
+    {{0x0008,0x1000}, "AE", "Network ID"},
+    {{0x0008,0x1010}, "SH", "Station Name"},
+    {{0x0008,0x1030}, "LO", "Study Description"},
+    {{0x0008,0x1032}, "SQ", "Procedure Code Sequence"},
+    {{0x0008,0x103E}, "LO", "Series Description"},
+    {{0x0008,0x103F}, "SQ", "Series Description Code Sequence"},
+    {{0x0008,0x1040}, "LO", "Institutional Department Name"},
+    {{0x0008,0x1048}, "PN", "Physician(s) of Record"},
+    {{0x0008,0x1049}, "SQ", "Physician(s) of Record Identification Sequence"},
+    {{0x0008,0x1050}, "PN", "Performing Physician's Name"},
+    {{0x0008,0x1052}, "SQ", "Performing Physician Identification Sequence"},
+    {{0x0008,0x1060}, "PN", "Name of Physician(s) Reading Study"},
+    {{0x0008,0x1062}, "SQ", "Physician(s) Reading Study Identification Sequence"},
+    {{0x0008,0x1070}, "PN", "Operators' Name"},
+    {{0x0008,0x1072}, "SQ", "Operator Identification Sequence"},
+    {{0x0008,0x1080}, "LO", "Admitting Diagnoses Description"},
+    {{0x0008,0x1084}, "SQ", "Admitting Diagnoses Code Sequence"},
+    {{0x0008,0x1090}, "LO", "Manufacturer's Model Name"},
+    {{0x0008,0x1100}, "SQ", "Referenced Results Sequence"},
+    {{0x0008,0x1110}, "SQ", "Referenced Study Sequence"},
+    {{0x0008,0x1111}, "SQ", "Referenced Performed Procedure Step Sequence"},
+    {{0x0008,0x1115}, "SQ", "Referenced Series Sequence"},
+    {{0x0008,0x1120}, "SQ", "Referenced Patient Sequence"},
+    {{0x0008,0x1125}, "SQ", "Referenced Visit Sequence"},
+    {{0x0008,0x1130}, "SQ", "Referenced Overlay Sequence"},
+    {{0x0008,0x1134}, "SQ", "Referenced Stereometric Instance Sequence"},
+    {{0x0008,0x113A}, "SQ", "Referenced Waveform Sequence"},
+    {{0x0008,0x1140}, "SQ", "Referenced Image Sequence"},
+    {{0x0008,0x1145}, "SQ", "Referenced Curve Sequence"},
+    {{0x0008,0x114A}, "SQ", "Referenced Instance Sequence"},
+    {{0x0008,0x114B}, "SQ", "Referenced Real World Value Mapping Instance Sequence"},
+    {{0x0008,0x1150}, "UI", "Referenced SOP Class UID"},
+    {{0x0008,0x1155}, "UI", "Referenced SOP Instance UID"},
+    {{0x0008,0x115A}, "UI", "SOP Classes Supported"},
+    {{0x0008,0x1160}, "IS", "Referenced Frame Number"},
+    {{0x0008,0x1161}, "UL", "Simple Frame List"},
+    {{0x0008,0x1162}, "UL", "Calculated Frame List"},
+    {{0x0008,0x1163}, "FD", "Time Range"},
+    {{0x0008,0x1164}, "SQ", "Frame Extraction Sequence"},
+    {{0x0008,0x1167}, "UI", "Multi-frame Source SOP Instance UID"},
+    {{0x0008,0x1190}, "UR", "Retrieve URL"},
+    {{0x0008,0x1195}, "UI", "Transaction UID"},
+    {{0x0008,0x1196}, "US", "Warning Reason"},
+    {{0x0008,0x1197}, "US", "Failure Reason"},
+    {{0x0008,0x1198}, "SQ", "Failed SOP Sequence"},
+    {{0x0008,0x1199}, "SQ", "Referenced SOP Sequence"},
+    {{0x0008,0x119A}, "SQ", "Other Failures Sequence"},
+    {{0x0008,0x1200}, "SQ", "Studies Containing Other Referenced Instances Sequence"},
+    {{0x0008,0x1250}, "SQ", "Related Series Sequence"},
+    {{0x0008,0x2110}, "CS", "Lossy Image Compression (Retired)"},
+    {{0x0008,0x2111}, "ST", "Derivation Description"},
+    {{0x0008,0x2112}, "SQ", "Source Image Sequence"},
+    {{0x0008,0x2120}, "SH", "Stage Name"},
+    {{0x0008,0x2122}, "IS", "Stage Number"},
+    {{0x0008,0x2124}, "IS", "Number of Stages"},
+    {{0x0008,0x2127}, "SH", "View Name"},
+    {{0x0008,0x2128}, "IS", "View Number"},
+    {{0x0008,0x2129}, "IS", "Number of Event Timers"},
+    {{0x0008,0x212A}, "IS", "Number of Views in Stage"},
+    {{0x0008,0x2130}, "DS", "Event Elapsed Time(s)"},
+    {{0x0008,0x2132}, "LO", "Event Timer Name(s)"},
+    {{0x0008,0x2133}, "SQ", "Event Timer Sequence"},
+    {{0x0008,0x2134}, "FD", "Event Time Offset"},
+    {{0x0008,0x2135}, "SQ", "Event Code Sequence"},
+    {{0x0008,0x2142}, "IS", "Start Trim"},
+    {{0x0008,0x2143}, "IS", "Stop Trim"},
+    {{0x0008,0x2144}, "IS", "Recommended Display Frame Rate"},
+    {{0x0008,0x2200}, "CS", "Transducer Position"},
+    {{0x0008,0x2204}, "CS", "Transducer Orientation"},
+    {{0x0008,0x2208}, "CS", "Anatomic Structure"},
+    {{0x0008,0x2218}, "SQ", "Anatomic Region Sequence"},
+    {{0x0008,0x2220}, "SQ", "Anatomic Region Modifier Sequence"},
+    {{0x0008,0x2228}, "SQ", "Primary Anatomic Structure Sequence"},
+    {{0x0008,0x2229}, "SQ", "Anatomic Structure, Space or Region Sequence"},
+    {{0x0008,0x2230}, "SQ", "Primary Anatomic Structure Modifier Sequence"},
+    {{0x0008,0x2240}, "SQ", "Transducer Position Sequence"},
+    {{0x0008,0x2242}, "SQ", "Transducer Position Modifier Sequence"},
+    {{0x0008,0x2244}, "SQ", "Transducer Orientation Sequence"},
+    {{0x0008,0x2246}, "SQ", "Transducer Orientation Modifier Sequence"},
+    {{0x0008,0x2251}, "SQ", "Anatomic Structure Space Or Region Code Sequence (Trial)"},
+    {{0x0008,0x2253}, "SQ", "Anatomic Portal Of Entrance Code Sequence (Trial)"},
+    {{0x0008,0x2255}, "SQ", "Anatomic Approach Direction Code Sequence (Trial)"},
+    {{0x0008,0x2256}, "ST", "Anatomic Perspective Description (Trial)"},
+    {{0x0008,0x2257}, "SQ", "Anatomic Perspective Code Sequence (Trial)"},
+    {{0x0008,0x2258}, "ST", "Anatomic Location Of Examining Instrument Description (Trial)"},
+    {{0x0008,0x2259}, "SQ", "Anatomic Location Of Examining Instrument Code Sequence (Trial)"},
+    {{0x0008,0x225A}, "SQ", "Anatomic Structure Space Or Region Modifier Code Sequence (Trial)"},
+    {{0x0008,0x225C}, "SQ", "On Axis Background Anatomic Structure Code Sequence (Trial)"},
+    {{0x0008,0x3001}, "SQ", "Alternate Representation Sequence"},
+    {{0x0008,0x3010}, "UI", "Irradiation Event UID"},
+    {{0x0008,0x3011}, "SQ", "Source Irradiation Event Sequence"},
+    {{0x0008,0x3012}, "UI", "Radiopharmaceutical Administration Event UID"},
+    {{0x0008,0x4000}, "LT", "Identifying Comments"},
+    {{0x0008,0x9007}, "CS", "Frame Type"},
+    {{0x0008,0x9092}, "SQ", "Referenced Image Evidence Sequence"},
+    {{0x0008,0x9121}, "SQ", "Referenced Raw Data Sequence"},
+    {{0x0008,0x9123}, "UI", "Creator-Version UID"},
+    {{0x0008,0x9124}, "SQ", "Derivation Image Sequence"},
+    {{0x0008,0x9154}, "SQ", "Source Image Evidence Sequence"},
+    {{0x0008,0x9205}, "CS", "Pixel Presentation"},
+    {{0x0008,0x9206}, "CS", "Volumetric Properties"},
+    {{0x0008,0x9207}, "CS", "Volume Based Calculation Technique"},
+    {{0x0008,0x9208}, "CS", "Complex Image Component"},
+    {{0x0008,0x9209}, "CS", "Acquisition Contrast"},
+    {{0x0008,0x9215}, "SQ", "Derivation Code Sequence"},
+    {{0x0008,0x9237}, "SQ", "Referenced Presentation State Sequence"},
+    {{0x0008,0x9410}, "SQ", "Referenced Other Plane Sequence"},
+    {{0x0008,0x9458}, "SQ", "Frame Display Sequence"},
+    {{0x0008,0x9459}, "FL", "Recommended Display Frame Rate in Float"},
+    {{0x0008,0x9460}, "CS", "Skip Frame Range Flag"},
+    {{0x0010,0x0010}, "PN", "Patient's Name"},
+    {{0x0010,0x0020}, "LO", "Patient ID"},
+    {{0x0010,0x0021}, "LO", "Issuer of Patient ID"},
+    {{0x0010,0x0022}, "CS", "Type of Patient ID"},
+    {{0x0010,0x0024}, "SQ", "Issuer of Patient ID Qualifiers Sequence"},
+    {{0x0010,0x0026}, "SQ", "Source Patient Group Identification Sequence"},
+    {{0x0010,0x0027}, "SQ", "Group of Patients Identification Sequence"},
+    {{0x0010,0x0028}, "US", "Subject Relative Position in Image"},
+    {{0x0010,0x0030}, "DA", "Patient's Birth Date"},
+    {{0x0010,0x0032}, "TM", "Patient's Birth Time"},
+    {{0x0010,0x0033}, "LO", "Patient's Birth Date in Alternative Calendar"},
+    {{0x0010,0x0034}, "LO", "Patient's Death Date in Alternative Calendar"},
+    {{0x0010,0x0035}, "CS", "Patient's Alternative Calendar"},
+    {{0x0010,0x0040}, "CS", "Patient's Sex"},
+    {{0x0010,0x0050}, "SQ", "Patient's Insurance Plan Code Sequence"},
+    {{0x0010,0x0101}, "SQ", "Patient's Primary Language Code Sequence"},
+    {{0x0010,0x0102}, "SQ", "Patient's Primary Language Modifier Code Sequence"},
+    {{0x0010,0x0200}, "CS", "Quality Control Subject"},
+    {{0x0010,0x0201}, "SQ", "Quality Control Subject Type Code Sequence"},
+    {{0x0010,0x0212}, "UC", "Strain Description"},
+    {{0x0010,0x0213}, "LO", "Strain Nomenclature"},
+    {{0x0010,0x0214}, "LO", "Strain Stock Number"},
+    {{0x0010,0x0215}, "SQ", "Strain Source Registry Code Sequence"},
+    {{0x0010,0x0216}, "SQ", "Strain Stock Sequence"},
+    {{0x0010,0x0217}, "LO", "Strain Source"},
+    {{0x0010,0x0218}, "UT", "Strain Additional Information"},
+    {{0x0010,0x0219}, "SQ", "Strain Code Sequence"},
+    {{0x0010,0x1000}, "LO", "Other Patient IDs"},
+    {{0x0010,0x1001}, "PN", "Other Patient Names"},
+    {{0x0010,0x1002}, "SQ", "Other Patient IDs Sequence"},
+    {{0x0010,0x1005}, "PN", "Patient's Birth Name"},
+    {{0x0010,0x1010}, "AS", "Patient's Age"},
+    {{0x0010,0x1020}, "DS", "Patient's Size"},
+    {{0x0010,0x1021}, "SQ", "Patient's Size Code Sequence"},
+    {{0x0010,0x1030}, "DS", "Patient's Weight"},
+    {{0x0010,0x1040}, "LO", "Patient's Address"},
+    {{0x0010,0x1050}, "LO", "Insurance Plan Identification"},
+    {{0x0010,0x1060}, "PN", "Patient's Mother's Birth Name"},
+    {{0x0010,0x1080}, "LO", "Military Rank"},
+    {{0x0010,0x1081}, "LO", "Branch of Service"},
+    {{0x0010,0x1090}, "LO", "Medical Record Locator"},
+    {{0x0010,0x1100}, "SQ", "Referenced Patient Photo Sequence"},
+    {{0x0010,0x2000}, "LO", "Medical Alerts"},
+    {{0x0010,0x2110}, "LO", "Allergies"},
+    {{0x0010,0x2150}, "LO", "Country of Residence"},
+    {{0x0010,0x2152}, "LO", "Region of Residence"},
+    {{0x0010,0x2154}, "SH", "Patient's Telephone Numbers"},
+    {{0x0010,0x2155}, "LT", "Patient's Telecom Information"},
+    {{0x0010,0x2160}, "SH", "Ethnic Group"},
+    {{0x0010,0x2180}, "SH", "Occupation"},
+    {{0x0010,0x21A0}, "CS", "Smoking Status"},
+    {{0x0010,0x21B0}, "LT", "Additional Patient History"},
+    {{0x0010,0x21C0}, "US", "Pregnancy Status"},
+    {{0x0010,0x21D0}, "DA", "Last Menstrual Date"},
+    {{0x0010,0x21F0}, "LO", "Patient's Religious Preference"},
+    {{0x0010,0x2201}, "LO", "Patient Species Description"},
+    {{0x0010,0x2202}, "SQ", "Patient Species Code Sequence"},
+    {{0x0010,0x2203}, "CS", "Patient's Sex Neutered"},
+    {{0x0010,0x2210}, "CS", "Anatomical Orientation Type"},
+    {{0x0010,0x2292}, "LO", "Patient Breed Description"},
+    {{0x0010,0x2293}, "SQ", "Patient Breed Code Sequence"},
+    {{0x0010,0x2294}, "SQ", "Breed Registration Sequence"},
+    {{0x0010,0x2295}, "LO", "Breed Registration Number"},
+    {{0x0010,0x2296}, "SQ", "Breed Registry Code Sequence"},
+    {{0x0010,0x2297}, "PN", "Responsible Person"},
+    {{0x0010,0x2298}, "CS", "Responsible Person Role"},
+    {{0x0010,0x2299}, "LO", "Responsible Organization"},
+    {{0x0010,0x4000}, "LT", "Patient Comments"},
+    {{0x0010,0x9431}, "FL", "Examined Body Thickness"},
+    {{0x0012,0x0010}, "LO", "Clinical Trial Sponsor Name"},
+    {{0x0012,0x0020}, "LO", "Clinical Trial Protocol ID"},
+    {{0x0012,0x0021}, "LO", "Clinical Trial Protocol Name"},
+    {{0x0012,0x0030}, "LO", "Clinical Trial Site ID"},
+    {{0x0012,0x0031}, "LO", "Clinical Trial Site Name"},
+    {{0x0012,0x0040}, "LO", "Clinical Trial Subject ID"},
+    {{0x0012,0x0042}, "LO", "Clinical Trial Subject Reading ID"},
+    {{0x0012,0x0050}, "LO", "Clinical Trial Time Point ID"},
+    {{0x0012,0x0051}, "ST", "Clinical Trial Time Point Description"},
+    {{0x0012,0x0060}, "LO", "Clinical Trial Coordinating Center Name"},
+    {{0x0012,0x0062}, "CS", "Patient Identity Removed"},
+    {{0x0012,0x0063}, "LO", "De-identification Method"},
+    {{0x0012,0x0064}, "SQ", "De-identification Method Code Sequence"},
+    {{0x0012,0x0071}, "LO", "Clinical Trial Series ID"},
+    {{0x0012,0x0072}, "LO", "Clinical Trial Series Description"},
+    {{0x0012,0x0081}, "LO", "Clinical Trial Protocol Ethics Committee Name"},
+    {{0x0012,0x0082}, "LO", "Clinical Trial Protocol Ethics Committee Approval Number"},
+    {{0x0012,0x0083}, "SQ", "Consent for Clinical Trial Use Sequence"},
+    {{0x0012,0x0084}, "CS", "Distribution Type"},
+    {{0x0012,0x0085}, "CS", "Consent for Distribution Flag"},
+    {{0x0014,0x0023}, "ST", "CAD File Format"},
+    {{0x0014,0x0024}, "ST", "Component Reference System"},
+    {{0x0014,0x0025}, "ST", "Component Manufacturing Procedure"},
+    {{0x0014,0x0028}, "ST", "Component Manufacturer"},
+    {{0x0014,0x0030}, "DS", "Material Thickness"},
+    {{0x0014,0x0032}, "DS", "Material Pipe Diameter"},
+    {{0x0014,0x0034}, "DS", "Material Isolation Diameter"},
+    {{0x0014,0x0042}, "ST", "Material Grade"},
+    {{0x0014,0x0044}, "ST", "Material Properties Description"},
+    {{0x0014,0x0045}, "ST", "Material Properties File Format (Retired)"},
+    {{0x0014,0x0046}, "LT", "Material Notes"},
+    {{0x0014,0x0050}, "CS", "Component Shape"},
+    {{0x0014,0x0052}, "CS", "Curvature Type"},
+    {{0x0014,0x0054}, "DS", "Outer Diameter"},
+    {{0x0014,0x0056}, "DS", "Inner Diameter"},
+    {{0x0014,0x0100}, "LO", "Component Welder IDs"},
+    {{0x0014,0x0101}, "CS", "Secondary Approval Status"},
+    {{0x0014,0x0102}, "DA", "Secondary Review Date"},
+    {{0x0014,0x0103}, "TM", "Secondary Review Time"},
+    {{0x0014,0x0104}, "PN", "Secondary Reviewer Name"},
+    {{0x0014,0x0105}, "ST", "Repair ID"},
+    {{0x0014,0x0106}, "SQ", "Multiple Component Approval Sequence"},
+    {{0x0014,0x0107}, "CS", "Other Approval Status"},
+    {{0x0014,0x0108}, "CS", "Other Secondary Approval Status"},
+    {{0x0014,0x1010}, "ST", "Actual Environmental Conditions"},
+    {{0x0014,0x1020}, "DA", "Expiry Date"},
+    {{0x0014,0x1040}, "ST", "Environmental Conditions"},
+    {{0x0014,0x2002}, "SQ", "Evaluator Sequence"},
+    {{0x0014,0x2004}, "IS", "Evaluator Number"},
+    {{0x0014,0x2006}, "PN", "Evaluator Name"},
+    {{0x0014,0x2008}, "IS", "Evaluation Attempt"},
+    {{0x0014,0x2012}, "SQ", "Indication Sequence"},
+    {{0x0014,0x2014}, "IS", "Indication Number"},
+    {{0x0014,0x2016}, "SH", "Indication Label"},
+    {{0x0014,0x2018}, "ST", "Indication Description"},
+    {{0x0014,0x201A}, "CS", "Indication Type"},
+    {{0x0014,0x201C}, "CS", "Indication Disposition"},
+    {{0x0014,0x201E}, "SQ", "Indication ROI Sequence"},
+    {{0x0014,0x2030}, "SQ", "Indication Physical Property Sequence"},
+    {{0x0014,0x2032}, "SH", "Property Label"},
+    {{0x0014,0x2202}, "IS", "Coordinate System Number of Axes"},
+    {{0x0014,0x2204}, "SQ", "Coordinate System Axes Sequence"},
+    {{0x0014,0x2206}, "ST", "Coordinate System Axis Description"},
+    {{0x0014,0x2208}, "CS", "Coordinate System Data Set Mapping"},
+    {{0x0014,0x220A}, "IS", "Coordinate System Axis Number"},
+    {{0x0014,0x220C}, "CS", "Coordinate System Axis Type"},
+    {{0x0014,0x220E}, "CS", "Coordinate System Axis Units"},
+    {{0x0014,0x2210}, "OB", "Coordinate System Axis Values"},
+    {{0x0014,0x2220}, "SQ", "Coordinate System Transform Sequence"},
+    {{0x0014,0x2222}, "ST", "Transform Description"},
+    {{0x0014,0x2224}, "IS", "Transform Number of Axes"},
+    {{0x0014,0x2226}, "IS", "Transform Order of Axes"},
+    {{0x0014,0x2228}, "CS", "Transformed Axis Units"},
+    {{0x0014,0x222A}, "DS", "Coordinate System Transform Rotation and Scale Matrix"},
+    {{0x0014,0x222C}, "DS", "Coordinate System Transform Translation Matrix"},
+    {{0x0014,0x3011}, "DS", "Internal Detector Frame Time"},
+    {{0x0014,0x3012}, "DS", "Number of Frames Integrated"},
+    {{0x0014,0x3020}, "SQ", "Detector Temperature Sequence"},
+    {{0x0014,0x3022}, "ST", "Sensor Name"},
+    {{0x0014,0x3024}, "DS", "Horizontal Offset of Sensor"},
+    {{0x0014,0x3026}, "DS", "Vertical Offset of Sensor"},
+    {{0x0014,0x3028}, "DS", "Sensor Temperature"},
+    {{0x0014,0x3040}, "SQ", "Dark Current Sequence"},
+    {{0x0014,0x3050}, "OB", "Dark Current Counts"},
+    {{0x0014,0x3060}, "SQ", "Gain Correction Reference Sequence"},
+    {{0x0014,0x3070}, "OB", "Air Counts"},
+    {{0x0014,0x3071}, "DS", "KV Used in Gain Calibration"},
+    {{0x0014,0x3072}, "DS", "MA Used in Gain Calibration"},
+    {{0x0014,0x3073}, "DS", "Number of Frames Used for Integration"},
+    {{0x0014,0x3074}, "LO", "Filter Material Used in Gain Calibration"},
+    {{0x0014,0x3075}, "DS", "Filter Thickness Used in Gain Calibration"},
+    {{0x0014,0x3076}, "DA", "Date of Gain Calibration"},
+    {{0x0014,0x3077}, "TM", "Time of Gain Calibration"},
+    {{0x0014,0x3080}, "OB", "Bad Pixel Image"},
+    {{0x0014,0x3099}, "LT", "Calibration Notes"},
+    {{0x0014,0x4002}, "SQ", "Pulser Equipment Sequence"},
+    {{0x0014,0x4004}, "CS", "Pulser Type"},
+    {{0x0014,0x4006}, "LT", "Pulser Notes"},
+    {{0x0014,0x4008}, "SQ", "Receiver Equipment Sequence"},
+    {{0x0014,0x400A}, "CS", "Amplifier Type"},
+    {{0x0014,0x400C}, "LT", "Receiver Notes"},
+    {{0x0014,0x400E}, "SQ", "Pre-Amplifier Equipment Sequence"},
+    {{0x0014,0x400F}, "LT", "Pre-Amplifier Notes"},
+    {{0x0014,0x4010}, "SQ", "Transmit Transducer Sequence"},
+    {{0x0014,0x4011}, "SQ", "Receive Transducer Sequence"},
+    {{0x0014,0x4012}, "US", "Number of Elements"},
+    {{0x0014,0x4013}, "CS", "Element Shape"},
+    {{0x0014,0x4014}, "DS", "Element Dimension A"},
+    {{0x0014,0x4015}, "DS", "Element Dimension B"},
+    {{0x0014,0x4016}, "DS", "Element Pitch A"},
+    {{0x0014,0x4017}, "DS", "Measured Beam Dimension A"},
+    {{0x0014,0x4018}, "DS", "Measured Beam Dimension B"},
+    {{0x0014,0x4019}, "DS", "Location of Measured Beam Diameter"},
+    {{0x0014,0x401A}, "DS", "Nominal Frequency"},
+    {{0x0014,0x401B}, "DS", "Measured Center Frequency"},
+    {{0x0014,0x401C}, "DS", "Measured Bandwidth"},
+    {{0x0014,0x401D}, "DS", "Element Pitch B"},
+    {{0x0014,0x4020}, "SQ", "Pulser Settings Sequence"},
+    {{0x0014,0x4022}, "DS", "Pulse Width"},
+    {{0x0014,0x4024}, "DS", "Excitation Frequency"},
+    {{0x0014,0x4026}, "CS", "Modulation Type"},
+    {{0x0014,0x4028}, "DS", "Damping"},
+    {{0x0014,0x4030}, "SQ", "Receiver Settings Sequence"},
+    {{0x0014,0x4031}, "DS", "Acquired Soundpath Length"},
+    {{0x0014,0x4032}, "CS", "Acquisition Compression Type"},
+    {{0x0014,0x4033}, "IS", "Acquisition Sample Size"},
+    {{0x0014,0x4034}, "DS", "Rectifier Smoothing"},
+    {{0x0014,0x4035}, "SQ", "DAC Sequence"},
+    {{0x0014,0x4036}, "CS", "DAC Type"},
+    {{0x0014,0x4038}, "DS", "DAC Gain Points"},
+    {{0x0014,0x403A}, "DS", "DAC Time Points"},
+    {{0x0014,0x403C}, "DS", "DAC Amplitude"},
+    {{0x0014,0x4040}, "SQ", "Pre-Amplifier Settings Sequence"},
+    {{0x0014,0x4050}, "SQ", "Transmit Transducer Settings Sequence"},
+    {{0x0014,0x4051}, "SQ", "Receive Transducer Settings Sequence"},
+    {{0x0014,0x4052}, "DS", "Incident Angle"},
+    {{0x0014,0x4054}, "ST", "Coupling Technique"},
+    {{0x0014,0x4056}, "ST", "Coupling Medium"},
+    {{0x0014,0x4057}, "DS", "Coupling Velocity"},
+    {{0x0014,0x4058}, "DS", "Probe Center Location X"},
+    {{0x0014,0x4059}, "DS", "Probe Center Location Z"},
+    {{0x0014,0x405A}, "DS", "Sound Path Length"},
+    {{0x0014,0x405C}, "ST", "Delay Law Identifier"},
+    {{0x0014,0x4060}, "SQ", "Gate Settings Sequence"},
+    {{0x0014,0x4062}, "DS", "Gate Threshold"},
+    {{0x0014,0x4064}, "DS", "Velocity of Sound"},
+    {{0x0014,0x4070}, "SQ", "Calibration Settings Sequence"},
+    {{0x0014,0x4072}, "ST", "Calibration Procedure"},
+    {{0x0014,0x4074}, "SH", "Procedure Version"},
+    {{0x0014,0x4076}, "DA", "Procedure Creation Date"},
+    {{0x0014,0x4078}, "DA", "Procedure Expiration Date"},
+    {{0x0014,0x407A}, "DA", "Procedure Last Modified Date"},
+    {{0x0014,0x407C}, "TM", "Calibration Time"},
+    {{0x0014,0x407E}, "DA", "Calibration Date"},
+    {{0x0014,0x4080}, "SQ", "Probe Drive Equipment Sequence"},
+    {{0x0014,0x4081}, "CS", "Drive Type"},
+    {{0x0014,0x4082}, "LT", "Probe Drive Notes"},
+    {{0x0014,0x4083}, "SQ", "Drive Probe Sequence"},
+    {{0x0014,0x4084}, "DS", "Probe Inductance"},
+    {{0x0014,0x4085}, "DS", "Probe Resistance"},
+    {{0x0014,0x4086}, "SQ", "Receive Probe Sequence"},
+    {{0x0014,0x4087}, "SQ", "Probe Drive Settings Sequence"},
+    {{0x0014,0x4088}, "DS", "Bridge Resistors"},
+    {{0x0014,0x4089}, "DS", "Probe Orientation Angle"},
+    {{0x0014,0x408B}, "DS", "User Selected Gain Y"},
+    {{0x0014,0x408C}, "DS", "User Selected Phase"},
+    {{0x0014,0x408D}, "DS", "User Selected Offset X"},
+    {{0x0014,0x408E}, "DS", "User Selected Offset Y"},
+    {{0x0014,0x4091}, "SQ", "Channel Settings Sequence"},
+    {{0x0014,0x4092}, "DS", "Channel Threshold"},
+    {{0x0014,0x409A}, "SQ", "Scanner Settings Sequence"},
+    {{0x0014,0x409B}, "ST", "Scan Procedure"},
+    {{0x0014,0x409C}, "DS", "Translation Rate X"},
+    {{0x0014,0x409D}, "DS", "Translation Rate Y"},
+    {{0x0014,0x409F}, "DS", "Channel Overlap"},
+    {{0x0014,0x40A0}, "LO", "Image Quality Indicator Type"},
+    {{0x0014,0x40A1}, "LO", "Image Quality Indicator Material"},
+    {{0x0014,0x40A2}, "LO", "Image Quality Indicator Size"},
+    {{0x0014,0x5002}, "IS", "LINAC Energy"},
+    {{0x0014,0x5004}, "IS", "LINAC Output"},
+    {{0x0014,0x5100}, "US", "Active Aperture"},
+    {{0x0014,0x5101}, "DS", "Total Aperture"},
+    {{0x0014,0x5102}, "DS", "Aperture Elevation"},
+    {{0x0014,0x5103}, "DS", "Main Lobe Angle"},
+    {{0x0014,0x5104}, "DS", "Main Roof Angle"},
+    {{0x0014,0x5105}, "CS", "Connector Type"},
+    {{0x0014,0x5106}, "SH", "Wedge Model Number"},
+    {{0x0014,0x5107}, "DS", "Wedge Angle Float"},
+    {{0x0014,0x5108}, "DS", "Wedge Roof Angle"},
+    {{0x0014,0x5109}, "CS", "Wedge Element 1 Position"},
+    {{0x0014,0x510A}, "DS", "Wedge Material Velocity"},
+    {{0x0014,0x510B}, "SH", "Wedge Material"},
+    {{0x0014,0x510C}, "DS", "Wedge Offset Z"},
+    {{0x0014,0x510D}, "DS", "Wedge Origin Offset X"},
+    {{0x0014,0x510E}, "DS", "Wedge Time Delay"},
+    {{0x0014,0x510F}, "SH", "Wedge Name"},
+    {{0x0014,0x5110}, "SH", "Wedge Manufacturer Name"},
+    {{0x0014,0x5111}, "LO", "Wedge Description"},
+    {{0x0014,0x5112}, "DS", "Nominal Beam Angle"},
+    {{0x0014,0x5113}, "DS", "Wedge Offset X"},
+    {{0x0014,0x5114}, "DS", "Wedge Offset Y"},
+    {{0x0014,0x5115}, "DS", "Wedge Total Length"},
+    {{0x0014,0x5116}, "DS", "Wedge In Contact Length"},
+    {{0x0014,0x5117}, "DS", "Wedge Front Gap"},
+    {{0x0014,0x5118}, "DS", "Wedge Total Height"},
+    {{0x0014,0x5119}, "DS", "Wedge Front Height"},
+    {{0x0014,0x511A}, "DS", "Wedge Rear Height"},
+    {{0x0014,0x511B}, "DS", "Wedge Total Width"},
+    {{0x0014,0x511C}, "DS", "Wedge In Contact Width"},
+    {{0x0014,0x511D}, "DS", "Wedge Chamfer Height"},
+    {{0x0014,0x511E}, "CS", "Wedge Curve"},
+    {{0x0014,0x511F}, "DS", "Radius Along the Wedge"},
+    {{0x0018,0x0010}, "LO", "Contrast/Bolus Agent"},
+    {{0x0018,0x0012}, "SQ", "Contrast/Bolus Agent Sequence"},
+    {{0x0018,0x0013}, "FL", "Contrast/Bolus T1 Relaxivity"},
+    {{0x0018,0x0014}, "SQ", "Contrast/Bolus Administration Route Sequence"},
+    {{0x0018,0x0015}, "CS", "Body Part Examined"},
+    {{0x0018,0x0020}, "CS", "Scanning Sequence"},
+    {{0x0018,0x0021}, "CS", "Sequence Variant"},
+    {{0x0018,0x0022}, "CS", "Scan Options"},
+    {{0x0018,0x0023}, "CS", "MR Acquisition Type"},
+    {{0x0018,0x0024}, "SH", "Sequence Name"},
+    {{0x0018,0x0025}, "CS", "Angio Flag"},
+    {{0x0018,0x0026}, "SQ", "Intervention Drug Information Sequence"},
+    {{0x0018,0x0027}, "TM", "Intervention Drug Stop Time"},
+    {{0x0018,0x0028}, "DS", "Intervention Drug Dose"},
+    {{0x0018,0x0029}, "SQ", "Intervention Drug Code Sequence"},
+    {{0x0018,0x002A}, "SQ", "Additional Drug Sequence"},
+    {{0x0018,0x0030}, "LO", "Radionuclide"},
+    {{0x0018,0x0031}, "LO", "Radiopharmaceutical"},
+    {{0x0018,0x0032}, "DS", "Energy Window Centerline"},
+    {{0x0018,0x0033}, "DS", "Energy Window Total Width"},
+    {{0x0018,0x0034}, "LO", "Intervention Drug Name"},
+    {{0x0018,0x0035}, "TM", "Intervention Drug Start Time"},
+    {{0x0018,0x0036}, "SQ", "Intervention Sequence"},
+    {{0x0018,0x0037}, "CS", "Therapy Type"},
+    {{0x0018,0x0038}, "CS", "Intervention Status"},
+    {{0x0018,0x0039}, "CS", "Therapy Description"},
+    {{0x0018,0x003A}, "ST", "Intervention Description"},
+    {{0x0018,0x0040}, "IS", "Cine Rate"},
+    {{0x0018,0x0042}, "CS", "Initial Cine Run State"},
+    {{0x0018,0x0050}, "DS", "Slice Thickness"},
+    {{0x0018,0x0060}, "DS", "KVP"},
+    {{0x0018,0x0061}, "DS", ""},
+    {{0x0018,0x0070}, "IS", "Counts Accumulated"},
+    {{0x0018,0x0071}, "CS", "Acquisition Termination Condition"},
+    {{0x0018,0x0072}, "DS", "Effective Duration"},
+    {{0x0018,0x0073}, "CS", "Acquisition Start Condition"},
+    {{0x0018,0x0074}, "IS", "Acquisition Start Condition Data"},
+    {{0x0018,0x0075}, "IS", "Acquisition Termination Condition Data"},
+    {{0x0018,0x0080}, "DS", "Repetition Time"},
+    {{0x0018,0x0081}, "DS", "Echo Time"},
+    {{0x0018,0x0082}, "DS", "Inversion Time"},
+    {{0x0018,0x0083}, "DS", "Number of Averages"},
+    {{0x0018,0x0084}, "DS", "Imaging Frequency"},
+    {{0x0018,0x0085}, "SH", "Imaged Nucleus"},
+    {{0x0018,0x0086}, "IS", "Echo Number(s)"},
+    {{0x0018,0x0087}, "DS", "Magnetic Field Strength"},
+    {{0x0018,0x0088}, "DS", "Spacing Between Slices"},
+    {{0x0018,0x0089}, "IS", "Number of Phase Encoding Steps"},
+    {{0x0018,0x0090}, "DS", "Data Collection Diameter"},
+    {{0x0018,0x0091}, "IS", "Echo Train Length"},
+    {{0x0018,0x0093}, "DS", "Percent Sampling"},
+    {{0x0018,0x0094}, "DS", "Percent Phase Field of View"},
+    {{0x0018,0x0095}, "DS", "Pixel Bandwidth"},
+    {{0x0018,0x1000}, "LO", "Device Serial Number"},
+    {{0x0018,0x1002}, "UI", "Device UID"},
+    {{0x0018,0x1003}, "LO", "Device ID"},
+    {{0x0018,0x1004}, "LO", "Plate ID"},
+    {{0x0018,0x1005}, "LO", "Generator ID"},
+    {{0x0018,0x1006}, "LO", "Grid ID"},
+    {{0x0018,0x1007}, "LO", "Cassette ID"},
+    {{0x0018,0x1008}, "LO", "Gantry ID"},
+    {{0x0018,0x1010}, "LO", "Secondary Capture Device ID"},
+    {{0x0018,0x1011}, "LO", "Hardcopy Creation Device ID"},
+    {{0x0018,0x1012}, "DA", "Date of Secondary Capture"},
+    {{0x0018,0x1014}, "TM", "Time of Secondary Capture"},
+    {{0x0018,0x1016}, "LO", "Secondary Capture Device Manufacturer"},
+    {{0x0018,0x1017}, "LO", "Hardcopy Device Manufacturer"},
+    {{0x0018,0x1018}, "LO", "Secondary Capture Device Manufacturer's Model Name"},
+    {{0x0018,0x1019}, "LO", "Secondary Capture Device Software Versions"},
+    {{0x0018,0x101A}, "LO", "Hardcopy Device Software Version"},
+    {{0x0018,0x101B}, "LO", "Hardcopy Device Manufacturer's Model Name"},
+    {{0x0018,0x1020}, "LO", "Software Version(s)"},
+    {{0x0018,0x1022}, "SH", "Video Image Format Acquired"},
+    {{0x0018,0x1023}, "LO", "Digital Image Format Acquired"},
+    {{0x0018,0x1030}, "LO", "Protocol Name"},
+    {{0x0018,0x1040}, "LO", "Contrast/Bolus Route"},
+    {{0x0018,0x1041}, "DS", "Contrast/Bolus Volume"},
+    {{0x0018,0x1042}, "TM", "Contrast/Bolus Start Time"},
+    {{0x0018,0x1043}, "TM", "Contrast/Bolus Stop Time"},
+    {{0x0018,0x1044}, "DS", "Contrast/Bolus Total Dose"},
+    {{0x0018,0x1045}, "IS", "Syringe Counts"},
+    {{0x0018,0x1046}, "DS", "Contrast Flow Rate"},
+    {{0x0018,0x1047}, "DS", "Contrast Flow Duration"},
+    {{0x0018,0x1048}, "CS", "Contrast/Bolus Ingredient"},
+    {{0x0018,0x1049}, "DS", "Contrast/Bolus Ingredient Concentration"},
+    {{0x0018,0x1050}, "DS", "Spatial Resolution"},
+    {{0x0018,0x1060}, "DS", "Trigger Time"},
+    {{0x0018,0x1061}, "LO", "Trigger Source or Type"},
+    {{0x0018,0x1062}, "IS", "Nominal Interval"},
+    {{0x0018,0x1063}, "DS", "Frame Time"},
+    {{0x0018,0x1064}, "LO", "Cardiac Framing Type"},
+    {{0x0018,0x1065}, "DS", "Frame Time Vector"},
+    {{0x0018,0x1066}, "DS", "Frame Delay"},
+    {{0x0018,0x1067}, "DS", "Image Trigger Delay"},
+    {{0x0018,0x1068}, "DS", "Multiplex Group Time Offset"},
+    {{0x0018,0x1069}, "DS", "Trigger Time Offset"},
+    {{0x0018,0x106A}, "CS", "Synchronization Trigger"},
+    {{0x0018,0x106C}, "US", "Synchronization Channel"},
+    {{0x0018,0x106E}, "UL", "Trigger Sample Position"},
+    {{0x0018,0x1070}, "LO", "Radiopharmaceutical Route"},
+    {{0x0018,0x1071}, "DS", "Radiopharmaceutical Volume"},
+    {{0x0018,0x1072}, "TM", "Radiopharmaceutical Start Time"},
+    {{0x0018,0x1073}, "TM", "Radiopharmaceutical Stop Time"},
+    {{0x0018,0x1074}, "DS", "Radionuclide Total Dose"},
+    {{0x0018,0x1075}, "DS", "Radionuclide Half Life"},
+    {{0x0018,0x1076}, "DS", "Radionuclide Positron Fraction"},
+    {{0x0018,0x1077}, "DS", "Radiopharmaceutical Specific Activity"},
+    {{0x0018,0x1078}, "DT", "Radiopharmaceutical Start DateTime"},
+    {{0x0018,0x1079}, "DT", "Radiopharmaceutical Stop DateTime"},
+    {{0x0018,0x1080}, "CS", "Beat Rejection Flag"},
+    {{0x0018,0x1081}, "IS", "Low R-R Value"},
+    {{0x0018,0x1082}, "IS", "High R-R Value"},
+    {{0x0018,0x1083}, "IS", "Intervals Acquired"},
+    {{0x0018,0x1084}, "IS", "Intervals Rejected"},
+    {{0x0018,0x1085}, "LO", "PVC Rejection"},
+    {{0x0018,0x1086}, "IS", "Skip Beats"},
+    {{0x0018,0x1088}, "IS", "Heart Rate"},
+    {{0x0018,0x1090}, "IS", "Cardiac Number of Images"},
+    {{0x0018,0x1094}, "IS", "Trigger Window"},
+    {{0x0018,0x1100}, "DS", "Reconstruction Diameter"},
+    {{0x0018,0x1110}, "DS", "Distance Source to Detector"},
+    {{0x0018,0x1111}, "DS", "Distance Source to Patient"},
+    {{0x0018,0x1114}, "DS", "Estimated Radiographic Magnification Factor"},
+    {{0x0018,0x1120}, "DS", "Gantry/Detector Tilt"},
+    {{0x0018,0x1121}, "DS", "Gantry/Detector Slew"},
+    {{0x0018,0x1130}, "DS", "Table Height"},
+    {{0x0018,0x1131}, "DS", "Table Traverse"},
+    {{0x0018,0x1134}, "CS", "Table Motion"},
+    {{0x0018,0x1135}, "DS", "Table Vertical Increment"},
+    {{0x0018,0x1136}, "DS", "Table Lateral Increment"},
+    {{0x0018,0x1137}, "DS", "Table Longitudinal Increment"},
+    {{0x0018,0x1138}, "DS", "Table Angle"},
+    {{0x0018,0x113A}, "CS", "Table Type"},
+    {{0x0018,0x1140}, "CS", "Rotation Direction"},
+    {{0x0018,0x1141}, "DS", "Angular Position"},
+    {{0x0018,0x1142}, "DS", "Radial Position"},
+    {{0x0018,0x1143}, "DS", "Scan Arc"},
+    {{0x0018,0x1144}, "DS", "Angular Step"},
+    {{0x0018,0x1145}, "DS", "Center of Rotation Offset"},
+    {{0x0018,0x1146}, "DS", "Rotation Offset"},
+    {{0x0018,0x1147}, "CS", "Field of View Shape"},
+    {{0x0018,0x1149}, "IS", "Field of View Dimension(s)"},
+    {{0x0018,0x1150}, "IS", "Exposure Time"},
+    {{0x0018,0x1151}, "IS", "X-Ray Tube Current"},
+    {{0x0018,0x1152}, "IS", "Exposure"},
+    {{0x0018,0x1153}, "IS", "Exposure in µAs"},
+    {{0x0018,0x1154}, "DS", "Average Pulse Width"},
+    {{0x0018,0x1155}, "CS", "Radiation Setting"},
+    {{0x0018,0x1156}, "CS", "Rectification Type"},
+    {{0x0018,0x115A}, "CS", "Radiation Mode"},
+    {{0x0018,0x115E}, "DS", "Image and Fluoroscopy Area Dose Product"},
+    {{0x0018,0x1160}, "SH", "Filter Type"},
+    {{0x0018,0x1161}, "LO", "Type of Filters"},
+    {{0x0018,0x1162}, "DS", "Intensifier Size"},
+    {{0x0018,0x1164}, "DS", "Imager Pixel Spacing"},
+    {{0x0018,0x1166}, "CS", "Grid"},
+    {{0x0018,0x1170}, "IS", "Generator Power"},
+    {{0x0018,0x1180}, "SH", "Collimator/grid Name"},
+    {{0x0018,0x1181}, "CS", "Collimator Type"},
+    {{0x0018,0x1182}, "IS", "Focal Distance"},
+    {{0x0018,0x1183}, "DS", "X Focus Center"},
+    {{0x0018,0x1184}, "DS", "Y Focus Center"},
+    {{0x0018,0x1190}, "DS", "Focal Spot(s)"},
+    {{0x0018,0x1191}, "CS", "Anode Target Material"},
+    {{0x0018,0x11A0}, "DS", "Body Part Thickness"},
+    {{0x0018,0x11A2}, "DS", "Compression Force"},
+    {{0x0018,0x11A4}, "LO", "Paddle Description"},
+    {{0x0018,0x1200}, "DA", "Date of Last Calibration"},
+    {{0x0018,0x1201}, "TM", "Time of Last Calibration"},
+    {{0x0018,0x1202}, "DT", "DateTime of Last Calibration"},
+    {{0x0018,0x1210}, "SH", "Convolution Kernel"},
+    {{0x0018,0x1240}, "IS", "Upper/Lower Pixel Values"},
+    {{0x0018,0x1242}, "IS", "Actual Frame Duration"},
+    {{0x0018,0x1243}, "IS", "Count Rate"},
+    {{0x0018,0x1244}, "US", "Preferred Playback Sequencing"},
+    {{0x0018,0x1250}, "SH", "Receive Coil Name"},
+    {{0x0018,0x1251}, "SH", "Transmit Coil Name"},
+    {{0x0018,0x1260}, "SH", "Plate Type"},
+    {{0x0018,0x1261}, "LO", "Phosphor Type"},
+    {{0x0018,0x1271}, "FD", "Water Equivalent Diameter"},
+    {{0x0018,0x1272}, "SQ", "Water Equivalent Diameter Calculation Method Code Sequence"},
+    {{0x0018,0x1300}, "DS", "Scan Velocity"},
+    {{0x0018,0x1301}, "CS", "Whole Body Technique"},
+    {{0x0018,0x1302}, "IS", "Scan Length"},
+    {{0x0018,0x1310}, "US", "Acquisition Matrix"},
+    {{0x0018,0x1312}, "CS", "In-plane Phase Encoding Direction"},
+    {{0x0018,0x1314}, "DS", "Flip Angle"},
+    {{0x0018,0x1315}, "CS", "Variable Flip Angle Flag"},
+    {{0x0018,0x1316}, "DS", "SAR"},
+    {{0x0018,0x1318}, "DS", "dB/dt"},
+    {{0x0018,0x1320}, "FL", "B1rms"},
+    {{0x0018,0x1400}, "LO", "Acquisition Device Processing Description"},
+    {{0x0018,0x1401}, "LO", "Acquisition Device Processing Code"},
+    {{0x0018,0x1402}, "CS", "Cassette Orientation"},
+    {{0x0018,0x1403}, "CS", "Cassette Size"},
+    {{0x0018,0x1404}, "US", "Exposures on Plate"},
+    {{0x0018,0x1405}, "IS", "Relative X-Ray Exposure"},
+    {{0x0018,0x1411}, "DS", "Exposure Index"},
+    {{0x0018,0x1412}, "DS", "Target Exposure Index"},
+    {{0x0018,0x1413}, "DS", "Deviation Index"},
+    {{0x0018,0x1450}, "DS", "Column Angulation"},
+    {{0x0018,0x1460}, "DS", "Tomo Layer Height"},
+    {{0x0018,0x1470}, "DS", "Tomo Angle"},
+    {{0x0018,0x1480}, "DS", "Tomo Time"},
+    {{0x0018,0x1490}, "CS", "Tomo Type"},
+    {{0x0018,0x1491}, "CS", "Tomo Class"},
+    {{0x0018,0x1495}, "IS", "Number of Tomosynthesis Source Images"},
+    {{0x0018,0x1500}, "CS", "Positioner Motion"},
+    {{0x0018,0x1508}, "CS", "Positioner Type"},
+    {{0x0018,0x1510}, "DS", "Positioner Primary Angle"},
+    {{0x0018,0x1511}, "DS", "Positioner Secondary Angle"},
+    {{0x0018,0x1520}, "DS", "Positioner Primary Angle Increment"},
+    {{0x0018,0x1521}, "DS", "Positioner Secondary Angle Increment"},
+    {{0x0018,0x1530}, "DS", "Detector Primary Angle"},
+    {{0x0018,0x1531}, "DS", "Detector Secondary Angle"},
+    {{0x0018,0x1600}, "CS", "Shutter Shape"},
+    {{0x0018,0x1602}, "IS", "Shutter Left Vertical Edge"},
+    {{0x0018,0x1604}, "IS", "Shutter Right Vertical Edge"},
+    {{0x0018,0x1606}, "IS", "Shutter Upper Horizontal Edge"},
+    {{0x0018,0x1608}, "IS", "Shutter Lower Horizontal Edge"},
+    {{0x0018,0x1610}, "IS", "Center of Circular Shutter"},
+    {{0x0018,0x1612}, "IS", "Radius of Circular Shutter"},
+    {{0x0018,0x1620}, "IS", "Vertices of the Polygonal Shutter"},
+    {{0x0018,0x1622}, "US", "Shutter Presentation Value"},
+    {{0x0018,0x1623}, "US", "Shutter Overlay Group"},
+    {{0x0018,0x1624}, "US", "Shutter Presentation Color CIELab Value"},
+    {{0x0018,0x1700}, "CS", "Collimator Shape"},
+    {{0x0018,0x1702}, "IS", "Collimator Left Vertical Edge"},
+    {{0x0018,0x1704}, "IS", "Collimator Right Vertical Edge"},
+    {{0x0018,0x1706}, "IS", "Collimator Upper Horizontal Edge"},
+    {{0x0018,0x1708}, "IS", "Collimator Lower Horizontal Edge"},
+    {{0x0018,0x1710}, "IS", "Center of Circular Collimator"},
+    {{0x0018,0x1712}, "IS", "Radius of Circular Collimator"},
+    {{0x0018,0x1720}, "IS", "Vertices of the Polygonal Collimator"},
+    {{0x0018,0x1800}, "CS", "Acquisition Time Synchronized"},
+    {{0x0018,0x1801}, "SH", "Time Source"},
+    {{0x0018,0x1802}, "CS", "Time Distribution Protocol"},
+    {{0x0018,0x1803}, "LO", "NTP Source Address"},
+    {{0x0018,0x2001}, "IS", "Page Number Vector"},
+    {{0x0018,0x2002}, "SH", "Frame Label Vector"},
+    {{0x0018,0x2003}, "DS", "Frame Primary Angle Vector"},
+    {{0x0018,0x2004}, "DS", "Frame Secondary Angle Vector"},
+    {{0x0018,0x2005}, "DS", "Slice Location Vector"},
+    {{0x0018,0x2006}, "SH", "Display Window Label Vector"},
+    {{0x0018,0x2010}, "DS", "Nominal Scanned Pixel Spacing"},
+    {{0x0018,0x2020}, "CS", "Digitizing Device Transport Direction"},
+    {{0x0018,0x2030}, "DS", "Rotation of Scanned Film"},
+    {{0x0018,0x2041}, "SQ", "Biopsy Target Sequence"},
+    {{0x0018,0x2042}, "UI", "Target UID"},
+    {{0x0018,0x2043}, "FL", "Localizing Cursor Position"},
+    {{0x0018,0x2044}, "FL", "Calculated Target Position"},
+    {{0x0018,0x2045}, "SH", "Target Label"},
+    {{0x0018,0x2046}, "FL", "Displayed Z Value"},
+    {{0x0018,0x3100}, "CS", "IVUS Acquisition"},
+    {{0x0018,0x3101}, "DS", "IVUS Pullback Rate"},
+    {{0x0018,0x3102}, "DS", "IVUS Gated Rate"},
+    {{0x0018,0x3103}, "IS", "IVUS Pullback Start Frame Number"},
+    {{0x0018,0x3104}, "IS", "IVUS Pullback Stop Frame Number"},
+    {{0x0018,0x3105}, "IS", "Lesion Number"},
+    {{0x0018,0x4000}, "LT", "Acquisition Comments"},
+    {{0x0018,0x5000}, "SH", "Output Power"},
+    {{0x0018,0x5010}, "LO", "Transducer Data"},
+    {{0x0018,0x5012}, "DS", "Focus Depth"},
+    {{0x0018,0x5020}, "LO", "Processing Function"},
+    {{0x0018,0x5021}, "LO", "Postprocessing Function"},
+    {{0x0018,0x5022}, "DS", "Mechanical Index"},
+    {{0x0018,0x5024}, "DS", "Bone Thermal Index"},
+    {{0x0018,0x5026}, "DS", "Cranial Thermal Index"},
+    {{0x0018,0x5027}, "DS", "Soft Tissue Thermal Index"},
+    {{0x0018,0x5028}, "DS", "Soft Tissue-focus Thermal Index"},
+    {{0x0018,0x5029}, "DS", "Soft Tissue-surface Thermal Index"},
+    {{0x0018,0x5030}, "DS", "Dynamic Range"},
+    {{0x0018,0x5040}, "DS", "Total Gain"},
+    {{0x0018,0x5050}, "IS", "Depth of Scan Field"},
+    {{0x0018,0x5100}, "CS", "Patient Position"},
+    {{0x0018,0x5101}, "CS", "View Position"},
+    {{0x0018,0x5104}, "SQ", "Projection Eponymous Name Code Sequence"},
+    {{0x0018,0x5210}, "DS", "Image Transformation Matrix"},
+    {{0x0018,0x5212}, "DS", "Image Translation Vector"},
+    {{0x0018,0x6000}, "DS", "Sensitivity"},
+    {{0x0018,0x6011}, "SQ", "Sequence of Ultrasound Regions"},
+    {{0x0018,0x6012}, "US", "Region Spatial Format"},
+    {{0x0018,0x6014}, "US", "Region Data Type"},
+    {{0x0018,0x6016}, "UL", "Region Flags"},
+    {{0x0018,0x6018}, "UL", "Region Location Min X0"},
+    {{0x0018,0x601A}, "UL", "Region Location Min Y0"},
+    {{0x0018,0x601C}, "UL", "Region Location Max X1"},
+    {{0x0018,0x601E}, "UL", "Region Location Max Y1"},
+    {{0x0018,0x6020}, "SL", "Reference Pixel X0"},
+    {{0x0018,0x6022}, "SL", "Reference Pixel Y0"},
+    {{0x0018,0x6024}, "US", "Physical Units X Direction"},
+    {{0x0018,0x6026}, "US", "Physical Units Y Direction"},
+    {{0x0018,0x6028}, "FD", "Reference Pixel Physical Value X"},
+    {{0x0018,0x602A}, "FD", "Reference Pixel Physical Value Y"},
+    {{0x0018,0x602C}, "FD", "Physical Delta X"},
+    {{0x0018,0x602E}, "FD", "Physical Delta Y"},
+    {{0x0018,0x6030}, "UL", "Transducer Frequency"},
+    {{0x0018,0x6031}, "CS", "Transducer Type"},
+    {{0x0018,0x6032}, "UL", "Pulse Repetition Frequency"},
+    {{0x0018,0x6034}, "FD", "Doppler Correction Angle"},
+    {{0x0018,0x6036}, "FD", "Steering Angle"},
+    {{0x0018,0x6038}, "UL", "Doppler Sample Volume X Position (Retired)"},
+    {{0x0018,0x6039}, "SL", "Doppler Sample Volume X Position"},
+    {{0x0018,0x603A}, "UL", "Doppler Sample Volume Y Position (Retired)"},
+    {{0x0018,0x603B}, "SL", "Doppler Sample Volume Y Position"},
+    {{0x0018,0x603C}, "UL", "TM-Line Position X0 (Retired)"},
+    {{0x0018,0x603D}, "SL", "TM-Line Position X0"},
+    {{0x0018,0x603E}, "UL", "TM-Line Position Y0 (Retired)"},
+    {{0x0018,0x603F}, "SL", "TM-Line Position Y0"},
+    {{0x0018,0x6040}, "UL", "TM-Line Position X1 (Retired)"},
+    {{0x0018,0x6041}, "SL", "TM-Line Position X1"},
+    {{0x0018,0x6042}, "UL", "TM-Line Position Y1 (Retired)"},
+    {{0x0018,0x6043}, "SL", "TM-Line Position Y1"},
+    {{0x0018,0x6044}, "US", "Pixel Component Organization"},
+    {{0x0018,0x6046}, "UL", "Pixel Component Mask"},
+    {{0x0018,0x6048}, "UL", "Pixel Component Range Start"},
+    {{0x0018,0x604A}, "UL", "Pixel Component Range Stop"},
+    {{0x0018,0x604C}, "US", "Pixel Component Physical Units"},
+    {{0x0018,0x604E}, "US", "Pixel Component Data Type"},
+    {{0x0018,0x6050}, "UL", "Number of Table Break Points"},
+    {{0x0018,0x6052}, "UL", "Table of X Break Points"},
+    {{0x0018,0x6054}, "FD", "Table of Y Break Points"},
+    {{0x0018,0x6056}, "UL", "Number of Table Entries"},
+    {{0x0018,0x6058}, "UL", "Table of Pixel Values"},
+    {{0x0018,0x605A}, "FL", "Table of Parameter Values"},
+    {{0x0018,0x6060}, "FL", "R Wave Time Vector"},
+    {{0x0018,0x7000}, "CS", "Detector Conditions Nominal Flag"},
+    {{0x0018,0x7001}, "DS", "Detector Temperature"},
+    {{0x0018,0x7004}, "CS", "Detector Type"},
+    {{0x0018,0x7005}, "CS", "Detector Configuration"},
+    {{0x0018,0x7006}, "LT", "Detector Description"},
+    {{0x0018,0x7008}, "LT", "Detector Mode"},
+    {{0x0018,0x700A}, "SH", "Detector ID"},
+    {{0x0018,0x700C}, "DA", "Date of Last Detector Calibration"},
+    {{0x0018,0x700E}, "TM", "Time of Last Detector Calibration"},
+    {{0x0018,0x7010}, "IS", "Exposures on Detector Since Last Calibration"},
+    {{0x0018,0x7011}, "IS", "Exposures on Detector Since Manufactured"},
+    {{0x0018,0x7012}, "DS", "Detector Time Since Last Exposure"},
+    {{0x0018,0x7014}, "DS", "Detector Active Time"},
+    {{0x0018,0x7016}, "DS", "Detector Activation Offset From Exposure"},
+    {{0x0018,0x701A}, "DS", "Detector Binning"},
+    {{0x0018,0x7020}, "DS", "Detector Element Physical Size"},
+    {{0x0018,0x7022}, "DS", "Detector Element Spacing"},
+    {{0x0018,0x7024}, "CS", "Detector Active Shape"},
+    {{0x0018,0x7026}, "DS", "Detector Active Dimension(s)"},
+    {{0x0018,0x7028}, "DS", "Detector Active Origin"},
+    {{0x0018,0x702A}, "LO", "Detector Manufacturer Name"},
+    {{0x0018,0x702B}, "LO", "Detector Manufacturer's Model Name"},
+    {{0x0018,0x7030}, "DS", "Field of View Origin"},
+    {{0x0018,0x7032}, "DS", "Field of View Rotation"},
+    {{0x0018,0x7034}, "CS", "Field of View Horizontal Flip"},
+    {{0x0018,0x7036}, "FL", "Pixel Data Area Origin Relative To FOV"},
+    {{0x0018,0x7038}, "FL", "Pixel Data Area Rotation Angle Relative To FOV"},
+    {{0x0018,0x7040}, "LT", "Grid Absorbing Material"},
+    {{0x0018,0x7041}, "LT", "Grid Spacing Material"},
+    {{0x0018,0x7042}, "DS", "Grid Thickness"},
+    {{0x0018,0x7044}, "DS", "Grid Pitch"},
+    {{0x0018,0x7046}, "IS", "Grid Aspect Ratio"},
+    {{0x0018,0x7048}, "DS", "Grid Period"},
+    {{0x0018,0x704C}, "DS", "Grid Focal Distance"},
+    {{0x0018,0x7050}, "CS", "Filter Material"},
+    {{0x0018,0x7052}, "DS", "Filter Thickness Minimum"},
+    {{0x0018,0x7054}, "DS", "Filter Thickness Maximum"},
+    {{0x0018,0x7056}, "FL", "Filter Beam Path Length Minimum"},
+    {{0x0018,0x7058}, "FL", "Filter Beam Path Length Maximum"},
+    {{0x0018,0x7060}, "CS", "Exposure Control Mode"},
+    {{0x0018,0x7062}, "LT", "Exposure Control Mode Description"},
+    {{0x0018,0x7064}, "CS", "Exposure Status"},
+    {{0x0018,0x7065}, "DS", "Phototimer Setting"},
+    {{0x0018,0x8150}, "DS", "Exposure Time in µS"},
+    {{0x0018,0x8151}, "DS", "X-Ray Tube Current in µA"},
+    {{0x0018,0x9004}, "CS", "Content Qualification"},
+    {{0x0018,0x9005}, "SH", "Pulse Sequence Name"},
+    {{0x0018,0x9006}, "SQ", "MR Imaging Modifier Sequence"},
+    {{0x0018,0x9008}, "CS", "Echo Pulse Sequence"},
+    {{0x0018,0x9009}, "CS", "Inversion Recovery"},
+    {{0x0018,0x9010}, "CS", "Flow Compensation"},
+    {{0x0018,0x9011}, "CS", "Multiple Spin Echo"},
+    {{0x0018,0x9012}, "CS", "Multi-planar Excitation"},
+    {{0x0018,0x9014}, "CS", "Phase Contrast"},
+    {{0x0018,0x9015}, "CS", "Time of Flight Contrast"},
+    {{0x0018,0x9016}, "CS", "Spoiling"},
+    {{0x0018,0x9017}, "CS", "Steady State Pulse Sequence"},
+    {{0x0018,0x9018}, "CS", "Echo Planar Pulse Sequence"},
+    {{0x0018,0x9019}, "FD", "Tag Angle First Axis"},
+    {{0x0018,0x9020}, "CS", "Magnetization Transfer"},
+    {{0x0018,0x9021}, "CS", "T2 Preparation"},
+    {{0x0018,0x9022}, "CS", "Blood Signal Nulling"},
+    {{0x0018,0x9024}, "CS", "Saturation Recovery"},
+    {{0x0018,0x9025}, "CS", "Spectrally Selected Suppression"},
+    {{0x0018,0x9026}, "CS", "Spectrally Selected Excitation"},
+    {{0x0018,0x9027}, "CS", "Spatial Pre-saturation"},
+    {{0x0018,0x9028}, "CS", "Tagging"},
+    {{0x0018,0x9029}, "CS", "Oversampling Phase"},
+    {{0x0018,0x9030}, "FD", "Tag Spacing First Dimension"},
+    {{0x0018,0x9032}, "CS", "Geometry of k-Space Traversal"},
+    {{0x0018,0x9033}, "CS", "Segmented k-Space Traversal"},
+    {{0x0018,0x9034}, "CS", "Rectilinear Phase Encode Reordering"},
+    {{0x0018,0x9035}, "FD", "Tag Thickness"},
+    {{0x0018,0x9036}, "CS", "Partial Fourier Direction"},
+    {{0x0018,0x9037}, "CS", "Cardiac Synchronization Technique"},
+    {{0x0018,0x9041}, "LO", "Receive Coil Manufacturer Name"},
+    {{0x0018,0x9042}, "SQ", "MR Receive Coil Sequence"},
+    {{0x0018,0x9043}, "CS", "Receive Coil Type"},
+    {{0x0018,0x9044}, "CS", "Quadrature Receive Coil"},
+    {{0x0018,0x9045}, "SQ", "Multi-Coil Definition Sequence"},
+    {{0x0018,0x9046}, "LO", "Multi-Coil Configuration"},
+    {{0x0018,0x9047}, "SH", "Multi-Coil Element Name"},
+    {{0x0018,0x9048}, "CS", "Multi-Coil Element Used"},
+    {{0x0018,0x9049}, "SQ", "MR Transmit Coil Sequence"},
+    {{0x0018,0x9050}, "LO", "Transmit Coil Manufacturer Name"},
+    {{0x0018,0x9051}, "CS", "Transmit Coil Type"},
+    {{0x0018,0x9052}, "FD", "Spectral Width"},
+    {{0x0018,0x9053}, "FD", "Chemical Shift Reference"},
+    {{0x0018,0x9054}, "CS", "Volume Localization Technique"},
+    {{0x0018,0x9058}, "US", "MR Acquisition Frequency Encoding Steps"},
+    {{0x0018,0x9059}, "CS", "De-coupling"},
+    {{0x0018,0x9060}, "CS", "De-coupled Nucleus"},
+    {{0x0018,0x9061}, "FD", "De-coupling Frequency"},
+    {{0x0018,0x9062}, "CS", "De-coupling Method"},
+    {{0x0018,0x9063}, "FD", "De-coupling Chemical Shift Reference"},
+    {{0x0018,0x9064}, "CS", "k-space Filtering"},
+    {{0x0018,0x9065}, "CS", "Time Domain Filtering"},
+    {{0x0018,0x9066}, "US", "Number of Zero Fills"},
+    {{0x0018,0x9067}, "CS", "Baseline Correction"},
+    {{0x0018,0x9069}, "FD", "Parallel Reduction Factor In-plane"},
+    {{0x0018,0x9070}, "FD", "Cardiac R-R Interval Specified"},
+    {{0x0018,0x9073}, "FD", "Acquisition Duration"},
+    {{0x0018,0x9074}, "DT", "Frame Acquisition DateTime"},
+    {{0x0018,0x9075}, "CS", "Diffusion Directionality"},
+    {{0x0018,0x9076}, "SQ", "Diffusion Gradient Direction Sequence"},
+    {{0x0018,0x9077}, "CS", "Parallel Acquisition"},
+    {{0x0018,0x9078}, "CS", "Parallel Acquisition Technique"},
+    {{0x0018,0x9079}, "FD", "Inversion Times"},
+    {{0x0018,0x9080}, "ST", "Metabolite Map Description"},
+    {{0x0018,0x9081}, "CS", "Partial Fourier"},
+    {{0x0018,0x9082}, "FD", "Effective Echo Time"},
+    {{0x0018,0x9083}, "SQ", "Metabolite Map Code Sequence"},
+    {{0x0018,0x9084}, "SQ", "Chemical Shift Sequence"},
+    {{0x0018,0x9085}, "CS", "Cardiac Signal Source"},
+    {{0x0018,0x9087}, "FD", "Diffusion b-value"},
+    {{0x0018,0x9089}, "FD", "Diffusion Gradient Orientation"},
+    {{0x0018,0x9090}, "FD", "Velocity Encoding Direction"},
+    {{0x0018,0x9091}, "FD", "Velocity Encoding Minimum Value"},
+    {{0x0018,0x9092}, "SQ", "Velocity Encoding Acquisition Sequence"},
+    {{0x0018,0x9093}, "US", "Number of k-Space Trajectories"},
+    {{0x0018,0x9094}, "CS", "Coverage of k-Space"},
+    {{0x0018,0x9095}, "UL", "Spectroscopy Acquisition Phase Rows"},
+    {{0x0018,0x9096}, "FD", "Parallel Reduction Factor In-plane (Retired)"},
+    {{0x0018,0x9098}, "FD", "Transmitter Frequency"},
+    {{0x0018,0x9100}, "CS", "Resonant Nucleus"},
+    {{0x0018,0x9101}, "CS", "Frequency Correction"},
+    {{0x0018,0x9103}, "SQ", "MR Spectroscopy FOV/Geometry Sequence"},
+    {{0x0018,0x9104}, "FD", "Slab Thickness"},
+    {{0x0018,0x9105}, "FD", "Slab Orientation"},
+    {{0x0018,0x9106}, "FD", "Mid Slab Position"},
+    {{0x0018,0x9107}, "SQ", "MR Spatial Saturation Sequence"},
+    {{0x0018,0x9112}, "SQ", "MR Timing and Related Parameters Sequence"},
+    {{0x0018,0x9114}, "SQ", "MR Echo Sequence"},
+    {{0x0018,0x9115}, "SQ", "MR Modifier Sequence"},
+    {{0x0018,0x9117}, "SQ", "MR Diffusion Sequence"},
+    {{0x0018,0x9118}, "SQ", "Cardiac Synchronization Sequence"},
+    {{0x0018,0x9119}, "SQ", "MR Averages Sequence"},
+    {{0x0018,0x9125}, "SQ", "MR FOV/Geometry Sequence"},
+    {{0x0018,0x9126}, "SQ", "Volume Localization Sequence"},
+    {{0x0018,0x9127}, "UL", "Spectroscopy Acquisition Data Columns"},
+    {{0x0018,0x9147}, "CS", "Diffusion Anisotropy Type"},
+    {{0x0018,0x9151}, "DT", "Frame Reference DateTime"},
+    {{0x0018,0x9152}, "SQ", "MR Metabolite Map Sequence"},
+    {{0x0018,0x9155}, "FD", "Parallel Reduction Factor out-of-plane"},
+    {{0x0018,0x9159}, "UL", "Spectroscopy Acquisition Out-of-plane Phase Steps"},
+    {{0x0018,0x9166}, "CS", "Bulk Motion Status"},
+    {{0x0018,0x9168}, "FD", "Parallel Reduction Factor Second In-plane"},
+    {{0x0018,0x9169}, "CS", "Cardiac Beat Rejection Technique"},
+    {{0x0018,0x9170}, "CS", "Respiratory Motion Compensation Technique"},
+    {{0x0018,0x9171}, "CS", "Respiratory Signal Source"},
+    {{0x0018,0x9172}, "CS", "Bulk Motion Compensation Technique"},
+    {{0x0018,0x9173}, "CS", "Bulk Motion Signal Source"},
+    {{0x0018,0x9174}, "CS", "Applicable Safety Standard Agency"},
+    {{0x0018,0x9175}, "LO", "Applicable Safety Standard Description"},
+    {{0x0018,0x9176}, "SQ", "Operating Mode Sequence"},
+    {{0x0018,0x9177}, "CS", "Operating Mode Type"},
+    {{0x0018,0x9178}, "CS", "Operating Mode"},
+    {{0x0018,0x9179}, "CS", "Specific Absorption Rate Definition"},
+    {{0x0018,0x9180}, "CS", "Gradient Output Type"},
+    {{0x0018,0x9181}, "FD", "Specific Absorption Rate Value"},
+    {{0x0018,0x9182}, "FD", "Gradient Output"},
+    {{0x0018,0x9183}, "CS", "Flow Compensation Direction"},
+    {{0x0018,0x9184}, "FD", "Tagging Delay"},
+    {{0x0018,0x9185}, "ST", "Respiratory Motion Compensation Technique Description"},
+    {{0x0018,0x9186}, "SH", "Respiratory Signal Source ID"},
+    {{0x0018,0x9195}, "FD", "Chemical Shift Minimum Integration Limit in Hz"},
+    {{0x0018,0x9196}, "FD", "Chemical Shift Maximum Integration Limit in Hz"},
+    {{0x0018,0x9197}, "SQ", "MR Velocity Encoding Sequence"},
+    {{0x0018,0x9198}, "CS", "First Order Phase Correction"},
+    {{0x0018,0x9199}, "CS", "Water Referenced Phase Correction"},
+    {{0x0018,0x9200}, "CS", "MR Spectroscopy Acquisition Type"},
+    {{0x0018,0x9214}, "CS", "Respiratory Cycle Position"},
+    {{0x0018,0x9217}, "FD", "Velocity Encoding Maximum Value"},
+    {{0x0018,0x9218}, "FD", "Tag Spacing Second Dimension"},
+    {{0x0018,0x9219}, "SS", "Tag Angle Second Axis"},
+    {{0x0018,0x9220}, "FD", "Frame Acquisition Duration"},
+    {{0x0018,0x9226}, "SQ", "MR Image Frame Type Sequence"},
+    {{0x0018,0x9227}, "SQ", "MR Spectroscopy Frame Type Sequence"},
+    {{0x0018,0x9231}, "US", "MR Acquisition Phase Encoding Steps in-plane"},
+    {{0x0018,0x9232}, "US", "MR Acquisition Phase Encoding Steps out-of-plane"},
+    {{0x0018,0x9234}, "UL", "Spectroscopy Acquisition Phase Columns"},
+    {{0x0018,0x9236}, "CS", "Cardiac Cycle Position"},
+    {{0x0018,0x9239}, "SQ", "Specific Absorption Rate Sequence"},
+    {{0x0018,0x9240}, "US", "RF Echo Train Length"},
+    {{0x0018,0x9241}, "US", "Gradient Echo Train Length"},
+    {{0x0018,0x9250}, "CS", "Arterial Spin Labeling Contrast"},
+    {{0x0018,0x9251}, "SQ", "MR Arterial Spin Labeling Sequence"},
+    {{0x0018,0x9252}, "LO", "ASL Technique Description"},
+    {{0x0018,0x9253}, "US", "ASL Slab Number"},
+    {{0x0018,0x9254}, "FD", "ASL Slab Thickness"},
+    {{0x0018,0x9255}, "FD", "ASL Slab Orientation"},
+    {{0x0018,0x9256}, "FD", "ASL Mid Slab Position"},
+    {{0x0018,0x9257}, "CS", "ASL Context"},
+    {{0x0018,0x9258}, "UL", "ASL Pulse Train Duration"},
+    {{0x0018,0x9259}, "CS", "ASL Crusher Flag"},
+    {{0x0018,0x925A}, "FD", "ASL Crusher Flow Limit"},
+    {{0x0018,0x925B}, "LO", "ASL Crusher Description"},
+    {{0x0018,0x925C}, "CS", "ASL Bolus Cut-off Flag"},
+    {{0x0018,0x925D}, "SQ", "ASL Bolus Cut-off Timing Sequence"},
+    {{0x0018,0x925E}, "LO", "ASL Bolus Cut-off Technique"},
+    {{0x0018,0x925F}, "UL", "ASL Bolus Cut-off Delay Time"},
+    {{0x0018,0x9260}, "SQ", "ASL Slab Sequence"},
+    {{0x0018,0x9295}, "FD", "Chemical Shift Minimum Integration Limit in ppm"},
+    {{0x0018,0x9296}, "FD", "Chemical Shift Maximum Integration Limit in ppm"},
+    {{0x0018,0x9297}, "CS", "Water Reference Acquisition"},
+    {{0x0018,0x9298}, "IS", "Echo Peak Position"},
+    {{0x0018,0x9301}, "SQ", "CT Acquisition Type Sequence"},
+    {{0x0018,0x9302}, "CS", "Acquisition Type"},
+    {{0x0018,0x9303}, "FD", "Tube Angle"},
+    {{0x0018,0x9304}, "SQ", "CT Acquisition Details Sequence"},
+    {{0x0018,0x9305}, "FD", "Revolution Time"},
+    {{0x0018,0x9306}, "FD", "Single Collimation Width"},
+    {{0x0018,0x9307}, "FD", "Total Collimation Width"},
+    {{0x0018,0x9308}, "SQ", "CT Table Dynamics Sequence"},
+    {{0x0018,0x9309}, "FD", "Table Speed"},
+    {{0x0018,0x9310}, "FD", "Table Feed per Rotation"},
+    {{0x0018,0x9311}, "FD", "Spiral Pitch Factor"},
+    {{0x0018,0x9312}, "SQ", "CT Geometry Sequence"},
+    {{0x0018,0x9313}, "FD", "Data Collection Center (Patient)"},
+    {{0x0018,0x9314}, "SQ", "CT Reconstruction Sequence"},
+    {{0x0018,0x9315}, "CS", "Reconstruction Algorithm"},
+    {{0x0018,0x9316}, "CS", "Convolution Kernel Group"},
+    {{0x0018,0x9317}, "FD", "Reconstruction Field of View"},
+    {{0x0018,0x9318}, "FD", "Reconstruction Target Center (Patient)"},
+    {{0x0018,0x9319}, "FD", "Reconstruction Angle"},
+    {{0x0018,0x9320}, "SH", "Image Filter"},
+    {{0x0018,0x9321}, "SQ", "CT Exposure Sequence"},
+    {{0x0018,0x9322}, "FD", "Reconstruction Pixel Spacing"},
+    {{0x0018,0x9323}, "CS", "Exposure Modulation Type"},
+    {{0x0018,0x9324}, "FD", "Estimated Dose Saving"},
+    {{0x0018,0x9325}, "SQ", "CT X-Ray Details Sequence"},
+    {{0x0018,0x9326}, "SQ", "CT Position Sequence"},
+    {{0x0018,0x9327}, "FD", "Table Position"},
+    {{0x0018,0x9328}, "FD", "Exposure Time in ms"},
+    {{0x0018,0x9329}, "SQ", "CT Image Frame Type Sequence"},
+    {{0x0018,0x9330}, "FD", "X-Ray Tube Current in mA"},
+    {{0x0018,0x9332}, "FD", "Exposure in mAs"},
+    {{0x0018,0x9333}, "CS", "Constant Volume Flag"},
+    {{0x0018,0x9334}, "CS", "Fluoroscopy Flag"},
+    {{0x0018,0x9335}, "FD", "Distance Source to Data Collection Center"},
+    {{0x0018,0x9337}, "US", "Contrast/Bolus Agent Number"},
+    {{0x0018,0x9338}, "SQ", "Contrast/Bolus Ingredient Code Sequence"},
+    {{0x0018,0x9340}, "SQ", "Contrast Administration Profile Sequence"},
+    {{0x0018,0x9341}, "SQ", "Contrast/Bolus Usage Sequence"},
+    {{0x0018,0x9342}, "CS", "Contrast/Bolus Agent Administered"},
+    {{0x0018,0x9343}, "CS", "Contrast/Bolus Agent Detected"},
+    {{0x0018,0x9344}, "CS", "Contrast/Bolus Agent Phase"},
+    {{0x0018,0x9345}, "FD", "CTDIvol"},
+    {{0x0018,0x9346}, "SQ", "CTDI Phantom Type Code Sequence"},
+    {{0x0018,0x9351}, "FL", "Calcium Scoring Mass Factor Patient"},
+    {{0x0018,0x9352}, "FL", "Calcium Scoring Mass Factor Device"},
+    {{0x0018,0x9353}, "FL", "Energy Weighting Factor"},
+    {{0x0018,0x9360}, "SQ", "CT Additional X-Ray Source Sequence"},
+    {{0x0018,0x9401}, "SQ", "Projection Pixel Calibration Sequence"},
+    {{0x0018,0x9402}, "FL", "Distance Source to Isocenter"},
+    {{0x0018,0x9403}, "FL", "Distance Object to Table Top"},
+    {{0x0018,0x9404}, "FL", "Object Pixel Spacing in Center of Beam"},
+    {{0x0018,0x9405}, "SQ", "Positioner Position Sequence"},
+    {{0x0018,0x9406}, "SQ", "Table Position Sequence"},
+    {{0x0018,0x9407}, "SQ", "Collimator Shape Sequence"},
+    {{0x0018,0x9410}, "CS", "Planes in Acquisition"},
+    {{0x0018,0x9412}, "SQ", "XA/XRF Frame Characteristics Sequence"},
+    {{0x0018,0x9417}, "SQ", "Frame Acquisition Sequence"},
+    {{0x0018,0x9420}, "CS", "X-Ray Receptor Type"},
+    {{0x0018,0x9423}, "LO", "Acquisition Protocol Name"},
+    {{0x0018,0x9424}, "LT", "Acquisition Protocol Description"},
+    {{0x0018,0x9425}, "CS", "Contrast/Bolus Ingredient Opaque"},
+    {{0x0018,0x9426}, "FL", "Distance Receptor Plane to Detector Housing"},
+    {{0x0018,0x9427}, "CS", "Intensifier Active Shape"},
+    {{0x0018,0x9428}, "FL", "Intensifier Active Dimension(s)"},
+    {{0x0018,0x9429}, "FL", "Physical Detector Size"},
+    {{0x0018,0x9430}, "FL", "Position of Isocenter Projection"},
+    {{0x0018,0x9432}, "SQ", "Field of View Sequence"},
+    {{0x0018,0x9433}, "LO", "Field of View Description"},
+    {{0x0018,0x9434}, "SQ", "Exposure Control Sensing Regions Sequence"},
+    {{0x0018,0x9435}, "CS", "Exposure Control Sensing Region Shape"},
+    {{0x0018,0x9436}, "SS", "Exposure Control Sensing Region Left Vertical Edge"},
+    {{0x0018,0x9437}, "SS", "Exposure Control Sensing Region Right Vertical Edge"},
+    {{0x0018,0x9438}, "SS", "Exposure Control Sensing Region Upper Horizontal Edge"},
+    {{0x0018,0x9439}, "SS", "Exposure Control Sensing Region Lower Horizontal Edge"},
+    {{0x0018,0x9440}, "SS", "Center of Circular Exposure Control Sensing Region"},
+    {{0x0018,0x9441}, "US", "Radius of Circular Exposure Control Sensing Region"},
+    {{0x0018,0x9442}, "SS", "Vertices of the Polygonal Exposure Control Sensing Region"},
+    {{0x0018,0x9445}, "", ""},
+    {{0x0018,0x9447}, "FL", "Column Angulation (Patient)"},
+    {{0x0018,0x9449}, "FL", "Beam Angle"},
+    {{0x0018,0x9451}, "SQ", "Frame Detector Parameters Sequence"},
+    {{0x0018,0x9452}, "FL", "Calculated Anatomy Thickness"},
+    {{0x0018,0x9455}, "SQ", "Calibration Sequence"},
+    {{0x0018,0x9456}, "SQ", "Object Thickness Sequence"},
+    {{0x0018,0x9457}, "CS", "Plane Identification"},
+    {{0x0018,0x9461}, "FL", "Field of View Dimension(s) in Float"},
+    {{0x0018,0x9462}, "SQ", "Isocenter Reference System Sequence"},
+    {{0x0018,0x9463}, "FL", "Positioner Isocenter Primary Angle"},
+    {{0x0018,0x9464}, "FL", "Positioner Isocenter Secondary Angle"},
+    {{0x0018,0x9465}, "FL", "Positioner Isocenter Detector Rotation Angle"},
+    {{0x0018,0x9466}, "FL", "Table X Position to Isocenter"},
+    {{0x0018,0x9467}, "FL", "Table Y Position to Isocenter"},
+    {{0x0018,0x9468}, "FL", "Table Z Position to Isocenter"},
+    {{0x0018,0x9469}, "FL", "Table Horizontal Rotation Angle"},
+    {{0x0018,0x9470}, "FL", "Table Head Tilt Angle"},
+    {{0x0018,0x9471}, "FL", "Table Cradle Tilt Angle"},
+    {{0x0018,0x9472}, "SQ", "Frame Display Shutter Sequence"},
+    {{0x0018,0x9473}, "FL", "Acquired Image Area Dose Product"},
+    {{0x0018,0x9474}, "CS", "C-arm Positioner Tabletop Relationship"},
+    {{0x0018,0x9476}, "SQ", "X-Ray Geometry Sequence"},
+    {{0x0018,0x9477}, "SQ", "Irradiation Event Identification Sequence"},
+    {{0x0018,0x9504}, "SQ", "X-Ray 3D Frame Type Sequence"},
+    {{0x0018,0x9506}, "SQ", "Contributing Sources Sequence"},
+    {{0x0018,0x9507}, "SQ", "X-Ray 3D Acquisition Sequence"},
+    {{0x0018,0x9508}, "FL", "Primary Positioner Scan Arc"},
+    {{0x0018,0x9509}, "FL", "Secondary Positioner Scan Arc"},
+    {{0x0018,0x9510}, "FL", "Primary Positioner Scan Start Angle"},
+    {{0x0018,0x9511}, "FL", "Secondary Positioner Scan Start Angle"},
+    {{0x0018,0x9514}, "FL", "Primary Positioner Increment"},
+    {{0x0018,0x9515}, "FL", "Secondary Positioner Increment"},
+    {{0x0018,0x9516}, "DT", "Start Acquisition DateTime"},
+    {{0x0018,0x9517}, "DT", "End Acquisition DateTime"},
+    {{0x0018,0x9518}, "SS", "Primary Positioner Increment Sign"},
+    {{0x0018,0x9519}, "SS", "Secondary Positioner Increment Sign"},
+    {{0x0018,0x9524}, "LO", "Application Name"},
+    {{0x0018,0x9525}, "LO", "Application Version"},
+    {{0x0018,0x9526}, "LO", "Application Manufacturer"},
+    {{0x0018,0x9527}, "CS", "Algorithm Type"},
+    {{0x0018,0x9528}, "LO", "Algorithm Description"},
+    {{0x0018,0x9530}, "SQ", "X-Ray 3D Reconstruction Sequence"},
+    {{0x0018,0x9531}, "LO", "Reconstruction Description"},
+    {{0x0018,0x9538}, "SQ", "Per Projection Acquisition Sequence"},
+    {{0x0018,0x9541}, "SQ", "Detector Position Sequence"},
+    {{0x0018,0x9542}, "SQ", "X-Ray Acquisition Dose Sequence"},
+    {{0x0018,0x9543}, "FD", "X-Ray Source Isocenter Primary Angle"},
+    {{0x0018,0x9544}, "FD", "X-Ray Source Isocenter Secondary Angle"},
+    {{0x0018,0x9545}, "FD", "Breast Support Isocenter Primary Angle"},
+    {{0x0018,0x9546}, "FD", "Breast Support Isocenter Secondary Angle"},
+    {{0x0018,0x9547}, "FD", "Breast Support X Position to Isocenter"},
+    {{0x0018,0x9548}, "FD", "Breast Support Y Position to Isocenter"},
+    {{0x0018,0x9549}, "FD", "Breast Support Z Position to Isocenter"},
+    {{0x0018,0x9550}, "FD", "Detector Isocenter Primary Angle"},
+    {{0x0018,0x9551}, "FD", "Detector Isocenter Secondary Angle"},
+    {{0x0018,0x9552}, "FD", "Detector X Position to Isocenter"},
+    {{0x0018,0x9553}, "FD", "Detector Y Position to Isocenter"},
+    {{0x0018,0x9554}, "FD", "Detector Z Position to Isocenter"},
+    {{0x0018,0x9555}, "SQ", "X-Ray Grid Sequence"},
+    {{0x0018,0x9556}, "SQ", "X-Ray Filter Sequence"},
+    {{0x0018,0x9557}, "FD", "Detector Active Area TLHC Position"},
+    {{0x0018,0x9558}, "FD", "Detector Active Area Orientation"},
+    {{0x0018,0x9559}, "CS", "Positioner Primary Angle Direction"},
+    {{0x0018,0x9601}, "SQ", "Diffusion b-matrix Sequence"},
+    {{0x0018,0x9602}, "FD", "Diffusion b-value XX"},
+    {{0x0018,0x9603}, "FD", "Diffusion b-value XY"},
+    {{0x0018,0x9604}, "FD", "Diffusion b-value XZ"},
+    {{0x0018,0x9605}, "FD", "Diffusion b-value YY"},
+    {{0x0018,0x9606}, "FD", "Diffusion b-value YZ"},
+    {{0x0018,0x9607}, "FD", "Diffusion b-value ZZ"},
+    {{0x0018,0x9621}, "SQ", "Functional MR Sequence"},
+    {{0x0018,0x9622}, "CS", "Functional Settling Phase Frames Present"},
+    {{0x0018,0x9623}, "DT", "Functional Sync Pulse"},
+    {{0x0018,0x9624}, "CS", "Settling Phase Frame"},
+    {{0x0018,0x9701}, "DT", "Decay Correction DateTime"},
+    {{0x0018,0x9715}, "FD", "Start Density Threshold"},
+    {{0x0018,0x9716}, "FD", "Start Relative Density Difference Threshold"},
+    {{0x0018,0x9717}, "FD", "Start Cardiac Trigger Count Threshold"},
+    {{0x0018,0x9718}, "FD", "Start Respiratory Trigger Count Threshold"},
+    {{0x0018,0x9719}, "FD", "Termination Counts Threshold"},
+    {{0x0018,0x9720}, "FD", "Termination Density Threshold"},
+    {{0x0018,0x9721}, "FD", "Termination Relative Density Threshold"},
+    {{0x0018,0x9722}, "FD", "Termination Time Threshold"},
+    {{0x0018,0x9723}, "FD", "Termination Cardiac Trigger Count Threshold"},
+    {{0x0018,0x9724}, "FD", "Termination Respiratory Trigger Count Threshold"},
+    {{0x0018,0x9725}, "CS", "Detector Geometry"},
+    {{0x0018,0x9726}, "FD", "Transverse Detector Separation"},
+    {{0x0018,0x9727}, "FD", "Axial Detector Dimension"},
+    {{0x0018,0x9729}, "US", "Radiopharmaceutical Agent Number"},
+    {{0x0018,0x9732}, "SQ", "PET Frame Acquisition Sequence"},
+    {{0x0018,0x9733}, "SQ", "PET Detector Motion Details Sequence"},
+    {{0x0018,0x9734}, "SQ", "PET Table Dynamics Sequence"},
+    {{0x0018,0x9735}, "SQ", "PET Position Sequence"},
+    {{0x0018,0x9736}, "SQ", "PET Frame Correction Factors Sequence"},
+    {{0x0018,0x9737}, "SQ", "Radiopharmaceutical Usage Sequence"},
+    {{0x0018,0x9738}, "CS", "Attenuation Correction Source"},
+    {{0x0018,0x9739}, "US", "Number of Iterations"},
+    {{0x0018,0x9740}, "US", "Number of Subsets"},
+    {{0x0018,0x9749}, "SQ", "PET Reconstruction Sequence"},
+    {{0x0018,0x9751}, "SQ", "PET Frame Type Sequence"},
+    {{0x0018,0x9755}, "CS", "Time of Flight Information Used"},
+    {{0x0018,0x9756}, "CS", "Reconstruction Type"},
+    {{0x0018,0x9758}, "CS", "Decay Corrected"},
+    {{0x0018,0x9759}, "CS", "Attenuation Corrected"},
+    {{0x0018,0x9760}, "CS", "Scatter Corrected"},
+    {{0x0018,0x9761}, "CS", "Dead Time Corrected"},
+    {{0x0018,0x9762}, "CS", "Gantry Motion Corrected"},
+    {{0x0018,0x9763}, "CS", "Patient Motion Corrected"},
+    {{0x0018,0x9764}, "CS", "Count Loss Normalization Corrected"},
+    {{0x0018,0x9765}, "CS", "Randoms Corrected"},
+    {{0x0018,0x9766}, "CS", "Non-uniform Radial Sampling Corrected"},
+    {{0x0018,0x9767}, "CS", "Sensitivity Calibrated"},
+    {{0x0018,0x9768}, "CS", "Detector Normalization Correction"},
+    {{0x0018,0x9769}, "CS", "Iterative Reconstruction Method"},
+    {{0x0018,0x9770}, "CS", "Attenuation Correction Temporal Relationship"},
+    {{0x0018,0x9771}, "SQ", "Patient Physiological State Sequence"},
+    {{0x0018,0x9772}, "SQ", "Patient Physiological State Code Sequence"},
+    {{0x0018,0x9801}, "FD", "Depth(s) of Focus"},
+    {{0x0018,0x9803}, "SQ", "Excluded Intervals Sequence"},
+    {{0x0018,0x9804}, "DT", "Exclusion Start DateTime"},
+    {{0x0018,0x9805}, "FD", "Exclusion Duration"},
+    {{0x0018,0x9806}, "SQ", "US Image Description Sequence"},
+    {{0x0018,0x9807}, "SQ", "Image Data Type Sequence"},
+    {{0x0018,0x9808}, "CS", "Data Type"},
+    {{0x0018,0x9809}, "SQ", "Transducer Scan Pattern Code Sequence"},
+    {{0x0018,0x980B}, "CS", "Aliased Data Type"},
+    {{0x0018,0x980C}, "CS", "Position Measuring Device Used"},
+    {{0x0018,0x980D}, "SQ", "Transducer Geometry Code Sequence"},
+    {{0x0018,0x980E}, "SQ", "Transducer Beam Steering Code Sequence"},
+    {{0x0018,0x980F}, "SQ", "Transducer Application Code Sequence"},
+    {{0x0018,0x9810}, "US", "Zero Velocity Pixel Value"},
+    {{0x0018,0xA001}, "SQ", "Contributing Equipment Sequence"},
+    {{0x0018,0xA002}, "DT", "Contribution DateTime"},
+    {{0x0018,0xA003}, "ST", "Contribution Description"},
+    {{0x0020,0x000D}, "UI", "Study Instance UID"},
+    {{0x0020,0x000E}, "UI", "Series Instance UID"},
+    {{0x0020,0x0010}, "SH", "Study ID"},
+    {{0x0020,0x0011}, "IS", "Series Number"},
+    {{0x0020,0x0012}, "IS", "Acquisition Number"},
+    {{0x0020,0x0013}, "IS", "Instance Number"},
+    {{0x0020,0x0014}, "IS", "Isotope Number"},
+    {{0x0020,0x0015}, "IS", "Phase Number"},
+    {{0x0020,0x0016}, "IS", "Interval Number"},
+    {{0x0020,0x0017}, "IS", "Time Slot Number"},
+    {{0x0020,0x0018}, "IS", "Angle Number"},
+    {{0x0020,0x0019}, "IS", "Item Number"},
+    {{0x0020,0x0020}, "CS", "Patient Orientation"},
+    {{0x0020,0x0022}, "IS", "Overlay Number"},
+    {{0x0020,0x0024}, "IS", "Curve Number"},
+    {{0x0020,0x0026}, "IS", "LUT Number"},
+    {{0x0020,0x0030}, "DS", "Image Position"},
+    {{0x0020,0x0032}, "DS", "Image Position (Patient)"},
+    {{0x0020,0x0035}, "DS", "Image Orientation"},
+    {{0x0020,0x0037}, "DS", "Image Orientation (Patient)"},
+    {{0x0020,0x0050}, "DS", "Location"},
+    {{0x0020,0x0052}, "UI", "Frame of Reference UID"},
+    {{0x0020,0x0060}, "CS", "Laterality"},
+    {{0x0020,0x0062}, "CS", "Image Laterality"},
+    {{0x0020,0x0070}, "LO", "Image Geometry Type"},
+    {{0x0020,0x0080}, "CS", "Masking Image"},
+    {{0x0020,0x00AA}, "IS", "Report Number"},
+    {{0x0020,0x0100}, "IS", "Temporal Position Identifier"},
+    {{0x0020,0x0105}, "IS", "Number of Temporal Positions"},
+    {{0x0020,0x0110}, "DS", "Temporal Resolution"},
+    {{0x0020,0x0200}, "UI", "Synchronization Frame of Reference UID"},
+    {{0x0020,0x0242}, "UI", "SOP Instance UID of Concatenation Source"},
+    {{0x0020,0x1000}, "IS", "Series in Study"},
+    {{0x0020,0x1001}, "IS", "Acquisitions in Series"},
+    {{0x0020,0x1002}, "IS", "Images in Acquisition"},
+    {{0x0020,0x1003}, "IS", "Images in Series"},
+    {{0x0020,0x1004}, "IS", "Acquisitions in Study"},
+    {{0x0020,0x1005}, "IS", "Images in Study"},
+    {{0x0020,0x1020}, "LO", "Reference"},
+    {{0x0020,0x1040}, "LO", "Position Reference Indicator"},
+    {{0x0020,0x1041}, "DS", "Slice Location"},
+    {{0x0020,0x1070}, "IS", "Other Study Numbers"},
+    {{0x0020,0x1200}, "IS", "Number of Patient Related Studies"},
+    {{0x0020,0x1202}, "IS", "Number of Patient Related Series"},
+    {{0x0020,0x1204}, "IS", "Number of Patient Related Instances"},
+    {{0x0020,0x1206}, "IS", "Number of Study Related Series"},
+    {{0x0020,0x1208}, "IS", "Number of Study Related Instances"},
+    {{0x0020,0x1209}, "IS", "Number of Series Related Instances"},
+    //{{0x0020,0x31xx}, "CS", "Source Image IDs"},
+    {{0x0020,0x3401}, "CS", "Modifying Device ID"},
+    {{0x0020,0x3402}, "CS", "Modified Image ID"},
+    {{0x0020,0x3403}, "DA", "Modified Image Date"},
+    {{0x0020,0x3404}, "LO", "Modifying Device Manufacturer"},
+    {{0x0020,0x3405}, "TM", "Modified Image Time"},
+    {{0x0020,0x3406}, "LO", "Modified Image Description"},
+    {{0x0020,0x4000}, "LT", "Image Comments"},
+    {{0x0020,0x5000}, "AT", "Original Image Identification"},
+    {{0x0020,0x5002}, "LO", "Original Image Identification Nomenclature"},
+    {{0x0020,0x9056}, "SH", "Stack ID"},
+    {{0x0020,0x9057}, "UL", "In-Stack Position Number"},
+    {{0x0020,0x9071}, "SQ", "Frame Anatomy Sequence"},
+    {{0x0020,0x9072}, "CS", "Frame Laterality"},
+    {{0x0020,0x9111}, "SQ", "Frame Content Sequence"},
+    {{0x0020,0x9113}, "SQ", "Plane Position Sequence"},
+    {{0x0020,0x9116}, "SQ", "Plane Orientation Sequence"},
+    {{0x0020,0x9128}, "UL", "Temporal Position Index"},
+    {{0x0020,0x9153}, "FD", "Nominal Cardiac Trigger Delay Time"},
+    {{0x0020,0x9154}, "FL", "Nominal Cardiac Trigger Time Prior To R-Peak"},
+    {{0x0020,0x9155}, "FL", "Actual Cardiac Trigger Time Prior To R-Peak"},
+    {{0x0020,0x9156}, "US", "Frame Acquisition Number"},
+    {{0x0020,0x9157}, "UL", "Dimension Index Values"},
+    {{0x0020,0x9158}, "LT", "Frame Comments"},
+    {{0x0020,0x9161}, "UI", "Concatenation UID"},
+    {{0x0020,0x9162}, "US", "In-concatenation Number"},
+    {{0x0020,0x9163}, "US", "In-concatenation Total Number"},
+    {{0x0020,0x9164}, "UI", "Dimension Organization UID"},
+    {{0x0020,0x9165}, "AT", "Dimension Index Pointer"},
+    {{0x0020,0x9167}, "AT", "Functional Group Pointer"},
+    {{0x0020,0x9170}, "SQ", "Unassigned Shared Converted Attributes Sequence"},
+    {{0x0020,0x9171}, "SQ", "Unassigned Per-Frame Converted Attributes Sequence"},
+    {{0x0020,0x9172}, "SQ", "Conversion Source Attributes Sequence"},
+    {{0x0020,0x9213}, "LO", "Dimension Index Private Creator"},
+    {{0x0020,0x9221}, "SQ", "Dimension Organization Sequence"},
+    {{0x0020,0x9222}, "SQ", "Dimension Index Sequence"},
+    {{0x0020,0x9228}, "UL", "Concatenation Frame Offset Number"},
+    {{0x0020,0x9238}, "LO", "Functional Group Private Creator"},
+    {{0x0020,0x9241}, "FL", "Nominal Percentage of Cardiac Phase"},
+    {{0x0020,0x9245}, "FL", "Nominal Percentage of Respiratory Phase"},
+    {{0x0020,0x9246}, "FL", "Starting Respiratory Amplitude"},
+    {{0x0020,0x9247}, "CS", "Starting Respiratory Phase"},
+    {{0x0020,0x9248}, "FL", "Ending Respiratory Amplitude"},
+    {{0x0020,0x9249}, "CS", "Ending Respiratory Phase"},
+    {{0x0020,0x9250}, "CS", "Respiratory Trigger Type"},
+    {{0x0020,0x9251}, "FD", "R-R Interval Time Nominal"},
+    {{0x0020,0x9252}, "FD", "Actual Cardiac Trigger Delay Time"},
+    {{0x0020,0x9253}, "SQ", "Respiratory Synchronization Sequence"},
+    {{0x0020,0x9254}, "FD", "Respiratory Interval Time"},
+    {{0x0020,0x9255}, "FD", "Nominal Respiratory Trigger Delay Time"},
+    {{0x0020,0x9256}, "FD", "Respiratory Trigger Delay Threshold"},
+    {{0x0020,0x9257}, "FD", "Actual Respiratory Trigger Delay Time"},
+    {{0x0020,0x9301}, "FD", "Image Position (Volume)"},
+    {{0x0020,0x9302}, "FD", "Image Orientation (Volume)"},
+    {{0x0020,0x9307}, "CS", "Ultrasound Acquisition Geometry"},
+    {{0x0020,0x9308}, "FD", "Apex Position"},
+    {{0x0020,0x9309}, "FD", "Volume to Transducer Mapping Matrix"},
+    {{0x0020,0x930A}, "FD", "Volume to Table Mapping Matrix"},
+    {{0x0020,0x930B}, "CS", "Volume to Transducer Relationship"},
+    {{0x0020,0x930C}, "CS", "Patient Frame of Reference Source"},
+    {{0x0020,0x930D}, "FD", "Temporal Position Time Offset"},
+    {{0x0020,0x930E}, "SQ", "Plane Position (Volume) Sequence"},
+    {{0x0020,0x930F}, "SQ", "Plane Orientation (Volume) Sequence"},
+    {{0x0020,0x9310}, "SQ", "Temporal Position Sequence"},
+    {{0x0020,0x9311}, "CS", "Dimension Organization Type"},
+    {{0x0020,0x9312}, "UI", "Volume Frame of Reference UID"},
+    {{0x0020,0x9313}, "UI", "Table Frame of Reference UID"},
+    {{0x0020,0x9421}, "LO", "Dimension Description Label"},
+    {{0x0020,0x9450}, "SQ", "Patient Orientation in Frame Sequence"},
+    {{0x0020,0x9453}, "LO", "Frame Label"},
+    {{0x0020,0x9518}, "US", "Acquisition Index"},
+    {{0x0020,0x9529}, "SQ", "Contributing SOP Instances Reference Sequence"},
+    {{0x0020,0x9536}, "US", "Reconstruction Index"},
+    {{0x0022,0x0001}, "US", "Light Path Filter Pass-Through Wavelength"},
+    {{0x0022,0x0002}, "US", "Light Path Filter Pass Band"},
+    {{0x0022,0x0003}, "US", "Image Path Filter Pass-Through Wavelength"},
+    {{0x0022,0x0004}, "US", "Image Path Filter Pass Band"},
+    {{0x0022,0x0005}, "CS", "Patient Eye Movement Commanded"},
+    {{0x0022,0x0006}, "SQ", "Patient Eye Movement Command Code Sequence"},
+    {{0x0022,0x0007}, "FL", "Spherical Lens Power"},
+    {{0x0022,0x0008}, "FL", "Cylinder Lens Power"},
+    {{0x0022,0x0009}, "FL", "Cylinder Axis"},
+    {{0x0022,0x000A}, "FL", "Emmetropic Magnification"},
+    {{0x0022,0x000B}, "FL", "Intra Ocular Pressure"},
+    {{0x0022,0x000C}, "FL", "Horizontal Field of View"},
+    {{0x0022,0x000D}, "CS", "Pupil Dilated"},
+    {{0x0022,0x000E}, "FL", "Degree of Dilation"},
+    {{0x0022,0x0010}, "FL", "Stereo Baseline Angle"},
+    {{0x0022,0x0011}, "FL", "Stereo Baseline Displacement"},
+    {{0x0022,0x0012}, "FL", "Stereo Horizontal Pixel Offset"},
+    {{0x0022,0x0013}, "FL", "Stereo Vertical Pixel Offset"},
+    {{0x0022,0x0014}, "FL", "Stereo Rotation"},
+    {{0x0022,0x0015}, "SQ", "Acquisition Device Type Code Sequence"},
+    {{0x0022,0x0016}, "SQ", "Illumination Type Code Sequence"},
+    {{0x0022,0x0017}, "SQ", "Light Path Filter Type Stack Code Sequence"},
+    {{0x0022,0x0018}, "SQ", "Image Path Filter Type Stack Code Sequence"},
+    {{0x0022,0x0019}, "SQ", "Lenses Code Sequence"},
+    {{0x0022,0x001A}, "SQ", "Channel Description Code Sequence"},
+    {{0x0022,0x001B}, "SQ", "Refractive State Sequence"},
+    {{0x0022,0x001C}, "SQ", "Mydriatic Agent Code Sequence"},
+    {{0x0022,0x001D}, "SQ", "Relative Image Position Code Sequence"},
+    {{0x0022,0x001E}, "FL", "Camera Angle of View"},
+    {{0x0022,0x0020}, "SQ", "Stereo Pairs Sequence"},
+    {{0x0022,0x0021}, "SQ", "Left Image Sequence"},
+    {{0x0022,0x0022}, "SQ", "Right Image Sequence"},
+    {{0x0022,0x0028}, "CS", "Stereo Pairs Present"},
+    {{0x0022,0x0030}, "FL", "Axial Length of the Eye"},
+    {{0x0022,0x0031}, "SQ", "Ophthalmic Frame Location Sequence"},
+    {{0x0022,0x0032}, "FL", "Reference Coordinates"},
+    {{0x0022,0x0035}, "FL", "Depth Spatial Resolution"},
+    {{0x0022,0x0036}, "FL", "Maximum Depth Distortion"},
+    {{0x0022,0x0037}, "FL", "Along-scan Spatial Resolution"},
+    {{0x0022,0x0038}, "FL", "Maximum Along-scan Distortion"},
+    {{0x0022,0x0039}, "CS", "Ophthalmic Image Orientation"},
+    {{0x0022,0x0041}, "FL", "Depth of Transverse Image"},
+    {{0x0022,0x0042}, "SQ", "Mydriatic Agent Concentration Units Sequence"},
+    {{0x0022,0x0048}, "FL", "Across-scan Spatial Resolution"},
+    {{0x0022,0x0049}, "FL", "Maximum Across-scan Distortion"},
+    {{0x0022,0x004E}, "DS", "Mydriatic Agent Concentration"},
+    {{0x0022,0x0055}, "FL", "Illumination Wave Length"},
+    {{0x0022,0x0056}, "FL", "Illumination Power"},
+    {{0x0022,0x0057}, "FL", "Illumination Bandwidth"},
+    {{0x0022,0x0058}, "SQ", "Mydriatic Agent Sequence"},
+    {{0x0022,0x1007}, "SQ", "Ophthalmic Axial Measurements Right Eye Sequence"},
+    {{0x0022,0x1008}, "SQ", "Ophthalmic Axial Measurements Left Eye Sequence"},
+    {{0x0022,0x1009}, "CS", "Ophthalmic Axial Measurements Device Type"},
+    {{0x0022,0x1010}, "CS", "Ophthalmic Axial Length Measurements Type"},
+    {{0x0022,0x1012}, "SQ", "Ophthalmic Axial Length Sequence"},
+    {{0x0022,0x1019}, "FL", "Ophthalmic Axial Length"},
+    {{0x0022,0x1024}, "SQ", "Lens Status Code Sequence"},
+    {{0x0022,0x1025}, "SQ", "Vitreous Status Code Sequence"},
+    {{0x0022,0x1028}, "SQ", "IOL Formula Code Sequence"},
+    {{0x0022,0x1029}, "LO", "IOL Formula Detail"},
+    {{0x0022,0x1033}, "FL", "Keratometer Index"},
+    {{0x0022,0x1035}, "SQ", "Source of Ophthalmic Axial Length Code Sequence"},
+    {{0x0022,0x1037}, "FL", "Target Refraction"},
+    {{0x0022,0x1039}, "CS", "Refractive Procedure Occurred"},
+    {{0x0022,0x1040}, "SQ", "Refractive Surgery Type Code Sequence"},
+    {{0x0022,0x1044}, "SQ", "Ophthalmic Ultrasound Method Code Sequence"},
+    {{0x0022,0x1050}, "SQ", "Ophthalmic Axial Length Measurements Sequence"},
+    {{0x0022,0x1053}, "FL", "IOL Power"},
+    {{0x0022,0x1054}, "FL", "Predicted Refractive Error"},
+    {{0x0022,0x1059}, "FL", "Ophthalmic Axial Length Velocity"},
+    {{0x0022,0x1065}, "LO", "Lens Status Description"},
+    {{0x0022,0x1066}, "LO", "Vitreous Status Description"},
+    {{0x0022,0x1090}, "SQ", "IOL Power Sequence"},
+    {{0x0022,0x1092}, "SQ", "Lens Constant Sequence"},
+    {{0x0022,0x1093}, "LO", "IOL Manufacturer"},
+    {{0x0022,0x1094}, "LO", "Lens Constant Description"},
+    {{0x0022,0x1095}, "LO", "Implant Name"},
+    {{0x0022,0x1096}, "SQ", "Keratometry Measurement Type Code Sequence"},
+    {{0x0022,0x1097}, "LO", "Implant Part Number"},
+    {{0x0022,0x1100}, "SQ", "Referenced Ophthalmic Axial Measurements Sequence"},
+    {{0x0022,0x1101}, "SQ", "Ophthalmic Axial Length Measurements Segment Name Code Sequence"},
+    {{0x0022,0x1103}, "SQ", "Refractive Error Before Refractive Surgery Code Sequence"},
+    {{0x0022,0x1121}, "FL", "IOL Power For Exact Emmetropia"},
+    {{0x0022,0x1122}, "FL", "IOL Power For Exact Target Refraction"},
+    {{0x0022,0x1125}, "SQ", "Anterior Chamber Depth Definition Code Sequence"},
+    {{0x0022,0x1127}, "SQ", "Lens Thickness Sequence"},
+    {{0x0022,0x1128}, "SQ", "Anterior Chamber Depth Sequence"},
+    {{0x0022,0x1130}, "FL", "Lens Thickness"},
+    {{0x0022,0x1131}, "FL", "Anterior Chamber Depth"},
+    {{0x0022,0x1132}, "SQ", "Source of Lens Thickness Data Code Sequence"},
+    {{0x0022,0x1133}, "SQ", "Source of Anterior Chamber Depth Data Code Sequence"},
+    {{0x0022,0x1134}, "SQ", "Source of Refractive Measurements Sequence"},
+    {{0x0022,0x1135}, "SQ", "Source of Refractive Measurements Code Sequence"},
+    {{0x0022,0x1140}, "CS", "Ophthalmic Axial Length Measurement Modified"},
+    {{0x0022,0x1150}, "SQ", "Ophthalmic Axial Length Data Source Code Sequence"},
+    {{0x0022,0x1153}, "SQ", "Ophthalmic Axial Length Acquisition Method Code Sequence"},
+    {{0x0022,0x1155}, "FL", "Signal to Noise Ratio"},
+    {{0x0022,0x1159}, "LO", "Ophthalmic Axial Length Data Source Description"},
+    {{0x0022,0x1210}, "SQ", "Ophthalmic Axial Length Measurements Total Length Sequence"},
+    {{0x0022,0x1211}, "SQ", "Ophthalmic Axial Length Measurements Segmental Length Sequence"},
+    {{0x0022,0x1212}, "SQ", "Ophthalmic Axial Length Measurements Length Summation Sequence"},
+    {{0x0022,0x1220}, "SQ", "Ultrasound Ophthalmic Axial Length Measurements Sequence"},
+    {{0x0022,0x1225}, "SQ", "Optical Ophthalmic Axial Length Measurements Sequence"},
+    {{0x0022,0x1230}, "SQ", "Ultrasound Selected Ophthalmic Axial Length Sequence"},
+    {{0x0022,0x1250}, "SQ", "Ophthalmic Axial Length Selection Method Code Sequence"},
+    {{0x0022,0x1255}, "SQ", "Optical Selected Ophthalmic Axial Length Sequence"},
+    {{0x0022,0x1257}, "SQ", "Selected Segmental Ophthalmic Axial Length Sequence"},
+    {{0x0022,0x1260}, "SQ", "Selected Total Ophthalmic Axial Length Sequence"},
+    {{0x0022,0x1262}, "SQ", "Ophthalmic Axial Length Quality Metric Sequence"},
+    {{0x0022,0x1265}, "SQ", "Ophthalmic Axial Length Quality Metric Type Code Sequence"},
+    {{0x0022,0x1273}, "LO", "Ophthalmic Axial Length Quality Metric Type Description"},
+    {{0x0022,0x1300}, "SQ", "Intraocular Lens Calculations Right Eye Sequence"},
+    {{0x0022,0x1310}, "SQ", "Intraocular Lens Calculations Left Eye Sequence"},
+    {{0x0022,0x1330}, "SQ", "Referenced Ophthalmic Axial Length Measurement QC Image Sequence"},
+    {{0x0022,0x1415}, "CS", "Ophthalmic Mapping Device Type"},
+    {{0x0022,0x1420}, "SQ", "Acquisition Method Code Sequence"},
+    {{0x0022,0x1423}, "SQ", "Acquisition Method Algorithm Sequence"},
+    {{0x0022,0x1436}, "SQ", "Ophthalmic Thickness Map Type Code Sequence"},
+    {{0x0022,0x1443}, "SQ", "Ophthalmic Thickness Mapping Normals Sequence"},
+    {{0x0022,0x1445}, "SQ", "Retinal Thickness Definition Code Sequence"},
+    {{0x0022,0x1450}, "SQ", "Pixel Value Mapping to Coded Concept Sequence"},
+    {{0x0022,0x1452}, "SS", "Mapped Pixel Value"},
+    {{0x0022,0x1454}, "LO", "Pixel Value Mapping Explanation"},
+    {{0x0022,0x1458}, "SQ", "Ophthalmic Thickness Map Quality Threshold Sequence"},
+    {{0x0022,0x1460}, "FL", "Ophthalmic Thickness Map Threshold Quality Rating"},
+    {{0x0022,0x1463}, "FL", "Anatomic Structure Reference Point"},
+    {{0x0022,0x1465}, "SQ", "Registration to Localizer Sequence"},
+    {{0x0022,0x1466}, "CS", "Registered Localizer Units"},
+    {{0x0022,0x1467}, "FL", "Registered Localizer Top Left Hand Corner"},
+    {{0x0022,0x1468}, "FL", "Registered Localizer Bottom Right Hand Corner"},
+    {{0x0022,0x1470}, "SQ", "Ophthalmic Thickness Map Quality Rating Sequence"},
+    {{0x0022,0x1472}, "SQ", "Relevant OPT Attributes Sequence"},
+    {{0x0022,0x1512}, "SQ", "Transformation Method Code Sequence"},
+    {{0x0022,0x1513}, "SQ", "Transformation Algorithm Sequence"},
+    {{0x0022,0x1515}, "CS", "Ophthalmic Axial Length Method"},
+    {{0x0022,0x1517}, "FL", "Ophthalmic FOV"},
+    {{0x0022,0x1518}, "SQ", "Two Dimensional to Three Dimensional Map Sequence"},
+    {{0x0022,0x1525}, "SQ", "Wide Field Ophthalmic Photography Quality Rating Sequence"},
+    {{0x0022,0x1526}, "SQ", "Wide Field Ophthalmic Photography Quality Threshold Sequence"},
+    {{0x0022,0x1527}, "FL", "Wide Field Ophthalmic Photography Threshold Quality Rating"},
+    {{0x0022,0x1528}, "FL", "X Coordinates Center Pixel View Angle"},
+    {{0x0022,0x1529}, "FL", "Y Coordinates Center Pixel View Angle"},
+    {{0x0022,0x1530}, "UL", "Number of Map Points"},
+    {{0x0022,0x1531}, "OF", "Two Dimensional to Three Dimensional Map Data"},
+    {{0x0024,0x0010}, "FL", "Visual Field Horizontal Extent"},
+    {{0x0024,0x0011}, "FL", "Visual Field Vertical Extent"},
+    {{0x0024,0x0012}, "CS", "Visual Field Shape"},
+    {{0x0024,0x0016}, "SQ", "Screening Test Mode Code Sequence"},
+    {{0x0024,0x0018}, "FL", "Maximum Stimulus Luminance"},
+    {{0x0024,0x0020}, "FL", "Background Luminance"},
+    {{0x0024,0x0021}, "SQ", "Stimulus Color Code Sequence"},
+    {{0x0024,0x0024}, "SQ", "Background Illumination Color Code Sequence"},
+    {{0x0024,0x0025}, "FL", "Stimulus Area"},
+    {{0x0024,0x0028}, "FL", "Stimulus Presentation Time"},
+    {{0x0024,0x0032}, "SQ", "Fixation Sequence"},
+    {{0x0024,0x0033}, "SQ", "Fixation Monitoring Code Sequence"},
+    {{0x0024,0x0034}, "SQ", "Visual Field Catch Trial Sequence"},
+    {{0x0024,0x0035}, "US", "Fixation Checked Quantity"},
+    {{0x0024,0x0036}, "US", "Patient Not Properly Fixated Quantity"},
+    {{0x0024,0x0037}, "CS", "Presented Visual Stimuli Data Flag"},
+    {{0x0024,0x0038}, "US", "Number of Visual Stimuli"},
+    {{0x0024,0x0039}, "CS", "Excessive Fixation Losses Data Flag"},
+    {{0x0024,0x0040}, "CS", "Excessive Fixation Losses"},
+    {{0x0024,0x0042}, "US", "Stimuli Retesting Quantity"},
+    {{0x0024,0x0044}, "LT", "Comments on Patient's Performance of Visual Field"},
+    {{0x0024,0x0045}, "CS", "False Negatives Estimate Flag"},
+    {{0x0024,0x0046}, "FL", "False Negatives Estimate"},
+    {{0x0024,0x0048}, "US", "Negative Catch Trials Quantity"},
+    {{0x0024,0x0050}, "US", "False Negatives Quantity"},
+    {{0x0024,0x0051}, "CS", "Excessive False Negatives Data Flag"},
+    {{0x0024,0x0052}, "CS", "Excessive False Negatives"},
+    {{0x0024,0x0053}, "CS", "False Positives Estimate Flag"},
+    {{0x0024,0x0054}, "FL", "False Positives Estimate"},
+    {{0x0024,0x0055}, "CS", "Catch Trials Data Flag"},
+    {{0x0024,0x0056}, "US", "Positive Catch Trials Quantity"},
+    {{0x0024,0x0057}, "CS", "Test Point Normals Data Flag"},
+    {{0x0024,0x0058}, "SQ", "Test Point Normals Sequence"},
+    {{0x0024,0x0059}, "CS", "Global Deviation Probability Normals Flag"},
+    {{0x0024,0x0060}, "US", "False Positives Quantity"},
+    {{0x0024,0x0061}, "CS", "Excessive False Positives Data Flag"},
+    {{0x0024,0x0062}, "CS", "Excessive False Positives"},
+    {{0x0024,0x0063}, "CS", "Visual Field Test Normals Flag"},
+    {{0x0024,0x0064}, "SQ", "Results Normals Sequence"},
+    {{0x0024,0x0065}, "SQ", "Age Corrected Sensitivity Deviation Algorithm Sequence"},
+    {{0x0024,0x0066}, "FL", "Global Deviation From Normal"},
+    {{0x0024,0x0067}, "SQ", "Generalized Defect Sensitivity Deviation Algorithm Sequence"},
+    {{0x0024,0x0068}, "FL", "Localized Deviation From Normal"},
+    {{0x0024,0x0069}, "LO", "Patient Reliability Indicator"},
+    {{0x0024,0x0070}, "FL", "Visual Field Mean Sensitivity"},
+    {{0x0024,0x0071}, "FL", "Global Deviation Probability"},
+    {{0x0024,0x0072}, "CS", "Local Deviation Probability Normals Flag"},
+    {{0x0024,0x0073}, "FL", "Localized Deviation Probability"},
+    {{0x0024,0x0074}, "CS", "Short Term Fluctuation Calculated"},
+    {{0x0024,0x0075}, "FL", "Short Term Fluctuation"},
+    {{0x0024,0x0076}, "CS", "Short Term Fluctuation Probability Calculated"},
+    {{0x0024,0x0077}, "FL", "Short Term Fluctuation Probability"},
+    {{0x0024,0x0078}, "CS", "Corrected Localized Deviation From Normal Calculated"},
+    {{0x0024,0x0079}, "FL", "Corrected Localized Deviation From Normal"},
+    {{0x0024,0x0080}, "CS", "Corrected Localized Deviation From Normal Probability Calculated"},
+    {{0x0024,0x0081}, "FL", "Corrected Localized Deviation From Normal Probability"},
+    {{0x0024,0x0083}, "SQ", "Global Deviation Probability Sequence"},
+    {{0x0024,0x0085}, "SQ", "Localized Deviation Probability Sequence"},
+    {{0x0024,0x0086}, "CS", "Foveal Sensitivity Measured"},
+    {{0x0024,0x0087}, "FL", "Foveal Sensitivity"},
+    {{0x0024,0x0088}, "FL", "Visual Field Test Duration"},
+    {{0x0024,0x0089}, "SQ", "Visual Field Test Point Sequence"},
+    {{0x0024,0x0090}, "FL", "Visual Field Test Point X-Coordinate"},
+    {{0x0024,0x0091}, "FL", "Visual Field Test Point Y-Coordinate"},
+    {{0x0024,0x0092}, "FL", "Age Corrected Sensitivity Deviation Value"},
+    {{0x0024,0x0093}, "CS", "Stimulus Results"},
+    {{0x0024,0x0094}, "FL", "Sensitivity Value"},
+    {{0x0024,0x0095}, "CS", "Retest Stimulus Seen"},
+    {{0x0024,0x0096}, "FL", "Retest Sensitivity Value"},
+    {{0x0024,0x0097}, "SQ", "Visual Field Test Point Normals Sequence"},
+    {{0x0024,0x0098}, "FL", "Quantified Defect"},
+    {{0x0024,0x0100}, "FL", "Age Corrected Sensitivity Deviation Probability Value"},
+    {{0x0024,0x0102}, "CS", "Generalized Defect Corrected Sensitivity Deviation Flag"},
+    {{0x0024,0x0103}, "FL", "Generalized Defect Corrected Sensitivity Deviation Value"},
+    {{0x0024,0x0104}, "FL", "Generalized Defect Corrected Sensitivity Deviation Probability Value"},
+    {{0x0024,0x0105}, "FL", "Minimum Sensitivity Value"},
+    {{0x0024,0x0106}, "CS", "Blind Spot Localized"},
+    {{0x0024,0x0107}, "FL", "Blind Spot X-Coordinate"},
+    {{0x0024,0x0108}, "FL", "Blind Spot Y-Coordinate"},
+    {{0x0024,0x0110}, "SQ", "Visual Acuity Measurement Sequence"},
+    {{0x0024,0x0112}, "SQ", "Refractive Parameters Used on Patient Sequence"},
+    {{0x0024,0x0113}, "CS", "Measurement Laterality"},
+    {{0x0024,0x0114}, "SQ", "Ophthalmic Patient Clinical Information Left Eye Sequence"},
+    {{0x0024,0x0115}, "SQ", "Ophthalmic Patient Clinical Information Right Eye Sequence"},
+    {{0x0024,0x0117}, "CS", "Foveal Point Normative Data Flag"},
+    {{0x0024,0x0118}, "FL", "Foveal Point Probability Value"},
+    {{0x0024,0x0120}, "CS", "Screening Baseline Measured"},
+    {{0x0024,0x0122}, "SQ", "Screening Baseline Measured Sequence"},
+    {{0x0024,0x0124}, "CS", "Screening Baseline Type"},
+    {{0x0024,0x0126}, "FL", "Screening Baseline Value"},
+    {{0x0024,0x0202}, "LO", "Algorithm Source"},
+    {{0x0024,0x0306}, "LO", "Data Set Name"},
+    {{0x0024,0x0307}, "LO", "Data Set Version"},
+    {{0x0024,0x0308}, "LO", "Data Set Source"},
+    {{0x0024,0x0309}, "LO", "Data Set Description"},
+    {{0x0024,0x0317}, "SQ", "Visual Field Test Reliability Global Index Sequence"},
+    {{0x0024,0x0320}, "SQ", "Visual Field Global Results Index Sequence"},
+    {{0x0024,0x0325}, "SQ", "Data Observation Sequence"},
+    {{0x0024,0x0338}, "CS", "Index Normals Flag"},
+    {{0x0024,0x0341}, "FL", "Index Probability"},
+    {{0x0024,0x0344}, "SQ", "Index Probability Sequence"},
+    {{0x0028,0x0002}, "US", "Samples per Pixel"},
+    {{0x0028,0x0003}, "US", "Samples per Pixel Used"},
+    {{0x0028,0x0004}, "CS", "Photometric Interpretation"},
+    {{0x0028,0x0005}, "US", "Image Dimensions"},
+    {{0x0028,0x0006}, "US", "Planar Configuration"},
+    {{0x0028,0x0008}, "IS", "Number of Frames"},
+    {{0x0028,0x0009}, "AT", "Frame Increment Pointer"},
+    {{0x0028,0x000A}, "AT", "Frame Dimension Pointer"},
+    {{0x0028,0x0010}, "US", "Rows"},
+    {{0x0028,0x0011}, "US", "Columns"},
+    {{0x0028,0x0012}, "US", "Planes"},
+    {{0x0028,0x0014}, "US", "Ultrasound Color Data Present"},
+    {{0x0028,0x0020}, "", ""},
+    {{0x0028,0x0030}, "DS", "Pixel Spacing"},
+    {{0x0028,0x0031}, "DS", "Zoom Factor"},
+    {{0x0028,0x0032}, "DS", "Zoom Center"},
+    {{0x0028,0x0034}, "IS", "Pixel Aspect Ratio"},
+    {{0x0028,0x0040}, "CS", "Image Format"},
+    {{0x0028,0x0050}, "LO", "Manipulated Image"},
+    {{0x0028,0x0051}, "CS", "Corrected Image"},
+    {{0x0028,0x005F}, "LO", "Compression Recognition Code"},
+    {{0x0028,0x0060}, "CS", "Compression Code"},
+    {{0x0028,0x0061}, "SH", "Compression Originator"},
+    {{0x0028,0x0062}, "LO", "Compression Label"},
+    {{0x0028,0x0063}, "SH", "Compression Description"},
+    {{0x0028,0x0065}, "CS", "Compression Sequence"},
+    {{0x0028,0x0066}, "AT", "Compression Step Pointers"},
+    {{0x0028,0x0068}, "US", "Repeat Interval"},
+    {{0x0028,0x0069}, "US", "Bits Grouped"},
+    {{0x0028,0x0070}, "US", "Perimeter Table"},
+    {{0x0028,0x0071}, "US", "Perimeter Value"},
+    {{0x0028,0x0080}, "US", "Predictor Rows"},
+    {{0x0028,0x0081}, "US", "Predictor Columns"},
+    {{0x0028,0x0082}, "US", "Predictor Constants"},
+    {{0x0028,0x0090}, "CS", "Blocked Pixels"},
+    {{0x0028,0x0091}, "US", "Block Rows"},
+    {{0x0028,0x0092}, "US", "Block Columns"},
+    {{0x0028,0x0093}, "US", "Row Overlap"},
+    {{0x0028,0x0094}, "US", "Column Overlap"},
+    {{0x0028,0x0100}, "US", "Bits Allocated"},
+    {{0x0028,0x0101}, "US", "Bits Stored"},
+    {{0x0028,0x0102}, "US", "High Bit"},
+    {{0x0028,0x0103}, "US", "Pixel Representation"},
+    {{0x0028,0x0104}, "SS", "Smallest Valid Pixel Value"},
+    {{0x0028,0x0105}, "SS", "Largest Valid Pixel Value"},
+    {{0x0028,0x0106}, "SS", "Smallest Image Pixel Value"},
+    {{0x0028,0x0107}, "SS", "Largest Image Pixel Value"},
+    {{0x0028,0x0108}, "SS", "Smallest Pixel Value in Series"},
+    {{0x0028,0x0109}, "SS", "Largest Pixel Value in Series"},
+    {{0x0028,0x0110}, "SS", "Smallest Image Pixel Value in Plane"},
+    {{0x0028,0x0111}, "SS", "Largest Image Pixel Value in Plane"},
+    {{0x0028,0x0120}, "US", "Pixel Padding Value"},
+    {{0x0028,0x0121}, "US", "Pixel Padding Range Limit"},
+    {{0x0028,0x0122}, "FL", "Float Pixel Padding Value"},
+    {{0x0028,0x0123}, "FD", "Double Float Pixel Padding Value"},
+    {{0x0028,0x0124}, "FL", "Float Pixel Padding Range Limit"},
+    {{0x0028,0x0125}, "FD", "Double Float Pixel Padding Range Limit"},
+    {{0x0028,0x0200}, "US", "Image Location"},
+    {{0x0028,0x0300}, "CS", "Quality Control Image"},
+    {{0x0028,0x0301}, "CS", "Burned In Annotation"},
+    {{0x0028,0x0302}, "CS", "Recognizable Visual Features"},
+    {{0x0028,0x0303}, "CS", "Longitudinal Temporal Information Modified"},
+    {{0x0028,0x0304}, "UI", "Referenced Color Palette Instance UID"},
+    {{0x0028,0x0400}, "LO", "Transform Label"},
+    {{0x0028,0x0401}, "LO", "Transform Version Number"},
+    {{0x0028,0x0402}, "US", "Number of Transform Steps"},
+    {{0x0028,0x0403}, "LO", "Sequence of Compressed Data"},
+    {{0x0028,0x0404}, "AT", "Details of Coefficients"},
+    //{{0x0028,0x04x0}, "US", "Rows For Nth Order Coefficients"},
+    //{{0x0028,0x04x1}, "US", "Columns For Nth Order Coefficients"},
+    //{{0x0028,0x04x2}, "LO", "Coefficient Coding"},
+    //{{0x0028,0x04x3}, "AT", "Coefficient Coding Pointers"},
+    {{0x0028,0x0700}, "LO", "DCT Label"},
+    {{0x0028,0x0701}, "CS", "Data Block Description"},
+    {{0x0028,0x0702}, "AT", "Data Block"},
+    {{0x0028,0x0710}, "US", "Normalization Factor Format"},
+    {{0x0028,0x0720}, "US", "Zonal Map Number Format"},
+    {{0x0028,0x0721}, "AT", "Zonal Map Location"},
+    {{0x0028,0x0722}, "US", "Zonal Map Format"},
+    {{0x0028,0x0730}, "US", "Adaptive Map Format"},
+    {{0x0028,0x0740}, "US", "Code Number Format"},
+    //{{0x0028,0x08x0}, "CS", "Code Label"},
+    //{{0x0028,0x08x2}, "US", "Number of Tables"},
+    //{{0x0028,0x08x3}, "AT", "Code Table Location"},
+    //{{0x0028,0x08x4}, "US", "Bits For Code Word"},
+    //{{0x0028,0x08x8}, "AT", "Image Data Location"},
+    {{0x0028,0x0A02}, "CS", "Pixel Spacing Calibration Type"},
+    {{0x0028,0x0A04}, "LO", "Pixel Spacing Calibration Description"},
+    {{0x0028,0x1040}, "CS", "Pixel Intensity Relationship"},
+    {{0x0028,0x1041}, "SS", "Pixel Intensity Relationship Sign"},
+    {{0x0028,0x1050}, "DS", "Window Center"},
+    {{0x0028,0x1051}, "DS", "Window Width"},
+    {{0x0028,0x1052}, "DS", "Rescale Intercept"},
+    {{0x0028,0x1053}, "DS", "Rescale Slope"},
+    {{0x0028,0x1054}, "LO", "Rescale Type"},
+    {{0x0028,0x1055}, "LO", "Window Center & Width Explanation"},
+    {{0x0028,0x1056}, "CS", "VOI LUT Function"},
+    {{0x0028,0x1080}, "CS", "Gray Scale"},
+    {{0x0028,0x1090}, "CS", "Recommended Viewing Mode"},
+    {{0x0028,0x1100}, "SS", "Gray Lookup Table Descriptor"},
+    {{0x0028,0x1101}, "SS", "Red Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1102}, "SS", "Green Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1103}, "SS", "Blue Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1104}, "US", "Alpha Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1111}, "SS", "Large Red Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1112}, "SS", "Large Green Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1113}, "SS", "Large Blue Palette Color Lookup Table Descriptor"},
+    {{0x0028,0x1199}, "UI", "Palette Color Lookup Table UID"},
+    {{0x0028,0x1200}, "SS or OW", "Gray Lookup Table Data"},
+    {{0x0028,0x1201}, "OW", "Red Palette Color Lookup Table Data"},
+    {{0x0028,0x1202}, "OW", "Green Palette Color Lookup Table Data"},
+    {{0x0028,0x1203}, "OW", "Blue Palette Color Lookup Table Data"},
+    {{0x0028,0x1204}, "OW", "Alpha Palette Color Lookup Table Data"},
+    {{0x0028,0x1211}, "OW", "Large Red Palette Color Lookup Table Data"},
+    {{0x0028,0x1212}, "OW", "Large Green Palette Color Lookup Table Data"},
+    {{0x0028,0x1213}, "OW", "Large Blue Palette Color Lookup Table Data"},
+    {{0x0028,0x1214}, "UI", "Large Palette Color Lookup Table UID"},
+    {{0x0028,0x1221}, "OW", "Segmented Red Palette Color Lookup Table Data"},
+    {{0x0028,0x1222}, "OW", "Segmented Green Palette Color Lookup Table Data"},
+    {{0x0028,0x1223}, "OW", "Segmented Blue Palette Color Lookup Table Data"},
+    {{0x0028,0x1224}, "OW", "Segmented Alpha Palette Color Lookup Table Data"},
+    {{0x0028,0x1300}, "CS", "Breast Implant Present"},
+    {{0x0028,0x1350}, "CS", "Partial View"},
+    {{0x0028,0x1351}, "ST", "Partial View Description"},
+    {{0x0028,0x1352}, "SQ", "Partial View Code Sequence"},
+    {{0x0028,0x135A}, "CS", "Spatial Locations Preserved"},
+    {{0x0028,0x1401}, "SQ", "Data Frame Assignment Sequence"},
+    {{0x0028,0x1402}, "CS", "Data Path Assignment"},
+    {{0x0028,0x1403}, "US", "Bits Mapped to Color Lookup Table"},
+    {{0x0028,0x1404}, "SQ", "Blending LUT 1 Sequence"},
+    {{0x0028,0x1405}, "CS", "Blending LUT 1 Transfer Function"},
+    {{0x0028,0x1406}, "FD", "Blending Weight Constant"},
+    {{0x0028,0x1407}, "US", "Blending Lookup Table Descriptor"},
+    {{0x0028,0x1408}, "OW", "Blending Lookup Table Data"},
+    {{0x0028,0x140B}, "SQ", "Enhanced Palette Color Lookup Table Sequence"},
+    {{0x0028,0x140C}, "SQ", "Blending LUT 2 Sequence"},
+    {{0x0028,0x140D}, "CS", "Blending LUT 2 Transfer Function"},
+    {{0x0028,0x140E}, "CS", "Data Path ID"},
+    {{0x0028,0x140F}, "CS", "RGB LUT Transfer Function"},
+    {{0x0028,0x1410}, "CS", "Alpha LUT Transfer Function"},
+    {{0x0028,0x2000}, "OB", "ICC Profile"},
+    {{0x0028,0x2002}, "CS", "Color Space"},
+    {{0x0028,0x2110}, "CS", "Lossy Image Compression"},
+    {{0x0028,0x2112}, "DS", "Lossy Image Compression Ratio"},
+    {{0x0028,0x2114}, "CS", "Lossy Image Compression Method"},
+    {{0x0028,0x3000}, "SQ", "Modality LUT Sequence"},
+    {{0x0028,0x3002}, "SS", "LUT Descriptor"},
+    {{0x0028,0x3003}, "LO", "LUT Explanation"},
+    {{0x0028,0x3004}, "LO", "Modality LUT Type"},
+    {{0x0028,0x3006}, "US or OW", "LUT Data"},
+    {{0x0028,0x3010}, "SQ", "VOI LUT Sequence"},
+    {{0x0028,0x3110}, "SQ", "Softcopy VOI LUT Sequence"},
+    {{0x0028,0x4000}, "LT", "Image Presentation Comments"},
+    {{0x0028,0x5000}, "SQ", "Bi-Plane Acquisition Sequence"},
+    {{0x0028,0x6010}, "US", "Representative Frame Number"},
+    {{0x0028,0x6020}, "US", "Frame Numbers of Interest (FOI)"},
+    {{0x0028,0x6022}, "LO", "Frame of Interest Description"},
+    {{0x0028,0x6023}, "CS", "Frame of Interest Type"},
+    {{0x0028,0x6030}, "US", "Mask Pointer(s)"},
+    {{0x0028,0x6040}, "US", "R Wave Pointer"},
+    {{0x0028,0x6100}, "SQ", "Mask Subtraction Sequence"},
+    {{0x0028,0x6101}, "CS", "Mask Operation"},
+    {{0x0028,0x6102}, "US", "Applicable Frame Range"},
+    {{0x0028,0x6110}, "US", "Mask Frame Numbers"},
+    {{0x0028,0x6112}, "US", "Contrast Frame Averaging"},
+    {{0x0028,0x6114}, "FL", "Mask Sub-pixel Shift"},
+    {{0x0028,0x6120}, "SS", "TID Offset"},
+    {{0x0028,0x6190}, "ST", "Mask Operation Explanation"},
+    {{0x0028,0x7000}, "SQ", "Equipment Administrator Sequence"},
+    {{0x0028,0x7001}, "US", "Number of Display Subsystems"},
+    {{0x0028,0x7002}, "US", "Current Configuration ID"},
+    {{0x0028,0x7003}, "US", "Display Subsystem ID"},
+    {{0x0028,0x7004}, "SH", "Display Subsystem Name"},
+    {{0x0028,0x7005}, "LO", "Display Subsystem Description"},
+    {{0x0028,0x7006}, "CS", "System Status"},
+    {{0x0028,0x7007}, "LO", "System Status Comment"},
+    {{0x0028,0x7008}, "SQ", "Target Luminance Characteristics Sequence"},
+    {{0x0028,0x7009}, "US", "Luminance Characteristics ID"},
+    {{0x0028,0x700A}, "SQ", "Display Subsystem Configuration Sequence"},
+    {{0x0028,0x700B}, "US", "Configuration ID"},
+    {{0x0028,0x700C}, "SH", "Configuration Name"},
+    {{0x0028,0x700D}, "LO", "Configuration Description"},
+    {{0x0028,0x700E}, "US", "Referenced Target Luminance Characteristics ID"},
+    {{0x0028,0x700F}, "SQ", "QA Results Sequence"},
+    {{0x0028,0x7010}, "SQ", "Display Subsystem QA Results Sequence"},
+    {{0x0028,0x7011}, "SQ", "Configuration QA Results Sequence"},
+    {{0x0028,0x7012}, "SQ", "Measurement Equipment Sequence"},
+    {{0x0028,0x7013}, "CS", "Measurement Functions"},
+    {{0x0028,0x7014}, "CS", "Measurement Equipment Type"},
+    {{0x0028,0x7015}, "SQ", "Visual Evaluation Result Sequence"},
+    {{0x0028,0x7016}, "SQ", "Display Calibration Result Sequence"},
+    {{0x0028,0x7017}, "US", "DDL Value"},
+    {{0x0028,0x7018}, "FL", "CIExy White Point"},
+    {{0x0028,0x7019}, "CS", "Display Function Type"},
+    {{0x0028,0x701A}, "FL", "Gamma Value"},
+    {{0x0028,0x701B}, "US", "Number of Luminance Points"},
+    {{0x0028,0x701C}, "SQ", "Luminance Response Sequence"},
+    {{0x0028,0x701D}, "FL", "Target Minimum Luminance"},
+    {{0x0028,0x701E}, "FL", "Target Maximum Luminance"},
+    {{0x0028,0x701F}, "FL", "Luminance Value"},
+    {{0x0028,0x7020}, "LO", "Luminance Response Description"},
+    {{0x0028,0x7021}, "CS", "White Point Flag"},
+    {{0x0028,0x7022}, "SQ", "Display Device Type Code Sequence"},
+    {{0x0028,0x7023}, "SQ", "Display Subsystem Sequence"},
+    {{0x0028,0x7024}, "SQ", "Luminance Result Sequence"},
+    {{0x0028,0x7025}, "CS", "Ambient Light Value Source"},
+    {{0x0028,0x7026}, "CS", "Measured Characteristics"},
+    {{0x0028,0x7027}, "SQ", "Luminance Uniformity Result Sequence"},
+    {{0x0028,0x7028}, "SQ", "Visual Evaluation Test Sequence"},
+    {{0x0028,0x7029}, "CS", "Test Result"},
+    {{0x0028,0x702A}, "LO", "Test Result Comment"},
+    {{0x0028,0x702B}, "CS", "Test Image Validation"},
+    {{0x0028,0x702C}, "SQ", "Test Pattern Code Sequence"},
+    {{0x0028,0x702D}, "SQ", "Measurement Pattern Code Sequence"},
+    {{0x0028,0x702E}, "SQ", "Visual Evaluation Method Code Sequence"},
+    {{0x0028,0x7FE0}, "UR", "Pixel Data Provider URL"},
+    {{0x0028,0x9001}, "UL", "Data Point Rows"},
+    {{0x0028,0x9002}, "UL", "Data Point Columns"},
+    {{0x0028,0x9003}, "CS", "Signal Domain Columns"},
+    {{0x0028,0x9099}, "US", "Largest Monochrome Pixel Value"},
+    {{0x0028,0x9108}, "CS", "Data Representation"},
+    {{0x0028,0x9110}, "SQ", "Pixel Measures Sequence"},
+    {{0x0028,0x9132}, "SQ", "Frame VOI LUT Sequence"},
+    {{0x0028,0x9145}, "SQ", "Pixel Value Transformation Sequence"},
+    {{0x0028,0x9235}, "CS", "Signal Domain Rows"},
+    {{0x0028,0x9411}, "FL", "Display Filter Percentage"},
+    {{0x0028,0x9415}, "SQ", "Frame Pixel Shift Sequence"},
+    {{0x0028,0x9416}, "US", "Subtraction Item ID"},
+    {{0x0028,0x9422}, "SQ", "Pixel Intensity Relationship LUT Sequence"},
+    {{0x0028,0x9443}, "SQ", "Frame Pixel Data Properties Sequence"},
+    {{0x0028,0x9444}, "CS", "Geometrical Properties"},
+    {{0x0028,0x9445}, "FL", "Geometric Maximum Distortion"},
+    {{0x0028,0x9446}, "CS", "Image Processing Applied"},
+    {{0x0028,0x9454}, "CS", "Mask Selection Mode"},
+    {{0x0028,0x9474}, "CS", "LUT Function"},
+    {{0x0028,0x9478}, "FL", "Mask Visibility Percentage"},
+    {{0x0028,0x9501}, "SQ", "Pixel Shift Sequence"},
+    {{0x0028,0x9502}, "SQ", "Region Pixel Shift Sequence"},
+    {{0x0028,0x9503}, "SS", "Vertices of the Region"},
+    {{0x0028,0x9505}, "SQ", "Multi-frame Presentation Sequence"},
+    {{0x0028,0x9506}, "US", "Pixel Shift Frame Range"},
+    {{0x0028,0x9507}, "US", "LUT Frame Range"},
+    {{0x0028,0x9520}, "DS", "Image to Equipment Mapping Matrix"},
+    {{0x0028,0x9537}, "CS", "Equipment Coordinate System Identification"},
+    {{0x0032,0x000A}, "CS", "Study Status ID"},
+    {{0x0032,0x000C}, "CS", "Study Priority ID"},
+    {{0x0032,0x0012}, "LO", "Study ID Issuer"},
+    {{0x0032,0x0032}, "DA", "Study Verified Date"},
+    {{0x0032,0x0033}, "TM", "Study Verified Time"},
+    {{0x0032,0x0034}, "DA", "Study Read Date"},
+    {{0x0032,0x0035}, "TM", "Study Read Time"},
+    {{0x0032,0x1000}, "DA", "Scheduled Study Start Date"},
+    {{0x0032,0x1001}, "TM", "Scheduled Study Start Time"},
+    {{0x0032,0x1010}, "DA", "Scheduled Study Stop Date"},
+    {{0x0032,0x1011}, "TM", "Scheduled Study Stop Time"},
+    {{0x0032,0x1020}, "LO", "Scheduled Study Location"},
+    {{0x0032,0x1021}, "AE", "Scheduled Study Location AE Title"},
+    {{0x0032,0x1030}, "LO", "Reason for Study"},
+    {{0x0032,0x1031}, "SQ", "Requesting Physician Identification Sequence"},
+    {{0x0032,0x1032}, "PN", "Requesting Physician"},
+    {{0x0032,0x1033}, "LO", "Requesting Service"},
+    {{0x0032,0x1034}, "SQ", "Requesting Service Code Sequence"},
+    {{0x0032,0x1040}, "DA", "Study Arrival Date"},
+    {{0x0032,0x1041}, "TM", "Study Arrival Time"},
+    {{0x0032,0x1050}, "DA", "Study Completion Date"},
+    {{0x0032,0x1051}, "TM", "Study Completion Time"},
+    {{0x0032,0x1055}, "CS", "Study Component Status ID"},
+    {{0x0032,0x1060}, "LO", "Requested Procedure Description"},
+    {{0x0032,0x1064}, "SQ", "Requested Procedure Code Sequence"},
+    {{0x0032,0x1070}, "LO", "Requested Contrast Agent"},
+    {{0x0032,0x4000}, "LT", "Study Comments"},
+    {{0x0038,0x0004}, "SQ", "Referenced Patient Alias Sequence"},
+    {{0x0038,0x0008}, "CS", "Visit Status ID"},
+    {{0x0038,0x0010}, "LO", "Admission ID"},
+    {{0x0038,0x0011}, "LO", "Issuer of Admission ID"},
+    {{0x0038,0x0014}, "SQ", "Issuer of Admission ID Sequence"},
+    {{0x0038,0x0016}, "LO", "Route of Admissions"},
+    {{0x0038,0x001A}, "DA", "Scheduled Admission Date"},
+    {{0x0038,0x001B}, "TM", "Scheduled Admission Time"},
+    {{0x0038,0x001C}, "DA", "Scheduled Discharge Date"},
+    {{0x0038,0x001D}, "TM", "Scheduled Discharge Time"},
+    {{0x0038,0x001E}, "LO", "Scheduled Patient Institution Residence"},
+    {{0x0038,0x0020}, "DA", "Admitting Date"},
+    {{0x0038,0x0021}, "TM", "Admitting Time"},
+    {{0x0038,0x0030}, "DA", "Discharge Date"},
+    {{0x0038,0x0032}, "TM", "Discharge Time"},
+    {{0x0038,0x0040}, "LO", "Discharge Diagnosis Description"},
+    {{0x0038,0x0044}, "SQ", "Discharge Diagnosis Code Sequence"},
+    {{0x0038,0x0050}, "LO", "Special Needs"},
+    {{0x0038,0x0060}, "LO", "Service Episode ID"},
+    {{0x0038,0x0061}, "LO", "Issuer of Service Episode ID"},
+    {{0x0038,0x0062}, "LO", "Service Episode Description"},
+    {{0x0038,0x0064}, "SQ", "Issuer of Service Episode ID Sequence"},
+    {{0x0038,0x0100}, "SQ", "Pertinent Documents Sequence"},
+    {{0x0038,0x0101}, "SQ", "Pertinent Resources Sequence"},
+    {{0x0038,0x0102}, "LO", "Resource Description"},
+    {{0x0038,0x0300}, "LO", "Current Patient Location"},
+    {{0x0038,0x0400}, "LO", "Patient's Institution Residence"},
+    {{0x0038,0x0500}, "LO", "Patient State"},
+    {{0x0038,0x0502}, "SQ", "Patient Clinical Trial Participation Sequence"},
+    {{0x0038,0x4000}, "LT", "Visit Comments"},
+    {{0x003A,0x0004}, "CS", "Waveform Originality"},
+    {{0x003A,0x0005}, "US", "Number of Waveform Channels"},
+    {{0x003A,0x0010}, "UL", "Number of Waveform Samples"},
+    {{0x003A,0x001A}, "DS", "Sampling Frequency"},
+    {{0x003A,0x0020}, "SH", "Multiplex Group Label"},
+    {{0x003A,0x0200}, "SQ", "Channel Definition Sequence"},
+    {{0x003A,0x0202}, "IS", "Waveform Channel Number"},
+    {{0x003A,0x0203}, "SH", "Channel Label"},
+    {{0x003A,0x0205}, "CS", "Channel Status"},
+    {{0x003A,0x0208}, "SQ", "Channel Source Sequence"},
+    {{0x003A,0x0209}, "SQ", "Channel Source Modifiers Sequence"},
+    {{0x003A,0x020A}, "SQ", "Source Waveform Sequence"},
+    {{0x003A,0x020C}, "LO", "Channel Derivation Description"},
+    {{0x003A,0x0210}, "DS", "Channel Sensitivity"},
+    {{0x003A,0x0211}, "SQ", "Channel Sensitivity Units Sequence"},
+    {{0x003A,0x0212}, "DS", "Channel Sensitivity Correction Factor"},
+    {{0x003A,0x0213}, "DS", "Channel Baseline"},
+    {{0x003A,0x0214}, "DS", "Channel Time Skew"},
+    {{0x003A,0x0215}, "DS", "Channel Sample Skew"},
+    {{0x003A,0x0218}, "DS", "Channel Offset"},
+    {{0x003A,0x021A}, "US", "Waveform Bits Stored"},
+    {{0x003A,0x0220}, "DS", "Filter Low Frequency"},
+    {{0x003A,0x0221}, "DS", "Filter High Frequency"},
+    {{0x003A,0x0222}, "DS", "Notch Filter Frequency"},
+    {{0x003A,0x0223}, "DS", "Notch Filter Bandwidth"},
+    {{0x003A,0x0230}, "FL", "Waveform Data Display Scale"},
+    {{0x003A,0x0231}, "US", "Waveform Display Background CIELab Value"},
+    {{0x003A,0x0240}, "SQ", "Waveform Presentation Group Sequence"},
+    {{0x003A,0x0241}, "US", "Presentation Group Number"},
+    {{0x003A,0x0242}, "SQ", "Channel Display Sequence"},
+    {{0x003A,0x0244}, "US", "Channel Recommended Display CIELab Value"},
+    {{0x003A,0x0245}, "FL", "Channel Position"},
+    {{0x003A,0x0246}, "CS", "Display Shading Flag"},
+    {{0x003A,0x0247}, "FL", "Fractional Channel Display Scale"},
+    {{0x003A,0x0248}, "FL", "Absolute Channel Display Scale"},
+    {{0x003A,0x0300}, "SQ", "Multiplexed Audio Channels Description Code Sequence"},
+    {{0x003A,0x0301}, "IS", "Channel Identification Code"},
+    {{0x003A,0x0302}, "CS", "Channel Mode"},
+    {{0x0040,0x0001}, "AE", "Scheduled Station AE Title"},
+    {{0x0040,0x0002}, "DA", "Scheduled Procedure Step Start Date"},
+    {{0x0040,0x0003}, "TM", "Scheduled Procedure Step Start Time"},
+    {{0x0040,0x0004}, "DA", "Scheduled Procedure Step End Date"},
+    {{0x0040,0x0005}, "TM", "Scheduled Procedure Step End Time"},
+    {{0x0040,0x0006}, "PN", "Scheduled Performing Physician's Name"},
+    {{0x0040,0x0007}, "LO", "Scheduled Procedure Step Description"},
+    {{0x0040,0x0008}, "SQ", "Scheduled Protocol Code Sequence"},
+    {{0x0040,0x0009}, "SH", "Scheduled Procedure Step ID"},
+    {{0x0040,0x000A}, "SQ", "Stage Code Sequence"},
+    {{0x0040,0x000B}, "SQ", "Scheduled Performing Physician Identification Sequence"},
+    {{0x0040,0x0010}, "SH", "Scheduled Station Name"},
+    {{0x0040,0x0011}, "SH", "Scheduled Procedure Step Location"},
+    {{0x0040,0x0012}, "LO", "Pre-Medication"},
+    {{0x0040,0x0020}, "CS", "Scheduled Procedure Step Status"},
+    {{0x0040,0x0026}, "SQ", "Order Placer Identifier Sequence"},
+    {{0x0040,0x0027}, "SQ", "Order Filler Identifier Sequence"},
+    {{0x0040,0x0031}, "UT", "Local Namespace Entity ID"},
+    {{0x0040,0x0032}, "UT", "Universal Entity ID"},
+    {{0x0040,0x0033}, "CS", "Universal Entity ID Type"},
+    {{0x0040,0x0035}, "CS", "Identifier Type Code"},
+    {{0x0040,0x0036}, "SQ", "Assigning Facility Sequence"},
+    {{0x0040,0x0039}, "SQ", "Assigning Jurisdiction Code Sequence"},
+    {{0x0040,0x003A}, "SQ", "Assigning Agency or Department Code Sequence"},
+    {{0x0040,0x0100}, "SQ", "Scheduled Procedure Step Sequence"},
+    {{0x0040,0x0220}, "SQ", "Referenced Non-Image Composite SOP Instance Sequence"},
+    {{0x0040,0x0241}, "AE", "Performed Station AE Title"},
+    {{0x0040,0x0242}, "SH", "Performed Station Name"},
+    {{0x0040,0x0243}, "SH", "Performed Location"},
+    {{0x0040,0x0244}, "DA", "Performed Procedure Step Start Date"},
+    {{0x0040,0x0245}, "TM", "Performed Procedure Step Start Time"},
+    {{0x0040,0x0250}, "DA", "Performed Procedure Step End Date"},
+    {{0x0040,0x0251}, "TM", "Performed Procedure Step End Time"},
+    {{0x0040,0x0252}, "CS", "Performed Procedure Step Status"},
+    {{0x0040,0x0253}, "SH", "Performed Procedure Step ID"},
+    {{0x0040,0x0254}, "LO", "Performed Procedure Step Description"},
+    {{0x0040,0x0255}, "LO", "Performed Procedure Type Description"},
+    {{0x0040,0x0260}, "SQ", "Performed Protocol Code Sequence"},
+    {{0x0040,0x0261}, "CS", "Performed Protocol Type"},
+    {{0x0040,0x0270}, "SQ", "Scheduled Step Attributes Sequence"},
+    {{0x0040,0x0275}, "SQ", "Request Attributes Sequence"},
+    {{0x0040,0x0280}, "ST", "Comments on the Performed Procedure Step"},
+    {{0x0040,0x0281}, "SQ", "Performed Procedure Step Discontinuation Reason Code Sequence"},
+    {{0x0040,0x0293}, "SQ", "Quantity Sequence"},
+    {{0x0040,0x0294}, "DS", "Quantity"},
+    {{0x0040,0x0295}, "SQ", "Measuring Units Sequence"},
+    {{0x0040,0x0296}, "SQ", "Billing Item Sequence"},
+    {{0x0040,0x0300}, "US", "Total Time of Fluoroscopy"},
+    {{0x0040,0x0301}, "US", "Total Number of Exposures"},
+    {{0x0040,0x0302}, "US", "Entrance Dose"},
+    {{0x0040,0x0303}, "US", "Exposed Area"},
+    {{0x0040,0x0306}, "DS", "Distance Source to Entrance"},
+    {{0x0040,0x0307}, "DS", "Distance Source to Support"},
+    {{0x0040,0x030E}, "SQ", "Exposure Dose Sequence"},
+    {{0x0040,0x0310}, "ST", "Comments on Radiation Dose"},
+    {{0x0040,0x0312}, "DS", "X-Ray Output"},
+    {{0x0040,0x0314}, "DS", "Half Value Layer"},
+    {{0x0040,0x0316}, "DS", "Organ Dose"},
+    {{0x0040,0x0318}, "CS", "Organ Exposed"},
+    {{0x0040,0x0320}, "SQ", "Billing Procedure Step Sequence"},
+    {{0x0040,0x0321}, "SQ", "Film Consumption Sequence"},
+    {{0x0040,0x0324}, "SQ", "Billing Supplies and Devices Sequence"},
+    {{0x0040,0x0330}, "SQ", "Referenced Procedure Step Sequence"},
+    {{0x0040,0x0340}, "SQ", "Performed Series Sequence"},
+    {{0x0040,0x0400}, "LT", "Comments on the Scheduled Procedure Step"},
+    {{0x0040,0x0440}, "SQ", "Protocol Context Sequence"},
+    {{0x0040,0x0441}, "SQ", "Content Item Modifier Sequence"},
+    {{0x0040,0x0500}, "SQ", "Scheduled Specimen Sequence"},
+    {{0x0040,0x050A}, "LO", "Specimen Accession Number"},
+    {{0x0040,0x0512}, "LO", "Container Identifier"},
+    {{0x0040,0x0513}, "SQ", "Issuer of the Container Identifier Sequence"},
+    {{0x0040,0x0515}, "SQ", "Alternate Container Identifier Sequence"},
+    {{0x0040,0x0518}, "SQ", "Container Type Code Sequence"},
+    {{0x0040,0x051A}, "LO", "Container Description"},
+    {{0x0040,0x0520}, "SQ", "Container Component Sequence"},
+    {{0x0040,0x0550}, "SQ", "Specimen Sequence"},
+    {{0x0040,0x0551}, "LO", "Specimen Identifier"},
+    {{0x0040,0x0552}, "SQ", "Specimen Description Sequence (Trial)"},
+    {{0x0040,0x0553}, "ST", "Specimen Description (Trial)"},
+    {{0x0040,0x0554}, "UI", "Specimen UID"},
+    {{0x0040,0x0555}, "SQ", "Acquisition Context Sequence"},
+    {{0x0040,0x0556}, "ST", "Acquisition Context Description"},
+    {{0x0040,0x0560}, "SQ", "Specimen Description Sequence"},
+    {{0x0040,0x0562}, "SQ", "Issuer of the Specimen Identifier Sequence"},
+    {{0x0040,0x059A}, "SQ", "Specimen Type Code Sequence"},
+    {{0x0040,0x0600}, "LO", "Specimen Short Description"},
+    {{0x0040,0x0602}, "UT", "Specimen Detailed Description"},
+    {{0x0040,0x0610}, "SQ", "Specimen Preparation Sequence"},
+    {{0x0040,0x0612}, "SQ", "Specimen Preparation Step Content Item Sequence"},
+    {{0x0040,0x0620}, "SQ", "Specimen Localization Content Item Sequence"},
+    {{0x0040,0x06FA}, "LO", "Slide Identifier"},
+    {{0x0040,0x071A}, "SQ", "Image Center Point Coordinates Sequence"},
+    {{0x0040,0x072A}, "DS", "X Offset in Slide Coordinate System"},
+    {{0x0040,0x073A}, "DS", "Y Offset in Slide Coordinate System"},
+    {{0x0040,0x074A}, "DS", "Z Offset in Slide Coordinate System"},
+    {{0x0040,0x08D8}, "SQ", "Pixel Spacing Sequence"},
+    {{0x0040,0x08DA}, "SQ", "Coordinate System Axis Code Sequence"},
+    {{0x0040,0x08EA}, "SQ", "Measurement Units Code Sequence"},
+    {{0x0040,0x09F8}, "SQ", "Vital Stain Code Sequence (Trial)"},
+    {{0x0040,0x1001}, "SH", "Requested Procedure ID"},
+    {{0x0040,0x1002}, "LO", "Reason for the Requested Procedure"},
+    {{0x0040,0x1003}, "SH", "Requested Procedure Priority"},
+    {{0x0040,0x1004}, "LO", "Patient Transport Arrangements"},
+    {{0x0040,0x1005}, "LO", "Requested Procedure Location"},
+    {{0x0040,0x1006}, "SH", "Placer Order Number / Procedure"},
+    {{0x0040,0x1007}, "SH", "Filler Order Number / Procedure"},
+    {{0x0040,0x1008}, "LO", "Confidentiality Code"},
+    {{0x0040,0x1009}, "SH", "Reporting Priority"},
+    {{0x0040,0x100A}, "SQ", "Reason for Requested Procedure Code Sequence"},
+    {{0x0040,0x1010}, "PN", "Names of Intended Recipients of Results"},
+    {{0x0040,0x1011}, "SQ", "Intended Recipients of Results Identification Sequence"},
+    {{0x0040,0x1012}, "SQ", "Reason For Performed Procedure Code Sequence"},
+    {{0x0040,0x1060}, "LO", "Requested Procedure Description (Trial)"},
+    {{0x0040,0x1101}, "SQ", "Person Identification Code Sequence"},
+    {{0x0040,0x1102}, "ST", "Person's Address"},
+    {{0x0040,0x1103}, "LO", "Person's Telephone Numbers"},
+    {{0x0040,0x1104}, "LT", "Person's Telecom Information"},
+    {{0x0040,0x1400}, "LT", "Requested Procedure Comments"},
+    {{0x0040,0x2001}, "LO", "Reason for the Imaging Service Request"},
+    {{0x0040,0x2004}, "DA", "Issue Date of Imaging Service Request"},
+    {{0x0040,0x2005}, "TM", "Issue Time of Imaging Service Request"},
+    {{0x0040,0x2006}, "SH", "Placer Order Number / Imaging Service Request (Retired)"},
+    {{0x0040,0x2007}, "SH", "Filler Order Number / Imaging Service Request (Retired)"},
+    {{0x0040,0x2008}, "PN", "Order Entered By"},
+    {{0x0040,0x2009}, "SH", "Order Enterer's Location"},
+    {{0x0040,0x2010}, "SH", "Order Callback Phone Number"},
+    {{0x0040,0x2011}, "LT", "Order Callback Telecom Information"},
+    {{0x0040,0x2016}, "LO", "Placer Order Number / Imaging Service Request"},
+    {{0x0040,0x2017}, "LO", "Filler Order Number / Imaging Service Request"},
+    {{0x0040,0x2400}, "LT", "Imaging Service Request Comments"},
+    {{0x0040,0x3001}, "LO", "Confidentiality Constraint on Patient Data Description"},
+    {{0x0040,0x4001}, "CS", "General Purpose Scheduled Procedure Step Status"},
+    {{0x0040,0x4002}, "CS", "General Purpose Performed Procedure Step Status"},
+    {{0x0040,0x4003}, "CS", "General Purpose Scheduled Procedure Step Priority"},
+    {{0x0040,0x4004}, "SQ", "Scheduled Processing Applications Code Sequence"},
+    {{0x0040,0x4005}, "DT", "Scheduled Procedure Step Start DateTime"},
+    {{0x0040,0x4006}, "CS", "Multiple Copies Flag"},
+    {{0x0040,0x4007}, "SQ", "Performed Processing Applications Code Sequence"},
+    {{0x0040,0x4009}, "SQ", "Human Performer Code Sequence"},
+    {{0x0040,0x4010}, "DT", "Scheduled Procedure Step Modification DateTime"},
+    {{0x0040,0x4011}, "DT", "Expected Completion DateTime"},
+    {{0x0040,0x4015}, "SQ", "Resulting General Purpose Performed Procedure Steps Sequence"},
+    {{0x0040,0x4016}, "SQ", "Referenced General Purpose Scheduled Procedure Step Sequence"},
+    {{0x0040,0x4018}, "SQ", "Scheduled Workitem Code Sequence"},
+    {{0x0040,0x4019}, "SQ", "Performed Workitem Code Sequence"},
+    {{0x0040,0x4020}, "CS", "Input Availability Flag"},
+    {{0x0040,0x4021}, "SQ", "Input Information Sequence"},
+    {{0x0040,0x4022}, "SQ", "Relevant Information Sequence"},
+    {{0x0040,0x4023}, "UI", "Referenced General Purpose Scheduled Procedure Step Transaction UID"},
+    {{0x0040,0x4025}, "SQ", "Scheduled Station Name Code Sequence"},
+    {{0x0040,0x4026}, "SQ", "Scheduled Station Class Code Sequence"},
+    {{0x0040,0x4027}, "SQ", "Scheduled Station Geographic Location Code Sequence"},
+    {{0x0040,0x4028}, "SQ", "Performed Station Name Code Sequence"},
+    {{0x0040,0x4029}, "SQ", "Performed Station Class Code Sequence"},
+    {{0x0040,0x4030}, "SQ", "Performed Station Geographic Location Code Sequence"},
+    {{0x0040,0x4031}, "SQ", "Requested Subsequent Workitem Code Sequence"},
+    {{0x0040,0x4032}, "SQ", "Non-DICOM Output Code Sequence"},
+    {{0x0040,0x4033}, "SQ", "Output Information Sequence"},
+    {{0x0040,0x4034}, "SQ", "Scheduled Human Performers Sequence"},
+    {{0x0040,0x4035}, "SQ", "Actual Human Performers Sequence"},
+    {{0x0040,0x4036}, "LO", "Human Performer's Organization"},
+    {{0x0040,0x4037}, "PN", "Human Performer's Name"},
+    {{0x0040,0x4040}, "CS", "Raw Data Handling"},
+    {{0x0040,0x4041}, "CS", "Input Readiness State"},
+    {{0x0040,0x4050}, "DT", "Performed Procedure Step Start DateTime"},
+    {{0x0040,0x4051}, "DT", "Performed Procedure Step End DateTime"},
+    {{0x0040,0x4052}, "DT", "Procedure Step Cancellation DateTime"},
+    {{0x0040,0x4070}, "SQ", "Output Destination Sequence"},
+    {{0x0040,0x4071}, "SQ", "DICOM Storage Sequence"},
+    {{0x0040,0x4072}, "SQ", "STOW-RS Storage Sequence"},
+    {{0x0040,0x4073}, "UR", "Storage URL"},
+    {{0x0040,0x4074}, "SQ", "XDS Storage Sequence"},
+    {{0x0040,0x8302}, "DS", "Entrance Dose in mGy"},
+    {{0x0040,0x9092}, "SQ", "Parametric Map Frame Type Sequence"},
+    {{0x0040,0x9094}, "SQ", "Referenced Image Real World Value Mapping Sequence"},
+    {{0x0040,0x9096}, "SQ", "Real World Value Mapping Sequence"},
+    {{0x0040,0x9098}, "SQ", "Pixel Value Mapping Code Sequence"},
+    {{0x0040,0x9210}, "SH", "LUT Label"},
+    {{0x0040,0x9211}, "SS", "Real World Value Last Value Mapped"},
+    {{0x0040,0x9212}, "FD", "Real World Value LUT Data"},
+    {{0x0040,0x9213}, "FD", "Double Float Real World Value Last Value Mapped"},
+    {{0x0040,0x9214}, "FD", "Double Float Real World Value First Value Mapped"},
+    {{0x0040,0x9216}, "SS", "Real World Value First Value Mapped"},
+    {{0x0040,0x9220}, "SQ", "Quantity Definition Sequence"},
+    {{0x0040,0x9224}, "FD", "Real World Value Intercept"},
+    {{0x0040,0x9225}, "FD", "Real World Value Slope"},
+    {{0x0040,0xA007}, "CS", "Findings Flag (Trial)"},
+    {{0x0040,0xA010}, "CS", "Relationship Type"},
+    {{0x0040,0xA020}, "SQ", "Findings Sequence (Trial)"},
+    {{0x0040,0xA021}, "UI", "Findings Group UID (Trial)"},
+    {{0x0040,0xA022}, "UI", "Referenced Findings Group UID (Trial)"},
+    {{0x0040,0xA023}, "DA", "Findings Group Recording Date (Trial)"},
+    {{0x0040,0xA024}, "TM", "Findings Group Recording Time (Trial)"},
+    {{0x0040,0xA026}, "SQ", "Findings Source Category Code Sequence (Trial)"},
+    {{0x0040,0xA027}, "LO", "Verifying Organization"},
+    {{0x0040,0xA028}, "SQ", "Documenting Organization Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA030}, "DT", "Verification DateTime"},
+    {{0x0040,0xA032}, "DT", "Observation DateTime"},
+    {{0x0040,0xA040}, "CS", "Value Type"},
+    {{0x0040,0xA043}, "SQ", "Concept Name Code Sequence"},
+    {{0x0040,0xA047}, "LO", "Measurement Precision Description (Trial)"},
+    {{0x0040,0xA050}, "CS", "Continuity Of Content"},
+    {{0x0040,0xA057}, "CS", "Urgency or Priority Alerts (Trial)"},
+    {{0x0040,0xA060}, "LO", "Sequencing Indicator (Trial)"},
+    {{0x0040,0xA066}, "SQ", "Document Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA067}, "PN", "Document Author (Trial)"},
+    {{0x0040,0xA068}, "SQ", "Document Author Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA070}, "SQ", "Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA073}, "SQ", "Verifying Observer Sequence"},
+    {{0x0040,0xA074}, "OB", "Object Binary Identifier (Trial)"},
+    {{0x0040,0xA075}, "PN", "Verifying Observer Name"},
+    {{0x0040,0xA076}, "SQ", "Documenting Observer Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA078}, "SQ", "Author Observer Sequence"},
+    {{0x0040,0xA07A}, "SQ", "Participant Sequence"},
+    {{0x0040,0xA07C}, "SQ", "Custodial Organization Sequence"},
+    {{0x0040,0xA080}, "CS", "Participation Type"},
+    {{0x0040,0xA082}, "DT", "Participation DateTime"},
+    {{0x0040,0xA084}, "CS", "Observer Type"},
+    {{0x0040,0xA085}, "SQ", "Procedure Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA088}, "SQ", "Verifying Observer Identification Code Sequence"},
+    {{0x0040,0xA089}, "OB", "Object Directory Binary Identifier (Trial)"},
+    {{0x0040,0xA090}, "SQ", "Equivalent CDA Document Sequence"},
+    {{0x0040,0xA0B0}, "US", "Referenced Waveform Channels"},
+    {{0x0040,0xA110}, "DA", "Date of Document or Verbal Transaction (Trial)"},
+    {{0x0040,0xA112}, "TM", "Time of Document Creation or Verbal Transaction (Trial)"},
+    {{0x0040,0xA120}, "DT", "DateTime"},
+    {{0x0040,0xA121}, "DA", "Date"},
+    {{0x0040,0xA122}, "TM", "Time"},
+    {{0x0040,0xA123}, "PN", "Person Name"},
+    {{0x0040,0xA124}, "UI", "UID"},
+    {{0x0040,0xA125}, "CS", "Report Status ID (Trial)"},
+    {{0x0040,0xA130}, "CS", "Temporal Range Type"},
+    {{0x0040,0xA132}, "UL", "Referenced Sample Positions"},
+    {{0x0040,0xA136}, "US", "Referenced Frame Numbers"},
+    {{0x0040,0xA138}, "DS", "Referenced Time Offsets"},
+    {{0x0040,0xA13A}, "DT", "Referenced DateTime"},
+    {{0x0040,0xA160}, "UT", "Text Value"},
+    {{0x0040,0xA161}, "FD", "Floating Point Value"},
+    {{0x0040,0xA162}, "SL", "Rational Numerator Value"},
+    {{0x0040,0xA163}, "UL", "Rational Denominator Value"},
+    {{0x0040,0xA167}, "SQ", "Observation Category Code Sequence (Trial)"},
+    {{0x0040,0xA168}, "SQ", "Concept Code Sequence"},
+    {{0x0040,0xA16A}, "ST", "Bibliographic Citation (Trial)"},
+    {{0x0040,0xA170}, "SQ", "Purpose of Reference Code Sequence"},
+    {{0x0040,0xA171}, "UI", "Observation UID"},
+    {{0x0040,0xA172}, "UI", "Referenced Observation UID (Trial)"},
+    {{0x0040,0xA173}, "CS", "Referenced Observation Class (Trial)"},
+    {{0x0040,0xA174}, "CS", "Referenced Object Observation Class (Trial)"},
+    {{0x0040,0xA180}, "US", "Annotation Group Number"},
+    {{0x0040,0xA192}, "DA", "Observation Date (Trial)"},
+    {{0x0040,0xA193}, "TM", "Observation Time (Trial)"},
+    {{0x0040,0xA194}, "CS", "Measurement Automation (Trial)"},
+    {{0x0040,0xA195}, "SQ", "Modifier Code Sequence"},
+    {{0x0040,0xA224}, "ST", "Identification Description (Trial)"},
+    {{0x0040,0xA290}, "CS", "Coordinates Set Geometric Type (Trial)"},
+    {{0x0040,0xA296}, "SQ", "Algorithm Code Sequence (Trial)"},
+    {{0x0040,0xA297}, "ST", "Algorithm Description (Trial)"},
+    {{0x0040,0xA29A}, "SL", "Pixel Coordinates Set (Trial)"},
+    {{0x0040,0xA300}, "SQ", "Measured Value Sequence"},
+    {{0x0040,0xA301}, "SQ", "Numeric Value Qualifier Code Sequence"},
+    {{0x0040,0xA307}, "PN", "Current Observer (Trial)"},
+    {{0x0040,0xA30A}, "DS", "Numeric Value"},
+    {{0x0040,0xA313}, "SQ", "Referenced Accession Sequence (Trial)"},
+    {{0x0040,0xA33A}, "ST", "Report Status Comment (Trial)"},
+    {{0x0040,0xA340}, "SQ", "Procedure Context Sequence (Trial)"},
+    {{0x0040,0xA352}, "PN", "Verbal Source (Trial)"},
+    {{0x0040,0xA353}, "ST", "Address (Trial)"},
+    {{0x0040,0xA354}, "LO", "Telephone Number (Trial)"},
+    {{0x0040,0xA358}, "SQ", "Verbal Source Identifier Code Sequence (Trial)"},
+    {{0x0040,0xA360}, "SQ", "Predecessor Documents Sequence"},
+    {{0x0040,0xA370}, "SQ", "Referenced Request Sequence"},
+    {{0x0040,0xA372}, "SQ", "Performed Procedure Code Sequence"},
+    {{0x0040,0xA375}, "SQ", "Current Requested Procedure Evidence Sequence"},
+    {{0x0040,0xA380}, "SQ", "Report Detail Sequence (Trial)"},
+    {{0x0040,0xA385}, "SQ", "Pertinent Other Evidence Sequence"},
+    {{0x0040,0xA390}, "SQ", "HL7 Structured Document Reference Sequence"},
+    {{0x0040,0xA402}, "UI", "Observation Subject UID (Trial)"},
+    {{0x0040,0xA403}, "CS", "Observation Subject Class (Trial)"},
+    {{0x0040,0xA404}, "SQ", "Observation Subject Type Code Sequence (Trial)"},
+    {{0x0040,0xA491}, "CS", "Completion Flag"},
+    {{0x0040,0xA492}, "LO", "Completion Flag Description"},
+    {{0x0040,0xA493}, "CS", "Verification Flag"},
+    {{0x0040,0xA494}, "CS", "Archive Requested"},
+    {{0x0040,0xA496}, "CS", "Preliminary Flag"},
+    {{0x0040,0xA504}, "SQ", "Content Template Sequence"},
+    {{0x0040,0xA525}, "SQ", "Identical Documents Sequence"},
+    {{0x0040,0xA600}, "CS", "Observation Subject Context Flag (Trial)"},
+    {{0x0040,0xA601}, "CS", "Observer Context Flag (Trial)"},
+    {{0x0040,0xA603}, "CS", "Procedure Context Flag (Trial)"},
+    {{0x0040,0xA730}, "SQ", "Content Sequence"},
+    {{0x0040,0xA731}, "SQ", "Relationship Sequence (Trial)"},
+    {{0x0040,0xA732}, "SQ", "Relationship Type Code Sequence (Trial)"},
+    {{0x0040,0xA744}, "SQ", "Language Code Sequence (Trial)"},
+    {{0x0040,0xA992}, "ST", "Uniform Resource Locator (Trial)"},
+    {{0x0040,0xB020}, "SQ", "Waveform Annotation Sequence"},
+    {{0x0040,0xDB00}, "CS", "Template Identifier"},
+    {{0x0040,0xDB06}, "DT", "Template Version"},
+    {{0x0040,0xDB07}, "DT", "Template Local Version"},
+    {{0x0040,0xDB0B}, "CS", "Template Extension Flag"},
+    {{0x0040,0xDB0C}, "UI", "Template Extension Organization UID"},
+    {{0x0040,0xDB0D}, "UI", "Template Extension Creator UID"},
+    {{0x0040,0xDB73}, "UL", "Referenced Content Item Identifier"},
+    {{0x0040,0xE001}, "ST", "HL7 Instance Identifier"},
+    {{0x0040,0xE004}, "DT", "HL7 Document Effective Time"},
+    {{0x0040,0xE006}, "SQ", "HL7 Document Type Code Sequence"},
+    {{0x0040,0xE008}, "SQ", "Document Class Code Sequence"},
+    {{0x0040,0xE010}, "UR", "Retrieve URI"},
+    {{0x0040,0xE011}, "UI", "Retrieve Location UID"},
+    {{0x0040,0xE020}, "CS", "Type of Instances"},
+    {{0x0040,0xE021}, "SQ", "DICOM Retrieval Sequence"},
+    {{0x0040,0xE022}, "SQ", "DICOM Media Retrieval Sequence"},
+    {{0x0040,0xE023}, "SQ", "WADO Retrieval Sequence"},
+    {{0x0040,0xE024}, "SQ", "XDS Retrieval Sequence"},
+    {{0x0040,0xE025}, "SQ", "WADO-RS Retrieval Sequence"},
+    {{0x0040,0xE030}, "UI", "Repository Unique ID"},
+    {{0x0040,0xE031}, "UI", "Home Community ID"},
+    {{0x0042,0x0010}, "ST", "Document Title"},
+    {{0x0042,0x0011}, "OB", "Encapsulated Document"},
+    {{0x0042,0x0012}, "LO", "MIME Type of Encapsulated Document"},
+    {{0x0042,0x0013}, "SQ", "Source Instance Sequence"},
+    {{0x0042,0x0014}, "LO", "List of MIME Types"},
+    {{0x0044,0x0001}, "ST", "Product Package Identifier"},
+    {{0x0044,0x0002}, "CS", "Substance Administration Approval"},
+    {{0x0044,0x0003}, "LT", "Approval Status Further Description"},
+    {{0x0044,0x0004}, "DT", "Approval Status DateTime"},
+    {{0x0044,0x0007}, "SQ", "Product Type Code Sequence"},
+    {{0x0044,0x0008}, "LO", "Product Name"},
+    {{0x0044,0x0009}, "LT", "Product Description"},
+    {{0x0044,0x000A}, "LO", "Product Lot Identifier"},
+    {{0x0044,0x000B}, "DT", "Product Expiration DateTime"},
+    {{0x0044,0x0010}, "DT", "Substance Administration DateTime"},
+    {{0x0044,0x0011}, "LO", "Substance Administration Notes"},
+    {{0x0044,0x0012}, "LO", "Substance Administration Device ID"},
+    {{0x0044,0x0013}, "SQ", "Product Parameter Sequence"},
+    {{0x0044,0x0019}, "SQ", "Substance Administration Parameter Sequence"},
+    {{0x0046,0x0012}, "LO", "Lens Description"},
+    {{0x0046,0x0014}, "SQ", "Right Lens Sequence"},
+    {{0x0046,0x0015}, "SQ", "Left Lens Sequence"},
+    {{0x0046,0x0016}, "SQ", "Unspecified Laterality Lens Sequence"},
+    {{0x0046,0x0018}, "SQ", "Cylinder Sequence"},
+    {{0x0046,0x0028}, "SQ", "Prism Sequence"},
+    {{0x0046,0x0030}, "FD", "Horizontal Prism Power"},
+    {{0x0046,0x0032}, "CS", "Horizontal Prism Base"},
+    {{0x0046,0x0034}, "FD", "Vertical Prism Power"},
+    {{0x0046,0x0036}, "CS", "Vertical Prism Base"},
+    {{0x0046,0x0038}, "CS", "Lens Segment Type"},
+    {{0x0046,0x0040}, "FD", "Optical Transmittance"},
+    {{0x0046,0x0042}, "FD", "Channel Width"},
+    {{0x0046,0x0044}, "FD", "Pupil Size"},
+    {{0x0046,0x0046}, "FD", "Corneal Size"},
+    {{0x0046,0x0050}, "SQ", "Autorefraction Right Eye Sequence"},
+    {{0x0046,0x0052}, "SQ", "Autorefraction Left Eye Sequence"},
+    {{0x0046,0x0060}, "FD", "Distance Pupillary Distance"},
+    {{0x0046,0x0062}, "FD", "Near Pupillary Distance"},
+    {{0x0046,0x0063}, "FD", "Intermediate Pupillary Distance"},
+    {{0x0046,0x0064}, "FD", "Other Pupillary Distance"},
+    {{0x0046,0x0070}, "SQ", "Keratometry Right Eye Sequence"},
+    {{0x0046,0x0071}, "SQ", "Keratometry Left Eye Sequence"},
+    {{0x0046,0x0074}, "SQ", "Steep Keratometric Axis Sequence"},
+    {{0x0046,0x0075}, "FD", "Radius of Curvature"},
+    {{0x0046,0x0076}, "FD", "Keratometric Power"},
+    {{0x0046,0x0077}, "FD", "Keratometric Axis"},
+    {{0x0046,0x0080}, "SQ", "Flat Keratometric Axis Sequence"},
+    {{0x0046,0x0092}, "CS", "Background Color"},
+    {{0x0046,0x0094}, "CS", "Optotype"},
+    {{0x0046,0x0095}, "CS", "Optotype Presentation"},
+    {{0x0046,0x0097}, "SQ", "Subjective Refraction Right Eye Sequence"},
+    {{0x0046,0x0098}, "SQ", "Subjective Refraction Left Eye Sequence"},
+    {{0x0046,0x0100}, "SQ", "Add Near Sequence"},
+    {{0x0046,0x0101}, "SQ", "Add Intermediate Sequence"},
+    {{0x0046,0x0102}, "SQ", "Add Other Sequence"},
+    {{0x0046,0x0104}, "FD", "Add Power"},
+    {{0x0046,0x0106}, "FD", "Viewing Distance"},
+    {{0x0046,0x0121}, "SQ", "Visual Acuity Type Code Sequence"},
+    {{0x0046,0x0122}, "SQ", "Visual Acuity Right Eye Sequence"},
+    {{0x0046,0x0123}, "SQ", "Visual Acuity Left Eye Sequence"},
+    {{0x0046,0x0124}, "SQ", "Visual Acuity Both Eyes Open Sequence"},
+    {{0x0046,0x0125}, "CS", "Viewing Distance Type"},
+    {{0x0046,0x0135}, "SS", "Visual Acuity Modifiers"},
+    {{0x0046,0x0137}, "FD", "Decimal Visual Acuity"},
+    {{0x0046,0x0139}, "LO", "Optotype Detailed Definition"},
+    {{0x0046,0x0145}, "SQ", "Referenced Refractive Measurements Sequence"},
+    {{0x0046,0x0146}, "FD", "Sphere Power"},
+    {{0x0046,0x0147}, "FD", "Cylinder Power"},
+    {{0x0046,0x0201}, "CS", "Corneal Topography Surface"},
+    {{0x0046,0x0202}, "FL", "Corneal Vertex Location"},
+    {{0x0046,0x0203}, "FL", "Pupil Centroid X-Coordinate"},
+    {{0x0046,0x0204}, "FL", "Pupil Centroid Y-Coordinate"},
+    {{0x0046,0x0205}, "FL", "Equivalent Pupil Radius"},
+    {{0x0046,0x0207}, "SQ", "Corneal Topography Map Type Code Sequence"},
+    {{0x0046,0x0208}, "IS", "Vertices of the Outline of Pupil"},
+    {{0x0046,0x0210}, "SQ", "Corneal Topography Mapping Normals Sequence"},
+    {{0x0046,0x0211}, "SQ", "Maximum Corneal Curvature Sequence"},
+    {{0x0046,0x0212}, "FL", "Maximum Corneal Curvature"},
+    {{0x0046,0x0213}, "FL", "Maximum Corneal Curvature Location"},
+    {{0x0046,0x0215}, "SQ", "Minimum Keratometric Sequence"},
+    {{0x0046,0x0218}, "SQ", "Simulated Keratometric Cylinder Sequence"},
+    {{0x0046,0x0220}, "FL", "Average Corneal Power"},
+    {{0x0046,0x0224}, "FL", "Corneal I-S Value"},
+    {{0x0046,0x0227}, "FL", "Analyzed Area"},
+    {{0x0046,0x0230}, "FL", "Surface Regularity Index"},
+    {{0x0046,0x0232}, "FL", "Surface Asymmetry Index"},
+    {{0x0046,0x0234}, "FL", "Corneal Eccentricity Index"},
+    {{0x0046,0x0236}, "FL", "Keratoconus Prediction Index"},
+    {{0x0046,0x0238}, "FL", "Decimal Potential Visual Acuity"},
+    {{0x0046,0x0242}, "CS", "Corneal Topography Map Quality Evaluation"},
+    {{0x0046,0x0244}, "SQ", "Source Image Corneal Processed Data Sequence"},
+    {{0x0046,0x0247}, "FL", "Corneal Point Location"},
+    {{0x0046,0x0248}, "CS", "Corneal Point Estimated"},
+    {{0x0046,0x0249}, "FL", "Axial Power"},
+    {{0x0046,0x0250}, "FL", "Tangential Power"},
+    {{0x0046,0x0251}, "FL", "Refractive Power"},
+    {{0x0046,0x0252}, "FL", "Relative Elevation"},
+    {{0x0046,0x0253}, "FL", "Corneal Wavefront"},
+    {{0x0048,0x0001}, "FL", "Imaged Volume Width"},
+    {{0x0048,0x0002}, "FL", "Imaged Volume Height"},
+    {{0x0048,0x0003}, "FL", "Imaged Volume Depth"},
+    {{0x0048,0x0006}, "UL", "Total Pixel Matrix Columns"},
+    {{0x0048,0x0007}, "UL", "Total Pixel Matrix Rows"},
+    {{0x0048,0x0008}, "SQ", "Total Pixel Matrix Origin Sequence"},
+    {{0x0048,0x0010}, "CS", "Specimen Label in Image"},
+    {{0x0048,0x0011}, "CS", "Focus Method"},
+    {{0x0048,0x0012}, "CS", "Extended Depth of Field"},
+    {{0x0048,0x0013}, "US", "Number of Focal Planes"},
+    {{0x0048,0x0014}, "FL", "Distance Between Focal Planes"},
+    {{0x0048,0x0015}, "US", "Recommended Absent Pixel CIELab Value"},
+    {{0x0048,0x0100}, "SQ", "Illuminator Type Code Sequence"},
+    {{0x0048,0x0102}, "DS", "Image Orientation (Slide)"},
+    {{0x0048,0x0105}, "SQ", "Optical Path Sequence"},
+    {{0x0048,0x0106}, "SH", "Optical Path Identifier"},
+    {{0x0048,0x0107}, "ST", "Optical Path Description"},
+    {{0x0048,0x0108}, "SQ", "Illumination Color Code Sequence"},
+    {{0x0048,0x0110}, "SQ", "Specimen Reference Sequence"},
+    {{0x0048,0x0111}, "DS", "Condenser Lens Power"},
+    {{0x0048,0x0112}, "DS", "Objective Lens Power"},
+    {{0x0048,0x0113}, "DS", "Objective Lens Numerical Aperture"},
+    {{0x0048,0x0120}, "SQ", "Palette Color Lookup Table Sequence"},
+    {{0x0048,0x0200}, "SQ", "Referenced Image Navigation Sequence"},
+    {{0x0048,0x0201}, "US", "Top Left Hand Corner of Localizer Area"},
+    {{0x0048,0x0202}, "US", "Bottom Right Hand Corner of Localizer Area"},
+    {{0x0048,0x0207}, "SQ", "Optical Path Identification Sequence"},
+    {{0x0048,0x021A}, "SQ", "Plane Position (Slide) Sequence"},
+    {{0x0048,0x021E}, "SL", "Column Position In Total Image Pixel Matrix"},
+    {{0x0048,0x021F}, "SL", "Row Position In Total Image Pixel Matrix"},
+    {{0x0048,0x0301}, "CS", "Pixel Origin Interpretation"},
+    {{0x0050,0x0004}, "CS", "Calibration Image"},
+    {{0x0050,0x0010}, "SQ", "Device Sequence"},
+    {{0x0050,0x0012}, "SQ", "Container Component Type Code Sequence"},
+    {{0x0050,0x0013}, "FD", "Container Component Thickness"},
+    {{0x0050,0x0014}, "DS", "Device Length"},
+    {{0x0050,0x0015}, "FD", "Container Component Width"},
+    {{0x0050,0x0016}, "DS", "Device Diameter"},
+    {{0x0050,0x0017}, "CS", "Device Diameter Units"},
+    {{0x0050,0x0018}, "DS", "Device Volume"},
+    {{0x0050,0x0019}, "DS", "Inter-Marker Distance"},
+    {{0x0050,0x001A}, "CS", "Container Component Material"},
+    {{0x0050,0x001B}, "LO", "Container Component ID"},
+    {{0x0050,0x001C}, "FD", "Container Component Length"},
+    {{0x0050,0x001D}, "FD", "Container Component Diameter"},
+    {{0x0050,0x001E}, "LO", "Container Component Description"},
+    {{0x0050,0x0020}, "LO", "Device Description"},
+    {{0x0052,0x0001}, "FL", "Contrast/Bolus Ingredient Percent by Volume"},
+    {{0x0052,0x0002}, "FD", "OCT Focal Distance"},
+    {{0x0052,0x0003}, "FD", "Beam Spot Size"},
+    {{0x0052,0x0004}, "FD", "Effective Refractive Index"},
+    {{0x0052,0x0006}, "CS", "OCT Acquisition Domain"},
+    {{0x0052,0x0007}, "FD", "OCT Optical Center Wavelength"},
+    {{0x0052,0x0008}, "FD", "Axial Resolution"},
+    {{0x0052,0x0009}, "FD", "Ranging Depth"},
+    {{0x0052,0x0011}, "FD", "A-line Rate"},
+    {{0x0052,0x0012}, "US", "A-lines Per Frame"},
+    {{0x0052,0x0013}, "FD", "Catheter Rotational Rate"},
+    {{0x0052,0x0014}, "FD", "A-line Pixel Spacing"},
+    {{0x0052,0x0016}, "SQ", "Mode of Percutaneous Access Sequence"},
+    {{0x0052,0x0025}, "SQ", "Intravascular OCT Frame Type Sequence"},
+    {{0x0052,0x0026}, "CS", "OCT Z Offset Applied"},
+    {{0x0052,0x0027}, "SQ", "Intravascular Frame Content Sequence"},
+    {{0x0052,0x0028}, "FD", "Intravascular Longitudinal Distance"},
+    {{0x0052,0x0029}, "SQ", "Intravascular OCT Frame Content Sequence"},
+    {{0x0052,0x0030}, "SS", "OCT Z Offset Correction"},
+    {{0x0052,0x0031}, "CS", "Catheter Direction of Rotation"},
+    {{0x0052,0x0033}, "FD", "Seam Line Location"},
+    {{0x0052,0x0034}, "FD", "First A-line Location"},
+    {{0x0052,0x0036}, "US", "Seam Line Index"},
+    {{0x0052,0x0038}, "US", "Number of Padded A-lines"},
+    {{0x0052,0x0039}, "CS", "Interpolation Type"},
+    {{0x0052,0x003A}, "CS", "Refractive Index Applied"},
+    {{0x0054,0x0010}, "US", "Energy Window Vector"},
+    {{0x0054,0x0011}, "US", "Number of Energy Windows"},
+    {{0x0054,0x0012}, "SQ", "Energy Window Information Sequence"},
+    {{0x0054,0x0013}, "SQ", "Energy Window Range Sequence"},
+    {{0x0054,0x0014}, "DS", "Energy Window Lower Limit"},
+    {{0x0054,0x0015}, "DS", "Energy Window Upper Limit"},
+    {{0x0054,0x0016}, "SQ", "Radiopharmaceutical Information Sequence"},
+    {{0x0054,0x0017}, "IS", "Residual Syringe Counts"},
+    {{0x0054,0x0018}, "SH", "Energy Window Name"},
+    {{0x0054,0x0020}, "US", "Detector Vector"},
+    {{0x0054,0x0021}, "US", "Number of Detectors"},
+    {{0x0054,0x0022}, "SQ", "Detector Information Sequence"},
+    {{0x0054,0x0030}, "US", "Phase Vector"},
+    {{0x0054,0x0031}, "US", "Number of Phases"},
+    {{0x0054,0x0032}, "SQ", "Phase Information Sequence"},
+    {{0x0054,0x0033}, "US", "Number of Frames in Phase"},
+    {{0x0054,0x0036}, "IS", "Phase Delay"},
+    {{0x0054,0x0038}, "IS", "Pause Between Frames"},
+    {{0x0054,0x0039}, "CS", "Phase Description"},
+    {{0x0054,0x0050}, "US", "Rotation Vector"},
+    {{0x0054,0x0051}, "US", "Number of Rotations"},
+    {{0x0054,0x0052}, "SQ", "Rotation Information Sequence"},
+    {{0x0054,0x0053}, "US", "Number of Frames in Rotation"},
+    {{0x0054,0x0060}, "US", "R-R Interval Vector"},
+    {{0x0054,0x0061}, "US", "Number of R-R Intervals"},
+    {{0x0054,0x0062}, "SQ", "Gated Information Sequence"},
+    {{0x0054,0x0063}, "SQ", "Data Information Sequence"},
+    {{0x0054,0x0070}, "US", "Time Slot Vector"},
+    {{0x0054,0x0071}, "US", "Number of Time Slots"},
+    {{0x0054,0x0072}, "SQ", "Time Slot Information Sequence"},
+    {{0x0054,0x0073}, "DS", "Time Slot Time"},
+    {{0x0054,0x0080}, "US", "Slice Vector"},
+    {{0x0054,0x0081}, "US", "Number of Slices"},
+    {{0x0054,0x0090}, "US", "Angular View Vector"},
+    {{0x0054,0x0100}, "US", "Time Slice Vector"},
+    {{0x0054,0x0101}, "US", "Number of Time Slices"},
+    {{0x0054,0x0200}, "DS", "Start Angle"},
+    {{0x0054,0x0202}, "CS", "Type of Detector Motion"},
+    {{0x0054,0x0210}, "IS", "Trigger Vector"},
+    {{0x0054,0x0211}, "US", "Number of Triggers in Phase"},
+    {{0x0054,0x0220}, "SQ", "View Code Sequence"},
+    {{0x0054,0x0222}, "SQ", "View Modifier Code Sequence"},
+    {{0x0054,0x0300}, "SQ", "Radionuclide Code Sequence"},
+    {{0x0054,0x0302}, "SQ", "Administration Route Code Sequence"},
+    {{0x0054,0x0304}, "SQ", "Radiopharmaceutical Code Sequence"},
+    {{0x0054,0x0306}, "SQ", "Calibration Data Sequence"},
+    {{0x0054,0x0308}, "US", "Energy Window Number"},
+    {{0x0054,0x0400}, "SH", "Image ID"},
+    {{0x0054,0x0410}, "SQ", "Patient Orientation Code Sequence"},
+    {{0x0054,0x0412}, "SQ", "Patient Orientation Modifier Code Sequence"},
+    {{0x0054,0x0414}, "SQ", "Patient Gantry Relationship Code Sequence"},
+    {{0x0054,0x0500}, "CS", "Slice Progression Direction"},
+    {{0x0054,0x0501}, "CS", "Scan Progression Direction"},
+    {{0x0054,0x1000}, "CS", "Series Type"},
+    {{0x0054,0x1001}, "CS", "Units"},
+    {{0x0054,0x1002}, "CS", "Counts Source"},
+    {{0x0054,0x1004}, "CS", "Reprojection Method"},
+    {{0x0054,0x1006}, "CS", "SUV Type"},
+    {{0x0054,0x1100}, "CS", "Randoms Correction Method"},
+    {{0x0054,0x1101}, "LO", "Attenuation Correction Method"},
+    {{0x0054,0x1102}, "CS", "Decay Correction"},
+    {{0x0054,0x1103}, "LO", "Reconstruction Method"},
+    {{0x0054,0x1104}, "LO", "Detector Lines of Response Used"},
+    {{0x0054,0x1105}, "LO", "Scatter Correction Method"},
+    {{0x0054,0x1200}, "DS", "Axial Acceptance"},
+    {{0x0054,0x1201}, "IS", "Axial Mash"},
+    {{0x0054,0x1202}, "IS", "Transverse Mash"},
+    {{0x0054,0x1203}, "DS", "Detector Element Size"},
+    {{0x0054,0x1210}, "DS", "Coincidence Window Width"},
+    {{0x0054,0x1220}, "CS", "Secondary Counts Type"},
+    {{0x0054,0x1300}, "DS", "Frame Reference Time"},
+    {{0x0054,0x1310}, "IS", "Primary (Prompts) Counts Accumulated"},
+    {{0x0054,0x1311}, "IS", "Secondary Counts Accumulated"},
+    {{0x0054,0x1320}, "DS", "Slice Sensitivity Factor"},
+    {{0x0054,0x1321}, "DS", "Decay Factor"},
+    {{0x0054,0x1322}, "DS", "Dose Calibration Factor"},
+    {{0x0054,0x1323}, "DS", "Scatter Fraction Factor"},
+    {{0x0054,0x1324}, "DS", "Dead Time Factor"},
+    {{0x0054,0x1330}, "US", "Image Index"},
+    {{0x0054,0x1400}, "CS", "Counts Included"},
+    {{0x0054,0x1401}, "CS", "Dead Time Correction Flag"},
+    {{0x0060,0x3000}, "SQ", "Histogram Sequence"},
+    {{0x0060,0x3002}, "US", "Histogram Number of Bins"},
+    {{0x0060,0x3004}, "SS", "Histogram First Bin Value"},
+    {{0x0060,0x3006}, "SS", "Histogram Last Bin Value"},
+    {{0x0060,0x3008}, "US", "Histogram Bin Width"},
+    {{0x0060,0x3010}, "LO", "Histogram Explanation"},
+    {{0x0060,0x3020}, "UL", "Histogram Data"},
+    {{0x0062,0x0001}, "CS", "Segmentation Type"},
+    {{0x0062,0x0002}, "SQ", "Segment Sequence"},
+    {{0x0062,0x0003}, "SQ", "Segmented Property Category Code Sequence"},
+    {{0x0062,0x0004}, "US", "Segment Number"},
+    {{0x0062,0x0005}, "LO", "Segment Label"},
+    {{0x0062,0x0006}, "ST", "Segment Description"},
+    {{0x0062,0x0008}, "CS", "Segment Algorithm Type"},
+    {{0x0062,0x0009}, "LO", "Segment Algorithm Name"},
+    {{0x0062,0x000A}, "SQ", "Segment Identification Sequence"},
+    {{0x0062,0x000B}, "US", "Referenced Segment Number"},
+    {{0x0062,0x000C}, "US", "Recommended Display Grayscale Value"},
+    {{0x0062,0x000D}, "US", "Recommended Display CIELab Value"},
+    {{0x0062,0x000E}, "US", "Maximum Fractional Value"},
+    {{0x0062,0x000F}, "SQ", "Segmented Property Type Code Sequence"},
+    {{0x0062,0x0010}, "CS", "Segmentation Fractional Type"},
+    {{0x0062,0x0011}, "SQ", "Segmented Property Type Modifier Code Sequence"},
+    {{0x0062,0x0012}, "SQ", "Used Segments Sequence"},
+    {{0x0062,0x0020}, "UT", "Tracking ID"},
+    {{0x0062,0x0021}, "UI", "Tracking UID"},
+    {{0x0064,0x0002}, "SQ", "Deformable Registration Sequence"},
+    {{0x0064,0x0003}, "UI", "Source Frame of Reference UID"},
+    {{0x0064,0x0005}, "SQ", "Deformable Registration Grid Sequence"},
+    {{0x0064,0x0007}, "UL", "Grid Dimensions"},
+    {{0x0064,0x0008}, "FD", "Grid Resolution"},
+    {{0x0064,0x0009}, "OF", "Vector Grid Data"},
+    {{0x0064,0x000F}, "SQ", "Pre Deformation Matrix Registration Sequence"},
+    {{0x0064,0x0010}, "SQ", "Post Deformation Matrix Registration Sequence"},
+    {{0x0066,0x0001}, "UL", "Number of Surfaces"},
+    {{0x0066,0x0002}, "SQ", "Surface Sequence"},
+    {{0x0066,0x0003}, "UL", "Surface Number"},
+    {{0x0066,0x0004}, "LT", "Surface Comments"},
+    {{0x0066,0x0009}, "CS", "Surface Processing"},
+    {{0x0066,0x000A}, "FL", "Surface Processing Ratio"},
+    {{0x0066,0x000B}, "LO", "Surface Processing Description"},
+    {{0x0066,0x000C}, "FL", "Recommended Presentation Opacity"},
+    {{0x0066,0x000D}, "CS", "Recommended Presentation Type"},
+    {{0x0066,0x000E}, "CS", "Finite Volume"},
+    {{0x0066,0x0010}, "CS", "Manifold"},
+    {{0x0066,0x0011}, "SQ", "Surface Points Sequence"},
+    {{0x0066,0x0012}, "SQ", "Surface Points Normals Sequence"},
+    {{0x0066,0x0013}, "SQ", "Surface Mesh Primitives Sequence"},
+    {{0x0066,0x0015}, "UL", "Number of Surface Points"},
+    {{0x0066,0x0016}, "OF", "Point Coordinates Data"},
+    {{0x0066,0x0017}, "FL", "Point Position Accuracy"},
+    {{0x0066,0x0018}, "FL", "Mean Point Distance"},
+    {{0x0066,0x0019}, "FL", "Maximum Point Distance"},
+    {{0x0066,0x001A}, "FL", "Points Bounding Box Coordinates"},
+    {{0x0066,0x001B}, "FL", "Axis of Rotation"},
+    {{0x0066,0x001C}, "FL", "Center of Rotation"},
+    {{0x0066,0x001E}, "UL", "Number of Vectors"},
+    {{0x0066,0x001F}, "US", "Vector Dimensionality"},
+    {{0x0066,0x0020}, "FL", "Vector Accuracy"},
+    {{0x0066,0x0021}, "OF", "Vector Coordinate Data"},
+    {{0x0066,0x0023}, "OW", "Triangle Point Index List"},
+    {{0x0066,0x0024}, "OW", "Edge Point Index List"},
+    {{0x0066,0x0025}, "OW", "Vertex Point Index List"},
+    {{0x0066,0x0026}, "SQ", "Triangle Strip Sequence"},
+    {{0x0066,0x0027}, "SQ", "Triangle Fan Sequence"},
+    {{0x0066,0x0028}, "SQ", "Line Sequence"},
+    {{0x0066,0x0029}, "OW", "Primitive Point Index List"},
+    {{0x0066,0x002A}, "UL", "Surface Count"},
+    {{0x0066,0x002B}, "SQ", "Referenced Surface Sequence"},
+    {{0x0066,0x002C}, "UL", "Referenced Surface Number"},
+    {{0x0066,0x002D}, "SQ", "Segment Surface Generation Algorithm Identification Sequence"},
+    {{0x0066,0x002E}, "SQ", "Segment Surface Source Instance Sequence"},
+    {{0x0066,0x002F}, "SQ", "Algorithm Family Code Sequence"},
+    {{0x0066,0x0030}, "SQ", "Algorithm Name Code Sequence"},
+    {{0x0066,0x0031}, "LO", "Algorithm Version"},
+    {{0x0066,0x0032}, "LT", "Algorithm Parameters"},
+    {{0x0066,0x0034}, "SQ", "Facet Sequence"},
+    {{0x0066,0x0035}, "SQ", "Surface Processing Algorithm Identification Sequence"},
+    {{0x0066,0x0036}, "LO", "Algorithm Name"},
+    {{0x0066,0x0037}, "FL", "Recommended Point Radius"},
+    {{0x0066,0x0038}, "FL", "Recommended Line Thickness"},
+    {{0x0066,0x0040}, "OL", "Long Primitive Point Index List"},
+    {{0x0066,0x0041}, "OL", "Long Triangle Point Index List"},
+    {{0x0066,0x0042}, "OL", "Long Edge Point Index List"},
+    {{0x0066,0x0043}, "OL", "Long Vertex Point Index List"},
+    {{0x0066,0x0101}, "SQ", "Track Set Sequence"},
+    {{0x0066,0x0102}, "SQ", "Track Sequence"},
+    {{0x0066,0x0103}, "OW", "Recommended Display CIELab Value List"},
+    {{0x0066,0x0104}, "SQ", "Tracking Algorithm Identification Sequence"},
+    {{0x0066,0x0105}, "UL", "Track Set Number"},
+    {{0x0066,0x0106}, "LO", "Track Set Label"},
+    {{0x0066,0x0107}, "UT", "Track Set Description"},
+    {{0x0066,0x0108}, "SQ", "Track Set Anatomical Type Code Sequence"},
+    {{0x0066,0x0121}, "SQ", "Measurements Sequence"},
+    {{0x0066,0x0124}, "SQ", "Track Set Statistics Sequence"},
+    {{0x0066,0x0125}, "OF", "Floating Point Values"},
+    {{0x0066,0x0129}, "OL", "Track Point Index List"},
+    {{0x0066,0x0130}, "SQ", "Track Statistics Sequence"},
+    {{0x0066,0x0132}, "SQ", "Measurement Values Sequence"},
+    {{0x0066,0x0133}, "SQ", "Diffusion Acquisition Code Sequence"},
+    {{0x0066,0x0134}, "SQ", "Diffusion Model Code Sequence"},
+    {{0x0068,0x6210}, "LO", "Implant Size"},
+    {{0x0068,0x6221}, "LO", "Implant Template Version"},
+    {{0x0068,0x6222}, "SQ", "Replaced Implant Template Sequence"},
+    {{0x0068,0x6223}, "CS", "Implant Type"},
+    {{0x0068,0x6224}, "SQ", "Derivation Implant Template Sequence"},
+    {{0x0068,0x6225}, "SQ", "Original Implant Template Sequence"},
+    {{0x0068,0x6226}, "DT", "Effective DateTime"},
+    {{0x0068,0x6230}, "SQ", "Implant Target Anatomy Sequence"},
+    {{0x0068,0x6260}, "SQ", "Information From Manufacturer Sequence"},
+    {{0x0068,0x6265}, "SQ", "Notification From Manufacturer Sequence"},
+    {{0x0068,0x6270}, "DT", "Information Issue DateTime"},
+    {{0x0068,0x6280}, "ST", "Information Summary"},
+    {{0x0068,0x62A0}, "SQ", "Implant Regulatory Disapproval Code Sequence"},
+    {{0x0068,0x62A5}, "FD", "Overall Template Spatial Tolerance"},
+    {{0x0068,0x62C0}, "SQ", "HPGL Document Sequence"},
+    {{0x0068,0x62D0}, "US", "HPGL Document ID"},
+    {{0x0068,0x62D5}, "LO", "HPGL Document Label"},
+    {{0x0068,0x62E0}, "SQ", "View Orientation Code Sequence"},
+    {{0x0068,0x62F0}, "FD", "View Orientation Modifier"},
+    {{0x0068,0x62F2}, "FD", "HPGL Document Scaling"},
+    {{0x0068,0x6300}, "OB", "HPGL Document"},
+    {{0x0068,0x6310}, "US", "HPGL Contour Pen Number"},
+    {{0x0068,0x6320}, "SQ", "HPGL Pen Sequence"},
+    {{0x0068,0x6330}, "US", "HPGL Pen Number"},
+    {{0x0068,0x6340}, "LO", "HPGL Pen Label"},
+    {{0x0068,0x6345}, "ST", "HPGL Pen Description"},
+    {{0x0068,0x6346}, "FD", "Recommended Rotation Point"},
+    {{0x0068,0x6347}, "FD", "Bounding Rectangle"},
+    {{0x0068,0x6350}, "US", "Implant Template 3D Model Surface Number"},
+    {{0x0068,0x6360}, "SQ", "Surface Model Description Sequence"},
+    {{0x0068,0x6380}, "LO", "Surface Model Label"},
+    {{0x0068,0x6390}, "FD", "Surface Model Scaling Factor"},
+    {{0x0068,0x63A0}, "SQ", "Materials Code Sequence"},
+    {{0x0068,0x63A4}, "SQ", "Coating Materials Code Sequence"},
+    {{0x0068,0x63A8}, "SQ", "Implant Type Code Sequence"},
+    {{0x0068,0x63AC}, "SQ", "Fixation Method Code Sequence"},
+    {{0x0068,0x63B0}, "SQ", "Mating Feature Sets Sequence"},
+    {{0x0068,0x63C0}, "US", "Mating Feature Set ID"},
+    {{0x0068,0x63D0}, "LO", "Mating Feature Set Label"},
+    {{0x0068,0x63E0}, "SQ", "Mating Feature Sequence"},
+    {{0x0068,0x63F0}, "US", "Mating Feature ID"},
+    {{0x0068,0x6400}, "SQ", "Mating Feature Degree of Freedom Sequence"},
+    {{0x0068,0x6410}, "US", "Degree of Freedom ID"},
+    {{0x0068,0x6420}, "CS", "Degree of Freedom Type"},
+    {{0x0068,0x6430}, "SQ", "2D Mating Feature Coordinates Sequence"},
+    {{0x0068,0x6440}, "US", "Referenced HPGL Document ID"},
+    {{0x0068,0x6450}, "FD", "2D Mating Point"},
+    {{0x0068,0x6460}, "FD", "2D Mating Axes"},
+    {{0x0068,0x6470}, "SQ", "2D Degree of Freedom Sequence"},
+    {{0x0068,0x6490}, "FD", "3D Degree of Freedom Axis"},
+    {{0x0068,0x64A0}, "FD", "Range of Freedom"},
+    {{0x0068,0x64C0}, "FD", "3D Mating Point"},
+    {{0x0068,0x64D0}, "FD", "3D Mating Axes"},
+    {{0x0068,0x64F0}, "FD", "2D Degree of Freedom Axis"},
+    {{0x0068,0x6500}, "SQ", "Planning Landmark Point Sequence"},
+    {{0x0068,0x6510}, "SQ", "Planning Landmark Line Sequence"},
+    {{0x0068,0x6520}, "SQ", "Planning Landmark Plane Sequence"},
+    {{0x0068,0x6530}, "US", "Planning Landmark ID"},
+    {{0x0068,0x6540}, "LO", "Planning Landmark Description"},
+    {{0x0068,0x6545}, "SQ", "Planning Landmark Identification Code Sequence"},
+    {{0x0068,0x6550}, "SQ", "2D Point Coordinates Sequence"},
+    {{0x0068,0x6560}, "FD", "2D Point Coordinates"},
+    {{0x0068,0x6590}, "FD", "3D Point Coordinates"},
+    {{0x0068,0x65A0}, "SQ", "2D Line Coordinates Sequence"},
+    {{0x0068,0x65B0}, "FD", "2D Line Coordinates"},
+    {{0x0068,0x65D0}, "FD", "3D Line Coordinates"},
+    {{0x0068,0x65E0}, "SQ", "2D Plane Coordinates Sequence"},
+    {{0x0068,0x65F0}, "FD", "2D Plane Intersection"},
+    {{0x0068,0x6610}, "FD", "3D Plane Origin"},
+    {{0x0068,0x6620}, "FD", "3D Plane Normal"},
+    {{0x0070,0x0001}, "SQ", "Graphic Annotation Sequence"},
+    {{0x0070,0x0002}, "CS", "Graphic Layer"},
+    {{0x0070,0x0003}, "CS", "Bounding Box Annotation Units"},
+    {{0x0070,0x0004}, "CS", "Anchor Point Annotation Units"},
+    {{0x0070,0x0005}, "CS", "Graphic Annotation Units"},
+    {{0x0070,0x0006}, "ST", "Unformatted Text Value"},
+    {{0x0070,0x0008}, "SQ", "Text Object Sequence"},
+    {{0x0070,0x0009}, "SQ", "Graphic Object Sequence"},
+    {{0x0070,0x0010}, "FL", "Bounding Box Top Left Hand Corner"},
+    {{0x0070,0x0011}, "FL", "Bounding Box Bottom Right Hand Corner"},
+    {{0x0070,0x0012}, "CS", "Bounding Box Text Horizontal Justification"},
+    {{0x0070,0x0014}, "FL", "Anchor Point"},
+    {{0x0070,0x0015}, "CS", "Anchor Point Visibility"},
+    {{0x0070,0x0020}, "US", "Graphic Dimensions"},
+    {{0x0070,0x0021}, "US", "Number of Graphic Points"},
+    {{0x0070,0x0022}, "FL", "Graphic Data"},
+    {{0x0070,0x0023}, "CS", "Graphic Type"},
+    {{0x0070,0x0024}, "CS", "Graphic Filled"},
+    {{0x0070,0x0040}, "IS", "Image Rotation (Retired)"},
+    {{0x0070,0x0041}, "CS", "Image Horizontal Flip"},
+    {{0x0070,0x0042}, "US", "Image Rotation"},
+    {{0x0070,0x0050}, "US", "Displayed Area Top Left Hand Corner (Trial)"},
+    {{0x0070,0x0051}, "US", "Displayed Area Bottom Right Hand Corner (Trial)"},
+    {{0x0070,0x0052}, "SL", "Displayed Area Top Left Hand Corner"},
+    {{0x0070,0x0053}, "SL", "Displayed Area Bottom Right Hand Corner"},
+    {{0x0070,0x005A}, "SQ", "Displayed Area Selection Sequence"},
+    {{0x0070,0x0060}, "SQ", "Graphic Layer Sequence"},
+    {{0x0070,0x0062}, "IS", "Graphic Layer Order"},
+    {{0x0070,0x0066}, "US", "Graphic Layer Recommended Display Grayscale Value"},
+    {{0x0070,0x0067}, "US", "Graphic Layer Recommended Display RGB Value"},
+    {{0x0070,0x0068}, "LO", "Graphic Layer Description"},
+    {{0x0070,0x0080}, "CS", "Content Label"},
+    {{0x0070,0x0081}, "LO", "Content Description"},
+    {{0x0070,0x0082}, "DA", "Presentation Creation Date"},
+    {{0x0070,0x0083}, "TM", "Presentation Creation Time"},
+    {{0x0070,0x0084}, "PN", "Content Creator's Name"},
+    {{0x0070,0x0086}, "SQ", "Content Creator's Identification Code Sequence"},
+    {{0x0070,0x0087}, "SQ", "Alternate Content Description Sequence"},
+    {{0x0070,0x0100}, "CS", "Presentation Size Mode"},
+    {{0x0070,0x0101}, "DS", "Presentation Pixel Spacing"},
+    {{0x0070,0x0102}, "IS", "Presentation Pixel Aspect Ratio"},
+    {{0x0070,0x0103}, "FL", "Presentation Pixel Magnification Ratio"},
+    {{0x0070,0x0207}, "LO", "Graphic Group Label"},
+    {{0x0070,0x0208}, "ST", "Graphic Group Description"},
+    {{0x0070,0x0209}, "SQ", "Compound Graphic Sequence"},
+    {{0x0070,0x0226}, "UL", "Compound Graphic Instance ID"},
+    {{0x0070,0x0227}, "LO", "Font Name"},
+    {{0x0070,0x0228}, "CS", "Font Name Type"},
+    {{0x0070,0x0229}, "LO", "CSS Font Name"},
+    {{0x0070,0x0230}, "FD", "Rotation Angle"},
+    {{0x0070,0x0231}, "SQ", "Text Style Sequence"},
+    {{0x0070,0x0232}, "SQ", "Line Style Sequence"},
+    {{0x0070,0x0233}, "SQ", "Fill Style Sequence"},
+    {{0x0070,0x0234}, "SQ", "Graphic Group Sequence"},
+    {{0x0070,0x0241}, "US", "Text Color CIELab Value"},
+    {{0x0070,0x0242}, "CS", "Horizontal Alignment"},
+    {{0x0070,0x0243}, "CS", "Vertical Alignment"},
+    {{0x0070,0x0244}, "CS", "Shadow Style"},
+    {{0x0070,0x0245}, "FL", "Shadow Offset X"},
+    {{0x0070,0x0246}, "FL", "Shadow Offset Y"},
+    {{0x0070,0x0247}, "US", "Shadow Color CIELab Value"},
+    {{0x0070,0x0248}, "CS", "Underlined"},
+    {{0x0070,0x0249}, "CS", "Bold"},
+    {{0x0070,0x0250}, "CS", "Italic"},
+    {{0x0070,0x0251}, "US", "Pattern On Color CIELab Value"},
+    {{0x0070,0x0252}, "US", "Pattern Off Color CIELab Value"},
+    {{0x0070,0x0253}, "FL", "Line Thickness"},
+    {{0x0070,0x0254}, "CS", "Line Dashing Style"},
+    {{0x0070,0x0255}, "UL", "Line Pattern"},
+    {{0x0070,0x0256}, "OB", "Fill Pattern"},
+    {{0x0070,0x0257}, "CS", "Fill Mode"},
+    {{0x0070,0x0258}, "FL", "Shadow Opacity"},
+    {{0x0070,0x0261}, "FL", "Gap Length"},
+    {{0x0070,0x0262}, "FL", "Diameter of Visibility"},
+    {{0x0070,0x0273}, "FL", "Rotation Point"},
+    {{0x0070,0x0274}, "CS", "Tick Alignment"},
+    {{0x0070,0x0278}, "CS", "Show Tick Label"},
+    {{0x0070,0x0279}, "CS", "Tick Label Alignment"},
+    {{0x0070,0x0282}, "CS", "Compound Graphic Units"},
+    {{0x0070,0x0284}, "FL", "Pattern On Opacity"},
+    {{0x0070,0x0285}, "FL", "Pattern Off Opacity"},
+    {{0x0070,0x0287}, "SQ", "Major Ticks Sequence"},
+    {{0x0070,0x0288}, "FL", "Tick Position"},
+    {{0x0070,0x0289}, "SH", "Tick Label"},
+    {{0x0070,0x0294}, "CS", "Compound Graphic Type"},
+    {{0x0070,0x0295}, "UL", "Graphic Group ID"},
+    {{0x0070,0x0306}, "CS", "Shape Type"},
+    {{0x0070,0x0308}, "SQ", "Registration Sequence"},
+    {{0x0070,0x0309}, "SQ", "Matrix Registration Sequence"},
+    {{0x0070,0x030A}, "SQ", "Matrix Sequence"},
+    {{0x0070,0x030B}, "FD", "Frame of Reference to Displayed Coordinate System Transformation Matrix"},
+    {{0x0070,0x030C}, "CS", "Frame of Reference Transformation Matrix Type"},
+    {{0x0070,0x030D}, "SQ", "Registration Type Code Sequence"},
+    {{0x0070,0x030F}, "ST", "Fiducial Description"},
+    {{0x0070,0x0310}, "SH", "Fiducial Identifier"},
+    {{0x0070,0x0311}, "SQ", "Fiducial Identifier Code Sequence"},
+    {{0x0070,0x0312}, "FD", "Contour Uncertainty Radius"},
+    {{0x0070,0x0314}, "SQ", "Used Fiducials Sequence"},
+    {{0x0070,0x0318}, "SQ", "Graphic Coordinates Data Sequence"},
+    {{0x0070,0x031A}, "UI", "Fiducial UID"},
+    {{0x0070,0x031C}, "SQ", "Fiducial Set Sequence"},
+    {{0x0070,0x031E}, "SQ", "Fiducial Sequence"},
+    {{0x0070,0x0401}, "US", "Graphic Layer Recommended Display CIELab Value"},
+    {{0x0070,0x0402}, "SQ", "Blending Sequence"},
+    {{0x0070,0x0403}, "FL", "Relative Opacity"},
+    {{0x0070,0x0404}, "SQ", "Referenced Spatial Registration Sequence"},
+    {{0x0070,0x0405}, "CS", "Blending Position"},
+    {{0x0070,0x1101}, "UI", "Presentation Display Collection UID"},
+    {{0x0070,0x1102}, "UI", "Presentation Sequence Collection UID"},
+    {{0x0070,0x1103}, "US", "Presentation Sequence Position Index"},
+    {{0x0070,0x1104}, "SQ", "Rendered Image Reference Sequence"},
+    {{0x0070,0x1201}, "SQ", "Volumetric Presentation State Input Sequence"},
+    {{0x0070,0x1202}, "CS", "Presentation Input Type"},
+    {{0x0070,0x1203}, "US", "Input Sequence Position Index"},
+    {{0x0070,0x1204}, "CS", "Crop"},
+    {{0x0070,0x1205}, "US", "Cropping Specification Index"},
+    {{0x0070,0x1206}, "CS", "Compositing Method"},
+    {{0x0070,0x1207}, "US", "Volumetric Presentation Input Number"},
+    {{0x0070,0x1208}, "CS", "Image Volume Geometry"},
+    {{0x0070,0x1301}, "SQ", "Volume Cropping Sequence"},
+    {{0x0070,0x1302}, "CS", "Volume Cropping Method"},
+    {{0x0070,0x1303}, "FD", "Bounding Box Crop"},
+    {{0x0070,0x1304}, "SQ", "Oblique Cropping Plane Sequence"},
+    {{0x0070,0x1305}, "FD", "Plane"},
+    {{0x0070,0x1306}, "FD", "Plane Normal"},
+    {{0x0070,0x1309}, "US", "Cropping Specification Number"},
+    {{0x0070,0x1501}, "CS", "Multi-Planar Reconstruction Style"},
+    {{0x0070,0x1502}, "CS", "MPR Thickness Type"},
+    {{0x0070,0x1503}, "FD", "MPR Slab Thickness"},
+    {{0x0070,0x1505}, "FD", "MPR Top Left Hand Corner"},
+    {{0x0070,0x1507}, "FD", "MPR View Width Direction"},
+    {{0x0070,0x1508}, "FD", "MPR View Width"},
+    {{0x0070,0x150C}, "UL", "Number of Volumetric Curve Points"},
+    {{0x0070,0x150D}, "OD", "Volumetric Curve Points"},
+    {{0x0070,0x1511}, "FD", "MPR View Height Direction"},
+    {{0x0070,0x1512}, "FD", "MPR View Height"},
+    {{0x0070,0x1801}, "SQ", "Presentation State Classification Component Sequence"},
+    {{0x0070,0x1802}, "CS", "Component Type"},
+    {{0x0070,0x1803}, "SQ", "Component Input Sequence"},
+    {{0x0070,0x1804}, "US", "Volumetric Presentation Input Index"},
+    {{0x0070,0x1805}, "SQ", "Presentation State Compositor Component Sequence"},
+    {{0x0070,0x1806}, "SQ", "Weighting Transfer Function Sequence"},
+    {{0x0070,0x1807}, "US", "Weighting Lookup Table Descriptor"},
+    {{0x0070,0x1808}, "OB", "Weighting Lookup Table Data"},
+    {{0x0070,0x1901}, "SQ", "Volumetric Annotation Sequence"},
+    {{0x0070,0x1903}, "SQ", "Referenced Structured Context Sequence"},
+    {{0x0070,0x1904}, "UI", "Referenced Content Item"},
+    {{0x0070,0x1905}, "SQ", "Volumetric Presentation Input Annotation Sequence"},
+    {{0x0070,0x1907}, "CS", "Annotation Clipping"},
+    {{0x0070,0x1A01}, "CS", "Presentation Animation Style"},
+    {{0x0070,0x1A03}, "FD", "Recommended Animation Rate"},
+    {{0x0070,0x1A04}, "SQ", "Animation Curve Sequence"},
+    {{0x0070,0x1A05}, "FD", "Animation Step Size"},
+    {{0x0072,0x0002}, "SH", "Hanging Protocol Name"},
+    {{0x0072,0x0004}, "LO", "Hanging Protocol Description"},
+    {{0x0072,0x0006}, "CS", "Hanging Protocol Level"},
+    {{0x0072,0x0008}, "LO", "Hanging Protocol Creator"},
+    {{0x0072,0x000A}, "DT", "Hanging Protocol Creation DateTime"},
+    {{0x0072,0x000C}, "SQ", "Hanging Protocol Definition Sequence"},
+    {{0x0072,0x000E}, "SQ", "Hanging Protocol User Identification Code Sequence"},
+    {{0x0072,0x0010}, "LO", "Hanging Protocol User Group Name"},
+    {{0x0072,0x0012}, "SQ", "Source Hanging Protocol Sequence"},
+    {{0x0072,0x0014}, "US", "Number of Priors Referenced"},
+    {{0x0072,0x0020}, "SQ", "Image Sets Sequence"},
+    {{0x0072,0x0022}, "SQ", "Image Set Selector Sequence"},
+    {{0x0072,0x0024}, "CS", "Image Set Selector Usage Flag"},
+    {{0x0072,0x0026}, "AT", "Selector Attribute"},
+    {{0x0072,0x0028}, "US", "Selector Value Number"},
+    {{0x0072,0x0030}, "SQ", "Time Based Image Sets Sequence"},
+    {{0x0072,0x0032}, "US", "Image Set Number"},
+    {{0x0072,0x0034}, "CS", "Image Set Selector Category"},
+    {{0x0072,0x0038}, "US", "Relative Time"},
+    {{0x0072,0x003A}, "CS", "Relative Time Units"},
+    {{0x0072,0x003C}, "SS", "Abstract Prior Value"},
+    {{0x0072,0x003E}, "SQ", "Abstract Prior Code Sequence"},
+    {{0x0072,0x0040}, "LO", "Image Set Label"},
+    {{0x0072,0x0050}, "CS", "Selector Attribute VR"},
+    {{0x0072,0x0052}, "AT", "Selector Sequence Pointer"},
+    {{0x0072,0x0054}, "LO", "Selector Sequence Pointer Private Creator"},
+    {{0x0072,0x0056}, "LO", "Selector Attribute Private Creator"},
+    {{0x0072,0x005E}, "AE", "Selector AE Value"},
+    {{0x0072,0x005F}, "AS", "Selector AS Value"},
+    {{0x0072,0x0060}, "AT", "Selector AT Value"},
+    {{0x0072,0x0061}, "DA", "Selector DA Value"},
+    {{0x0072,0x0062}, "CS", "Selector CS Value"},
+    {{0x0072,0x0063}, "DT", "Selector DT Value"},
+    {{0x0072,0x0064}, "IS", "Selector IS Value"},
+    {{0x0072,0x0065}, "OB", "Selector OB Value"},
+    {{0x0072,0x0066}, "LO", "Selector LO Value"},
+    {{0x0072,0x0067}, "OF", "Selector OF Value"},
+    {{0x0072,0x0068}, "LT", "Selector LT Value"},
+    {{0x0072,0x0069}, "OW", "Selector OW Value"},
+    {{0x0072,0x006A}, "PN", "Selector PN Value"},
+    {{0x0072,0x006B}, "TM", "Selector TM Value"},
+    {{0x0072,0x006C}, "SH", "Selector SH Value"},
+    {{0x0072,0x006D}, "UN", "Selector UN Value"},
+    {{0x0072,0x006E}, "ST", "Selector ST Value"},
+    {{0x0072,0x006F}, "UC", "Selector UC Value"},
+    {{0x0072,0x0070}, "UT", "Selector UT Value"},
+    {{0x0072,0x0071}, "UR", "Selector UR Value"},
+    {{0x0072,0x0072}, "DS", "Selector DS Value"},
+    {{0x0072,0x0073}, "OD", "Selector OD Value"},
+    {{0x0072,0x0074}, "FD", "Selector FD Value"},
+    {{0x0072,0x0075}, "OL", "Selector OL Value"},
+    {{0x0072,0x0076}, "FL", "Selector FL Value"},
+    {{0x0072,0x0078}, "UL", "Selector UL Value"},
+    {{0x0072,0x007A}, "US", "Selector US Value"},
+    {{0x0072,0x007C}, "SL", "Selector SL Value"},
+    {{0x0072,0x007E}, "SS", "Selector SS Value"},
+    {{0x0072,0x007F}, "UI", "Selector UI Value"},
+    {{0x0072,0x0080}, "SQ", "Selector Code Sequence Value"},
+    {{0x0072,0x0100}, "US", "Number of Screens"},
+    {{0x0072,0x0102}, "SQ", "Nominal Screen Definition Sequence"},
+    {{0x0072,0x0104}, "US", "Number of Vertical Pixels"},
+    {{0x0072,0x0106}, "US", "Number of Horizontal Pixels"},
+    {{0x0072,0x0108}, "FD", "Display Environment Spatial Position"},
+    {{0x0072,0x010A}, "US", "Screen Minimum Grayscale Bit Depth"},
+    {{0x0072,0x010C}, "US", "Screen Minimum Color Bit Depth"},
+    {{0x0072,0x010E}, "US", "Application Maximum Repaint Time"},
+    {{0x0072,0x0200}, "SQ", "Display Sets Sequence"},
+    {{0x0072,0x0202}, "US", "Display Set Number"},
+    {{0x0072,0x0203}, "LO", "Display Set Label"},
+    {{0x0072,0x0204}, "US", "Display Set Presentation Group"},
+    {{0x0072,0x0206}, "LO", "Display Set Presentation Group Description"},
+    {{0x0072,0x0208}, "CS", "Partial Data Display Handling"},
+    {{0x0072,0x0210}, "SQ", "Synchronized Scrolling Sequence"},
+    {{0x0072,0x0212}, "US", "Display Set Scrolling Group"},
+    {{0x0072,0x0214}, "SQ", "Navigation Indicator Sequence"},
+    {{0x0072,0x0216}, "US", "Navigation Display Set"},
+    {{0x0072,0x0218}, "US", "Reference Display Sets"},
+    {{0x0072,0x0300}, "SQ", "Image Boxes Sequence"},
+    {{0x0072,0x0302}, "US", "Image Box Number"},
+    {{0x0072,0x0304}, "CS", "Image Box Layout Type"},
+    {{0x0072,0x0306}, "US", "Image Box Tile Horizontal Dimension"},
+    {{0x0072,0x0308}, "US", "Image Box Tile Vertical Dimension"},
+    {{0x0072,0x0310}, "CS", "Image Box Scroll Direction"},
+    {{0x0072,0x0312}, "CS", "Image Box Small Scroll Type"},
+    {{0x0072,0x0314}, "US", "Image Box Small Scroll Amount"},
+    {{0x0072,0x0316}, "CS", "Image Box Large Scroll Type"},
+    {{0x0072,0x0318}, "US", "Image Box Large Scroll Amount"},
+    {{0x0072,0x0320}, "US", "Image Box Overlap Priority"},
+    {{0x0072,0x0330}, "FD", "Cine Relative to Real-Time"},
+    {{0x0072,0x0400}, "SQ", "Filter Operations Sequence"},
+    {{0x0072,0x0402}, "CS", "Filter-by Category"},
+    {{0x0072,0x0404}, "CS", "Filter-by Attribute Presence"},
+    {{0x0072,0x0406}, "CS", "Filter-by Operator"},
+    {{0x0072,0x0420}, "US", "Structured Display Background CIELab Value"},
+    {{0x0072,0x0421}, "US", "Empty Image Box CIELab Value"},
+    {{0x0072,0x0422}, "SQ", "Structured Display Image Box Sequence"},
+    {{0x0072,0x0424}, "SQ", "Structured Display Text Box Sequence"},
+    {{0x0072,0x0427}, "SQ", "Referenced First Frame Sequence"},
+    {{0x0072,0x0430}, "SQ", "Image Box Synchronization Sequence"},
+    {{0x0072,0x0432}, "US", "Synchronized Image Box List"},
+    {{0x0072,0x0434}, "CS", "Type of Synchronization"},
+    {{0x0072,0x0500}, "CS", "Blending Operation Type"},
+    {{0x0072,0x0510}, "CS", "Reformatting Operation Type"},
+    {{0x0072,0x0512}, "FD", "Reformatting Thickness"},
+    {{0x0072,0x0514}, "FD", "Reformatting Interval"},
+    {{0x0072,0x0516}, "CS", "Reformatting Operation Initial View Direction"},
+    {{0x0072,0x0520}, "CS", "3D Rendering Type"},
+    {{0x0072,0x0600}, "SQ", "Sorting Operations Sequence"},
+    {{0x0072,0x0602}, "CS", "Sort-by Category"},
+    {{0x0072,0x0604}, "CS", "Sorting Direction"},
+    {{0x0072,0x0700}, "CS", "Display Set Patient Orientation"},
+    {{0x0072,0x0702}, "CS", "VOI Type"},
+    {{0x0072,0x0704}, "CS", "Pseudo-Color Type"},
+    {{0x0072,0x0705}, "SQ", "Pseudo-Color Palette Instance Reference Sequence"},
+    {{0x0072,0x0706}, "CS", "Show Grayscale Inverted"},
+    {{0x0072,0x0710}, "CS", "Show Image True Size Flag"},
+    {{0x0072,0x0712}, "CS", "Show Graphic Annotation Flag"},
+    {{0x0072,0x0714}, "CS", "Show Patient Demographics Flag"},
+    {{0x0072,0x0716}, "CS", "Show Acquisition Techniques Flag"},
+    {{0x0072,0x0717}, "CS", "Display Set Horizontal Justification"},
+    {{0x0072,0x0718}, "CS", "Display Set Vertical Justification"},
+    {{0x0074,0x0120}, "FD", "Continuation Start Meterset"},
+    {{0x0074,0x0121}, "FD", "Continuation End Meterset"},
+    {{0x0074,0x1000}, "CS", "Procedure Step State"},
+    {{0x0074,0x1002}, "SQ", "Procedure Step Progress Information Sequence"},
+    {{0x0074,0x1004}, "DS", "Procedure Step Progress"},
+    {{0x0074,0x1006}, "ST", "Procedure Step Progress Description"},
+    {{0x0074,0x1008}, "SQ", "Procedure Step Communications URI Sequence"},
+    {{0x0074,0x100A}, "UR", "Contact URI"},
+    {{0x0074,0x100C}, "LO", "Contact Display Name"},
+    {{0x0074,0x100E}, "SQ", "Procedure Step Discontinuation Reason Code Sequence"},
+    {{0x0074,0x1020}, "SQ", "Beam Task Sequence"},
+    {{0x0074,0x1022}, "CS", "Beam Task Type"},
+    {{0x0074,0x1024}, "IS", "Beam Order Index (Trial)"},
+    {{0x0074,0x1025}, "CS", "Autosequence Flag"},
+    {{0x0074,0x1026}, "FD", "Table Top Vertical Adjusted Position"},
+    {{0x0074,0x1027}, "FD", "Table Top Longitudinal Adjusted Position"},
+    {{0x0074,0x1028}, "FD", "Table Top Lateral Adjusted Position"},
+    {{0x0074,0x102A}, "FD", "Patient Support Adjusted Angle"},
+    {{0x0074,0x102B}, "FD", "Table Top Eccentric Adjusted Angle"},
+    {{0x0074,0x102C}, "FD", "Table Top Pitch Adjusted Angle"},
+    {{0x0074,0x102D}, "FD", "Table Top Roll Adjusted Angle"},
+    {{0x0074,0x1030}, "SQ", "Delivery Verification Image Sequence"},
+    {{0x0074,0x1032}, "CS", "Verification Image Timing"},
+    {{0x0074,0x1034}, "CS", "Double Exposure Flag"},
+    {{0x0074,0x1036}, "CS", "Double Exposure Ordering"},
+    {{0x0074,0x1038}, "DS", "Double Exposure Meterset (Trial)"},
+    {{0x0074,0x103A}, "DS", "Double Exposure Field Delta (Trial)"},
+    {{0x0074,0x1040}, "SQ", "Related Reference RT Image Sequence"},
+    {{0x0074,0x1042}, "SQ", "General Machine Verification Sequence"},
+    {{0x0074,0x1044}, "SQ", "Conventional Machine Verification Sequence"},
+    {{0x0074,0x1046}, "SQ", "Ion Machine Verification Sequence"},
+    {{0x0074,0x1048}, "SQ", "Failed Attributes Sequence"},
+    {{0x0074,0x104A}, "SQ", "Overridden Attributes Sequence"},
+    {{0x0074,0x104C}, "SQ", "Conventional Control Point Verification Sequence"},
+    {{0x0074,0x104E}, "SQ", "Ion Control Point Verification Sequence"},
+    {{0x0074,0x1050}, "SQ", "Attribute Occurrence Sequence"},
+    {{0x0074,0x1052}, "AT", "Attribute Occurrence Pointer"},
+    {{0x0074,0x1054}, "UL", "Attribute Item Selector"},
+    {{0x0074,0x1056}, "LO", "Attribute Occurrence Private Creator"},
+    {{0x0074,0x1057}, "IS", "Selector Sequence Pointer Items"},
+    {{0x0074,0x1200}, "CS", "Scheduled Procedure Step Priority"},
+    {{0x0074,0x1202}, "LO", "Worklist Label"},
+    {{0x0074,0x1204}, "LO", "Procedure Step Label"},
+    {{0x0074,0x1210}, "SQ", "Scheduled Processing Parameters Sequence"},
+    {{0x0074,0x1212}, "SQ", "Performed Processing Parameters Sequence"},
+    {{0x0074,0x1216}, "SQ", "Unified Procedure Step Performed Procedure Sequence"},
+    {{0x0074,0x1220}, "SQ", "Related Procedure Step Sequence"},
+    {{0x0074,0x1222}, "LO", "Procedure Step Relationship Type"},
+    {{0x0074,0x1224}, "SQ", "Replaced Procedure Step Sequence"},
+    {{0x0074,0x1230}, "LO", "Deletion Lock"},
+    {{0x0074,0x1234}, "AE", "Receiving AE"},
+    {{0x0074,0x1236}, "AE", "Requesting AE"},
+    {{0x0074,0x1238}, "LT", "Reason for Cancellation"},
+    {{0x0074,0x1242}, "CS", "SCP Status"},
+    {{0x0074,0x1244}, "CS", "Subscription List Status"},
+    {{0x0074,0x1246}, "CS", "Unified Procedure Step List Status"},
+    {{0x0074,0x1324}, "UL", "Beam Order Index"},
+    {{0x0074,0x1338}, "FD", "Double Exposure Meterset"},
+    {{0x0074,0x133A}, "FD", "Double Exposure Field Delta"},
+    {{0x0074,0x1401}, "SQ", "Brachy Task Sequence"},
+    {{0x0074,0x1402}, "DS", "Continuation Start Total Reference Air Kerma"},
+    {{0x0074,0x1403}, "DS", "Continuation End Total Reference Air Kerma"},
+    {{0x0074,0x1404}, "IS", "Continuation Pulse Number"},
+    {{0x0074,0x1405}, "SQ", "Channel Delivery Order Sequence"},
+    {{0x0074,0x1406}, "IS", "Referenced Channel Number"},
+    {{0x0074,0x1407}, "DS", "Start Cumulative Time Weight"},
+    {{0x0074,0x1408}, "DS", "End Cumulative Time Weight"},
+    {{0x0074,0x1409}, "SQ", "Omitted Channel Sequence"},
+    {{0x0074,0x140A}, "CS", "Reason for Channel Omission"},
+    {{0x0074,0x140B}, "LO", "Reason for Channel Omission Description"},
+    {{0x0074,0x140C}, "IS", "Channel Delivery Order Index"},
+    {{0x0074,0x140D}, "SQ", "Channel Delivery Continuation Sequence"},
+    {{0x0074,0x140E}, "SQ", "Omitted Application Setup Sequence"},
+    {{0x0076,0x0001}, "LO", "Implant Assembly Template Name"},
+    {{0x0076,0x0003}, "LO", "Implant Assembly Template Issuer"},
+    {{0x0076,0x0006}, "LO", "Implant Assembly Template Version"},
+    {{0x0076,0x0008}, "SQ", "Replaced Implant Assembly Template Sequence"},
+    {{0x0076,0x000A}, "CS", "Implant Assembly Template Type"},
+    {{0x0076,0x000C}, "SQ", "Original Implant Assembly Template Sequence"},
+    {{0x0076,0x000E}, "SQ", "Derivation Implant Assembly Template Sequence"},
+    {{0x0076,0x0010}, "SQ", "Implant Assembly Template Target Anatomy Sequence"},
+    {{0x0076,0x0020}, "SQ", "Procedure Type Code Sequence"},
+    {{0x0076,0x0030}, "LO", "Surgical Technique"},
+    {{0x0076,0x0032}, "SQ", "Component Types Sequence"},
+    {{0x0076,0x0034}, "CS", "Component Type Code Sequence"},
+    {{0x0076,0x0036}, "CS", "Exclusive Component Type"},
+    {{0x0076,0x0038}, "CS", "Mandatory Component Type"},
+    {{0x0076,0x0040}, "SQ", "Component Sequence"},
+    {{0x0076,0x0055}, "US", "Component ID"},
+    {{0x0076,0x0060}, "SQ", "Component Assembly Sequence"},
+    {{0x0076,0x0070}, "US", "Component 1 Referenced ID"},
+    {{0x0076,0x0080}, "US", "Component 1 Referenced Mating Feature Set ID"},
+    {{0x0076,0x0090}, "US", "Component 1 Referenced Mating Feature ID"},
+    {{0x0076,0x00A0}, "US", "Component 2 Referenced ID"},
+    {{0x0076,0x00B0}, "US", "Component 2 Referenced Mating Feature Set ID"},
+    {{0x0076,0x00C0}, "US", "Component 2 Referenced Mating Feature ID"},
+    {{0x0078,0x0001}, "LO", "Implant Template Group Name"},
+    {{0x0078,0x0010}, "ST", "Implant Template Group Description"},
+    {{0x0078,0x0020}, "LO", "Implant Template Group Issuer"},
+    {{0x0078,0x0024}, "LO", "Implant Template Group Version"},
+    {{0x0078,0x0026}, "SQ", "Replaced Implant Template Group Sequence"},
+    {{0x0078,0x0028}, "SQ", "Implant Template Group Target Anatomy Sequence"},
+    {{0x0078,0x002A}, "SQ", "Implant Template Group Members Sequence"},
+    {{0x0078,0x002E}, "US", "Implant Template Group Member ID"},
+    {{0x0078,0x0050}, "FD", "3D Implant Template Group Member Matching Point"},
+    {{0x0078,0x0060}, "FD", "3D Implant Template Group Member Matching Axes"},
+    {{0x0078,0x0070}, "SQ", "Implant Template Group Member Matching 2D Coordinates Sequence"},
+    {{0x0078,0x0090}, "FD", "2D Implant Template Group Member Matching Point"},
+    {{0x0078,0x00A0}, "FD", "2D Implant Template Group Member Matching Axes"},
+    {{0x0078,0x00B0}, "SQ", "Implant Template Group Variation Dimension Sequence"},
+    {{0x0078,0x00B2}, "LO", "Implant Template Group Variation Dimension Name"},
+    {{0x0078,0x00B4}, "SQ", "Implant Template Group Variation Dimension Rank Sequence"},
+    {{0x0078,0x00B6}, "US", "Referenced Implant Template Group Member ID"},
+    {{0x0078,0x00B8}, "US", "Implant Template Group Variation Dimension Rank"},
+    {{0x0080,0x0001}, "SQ", "Surface Scan Acquisition Type Code Sequence"},
+    {{0x0080,0x0002}, "SQ", "Surface Scan Mode Code Sequence"},
+    {{0x0080,0x0003}, "SQ", "Registration Method Code Sequence"},
+    {{0x0080,0x0004}, "FD", "Shot Duration Time"},
+    {{0x0080,0x0005}, "FD", "Shot Offset Time"},
+    {{0x0080,0x0006}, "US", "Surface Point Presentation Value Data"},
+    {{0x0080,0x0007}, "US", "Surface Point Color CIELab Value Data"},
+    {{0x0080,0x0008}, "SQ", "UV Mapping Sequence"},
+    {{0x0080,0x0009}, "SH", "Texture Label"},
+    {{0x0080,0x0010}, "OF", "U Value Data"},
+    {{0x0080,0x0011}, "OF", "V Value Data"},
+    {{0x0080,0x0012}, "SQ", "Referenced Texture Sequence"},
+    {{0x0080,0x0013}, "SQ", "Referenced Surface Data Sequence"},
+    {{0x0082,0x0001}, "CS", "Assessment Summary"},
+    {{0x0082,0x0003}, "UT", "Assessment Summary Description"},
+    {{0x0082,0x0004}, "SQ", "Assessed SOP Instance Sequence"},
+    {{0x0082,0x0005}, "SQ", "Referenced Comparison SOP Instance Sequence"},
+    {{0x0082,0x0006}, "UL", "Number of Assessment Observations"},
+    {{0x0082,0x0007}, "SQ", "Assessment Observations Sequence"},
+    {{0x0082,0x0008}, "CS", "Observation Significance"},
+    {{0x0082,0x000A}, "UT", "Observation Description"},
+    {{0x0082,0x000C}, "SQ", "Structured Constraint Observation Sequence"},
+    {{0x0082,0x0010}, "SQ", "Assessed Attribute Value Sequence"},
+    {{0x0082,0x0016}, "LO", "Assessment Set ID"},
+    {{0x0082,0x0017}, "SQ", "Assessment Requester Sequence"},
+    {{0x0082,0x0018}, "LO", "Selector Attribute Name"},
+    {{0x0082,0x0019}, "LO", "Selector Attribute Keyword"},
+    {{0x0082,0x0021}, "SQ", "Assessment Type Code Sequence"},
+    {{0x0082,0x0022}, "SQ", "Observation Basis Code Sequence"},
+    {{0x0082,0x0023}, "LO", "Assessment Label"},
+    {{0x0082,0x0032}, "CS", "Constraint Type"},
+    {{0x0082,0x0033}, "UT", "Specification Selection Guidance"},
+    {{0x0082,0x0034}, "SQ", "Constraint Value Sequence"},
+    {{0x0082,0x0035}, "SQ", "Recommended Default Value Sequence"},
+    {{0x0082,0x0036}, "CS", "Constraint Violation Significance"},
+    {{0x0082,0x0037}, "UT", "Constraint Violation Condition"},
+    {{0x0088,0x0130}, "SH", "Storage Media File-set ID"},
+    {{0x0088,0x0140}, "UI", "Storage Media File-set UID"},
+    {{0x0088,0x0200}, "SQ", "Icon Image Sequence"},
+    {{0x0088,0x0904}, "LO", "Topic Title"},
+    {{0x0088,0x0906}, "ST", "Topic Subject"},
+    {{0x0088,0x0910}, "LO", "Topic Author"},
+    {{0x0088,0x0912}, "LO", "Topic Keywords"},
+    {{0x0100,0x0410}, "CS", "SOP Instance Status"},
+    {{0x0100,0x0420}, "DT", "SOP Authorization DateTime"},
+    {{0x0100,0x0424}, "LT", "SOP Authorization Comment"},
+    {{0x0100,0x0426}, "LO", "Authorization Equipment Certification Number"},
+    {{0x0400,0x0005}, "US", "MAC ID Number"},
+    {{0x0400,0x0010}, "UI", "MAC Calculation Transfer Syntax UID"},
+    {{0x0400,0x0015}, "CS", "MAC Algorithm"},
+    {{0x0400,0x0020}, "AT", "Data Elements Signed"},
+    {{0x0400,0x0100}, "UI", "Digital Signature UID"},
+    {{0x0400,0x0105}, "DT", "Digital Signature DateTime"},
+    {{0x0400,0x0110}, "CS", "Certificate Type"},
+    {{0x0400,0x0115}, "OB", "Certificate of Signer"},
+    {{0x0400,0x0120}, "OB", "Signature"},
+    {{0x0400,0x0305}, "CS", "Certified Timestamp Type"},
+    {{0x0400,0x0310}, "OB", "Certified Timestamp"},
+    {{0x0400,0x0315}, "FL", ""},
+    {{0x0400,0x0401}, "SQ", "Digital Signature Purpose Code Sequence"},
+    {{0x0400,0x0402}, "SQ", "Referenced Digital Signature Sequence"},
+    {{0x0400,0x0403}, "SQ", "Referenced SOP Instance MAC Sequence"},
+    {{0x0400,0x0404}, "OB", "MAC"},
+    {{0x0400,0x0500}, "SQ", "Encrypted Attributes Sequence"},
+    {{0x0400,0x0510}, "UI", "Encrypted Content Transfer Syntax UID"},
+    {{0x0400,0x0520}, "OB", "Encrypted Content"},
+    {{0x0400,0x0550}, "SQ", "Modified Attributes Sequence"},
+    {{0x0400,0x0561}, "SQ", "Original Attributes Sequence"},
+    {{0x0400,0x0562}, "DT", "Attribute Modification DateTime"},
+    {{0x0400,0x0563}, "LO", "Modifying System"},
+    {{0x0400,0x0564}, "LO", "Source of Previous Values"},
+    {{0x0400,0x0565}, "CS", "Reason for the Attribute Modification"},
+    //{{0x1000,0xxxx0}, "US", "Escape Triplet"},
+    //{{0x1000,0xxxx1}, "US", "Run Length Triplet"},
+    //{{0x1000,0xxxx2}, "US", "Huffman Table Size"},
+    //{{0x1000,0xxxx3}, "US", "Huffman Table Triplet"},
+    //{{0x1000,0xxxx4}, "US", "Shift Table Size"},
+    //{{0x1000,0xxxx5}, "US", "Shift Table Triplet"},
+    //{{0x1010,0xxxxx}, "US", "Zonal Map"},
+    {{0x2000,0x0010}, "IS", "Number of Copies"},
+    {{0x2000,0x001E}, "SQ", "Printer Configuration Sequence"},
+    {{0x2000,0x0020}, "CS", "Print Priority"},
+    {{0x2000,0x0030}, "CS", "Medium Type"},
+    {{0x2000,0x0040}, "CS", "Film Destination"},
+    {{0x2000,0x0050}, "LO", "Film Session Label"},
+    {{0x2000,0x0060}, "IS", "Memory Allocation"},
+    {{0x2000,0x0061}, "IS", "Maximum Memory Allocation"},
+    {{0x2000,0x0062}, "CS", "Color Image Printing Flag"},
+    {{0x2000,0x0063}, "CS", "Collation Flag"},
+    {{0x2000,0x0065}, "CS", "Annotation Flag"},
+    {{0x2000,0x0067}, "CS", "Image Overlay Flag"},
+    {{0x2000,0x0069}, "CS", "Presentation LUT Flag"},
+    {{0x2000,0x006A}, "CS", "Image Box Presentation LUT Flag"},
+    {{0x2000,0x00A0}, "US", "Memory Bit Depth"},
+    {{0x2000,0x00A1}, "US", "Printing Bit Depth"},
+    {{0x2000,0x00A2}, "SQ", "Media Installed Sequence"},
+    {{0x2000,0x00A4}, "SQ", "Other Media Available Sequence"},
+    {{0x2000,0x00A8}, "SQ", "Supported Image Display Formats Sequence"},
+    {{0x2000,0x0500}, "SQ", "Referenced Film Box Sequence"},
+    {{0x2000,0x0510}, "SQ", "Referenced Stored Print Sequence"},
+    {{0x2010,0x0010}, "ST", "Image Display Format"},
+    {{0x2010,0x0030}, "CS", "Annotation Display Format ID"},
+    {{0x2010,0x0040}, "CS", "Film Orientation"},
+    {{0x2010,0x0050}, "CS", "Film Size ID"},
+    {{0x2010,0x0052}, "CS", "Printer Resolution ID"},
+    {{0x2010,0x0054}, "CS", "Default Printer Resolution ID"},
+    {{0x2010,0x0060}, "CS", "Magnification Type"},
+    {{0x2010,0x0080}, "CS", "Smoothing Type"},
+    {{0x2010,0x00A6}, "CS", "Default Magnification Type"},
+    {{0x2010,0x00A7}, "CS", "Other Magnification Types Available"},
+    {{0x2010,0x00A8}, "CS", "Default Smoothing Type"},
+    {{0x2010,0x00A9}, "CS", "Other Smoothing Types Available"},
+    {{0x2010,0x0100}, "CS", "Border Density"},
+    {{0x2010,0x0110}, "CS", "Empty Image Density"},
+    {{0x2010,0x0120}, "US", "Min Density"},
+    {{0x2010,0x0130}, "US", "Max Density"},
+    {{0x2010,0x0140}, "CS", "Trim"},
+    {{0x2010,0x0150}, "ST", "Configuration Information"},
+    {{0x2010,0x0152}, "LT", "Configuration Information Description"},
+    {{0x2010,0x0154}, "IS", "Maximum Collated Films"},
+    {{0x2010,0x015E}, "US", "Illumination"},
+    {{0x2010,0x0160}, "US", "Reflected Ambient Light"},
+    {{0x2010,0x0376}, "DS", "Printer Pixel Spacing"},
+    {{0x2010,0x0500}, "SQ", "Referenced Film Session Sequence"},
+    {{0x2010,0x0510}, "SQ", "Referenced Image Box Sequence"},
+    {{0x2010,0x0520}, "SQ", "Referenced Basic Annotation Box Sequence"},
+    {{0x2020,0x0010}, "US", "Image Box Position"},
+    {{0x2020,0x0020}, "CS", "Polarity"},
+    {{0x2020,0x0030}, "DS", "Requested Image Size"},
+    {{0x2020,0x0040}, "CS", "Requested Decimate/Crop Behavior"},
+    {{0x2020,0x0050}, "CS", "Requested Resolution ID"},
+    {{0x2020,0x00A0}, "CS", "Requested Image Size Flag"},
+    {{0x2020,0x00A2}, "CS", "Decimate/Crop Result"},
+    {{0x2020,0x0110}, "SQ", "Basic Grayscale Image Sequence"},
+    {{0x2020,0x0111}, "SQ", "Basic Color Image Sequence"},
+    {{0x2020,0x0130}, "SQ", "Referenced Image Overlay Box Sequence"},
+    {{0x2020,0x0140}, "SQ", "Referenced VOI LUT Box Sequence"},
+    {{0x2030,0x0010}, "US", "Annotation Position"},
+    {{0x2030,0x0020}, "LO", "Text String"},
+    {{0x2040,0x0010}, "SQ", "Referenced Overlay Plane Sequence"},
+    {{0x2040,0x0011}, "US", "Referenced Overlay Plane Groups"},
+    {{0x2040,0x0020}, "SQ", "Overlay Pixel Data Sequence"},
+    {{0x2040,0x0060}, "CS", "Overlay Magnification Type"},
+    {{0x2040,0x0070}, "CS", "Overlay Smoothing Type"},
+    {{0x2040,0x0072}, "CS", "Overlay or Image Magnification"},
+    {{0x2040,0x0074}, "US", "Magnify to Number of Columns"},
+    {{0x2040,0x0080}, "CS", "Overlay Foreground Density"},
+    {{0x2040,0x0082}, "CS", "Overlay Background Density"},
+    {{0x2040,0x0090}, "CS", "Overlay Mode"},
+    {{0x2040,0x0100}, "CS", "Threshold Density"},
+    {{0x2040,0x0500}, "SQ", "Referenced Image Box Sequence (Retired)"},
+    {{0x2050,0x0010}, "SQ", "Presentation LUT Sequence"},
+    {{0x2050,0x0020}, "CS", "Presentation LUT Shape"},
+    {{0x2050,0x0500}, "SQ", "Referenced Presentation LUT Sequence"},
+    {{0x2100,0x0010}, "SH", "Print Job ID"},
+    {{0x2100,0x0020}, "CS", "Execution Status"},
+    {{0x2100,0x0030}, "CS", "Execution Status Info"},
+    {{0x2100,0x0040}, "DA", "Creation Date"},
+    {{0x2100,0x0050}, "TM", "Creation Time"},
+    {{0x2100,0x0070}, "AE", "Originator"},
+    {{0x2100,0x0140}, "AE", "Destination AE"},
+    {{0x2100,0x0160}, "SH", "Owner ID"},
+    {{0x2100,0x0170}, "IS", "Number of Films"},
+    {{0x2100,0x0500}, "SQ", "Referenced Print Job Sequence (Pull Stored Print)"},
+    {{0x2110,0x0010}, "CS", "Printer Status"},
+    {{0x2110,0x0020}, "CS", "Printer Status Info"},
+    {{0x2110,0x0030}, "LO", "Printer Name"},
+    {{0x2110,0x0099}, "SH", "Print Queue ID"},
+    {{0x2120,0x0010}, "CS", "Queue Status"},
+    {{0x2120,0x0050}, "SQ", "Print Job Description Sequence"},
+    {{0x2120,0x0070}, "SQ", "Referenced Print Job Sequence"},
+    {{0x2130,0x0010}, "SQ", "Print Management Capabilities Sequence"},
+    {{0x2130,0x0015}, "SQ", "Printer Characteristics Sequence"},
+    {{0x2130,0x0030}, "SQ", "Film Box Content Sequence"},
+    {{0x2130,0x0040}, "SQ", "Image Box Content Sequence"},
+    {{0x2130,0x0050}, "SQ", "Annotation Content Sequence"},
+    {{0x2130,0x0060}, "SQ", "Image Overlay Box Content Sequence"},
+    {{0x2130,0x0080}, "SQ", "Presentation LUT Content Sequence"},
+    {{0x2130,0x00A0}, "SQ", "Proposed Study Sequence"},
+    {{0x2130,0x00C0}, "SQ", "Original Image Sequence"},
+    {{0x2200,0x0001}, "CS", "Label Using Information Extracted From Instances"},
+    {{0x2200,0x0002}, "UT", "Label Text"},
+    {{0x2200,0x0003}, "CS", "Label Style Selection"},
+    {{0x2200,0x0004}, "LT", "Media Disposition"},
+    {{0x2200,0x0005}, "LT", "Barcode Value"},
+    {{0x2200,0x0006}, "CS", "Barcode Symbology"},
+    {{0x2200,0x0007}, "CS", "Allow Media Splitting"},
+    {{0x2200,0x0008}, "CS", "Include Non-DICOM Objects"},
+    {{0x2200,0x0009}, "CS", "Include Display Application"},
+    {{0x2200,0x000A}, "CS", "Preserve Composite Instances After Media Creation"},
+    {{0x2200,0x000B}, "US", "Total Number of Pieces of Media Created"},
+    {{0x2200,0x000C}, "LO", "Requested Media Application Profile"},
+    {{0x2200,0x000D}, "SQ", "Referenced Storage Media Sequence"},
+    {{0x2200,0x000E}, "AT", "Failure Attributes"},
+    {{0x2200,0x000F}, "CS", "Allow Lossy Compression"},
+    {{0x2200,0x0020}, "CS", "Request Priority"},
+    {{0x3002,0x0002}, "SH", "RT Image Label"},
+    {{0x3002,0x0003}, "LO", "RT Image Name"},
+    {{0x3002,0x0004}, "ST", "RT Image Description"},
+    {{0x3002,0x000A}, "CS", "Reported Values Origin"},
+    {{0x3002,0x000C}, "CS", "RT Image Plane"},
+    {{0x3002,0x000D}, "DS", "X-Ray Image Receptor Translation"},
+    {{0x3002,0x000E}, "DS", "X-Ray Image Receptor Angle"},
+    {{0x3002,0x0010}, "DS", "RT Image Orientation"},
+    {{0x3002,0x0011}, "DS", "Image Plane Pixel Spacing"},
+    {{0x3002,0x0012}, "DS", "RT Image Position"},
+    {{0x3002,0x0020}, "SH", "Radiation Machine Name"},
+    {{0x3002,0x0022}, "DS", "Radiation Machine SAD"},
+    {{0x3002,0x0024}, "DS", "Radiation Machine SSD"},
+    {{0x3002,0x0026}, "DS", "RT Image SID"},
+    {{0x3002,0x0028}, "DS", "Source to Reference Object Distance"},
+    {{0x3002,0x0029}, "IS", "Fraction Number"},
+    {{0x3002,0x0030}, "SQ", "Exposure Sequence"},
+    {{0x3002,0x0032}, "DS", "Meterset Exposure"},
+    {{0x3002,0x0034}, "DS", "Diaphragm Position"},
+    {{0x3002,0x0040}, "SQ", "Fluence Map Sequence"},
+    {{0x3002,0x0041}, "CS", "Fluence Data Source"},
+    {{0x3002,0x0042}, "DS", "Fluence Data Scale"},
+    {{0x3002,0x0050}, "SQ", "Primary Fluence Mode Sequence"},
+    {{0x3002,0x0051}, "CS", "Fluence Mode"},
+    {{0x3002,0x0052}, "SH", "Fluence Mode ID"},
+    {{0x3004,0x0001}, "CS", "DVH Type"},
+    {{0x3004,0x0002}, "CS", "Dose Units"},
+    {{0x3004,0x0004}, "CS", "Dose Type"},
+    {{0x3004,0x0005}, "CS", "Spatial Transform of Dose"},
+    {{0x3004,0x0006}, "LO", "Dose Comment"},
+    {{0x3004,0x0008}, "DS", "Normalization Point"},
+    {{0x3004,0x000A}, "CS", "Dose Summation Type"},
+    {{0x3004,0x000C}, "DS", "Grid Frame Offset Vector"},
+    {{0x3004,0x000E}, "DS", "Dose Grid Scaling"},
+    {{0x3004,0x0010}, "SQ", "RT Dose ROI Sequence"},
+    {{0x3004,0x0012}, "DS", "Dose Value"},
+    {{0x3004,0x0014}, "CS", "Tissue Heterogeneity Correction"},
+    {{0x3004,0x0040}, "DS", "DVH Normalization Point"},
+    {{0x3004,0x0042}, "DS", "DVH Normalization Dose Value"},
+    {{0x3004,0x0050}, "SQ", "DVH Sequence"},
+    {{0x3004,0x0052}, "DS", "DVH Dose Scaling"},
+    {{0x3004,0x0054}, "CS", "DVH Volume Units"},
+    {{0x3004,0x0056}, "IS", "DVH Number of Bins"},
+    {{0x3004,0x0058}, "DS", "DVH Data"},
+    {{0x3004,0x0060}, "SQ", "DVH Referenced ROI Sequence"},
+    {{0x3004,0x0062}, "CS", "DVH ROI Contribution Type"},
+    {{0x3004,0x0070}, "DS", "DVH Minimum Dose"},
+    {{0x3004,0x0072}, "DS", "DVH Maximum Dose"},
+    {{0x3004,0x0074}, "DS", "DVH Mean Dose"},
+    {{0x3006,0x0002}, "SH", "Structure Set Label"},
+    {{0x3006,0x0004}, "LO", "Structure Set Name"},
+    {{0x3006,0x0006}, "ST", "Structure Set Description"},
+    {{0x3006,0x0008}, "DA", "Structure Set Date"},
+    {{0x3006,0x0009}, "TM", "Structure Set Time"},
+    {{0x3006,0x0010}, "SQ", "Referenced Frame of Reference Sequence"},
+    {{0x3006,0x0012}, "SQ", "RT Referenced Study Sequence"},
+    {{0x3006,0x0014}, "SQ", "RT Referenced Series Sequence"},
+    {{0x3006,0x0016}, "SQ", "Contour Image Sequence"},
+    {{0x3006,0x0018}, "SQ", "Predecessor Structure Set Sequence"},
+    {{0x3006,0x0020}, "SQ", "Structure Set ROI Sequence"},
+    {{0x3006,0x0022}, "IS", "ROI Number"},
+    {{0x3006,0x0024}, "UI", "Referenced Frame of Reference UID"},
+    {{0x3006,0x0026}, "LO", "ROI Name"},
+    {{0x3006,0x0028}, "ST", "ROI Description"},
+    {{0x3006,0x002A}, "IS", "ROI Display Color"},
+    {{0x3006,0x002C}, "DS", "ROI Volume"},
+    {{0x3006,0x0030}, "SQ", "RT Related ROI Sequence"},
+    {{0x3006,0x0033}, "CS", "RT ROI Relationship"},
+    {{0x3006,0x0036}, "CS", "ROI Generation Algorithm"},
+    {{0x3006,0x0038}, "LO", "ROI Generation Description"},
+    {{0x3006,0x0039}, "SQ", "ROI Contour Sequence"},
+    {{0x3006,0x0040}, "SQ", "Contour Sequence"},
+    {{0x3006,0x0042}, "CS", "Contour Geometric Type"},
+    {{0x3006,0x0044}, "DS", "Contour Slab Thickness"},
+    {{0x3006,0x0045}, "DS", "Contour Offset Vector"},
+    {{0x3006,0x0046}, "IS", "Number of Contour Points"},
+    {{0x3006,0x0048}, "IS", "Contour Number"},
+    {{0x3006,0x0049}, "IS", "Attached Contours"},
+    {{0x3006,0x0050}, "DS", "Contour Data"},
+    {{0x3006,0x0080}, "SQ", "RT ROI Observations Sequence"},
+    {{0x3006,0x0082}, "IS", "Observation Number"},
+    {{0x3006,0x0084}, "IS", "Referenced ROI Number"},
+    {{0x3006,0x0085}, "SH", "ROI Observation Label"},
+    {{0x3006,0x0086}, "SQ", "RT ROI Identification Code Sequence"},
+    {{0x3006,0x0088}, "ST", "ROI Observation Description"},
+    {{0x3006,0x00A0}, "SQ", "Related RT ROI Observations Sequence"},
+    {{0x3006,0x00A4}, "CS", "RT ROI Interpreted Type"},
+    {{0x3006,0x00A6}, "PN", "ROI Interpreter"},
+    {{0x3006,0x00B0}, "SQ", "ROI Physical Properties Sequence"},
+    {{0x3006,0x00B2}, "CS", "ROI Physical Property"},
+    {{0x3006,0x00B4}, "DS", "ROI Physical Property Value"},
+    {{0x3006,0x00B6}, "SQ", "ROI Elemental Composition Sequence"},
+    {{0x3006,0x00B7}, "US", "ROI Elemental Composition Atomic Number"},
+    {{0x3006,0x00B8}, "FL", "ROI Elemental Composition Atomic Mass Fraction"},
+    {{0x3006,0x00B9}, "SQ", "Additional RT ROI Identification Code Sequence"},
+    {{0x3006,0x00C0}, "SQ", "Frame of Reference Relationship Sequence"},
+    {{0x3006,0x00C2}, "UI", "Related Frame of Reference UID"},
+    {{0x3006,0x00C4}, "CS", "Frame of Reference Transformation Type"},
+    {{0x3006,0x00C6}, "DS", "Frame of Reference Transformation Matrix"},
+    {{0x3006,0x00C8}, "LO", "Frame of Reference Transformation Comment"},
+    {{0x3008,0x0010}, "SQ", "Measured Dose Reference Sequence"},
+    {{0x3008,0x0012}, "ST", "Measured Dose Description"},
+    {{0x3008,0x0014}, "CS", "Measured Dose Type"},
+    {{0x3008,0x0016}, "DS", "Measured Dose Value"},
+    {{0x3008,0x0020}, "SQ", "Treatment Session Beam Sequence"},
+    {{0x3008,0x0021}, "SQ", "Treatment Session Ion Beam Sequence"},
+    {{0x3008,0x0022}, "IS", "Current Fraction Number"},
+    {{0x3008,0x0024}, "DA", "Treatment Control Point Date"},
+    {{0x3008,0x0025}, "TM", "Treatment Control Point Time"},
+    {{0x3008,0x002A}, "CS", "Treatment Termination Status"},
+    {{0x3008,0x002B}, "SH", "Treatment Termination Code"},
+    {{0x3008,0x002C}, "CS", "Treatment Verification Status"},
+    {{0x3008,0x0030}, "SQ", "Referenced Treatment Record Sequence"},
+    {{0x3008,0x0032}, "DS", "Specified Primary Meterset"},
+    {{0x3008,0x0033}, "DS", "Specified Secondary Meterset"},
+    {{0x3008,0x0036}, "DS", "Delivered Primary Meterset"},
+    {{0x3008,0x0037}, "DS", "Delivered Secondary Meterset"},
+    {{0x3008,0x003A}, "DS", "Specified Treatment Time"},
+    {{0x3008,0x003B}, "DS", "Delivered Treatment Time"},
+    {{0x3008,0x0040}, "SQ", "Control Point Delivery Sequence"},
+    {{0x3008,0x0041}, "SQ", "Ion Control Point Delivery Sequence"},
+    {{0x3008,0x0042}, "DS", "Specified Meterset"},
+    {{0x3008,0x0044}, "DS", "Delivered Meterset"},
+    {{0x3008,0x0045}, "FL", "Meterset Rate Set"},
+    {{0x3008,0x0046}, "FL", "Meterset Rate Delivered"},
+    {{0x3008,0x0047}, "FL", "Scan Spot Metersets Delivered"},
+    {{0x3008,0x0048}, "DS", "Dose Rate Delivered"},
+    {{0x3008,0x0050}, "SQ", "Treatment Summary Calculated Dose Reference Sequence"},
+    {{0x3008,0x0052}, "DS", "Cumulative Dose to Dose Reference"},
+    {{0x3008,0x0054}, "DA", "First Treatment Date"},
+    {{0x3008,0x0056}, "DA", "Most Recent Treatment Date"},
+    {{0x3008,0x005A}, "IS", "Number of Fractions Delivered"},
+    {{0x3008,0x0060}, "SQ", "Override Sequence"},
+    {{0x3008,0x0061}, "AT", "Parameter Sequence Pointer"},
+    {{0x3008,0x0062}, "AT", "Override Parameter Pointer"},
+    {{0x3008,0x0063}, "IS", "Parameter Item Index"},
+    {{0x3008,0x0064}, "IS", "Measured Dose Reference Number"},
+    {{0x3008,0x0065}, "AT", "Parameter Pointer"},
+    {{0x3008,0x0066}, "ST", "Override Reason"},
+    {{0x3008,0x0068}, "SQ", "Corrected Parameter Sequence"},
+    {{0x3008,0x006A}, "FL", "Correction Value"},
+    {{0x3008,0x0070}, "SQ", "Calculated Dose Reference Sequence"},
+    {{0x3008,0x0072}, "IS", "Calculated Dose Reference Number"},
+    {{0x3008,0x0074}, "ST", "Calculated Dose Reference Description"},
+    {{0x3008,0x0076}, "DS", "Calculated Dose Reference Dose Value"},
+    {{0x3008,0x0078}, "DS", "Start Meterset"},
+    {{0x3008,0x007A}, "DS", "End Meterset"},
+    {{0x3008,0x0080}, "SQ", "Referenced Measured Dose Reference Sequence"},
+    {{0x3008,0x0082}, "IS", "Referenced Measured Dose Reference Number"},
+    {{0x3008,0x0090}, "SQ", "Referenced Calculated Dose Reference Sequence"},
+    {{0x3008,0x0092}, "IS", "Referenced Calculated Dose Reference Number"},
+    {{0x3008,0x00A0}, "SQ", "Beam Limiting Device Leaf Pairs Sequence"},
+    {{0x3008,0x00B0}, "SQ", "Recorded Wedge Sequence"},
+    {{0x3008,0x00C0}, "SQ", "Recorded Compensator Sequence"},
+    {{0x3008,0x00D0}, "SQ", "Recorded Block Sequence"},
+    {{0x3008,0x00E0}, "SQ", "Treatment Summary Measured Dose Reference Sequence"},
+    {{0x3008,0x00F0}, "SQ", "Recorded Snout Sequence"},
+    {{0x3008,0x00F2}, "SQ", "Recorded Range Shifter Sequence"},
+    {{0x3008,0x00F4}, "SQ", "Recorded Lateral Spreading Device Sequence"},
+    {{0x3008,0x00F6}, "SQ", "Recorded Range Modulator Sequence"},
+    {{0x3008,0x0100}, "SQ", "Recorded Source Sequence"},
+    {{0x3008,0x0105}, "LO", "Source Serial Number"},
+    {{0x3008,0x0110}, "SQ", "Treatment Session Application Setup Sequence"},
+    {{0x3008,0x0116}, "CS", "Application Setup Check"},
+    {{0x3008,0x0120}, "SQ", "Recorded Brachy Accessory Device Sequence"},
+    {{0x3008,0x0122}, "IS", "Referenced Brachy Accessory Device Number"},
+    {{0x3008,0x0130}, "SQ", "Recorded Channel Sequence"},
+    {{0x3008,0x0132}, "DS", "Specified Channel Total Time"},
+    {{0x3008,0x0134}, "DS", "Delivered Channel Total Time"},
+    {{0x3008,0x0136}, "IS", "Specified Number of Pulses"},
+    {{0x3008,0x0138}, "IS", "Delivered Number of Pulses"},
+    {{0x3008,0x013A}, "DS", "Specified Pulse Repetition Interval"},
+    {{0x3008,0x013C}, "DS", "Delivered Pulse Repetition Interval"},
+    {{0x3008,0x0140}, "SQ", "Recorded Source Applicator Sequence"},
+    {{0x3008,0x0142}, "IS", "Referenced Source Applicator Number"},
+    {{0x3008,0x0150}, "SQ", "Recorded Channel Shield Sequence"},
+    {{0x3008,0x0152}, "IS", "Referenced Channel Shield Number"},
+    {{0x3008,0x0160}, "SQ", "Brachy Control Point Delivered Sequence"},
+    {{0x3008,0x0162}, "DA", "Safe Position Exit Date"},
+    {{0x3008,0x0164}, "TM", "Safe Position Exit Time"},
+    {{0x3008,0x0166}, "DA", "Safe Position Return Date"},
+    {{0x3008,0x0168}, "TM", "Safe Position Return Time"},
+    {{0x3008,0x0171}, "SQ", "Pulse Specific Brachy Control Point Delivered Sequence"},
+    {{0x3008,0x0172}, "US", "Pulse Number"},
+    {{0x3008,0x0173}, "SQ", "Brachy Pulse Control Point Delivered Sequence"},
+    {{0x3008,0x0200}, "CS", "Current Treatment Status"},
+    {{0x3008,0x0202}, "ST", "Treatment Status Comment"},
+    {{0x3008,0x0220}, "SQ", "Fraction Group Summary Sequence"},
+    {{0x3008,0x0223}, "IS", "Referenced Fraction Number"},
+    {{0x3008,0x0224}, "CS", "Fraction Group Type"},
+    {{0x3008,0x0230}, "CS", "Beam Stopper Position"},
+    {{0x3008,0x0240}, "SQ", "Fraction Status Summary Sequence"},
+    {{0x3008,0x0250}, "DA", "Treatment Date"},
+    {{0x3008,0x0251}, "TM", "Treatment Time"},
+    {{0x300A,0x0002}, "SH", "RT Plan Label"},
+    {{0x300A,0x0003}, "LO", "RT Plan Name"},
+    {{0x300A,0x0004}, "ST", "RT Plan Description"},
+    {{0x300A,0x0006}, "DA", "RT Plan Date"},
+    {{0x300A,0x0007}, "TM", "RT Plan Time"},
+    {{0x300A,0x0009}, "LO", "Treatment Protocols"},
+    {{0x300A,0x000A}, "CS", "Plan Intent"},
+    {{0x300A,0x000B}, "LO", "Treatment Sites"},
+    {{0x300A,0x000C}, "CS", "RT Plan Geometry"},
+    {{0x300A,0x000E}, "ST", "Prescription Description"},
+    {{0x300A,0x0010}, "SQ", "Dose Reference Sequence"},
+    {{0x300A,0x0012}, "IS", "Dose Reference Number"},
+    {{0x300A,0x0013}, "UI", "Dose Reference UID"},
+    {{0x300A,0x0014}, "CS", "Dose Reference Structure Type"},
+    {{0x300A,0x0015}, "CS", "Nominal Beam Energy Unit"},
+    {{0x300A,0x0016}, "LO", "Dose Reference Description"},
+    {{0x300A,0x0018}, "DS", "Dose Reference Point Coordinates"},
+    {{0x300A,0x001A}, "DS", "Nominal Prior Dose"},
+    {{0x300A,0x0020}, "CS", "Dose Reference Type"},
+    {{0x300A,0x0021}, "DS", "Constraint Weight"},
+    {{0x300A,0x0022}, "DS", "Delivery Warning Dose"},
+    {{0x300A,0x0023}, "DS", "Delivery Maximum Dose"},
+    {{0x300A,0x0025}, "DS", "Target Minimum Dose"},
+    {{0x300A,0x0026}, "DS", "Target Prescription Dose"},
+    {{0x300A,0x0027}, "DS", "Target Maximum Dose"},
+    {{0x300A,0x0028}, "DS", "Target Underdose Volume Fraction"},
+    {{0x300A,0x002A}, "DS", "Organ at Risk Full-volume Dose"},
+    {{0x300A,0x002B}, "DS", "Organ at Risk Limit Dose"},
+    {{0x300A,0x002C}, "DS", "Organ at Risk Maximum Dose"},
+    {{0x300A,0x002D}, "DS", "Organ at Risk Overdose Volume Fraction"},
+    {{0x300A,0x0040}, "SQ", "Tolerance Table Sequence"},
+    {{0x300A,0x0042}, "IS", "Tolerance Table Number"},
+    {{0x300A,0x0043}, "SH", "Tolerance Table Label"},
+    {{0x300A,0x0044}, "DS", "Gantry Angle Tolerance"},
+    {{0x300A,0x0046}, "DS", "Beam Limiting Device Angle Tolerance"},
+    {{0x300A,0x0048}, "SQ", "Beam Limiting Device Tolerance Sequence"},
+    {{0x300A,0x004A}, "DS", "Beam Limiting Device Position Tolerance"},
+    {{0x300A,0x004B}, "FL", "Snout Position Tolerance"},
+    {{0x300A,0x004C}, "DS", "Patient Support Angle Tolerance"},
+    {{0x300A,0x004E}, "DS", "Table Top Eccentric Angle Tolerance"},
+    {{0x300A,0x004F}, "FL", "Table Top Pitch Angle Tolerance"},
+    {{0x300A,0x0050}, "FL", "Table Top Roll Angle Tolerance"},
+    {{0x300A,0x0051}, "DS", "Table Top Vertical Position Tolerance"},
+    {{0x300A,0x0052}, "DS", "Table Top Longitudinal Position Tolerance"},
+    {{0x300A,0x0053}, "DS", "Table Top Lateral Position Tolerance"},
+    {{0x300A,0x0055}, "CS", "RT Plan Relationship"},
+    {{0x300A,0x0070}, "SQ", "Fraction Group Sequence"},
+    {{0x300A,0x0071}, "IS", "Fraction Group Number"},
+    {{0x300A,0x0072}, "LO", "Fraction Group Description"},
+    {{0x300A,0x0078}, "IS", "Number of Fractions Planned"},
+    {{0x300A,0x0079}, "IS", "Number of Fraction Pattern Digits Per Day"},
+    {{0x300A,0x007A}, "IS", "Repeat Fraction Cycle Length"},
+    {{0x300A,0x007B}, "LT", "Fraction Pattern"},
+    {{0x300A,0x0080}, "IS", "Number of Beams"},
+    {{0x300A,0x0082}, "DS", "Beam Dose Specification Point"},
+    {{0x300A,0x0084}, "DS", "Beam Dose"},
+    {{0x300A,0x0086}, "DS", "Beam Meterset"},
+    {{0x300A,0x0088}, "FL", "Beam Dose Point Depth"},
+    {{0x300A,0x0089}, "FL", "Beam Dose Point Equivalent Depth"},
+    {{0x300A,0x008A}, "FL", "Beam Dose Point SSD"},
+    {{0x300A,0x008B}, "CS", "Beam Dose Meaning"},
+    {{0x300A,0x008C}, "SQ", "Beam Dose Verification Control Point Sequence"},
+    {{0x300A,0x008D}, "FL", "Average Beam Dose Point Depth"},
+    {{0x300A,0x008E}, "FL", "Average Beam Dose Point Equivalent Depth"},
+    {{0x300A,0x008F}, "FL", "Average Beam Dose Point SSD"},
+    {{0x300A,0x0090}, "CS", "Beam Dose Type"},
+    {{0x300A,0x0091}, "DS", "Alternate Beam Dose"},
+    {{0x300A,0x0092}, "CS", "Alternate Beam Dose Type"},
+    {{0x300A,0x00A0}, "IS", "Number of Brachy Application Setups"},
+    {{0x300A,0x00A2}, "DS", "Brachy Application Setup Dose Specification Point"},
+    {{0x300A,0x00A4}, "DS", "Brachy Application Setup Dose"},
+    {{0x300A,0x00B0}, "SQ", "Beam Sequence"},
+    {{0x300A,0x00B2}, "SH", "Treatment Machine Name"},
+    {{0x300A,0x00B3}, "CS", "Primary Dosimeter Unit"},
+    {{0x300A,0x00B4}, "DS", "Source-Axis Distance"},
+    {{0x300A,0x00B6}, "SQ", "Beam Limiting Device Sequence"},
+    {{0x300A,0x00B8}, "CS", "RT Beam Limiting Device Type"},
+    {{0x300A,0x00BA}, "DS", "Source to Beam Limiting Device Distance"},
+    {{0x300A,0x00BB}, "FL", "Isocenter to Beam Limiting Device Distance"},
+    {{0x300A,0x00BC}, "IS", "Number of Leaf/Jaw Pairs"},
+    {{0x300A,0x00BE}, "DS", "Leaf Position Boundaries"},
+    {{0x300A,0x00C0}, "IS", "Beam Number"},
+    {{0x300A,0x00C2}, "LO", "Beam Name"},
+    {{0x300A,0x00C3}, "ST", "Beam Description"},
+    {{0x300A,0x00C4}, "CS", "Beam Type"},
+    {{0x300A,0x00C5}, "FD", "Beam Delivery Duration Limit"},
+    {{0x300A,0x00C6}, "CS", "Radiation Type"},
+    {{0x300A,0x00C7}, "CS", "High-Dose Technique Type"},
+    {{0x300A,0x00C8}, "IS", "Reference Image Number"},
+    {{0x300A,0x00CA}, "SQ", "Planned Verification Image Sequence"},
+    {{0x300A,0x00CC}, "LO", "Imaging Device-Specific Acquisition Parameters"},
+    {{0x300A,0x00CE}, "CS", "Treatment Delivery Type"},
+    {{0x300A,0x00D0}, "IS", "Number of Wedges"},
+    {{0x300A,0x00D1}, "SQ", "Wedge Sequence"},
+    {{0x300A,0x00D2}, "IS", "Wedge Number"},
+    {{0x300A,0x00D3}, "CS", "Wedge Type"},
+    {{0x300A,0x00D4}, "SH", "Wedge ID"},
+    {{0x300A,0x00D5}, "IS", "Wedge Angle"},
+    {{0x300A,0x00D6}, "DS", "Wedge Factor"},
+    {{0x300A,0x00D7}, "FL", "Total Wedge Tray Water-Equivalent Thickness"},
+    {{0x300A,0x00D8}, "DS", "Wedge Orientation"},
+    {{0x300A,0x00D9}, "FL", "Isocenter to Wedge Tray Distance"},
+    {{0x300A,0x00DA}, "DS", "Source to Wedge Tray Distance"},
+    {{0x300A,0x00DB}, "FL", "Wedge Thin Edge Position"},
+    {{0x300A,0x00DC}, "SH", "Bolus ID"},
+    {{0x300A,0x00DD}, "ST", "Bolus Description"},
+    {{0x300A,0x00DE}, "DS", "Effective Wedge Angle"},
+    {{0x300A,0x00E0}, "IS", "Number of Compensators"},
+    {{0x300A,0x00E1}, "SH", "Material ID"},
+    {{0x300A,0x00E2}, "DS", "Total Compensator Tray Factor"},
+    {{0x300A,0x00E3}, "SQ", "Compensator Sequence"},
+    {{0x300A,0x00E4}, "IS", "Compensator Number"},
+    {{0x300A,0x00E5}, "SH", "Compensator ID"},
+    {{0x300A,0x00E6}, "DS", "Source to Compensator Tray Distance"},
+    {{0x300A,0x00E7}, "IS", "Compensator Rows"},
+    {{0x300A,0x00E8}, "IS", "Compensator Columns"},
+    {{0x300A,0x00E9}, "DS", "Compensator Pixel Spacing"},
+    {{0x300A,0x00EA}, "DS", "Compensator Position"},
+    {{0x300A,0x00EB}, "DS", "Compensator Transmission Data"},
+    {{0x300A,0x00EC}, "DS", "Compensator Thickness Data"},
+    {{0x300A,0x00ED}, "IS", "Number of Boli"},
+    {{0x300A,0x00EE}, "CS", "Compensator Type"},
+    {{0x300A,0x00EF}, "SH", "Compensator Tray ID"},
+    {{0x300A,0x00F0}, "IS", "Number of Blocks"},
+    {{0x300A,0x00F2}, "DS", "Total Block Tray Factor"},
+    {{0x300A,0x00F3}, "FL", "Total Block Tray Water-Equivalent Thickness"},
+    {{0x300A,0x00F4}, "SQ", "Block Sequence"},
+    {{0x300A,0x00F5}, "SH", "Block Tray ID"},
+    {{0x300A,0x00F6}, "DS", "Source to Block Tray Distance"},
+    {{0x300A,0x00F7}, "FL", "Isocenter to Block Tray Distance"},
+    {{0x300A,0x00F8}, "CS", "Block Type"},
+    {{0x300A,0x00F9}, "LO", "Accessory Code"},
+    {{0x300A,0x00FA}, "CS", "Block Divergence"},
+    {{0x300A,0x00FB}, "CS", "Block Mounting Position"},
+    {{0x300A,0x00FC}, "IS", "Block Number"},
+    {{0x300A,0x00FE}, "LO", "Block Name"},
+    {{0x300A,0x0100}, "DS", "Block Thickness"},
+    {{0x300A,0x0102}, "DS", "Block Transmission"},
+    {{0x300A,0x0104}, "IS", "Block Number of Points"},
+    {{0x300A,0x0106}, "DS", "Block Data"},
+    {{0x300A,0x0107}, "SQ", "Applicator Sequence"},
+    {{0x300A,0x0108}, "SH", "Applicator ID"},
+    {{0x300A,0x0109}, "CS", "Applicator Type"},
+    {{0x300A,0x010A}, "LO", "Applicator Description"},
+    {{0x300A,0x010C}, "DS", "Cumulative Dose Reference Coefficient"},
+    {{0x300A,0x010E}, "DS", "Final Cumulative Meterset Weight"},
+    {{0x300A,0x0110}, "IS", "Number of Control Points"},
+    {{0x300A,0x0111}, "SQ", "Control Point Sequence"},
+    {{0x300A,0x0112}, "IS", "Control Point Index"},
+    {{0x300A,0x0114}, "DS", "Nominal Beam Energy"},
+    {{0x300A,0x0115}, "DS", "Dose Rate Set"},
+    {{0x300A,0x0116}, "SQ", "Wedge Position Sequence"},
+    {{0x300A,0x0118}, "CS", "Wedge Position"},
+    {{0x300A,0x011A}, "SQ", "Beam Limiting Device Position Sequence"},
+    {{0x300A,0x011C}, "DS", "Leaf/Jaw Positions"},
+    {{0x300A,0x011E}, "DS", "Gantry Angle"},
+    {{0x300A,0x011F}, "CS", "Gantry Rotation Direction"},
+    {{0x300A,0x0120}, "DS", "Beam Limiting Device Angle"},
+    {{0x300A,0x0121}, "CS", "Beam Limiting Device Rotation Direction"},
+    {{0x300A,0x0122}, "DS", "Patient Support Angle"},
+    {{0x300A,0x0123}, "CS", "Patient Support Rotation Direction"},
+    {{0x300A,0x0124}, "DS", "Table Top Eccentric Axis Distance"},
+    {{0x300A,0x0125}, "DS", "Table Top Eccentric Angle"},
+    {{0x300A,0x0126}, "CS", "Table Top Eccentric Rotation Direction"},
+    {{0x300A,0x0128}, "DS", "Table Top Vertical Position"},
+    {{0x300A,0x0129}, "DS", "Table Top Longitudinal Position"},
+    {{0x300A,0x012A}, "DS", "Table Top Lateral Position"},
+    {{0x300A,0x012C}, "DS", "Isocenter Position"},
+    {{0x300A,0x012E}, "DS", "Surface Entry Point"},
+    {{0x300A,0x0130}, "DS", "Source to Surface Distance"},
+    {{0x300A,0x0131}, "FL", "Average Beam Dose Point Source to External Contour Distance"},
+    {{0x300A,0x0132}, "FL", "Source to External Contour Distance"},
+    {{0x300A,0x0133}, "FL", "External Contour Entry Point"},
+    {{0x300A,0x0134}, "DS", "Cumulative Meterset Weight"},
+    {{0x300A,0x0140}, "FL", "Table Top Pitch Angle"},
+    {{0x300A,0x0142}, "CS", "Table Top Pitch Rotation Direction"},
+    {{0x300A,0x0144}, "FL", "Table Top Roll Angle"},
+    {{0x300A,0x0146}, "CS", "Table Top Roll Rotation Direction"},
+    {{0x300A,0x0148}, "FL", "Head Fixation Angle"},
+    {{0x300A,0x014A}, "FL", "Gantry Pitch Angle"},
+    {{0x300A,0x014C}, "CS", "Gantry Pitch Rotation Direction"},
+    {{0x300A,0x014E}, "FL", "Gantry Pitch Angle Tolerance"},
+    {{0x300A,0x0150}, "CS", "Fixation Eye"},
+    {{0x300A,0x0151}, "DS", "Chair Head Frame Position"},
+    {{0x300A,0x0152}, "DS", "Head Fixation Angle Tolerance"},
+    {{0x300A,0x0153}, "DS", "Chair Head Frame Position Tolerance"},
+    {{0x300A,0x0154}, "DS", "Fixation Light Azimuthal Angle Tolerance"},
+    {{0x300A,0x0155}, "DS", "Fixation Light Polar Angle Tolerance"},
+    {{0x300A,0x0180}, "SQ", "Patient Setup Sequence"},
+    {{0x300A,0x0182}, "IS", "Patient Setup Number"},
+    {{0x300A,0x0183}, "LO", "Patient Setup Label"},
+    {{0x300A,0x0184}, "LO", "Patient Additional Position"},
+    {{0x300A,0x0190}, "SQ", "Fixation Device Sequence"},
+    {{0x300A,0x0192}, "CS", "Fixation Device Type"},
+    {{0x300A,0x0194}, "SH", "Fixation Device Label"},
+    {{0x300A,0x0196}, "ST", "Fixation Device Description"},
+    {{0x300A,0x0198}, "SH", "Fixation Device Position"},
+    {{0x300A,0x0199}, "FL", "Fixation Device Pitch Angle"},
+    {{0x300A,0x019A}, "FL", "Fixation Device Roll Angle"},
+    {{0x300A,0x01A0}, "SQ", "Shielding Device Sequence"},
+    {{0x300A,0x01A2}, "CS", "Shielding Device Type"},
+    {{0x300A,0x01A4}, "SH", "Shielding Device Label"},
+    {{0x300A,0x01A6}, "ST", "Shielding Device Description"},
+    {{0x300A,0x01A8}, "SH", "Shielding Device Position"},
+    {{0x300A,0x01B0}, "CS", "Setup Technique"},
+    {{0x300A,0x01B2}, "ST", "Setup Technique Description"},
+    {{0x300A,0x01B4}, "SQ", "Setup Device Sequence"},
+    {{0x300A,0x01B6}, "CS", "Setup Device Type"},
+    {{0x300A,0x01B8}, "SH", "Setup Device Label"},
+    {{0x300A,0x01BA}, "ST", "Setup Device Description"},
+    {{0x300A,0x01BC}, "DS", "Setup Device Parameter"},
+    {{0x300A,0x01D0}, "ST", "Setup Reference Description"},
+    {{0x300A,0x01D2}, "DS", "Table Top Vertical Setup Displacement"},
+    {{0x300A,0x01D4}, "DS", "Table Top Longitudinal Setup Displacement"},
+    {{0x300A,0x01D6}, "DS", "Table Top Lateral Setup Displacement"},
+    {{0x300A,0x0200}, "CS", "Brachy Treatment Technique"},
+    {{0x300A,0x0202}, "CS", "Brachy Treatment Type"},
+    {{0x300A,0x0206}, "SQ", "Treatment Machine Sequence"},
+    {{0x300A,0x0210}, "SQ", "Source Sequence"},
+    {{0x300A,0x0212}, "IS", "Source Number"},
+    {{0x300A,0x0214}, "CS", "Source Type"},
+    {{0x300A,0x0216}, "LO", "Source Manufacturer"},
+    {{0x300A,0x0218}, "DS", "Active Source Diameter"},
+    {{0x300A,0x021A}, "DS", "Active Source Length"},
+    {{0x300A,0x021B}, "SH", "Source Model ID"},
+    {{0x300A,0x021C}, "LO", "Source Description"},
+    {{0x300A,0x0222}, "DS", "Source Encapsulation Nominal Thickness"},
+    {{0x300A,0x0224}, "DS", "Source Encapsulation Nominal Transmission"},
+    {{0x300A,0x0226}, "LO", "Source Isotope Name"},
+    {{0x300A,0x0228}, "DS", "Source Isotope Half Life"},
+    {{0x300A,0x0229}, "CS", "Source Strength Units"},
+    {{0x300A,0x022A}, "DS", "Reference Air Kerma Rate"},
+    {{0x300A,0x022B}, "DS", "Source Strength"},
+    {{0x300A,0x022C}, "DA", "Source Strength Reference Date"},
+    {{0x300A,0x022E}, "TM", "Source Strength Reference Time"},
+    {{0x300A,0x0230}, "SQ", "Application Setup Sequence"},
+    {{0x300A,0x0232}, "CS", "Application Setup Type"},
+    {{0x300A,0x0234}, "IS", "Application Setup Number"},
+    {{0x300A,0x0236}, "LO", "Application Setup Name"},
+    {{0x300A,0x0238}, "LO", "Application Setup Manufacturer"},
+    {{0x300A,0x0240}, "IS", "Template Number"},
+    {{0x300A,0x0242}, "SH", "Template Type"},
+    {{0x300A,0x0244}, "LO", "Template Name"},
+    {{0x300A,0x0250}, "DS", "Total Reference Air Kerma"},
+    {{0x300A,0x0260}, "SQ", "Brachy Accessory Device Sequence"},
+    {{0x300A,0x0262}, "IS", "Brachy Accessory Device Number"},
+    {{0x300A,0x0263}, "SH", "Brachy Accessory Device ID"},
+    {{0x300A,0x0264}, "CS", "Brachy Accessory Device Type"},
+    {{0x300A,0x0266}, "LO", "Brachy Accessory Device Name"},
+    {{0x300A,0x026A}, "DS", "Brachy Accessory Device Nominal Thickness"},
+    {{0x300A,0x026C}, "DS", "Brachy Accessory Device Nominal Transmission"},
+    {{0x300A,0x0280}, "SQ", "Channel Sequence"},
+    {{0x300A,0x0282}, "IS", "Channel Number"},
+    {{0x300A,0x0284}, "DS", "Channel Length"},
+    {{0x300A,0x0286}, "DS", "Channel Total Time"},
+    {{0x300A,0x0288}, "CS", "Source Movement Type"},
+    {{0x300A,0x028A}, "IS", "Number of Pulses"},
+    {{0x300A,0x028C}, "DS", "Pulse Repetition Interval"},
+    {{0x300A,0x0290}, "IS", "Source Applicator Number"},
+    {{0x300A,0x0291}, "SH", "Source Applicator ID"},
+    {{0x300A,0x0292}, "CS", "Source Applicator Type"},
+    {{0x300A,0x0294}, "LO", "Source Applicator Name"},
+    {{0x300A,0x0296}, "DS", "Source Applicator Length"},
+    {{0x300A,0x0298}, "LO", "Source Applicator Manufacturer"},
+    {{0x300A,0x029C}, "DS", "Source Applicator Wall Nominal Thickness"},
+    {{0x300A,0x029E}, "DS", "Source Applicator Wall Nominal Transmission"},
+    {{0x300A,0x02A0}, "DS", "Source Applicator Step Size"},
+    {{0x300A,0x02A2}, "IS", "Transfer Tube Number"},
+    {{0x300A,0x02A4}, "DS", "Transfer Tube Length"},
+    {{0x300A,0x02B0}, "SQ", "Channel Shield Sequence"},
+    {{0x300A,0x02B2}, "IS", "Channel Shield Number"},
+    {{0x300A,0x02B3}, "SH", "Channel Shield ID"},
+    {{0x300A,0x02B4}, "LO", "Channel Shield Name"},
+    {{0x300A,0x02B8}, "DS", "Channel Shield Nominal Thickness"},
+    {{0x300A,0x02BA}, "DS", "Channel Shield Nominal Transmission"},
+    {{0x300A,0x02C8}, "DS", "Final Cumulative Time Weight"},
+    {{0x300A,0x02D0}, "SQ", "Brachy Control Point Sequence"},
+    {{0x300A,0x02D2}, "DS", "Control Point Relative Position"},
+    {{0x300A,0x02D4}, "DS", "Control Point 3D Position"},
+    {{0x300A,0x02D6}, "DS", "Cumulative Time Weight"},
+    {{0x300A,0x02E0}, "CS", "Compensator Divergence"},
+    {{0x300A,0x02E1}, "CS", "Compensator Mounting Position"},
+    {{0x300A,0x02E2}, "DS", "Source to Compensator Distance"},
+    {{0x300A,0x02E3}, "FL", "Total Compensator Tray Water-Equivalent Thickness"},
+    {{0x300A,0x02E4}, "FL", "Isocenter to Compensator Tray Distance"},
+    {{0x300A,0x02E5}, "FL", "Compensator Column Offset"},
+    {{0x300A,0x02E6}, "FL", "Isocenter to Compensator Distances"},
+    {{0x300A,0x02E7}, "FL", "Compensator Relative Stopping Power Ratio"},
+    {{0x300A,0x02E8}, "FL", "Compensator Milling Tool Diameter"},
+    {{0x300A,0x02EA}, "SQ", "Ion Range Compensator Sequence"},
+    {{0x300A,0x02EB}, "LT", "Compensator Description"},
+    {{0x300A,0x0302}, "IS", "Radiation Mass Number"},
+    {{0x300A,0x0304}, "IS", "Radiation Atomic Number"},
+    {{0x300A,0x0306}, "SS", "Radiation Charge State"},
+    {{0x300A,0x0308}, "CS", "Scan Mode"},
+    {{0x300A,0x0309}, "CS", "Modulated Scan Mode Type"},
+    {{0x300A,0x030A}, "FL", "Virtual Source-Axis Distances"},
+    {{0x300A,0x030C}, "SQ", "Snout Sequence"},
+    {{0x300A,0x030D}, "FL", "Snout Position"},
+    {{0x300A,0x030F}, "SH", "Snout ID"},
+    {{0x300A,0x0312}, "IS", "Number of Range Shifters"},
+    {{0x300A,0x0314}, "SQ", "Range Shifter Sequence"},
+    {{0x300A,0x0316}, "IS", "Range Shifter Number"},
+    {{0x300A,0x0318}, "SH", "Range Shifter ID"},
+    {{0x300A,0x0320}, "CS", "Range Shifter Type"},
+    {{0x300A,0x0322}, "LO", "Range Shifter Description"},
+    {{0x300A,0x0330}, "IS", "Number of Lateral Spreading Devices"},
+    {{0x300A,0x0332}, "SQ", "Lateral Spreading Device Sequence"},
+    {{0x300A,0x0334}, "IS", "Lateral Spreading Device Number"},
+    {{0x300A,0x0336}, "SH", "Lateral Spreading Device ID"},
+    {{0x300A,0x0338}, "CS", "Lateral Spreading Device Type"},
+    {{0x300A,0x033A}, "LO", "Lateral Spreading Device Description"},
+    {{0x300A,0x033C}, "FL", "Lateral Spreading Device Water Equivalent Thickness"},
+    {{0x300A,0x0340}, "IS", "Number of Range Modulators"},
+    {{0x300A,0x0342}, "SQ", "Range Modulator Sequence"},
+    {{0x300A,0x0344}, "IS", "Range Modulator Number"},
+    {{0x300A,0x0346}, "SH", "Range Modulator ID"},
+    {{0x300A,0x0348}, "CS", "Range Modulator Type"},
+    {{0x300A,0x034A}, "LO", "Range Modulator Description"},
+    {{0x300A,0x034C}, "SH", "Beam Current Modulation ID"},
+    {{0x300A,0x0350}, "CS", "Patient Support Type"},
+    {{0x300A,0x0352}, "SH", "Patient Support ID"},
+    {{0x300A,0x0354}, "LO", "Patient Support Accessory Code"},
+    {{0x300A,0x0355}, "LO", "Tray Accessory Code"},
+    {{0x300A,0x0356}, "FL", "Fixation Light Azimuthal Angle"},
+    {{0x300A,0x0358}, "FL", "Fixation Light Polar Angle"},
+    {{0x300A,0x035A}, "FL", "Meterset Rate"},
+    {{0x300A,0x0360}, "SQ", "Range Shifter Settings Sequence"},
+    {{0x300A,0x0362}, "LO", "Range Shifter Setting"},
+    {{0x300A,0x0364}, "FL", "Isocenter to Range Shifter Distance"},
+    {{0x300A,0x0366}, "FL", "Range Shifter Water Equivalent Thickness"},
+    {{0x300A,0x0370}, "SQ", "Lateral Spreading Device Settings Sequence"},
+    {{0x300A,0x0372}, "LO", "Lateral Spreading Device Setting"},
+    {{0x300A,0x0374}, "FL", "Isocenter to Lateral Spreading Device Distance"},
+    {{0x300A,0x0380}, "SQ", "Range Modulator Settings Sequence"},
+    {{0x300A,0x0382}, "FL", "Range Modulator Gating Start Value"},
+    {{0x300A,0x0384}, "FL", "Range Modulator Gating Stop Value"},
+    {{0x300A,0x0386}, "FL", "Range Modulator Gating Start Water Equivalent Thickness"},
+    {{0x300A,0x0388}, "FL", "Range Modulator Gating Stop Water Equivalent Thickness"},
+    {{0x300A,0x038A}, "FL", "Isocenter to Range Modulator Distance"},
+    {{0x300A,0x0390}, "SH", "Scan Spot Tune ID"},
+    {{0x300A,0x0391}, "IS", "Scan Spot Prescribed Indices"},
+    {{0x300A,0x0392}, "IS", "Number of Scan Spot Positions"},
+    {{0x300A,0x0393}, "CS", "Scan Spot Reordered"},
+    {{0x300A,0x0394}, "FL", "Scan Spot Position Map"},
+    {{0x300A,0x0395}, "CS", "Scan Spot Reordering Allowed"},
+    {{0x300A,0x0396}, "FL", "Scan Spot Meterset Weights"},
+    {{0x300A,0x0398}, "FL", "Scanning Spot Size"},
+    {{0x300A,0x039A}, "IS", "Number of Paintings"},
+    {{0x300A,0x03A0}, "SQ", "Ion Tolerance Table Sequence"},
+    {{0x300A,0x03A2}, "SQ", "Ion Beam Sequence"},
+    {{0x300A,0x03A4}, "SQ", "Ion Beam Limiting Device Sequence"},
+    {{0x300A,0x03A6}, "SQ", "Ion Block Sequence"},
+    {{0x300A,0x03A8}, "SQ", "Ion Control Point Sequence"},
+    {{0x300A,0x03AA}, "SQ", "Ion Wedge Sequence"},
+    {{0x300A,0x03AC}, "SQ", "Ion Wedge Position Sequence"},
+    {{0x300A,0x0401}, "SQ", "Referenced Setup Image Sequence"},
+    {{0x300A,0x0402}, "ST", "Setup Image Comment"},
+    {{0x300A,0x0410}, "SQ", "Motion Synchronization Sequence"},
+    {{0x300A,0x0412}, "FL", "Control Point Orientation"},
+    {{0x300A,0x0420}, "SQ", "General Accessory Sequence"},
+    {{0x300A,0x0421}, "SH", "General Accessory ID"},
+    {{0x300A,0x0422}, "ST", "General Accessory Description"},
+    {{0x300A,0x0423}, "CS", "General Accessory Type"},
+    {{0x300A,0x0424}, "IS", "General Accessory Number"},
+    {{0x300A,0x0425}, "FL", "Source to General Accessory Distance"},
+    {{0x300A,0x0431}, "SQ", "Applicator Geometry Sequence"},
+    {{0x300A,0x0432}, "CS", "Applicator Aperture Shape"},
+    {{0x300A,0x0433}, "FL", "Applicator Opening"},
+    {{0x300A,0x0434}, "FL", "Applicator Opening X"},
+    {{0x300A,0x0435}, "FL", "Applicator Opening Y"},
+    {{0x300A,0x0436}, "FL", "Source to Applicator Mounting Position Distance"},
+    {{0x300A,0x0440}, "IS", "Number of Block Slab Items"},
+    {{0x300A,0x0441}, "SQ", "Block Slab Sequence"},
+    {{0x300A,0x0442}, "DS", "Block Slab Thickness"},
+    {{0x300A,0x0443}, "US", "Block Slab Number"},
+    {{0x300A,0x0450}, "SQ", "Device Motion Control Sequence"},
+    {{0x300A,0x0451}, "CS", "Device Motion Execution Mode"},
+    {{0x300A,0x0452}, "CS", "Device Motion Observation Mode"},
+    {{0x300A,0x0453}, "SQ", "Device Motion Parameter Code Sequence"},
+    {{0x300A,0x0501}, "FL", "Distal Depth Fraction"},
+    {{0x300A,0x0502}, "FL", "Distal Depth"},
+    {{0x300A,0x0503}, "FL", "Nominal Range Modulation Fractions"},
+    {{0x300A,0x0504}, "FL", "Nominal Range Modulated Region Depths"},
+    {{0x300A,0x0505}, "SQ", "Depth Dose Parameters Sequence"},
+    {{0x300A,0x0506}, "SQ", "Delivered Depth Dose Parameters Sequence"},
+    {{0x300A,0x0507}, "FL", "Delivered Distal Depth Fraction"},
+    {{0x300A,0x0508}, "FL", "Delivered Distal Depth"},
+    {{0x300A,0x0509}, "FL", "Delivered Nominal Range Modulation Fractions"},
+    {{0x300A,0x0510}, "FL", "Delivered Nominal Range Modulated Region Depths"},
+    {{0x300A,0x0511}, "CS", "Delivered Reference Dose Definition"},
+    {{0x300A,0x0512}, "CS", "Reference Dose Definition"},
+    {{0x300C,0x0002}, "SQ", "Referenced RT Plan Sequence"},
+    {{0x300C,0x0004}, "SQ", "Referenced Beam Sequence"},
+    {{0x300C,0x0006}, "IS", "Referenced Beam Number"},
+    {{0x300C,0x0007}, "IS", "Referenced Reference Image Number"},
+    {{0x300C,0x0008}, "DS", "Start Cumulative Meterset Weight"},
+    {{0x300C,0x0009}, "DS", "End Cumulative Meterset Weight"},
+    {{0x300C,0x000A}, "SQ", "Referenced Brachy Application Setup Sequence"},
+    {{0x300C,0x000C}, "IS", "Referenced Brachy Application Setup Number"},
+    {{0x300C,0x000E}, "IS", "Referenced Source Number"},
+    {{0x300C,0x0020}, "SQ", "Referenced Fraction Group Sequence"},
+    {{0x300C,0x0022}, "IS", "Referenced Fraction Group Number"},
+    {{0x300C,0x0040}, "SQ", "Referenced Verification Image Sequence"},
+    {{0x300C,0x0042}, "SQ", "Referenced Reference Image Sequence"},
+    {{0x300C,0x0050}, "SQ", "Referenced Dose Reference Sequence"},
+    {{0x300C,0x0051}, "IS", "Referenced Dose Reference Number"},
+    {{0x300C,0x0055}, "SQ", "Brachy Referenced Dose Reference Sequence"},
+    {{0x300C,0x0060}, "SQ", "Referenced Structure Set Sequence"},
+    {{0x300C,0x006A}, "IS", "Referenced Patient Setup Number"},
+    {{0x300C,0x0080}, "SQ", "Referenced Dose Sequence"},
+    {{0x300C,0x00A0}, "IS", "Referenced Tolerance Table Number"},
+    {{0x300C,0x00B0}, "SQ", "Referenced Bolus Sequence"},
+    {{0x300C,0x00C0}, "IS", "Referenced Wedge Number"},
+    {{0x300C,0x00D0}, "IS", "Referenced Compensator Number"},
+    {{0x300C,0x00E0}, "IS", "Referenced Block Number"},
+    {{0x300C,0x00F0}, "IS", "Referenced Control Point Index"},
+    {{0x300C,0x00F2}, "SQ", "Referenced Control Point Sequence"},
+    {{0x300C,0x00F4}, "IS", "Referenced Start Control Point Index"},
+    {{0x300C,0x00F6}, "IS", "Referenced Stop Control Point Index"},
+    {{0x300C,0x0100}, "IS", "Referenced Range Shifter Number"},
+    {{0x300C,0x0102}, "IS", "Referenced Lateral Spreading Device Number"},
+    {{0x300C,0x0104}, "IS", "Referenced Range Modulator Number"},
+    {{0x300C,0x0111}, "SQ", "Omitted Beam Task Sequence"},
+    {{0x300C,0x0112}, "CS", "Reason for Omission"},
+    {{0x300C,0x0113}, "LO", "Reason for Omission Description"},
+    {{0x300E,0x0002}, "CS", "Approval Status"},
+    {{0x300E,0x0004}, "DA", "Review Date"},
+    {{0x300E,0x0005}, "TM", "Review Time"},
+    {{0x300E,0x0008}, "PN", "Reviewer Name"},
+    {{0x4000,0x0010}, "LT", "Arbitrary"},
+    {{0x4000,0x4000}, "LT", "Text Comments"},
+    {{0x4008,0x0040}, "SH", "Results ID"},
+    {{0x4008,0x0042}, "LO", "Results ID Issuer"},
+    {{0x4008,0x0050}, "SQ", "Referenced Interpretation Sequence"},
+    {{0x4008,0x00FF}, "CS", "Report Production Status (Trial)"},
+    {{0x4008,0x0100}, "DA", "Interpretation Recorded Date"},
+    {{0x4008,0x0101}, "TM", "Interpretation Recorded Time"},
+    {{0x4008,0x0102}, "PN", "Interpretation Recorder"},
+    {{0x4008,0x0103}, "LO", "Reference to Recorded Sound"},
+    {{0x4008,0x0108}, "DA", "Interpretation Transcription Date"},
+    {{0x4008,0x0109}, "TM", "Interpretation Transcription Time"},
+    {{0x4008,0x010A}, "PN", "Interpretation Transcriber"},
+    {{0x4008,0x010B}, "ST", "Interpretation Text"},
+    {{0x4008,0x010C}, "PN", "Interpretation Author"},
+    {{0x4008,0x0111}, "SQ", "Interpretation Approver Sequence"},
+    {{0x4008,0x0112}, "DA", "Interpretation Approval Date"},
+    {{0x4008,0x0113}, "TM", "Interpretation Approval Time"},
+    {{0x4008,0x0114}, "PN", "Physician Approving Interpretation"},
+    {{0x4008,0x0115}, "LT", "Interpretation Diagnosis Description"},
+    {{0x4008,0x0117}, "SQ", "Interpretation Diagnosis Code Sequence"},
+    {{0x4008,0x0118}, "SQ", "Results Distribution List Sequence"},
+    {{0x4008,0x0119}, "PN", "Distribution Name"},
+    {{0x4008,0x011A}, "LO", "Distribution Address"},
+    {{0x4008,0x0200}, "SH", "Interpretation ID"},
+    {{0x4008,0x0202}, "LO", "Interpretation ID Issuer"},
+    {{0x4008,0x0210}, "CS", "Interpretation Type ID"},
+    {{0x4008,0x0212}, "CS", "Interpretation Status ID"},
+    {{0x4008,0x0300}, "ST", "Impressions"},
+    {{0x4008,0x4000}, "ST", "Results Comments"},
+    {{0x4010,0x0001}, "CS", "Low Energy Detectors"},
+    {{0x4010,0x0002}, "CS", "High Energy Detectors"},
+    {{0x4010,0x0004}, "SQ", "Detector Geometry Sequence"},
+    {{0x4010,0x1001}, "SQ", "Threat ROI Voxel Sequence"},
+    {{0x4010,0x1004}, "FL", "Threat ROI Base"},
+    {{0x4010,0x1005}, "FL", "Threat ROI Extents"},
+    {{0x4010,0x1006}, "OB", "Threat ROI Bitmap"},
+    {{0x4010,0x1007}, "SH", "Route Segment ID"},
+    {{0x4010,0x1008}, "CS", "Gantry Type"},
+    {{0x4010,0x1009}, "CS", "OOI Owner Type"},
+    {{0x4010,0x100A}, "SQ", "Route Segment Sequence"},
+    {{0x4010,0x1010}, "US", "Potential Threat Object ID"},
+    {{0x4010,0x1011}, "SQ", "Threat Sequence"},
+    {{0x4010,0x1012}, "CS", "Threat Category"},
+    {{0x4010,0x1013}, "LT", "Threat Category Description"},
+    {{0x4010,0x1014}, "CS", "ATD Ability Assessment"},
+    {{0x4010,0x1015}, "CS", "ATD Assessment Flag"},
+    {{0x4010,0x1016}, "FL", "ATD Assessment Probability"},
+    {{0x4010,0x1017}, "FL", "Mass"},
+    {{0x4010,0x1018}, "FL", "Density"},
+    {{0x4010,0x1019}, "FL", "Z Effective"},
+    {{0x4010,0x101A}, "SH", "Boarding Pass ID"},
+    {{0x4010,0x101B}, "FL", "Center of Mass"},
+    {{0x4010,0x101C}, "FL", "Center of PTO"},
+    {{0x4010,0x101D}, "FL", "Bounding Polygon"},
+    {{0x4010,0x101E}, "SH", "Route Segment Start Location ID"},
+    {{0x4010,0x101F}, "SH", "Route Segment End Location ID"},
+    {{0x4010,0x1020}, "CS", "Route Segment Location ID Type"},
+    {{0x4010,0x1021}, "CS", "Abort Reason"},
+    {{0x4010,0x1023}, "FL", "Volume of PTO"},
+    {{0x4010,0x1024}, "CS", "Abort Flag"},
+    {{0x4010,0x1025}, "DT", "Route Segment Start Time"},
+    {{0x4010,0x1026}, "DT", "Route Segment End Time"},
+    {{0x4010,0x1027}, "CS", "TDR Type"},
+    {{0x4010,0x1028}, "CS", "International Route Segment"},
+    {{0x4010,0x1029}, "LO", "Threat Detection Algorithm and Version"},
+    {{0x4010,0x102A}, "SH", "Assigned Location"},
+    {{0x4010,0x102B}, "DT", "Alarm Decision Time"},
+    {{0x4010,0x1031}, "CS", "Alarm Decision"},
+    {{0x4010,0x1033}, "US", "Number of Total Objects"},
+    {{0x4010,0x1034}, "US", "Number of Alarm Objects"},
+    {{0x4010,0x1037}, "SQ", "PTO Representation Sequence"},
+    {{0x4010,0x1038}, "SQ", "ATD Assessment Sequence"},
+    {{0x4010,0x1039}, "CS", "TIP Type"},
+    {{0x4010,0x103A}, "CS", "Version"},
+    {{0x4010,0x1041}, "DT", "OOI Owner Creation Time"},
+    {{0x4010,0x1042}, "CS", "OOI Type"},
+    {{0x4010,0x1043}, "FL", "OOI Size"},
+    {{0x4010,0x1044}, "CS", "Acquisition Status"},
+    {{0x4010,0x1045}, "SQ", "Basis Materials Code Sequence"},
+    {{0x4010,0x1046}, "CS", "Phantom Type"},
+    {{0x4010,0x1047}, "SQ", "OOI Owner Sequence"},
+    {{0x4010,0x1048}, "CS", "Scan Type"},
+    {{0x4010,0x1051}, "LO", "Itinerary ID"},
+    {{0x4010,0x1052}, "SH", "Itinerary ID Type"},
+    {{0x4010,0x1053}, "LO", "Itinerary ID Assigning Authority"},
+    {{0x4010,0x1054}, "SH", "Route ID"},
+    {{0x4010,0x1055}, "SH", "Route ID Assigning Authority"},
+    {{0x4010,0x1056}, "CS", "Inbound Arrival Type"},
+    {{0x4010,0x1058}, "SH", "Carrier ID"},
+    {{0x4010,0x1059}, "CS", "Carrier ID Assigning Authority"},
+    {{0x4010,0x1060}, "FL", "Source Orientation"},
+    {{0x4010,0x1061}, "FL", "Source Position"},
+    {{0x4010,0x1062}, "FL", "Belt Height"},
+    {{0x4010,0x1064}, "SQ", "Algorithm Routing Code Sequence"},
+    {{0x4010,0x1067}, "CS", "Transport Classification"},
+    {{0x4010,0x1068}, "LT", "OOI Type Descriptor"},
+    {{0x4010,0x1069}, "FL", "Total Processing Time"},
+    {{0x4010,0x106C}, "OB", "Detector Calibration Data"},
+    {{0x4010,0x106D}, "CS", "Additional Screening Performed"},
+    {{0x4010,0x106E}, "CS", "Additional Inspection Selection Criteria"},
+    {{0x4010,0x106F}, "SQ", "Additional Inspection Method Sequence"},
+    {{0x4010,0x1070}, "CS", "AIT Device Type"},
+    {{0x4010,0x1071}, "SQ", "QR Measurements Sequence"},
+    {{0x4010,0x1072}, "SQ", "Target Material Sequence"},
+    {{0x4010,0x1073}, "FD", "SNR Threshold"},
+    {{0x4010,0x1075}, "DS", "Image Scale Representation"},
+    {{0x4010,0x1076}, "SQ", "Referenced PTO Sequence"},
+    {{0x4010,0x1077}, "SQ", "Referenced TDR Instance Sequence"},
+    {{0x4010,0x1078}, "ST", "PTO Location Description"},
+    {{0x4010,0x1079}, "SQ", "Anomaly Locator Indicator Sequence"},
+    {{0x4010,0x107A}, "FL", "Anomaly Locator Indicator"},
+    {{0x4010,0x107B}, "SQ", "PTO Region Sequence"},
+    {{0x4010,0x107C}, "CS", "Inspection Selection Criteria"},
+    {{0x4010,0x107D}, "SQ", "Secondary Inspection Method Sequence"},
+    {{0x4010,0x107E}, "DS", "PRCS to RCS Orientation"},
+    {{0x4FFE,0x0001}, "SQ", "MAC Parameters Sequence"},
+    //{{0x50xx,0x0005}, "US", "Curve Dimensions"},
+    //{{0x50xx,0x0010}, "US", "Number of Points"},
+    //{{0x50xx,0x0020}, "CS", "Type of Data"},
+    //{{0x50xx,0x0022}, "LO", "Curve Description"},
+    //{{0x50xx,0x0030}, "SH", "Axis Units"},
+    //{{0x50xx,0x0040}, "SH", "Axis Labels"},
+    //{{0x50xx,0x0103}, "US", "Data Value Representation"},
+    //{{0x50xx,0x0104}, "US", "Minimum Coordinate Value"},
+    //{{0x50xx,0x0105}, "US", "Maximum Coordinate Value"},
+    //{{0x50xx,0x0106}, "SH", "Curve Range"},
+    //{{0x50xx,0x0110}, "US", "Curve Data Descriptor"},
+    //{{0x50xx,0x0112}, "US", "Coordinate Start Value"},
+    //{{0x50xx,0x0114}, "US", "Coordinate Step Value"},
+    //{{0x50xx,0x1001}, "CS", "Curve Activation Layer"},
+    //{{0x50xx,0x2000}, "US", "Audio Type"},
+    //{{0x50xx,0x2002}, "US", "Audio Sample Format"},
+    //{{0x50xx,0x2004}, "US", "Number of Channels"},
+    //{{0x50xx,0x2006}, "UL", "Number of Samples"},
+    //{{0x50xx,0x2008}, "UL", "Sample Rate"},
+    //{{0x50xx,0x200A}, "UL", "Total Time"},
+    //{{0x50xx,0x200C}, "OB", "Audio Sample Data"},
+    //{{0x50xx,0x200E}, "LT", "Audio Comments"},
+    //{{0x50xx,0x2500}, "LO", "Curve Label"},
+    //{{0x50xx,0x2600}, "SQ", "Curve Referenced Overlay Sequence"},
+    //{{0x50xx,0x2610}, "US", "Curve Referenced Overlay Group"},
+    //{{0x50xx,0x3000}, "OB", "Curve Data"},
+    {{0x5200,0x9229}, "SQ", "Shared Functional Groups Sequence"},
+    {{0x5200,0x9230}, "SQ", "Per-frame Functional Groups Sequence"},
+    {{0x5400,0x0100}, "SQ", "Waveform Sequence"},
+    {{0x5400,0x0110}, "OB", "Channel Minimum Value"},
+    {{0x5400,0x0112}, "OB", "Channel Maximum Value"},
+    {{0x5400,0x1004}, "US", "Waveform Bits Allocated"},
+    {{0x5400,0x1006}, "CS", "Waveform Sample Interpretation"},
+    {{0x5400,0x100A}, "OB", "Waveform Padding Value"},
+    {{0x5400,0x1010}, "OB", "Waveform Data"},
+    {{0x5600,0x0010}, "OF", "First Order Phase Correction Angle"},
+    {{0x5600,0x0020}, "OF", "Spectroscopy Data"},
+    //{{0x60xx,0x0010}, "US", "Overlay Rows"},
+    //{{0x60xx,0x0011}, "US", "Overlay Columns"},
+    //{{0x60xx,0x0012}, "US", "Overlay Planes"},
+    //{{0x60xx,0x0015}, "IS", "Number of Frames in Overlay"},
+    //{{0x60xx,0x0022}, "LO", "Overlay Description"},
+    //{{0x60xx,0x0040}, "CS", "Overlay Type"},
+    //{{0x60xx,0x0045}, "LO", "Overlay Subtype"},
+    //{{0x60xx,0x0050}, "SS", "Overlay Origin"},
+    //{{0x60xx,0x0051}, "US", "Image Frame Origin"},
+    //{{0x60xx,0x0052}, "US", "Overlay Plane Origin"},
+    //{{0x60xx,0x0060}, "CS", "Overlay Compression Code"},
+    //{{0x60xx,0x0061}, "SH", "Overlay Compression Originator"},
+    //{{0x60xx,0x0062}, "SH", "Overlay Compression Label"},
+    //{{0x60xx,0x0063}, "CS", "Overlay Compression Description"},
+    //{{0x60xx,0x0066}, "AT", "Overlay Compression Step Pointers"},
+    //{{0x60xx,0x0068}, "US", "Overlay Repeat Interval"},
+    //{{0x60xx,0x0069}, "US", "Overlay Bits Grouped"},
+    //{{0x60xx,0x0100}, "US", "Overlay Bits Allocated"},
+    //{{0x60xx,0x0102}, "US", "Overlay Bit Position"},
+    //{{0x60xx,0x0110}, "CS", "Overlay Format"},
+    //{{0x60xx,0x0200}, "US", "Overlay Location"},
+    //{{0x60xx,0x0800}, "CS", "Overlay Code Label"},
+    //{{0x60xx,0x0802}, "US", "Overlay Number of Tables"},
+    //{{0x60xx,0x0803}, "AT", "Overlay Code Table Location"},
+    //{{0x60xx,0x0804}, "US", "Overlay Bits For Code Word"},
+    //{{0x60xx,0x1001}, "CS", "Overlay Activation Layer"},
+    //{{0x60xx,0x1100}, "US", "Overlay Descriptor - Gray"},
+    //{{0x60xx,0x1101}, "US", "Overlay Descriptor - Red"},
+    //{{0x60xx,0x1102}, "US", "Overlay Descriptor - Green"},
+    //{{0x60xx,0x1103}, "US", "Overlay Descriptor - Blue"},
+    //{{0x60xx,0x1200}, "US", "Overlays - Gray"},
+    //{{0x60xx,0x1201}, "US", "Overlays - Red"},
+    //{{0x60xx,0x1202}, "US", "Overlays - Green"},
+    //{{0x60xx,0x1203}, "US", "Overlays - Blue"},
+    //{{0x60xx,0x1301}, "IS", "ROI Area"},
+    //{{0x60xx,0x1302}, "DS", "ROI Mean"},
+    //{{0x60xx,0x1303}, "DS", "ROI Standard Deviation"},
+    //{{0x60xx,0x1500}, "LO", "Overlay Label"},
+    //{{0x60xx,0x3000}, "OB", "Overlay Data"},
+    //{{0x60xx,0x4000}, "LT", "Overlay Comments"},
+    {{0x7FE0,0x0008}, "OF", "Float Pixel Data"},
+    {{0x7FE0,0x0009}, "OD", "Double Float Pixel Data"},
+    {{0x7FE0,0x0010}, "OB", "Pixel Data"},
+    {{0x7FE0,0x0020}, "OW", "Coefficients SDVN"},
+    {{0x7FE0,0x0030}, "OW", "Coefficients SDHN"},
+    {{0x7FE0,0x0040}, "OW", "Coefficients SDDN"},
+    //{{0x7Fxx,0x0010}, "OB", "Variable Pixel Data"},
+    //{{0x7Fxx,0x0011}, "US", "Variable Next Data Group"},
+    //{{0x7Fxx,0x0020}, "OW", "Variable Coefficients SDVN"},
+    //{{0x7Fxx,0x0030}, "OW", "Variable Coefficients SDHN"},
+    //{{0x7Fxx,0x0040}, "OW", "Variable Coefficients SDDN"},
+    {{0xFFFA,0xFFFA}, "SQ", "Digital Signatures Sequence"},
+    {{0xFFFC,0xFFFC}, "OB", "Data Set Trailing Padding"},
+    {{0xFFFE,0xE000}, "", "Item"},
+    {{0xFFFE,0xE00D}, "", "Item Delimitation Item"},
+    {{0xFFFE,0xE0DD}, "", "Sequence Delimitation Item"}
+};
+
+static constexpr int dictionarySize = sizeof(dictionary)/sizeof(Reference);
 
+// binSearch depends on the table being in order, so check it at compile time
+static constexpr bool dictionarySorted() {
+	for (int i = 1; i < dictionarySize; i++)
+		if (dictionary[i].tag[0] < dictionary[i-1].tag[0] ||
+			(dictionary[i].tag[0] == dictionary[i-1].tag[0] &&
+			 dictionary[i].tag[1] <= dictionary[i-1].tag[1]))
+			return false;
+	return true;
+}
+static_assert(dictionarySorted(), "DICOM dictionary must be sorted by tag");
+
+database::database() {
     validVR << "AE" << "AS" << "AT" << "CS" << "DA" << "DS" << "DT" << "FL"
             << "FD" << "IS" << "LO" << "LT" << "OB" << "OF" << "OW" << "PN"
             << "SH" << "SL" << "SQ" << "SS" << "ST" << "TM" << "UI" << "UL"
             << "UN" << "US" << "UT";
     implicitVR << "OB" << "OW" << "OF" << "SQ" << "UT" << "UN";
-
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0000;
-    x->title="File Meta Information Group Length";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0001;
-    x->title="File Meta Information Version";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0002;
-    x->title="Media Storage SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0003;
-    x->title="Media Storage SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0010;
-    x->title="Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0012;
-    x->title="Implementation Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0013;
-    x->title="Implementation Version Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0016;
-    x->title="Source Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0017;
-    x->title="Sending Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0018;
-    x->title="Receiving Application Entity Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0100;
-    x->title="Private Information Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0002;
-    x->tag[1]=0x0102;
-    x->title="Private Information";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1130;
-    x->title="File-set ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1141;
-    x->title="File-set Descriptor File ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1142;
-    x->title="Specific Character Set of File-set Descriptor File";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1200;
-    x->title="Offset of the First Directory Record of the Root Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1202;
-    x->title="Offset of the Last Directory Record of the Root Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1212;
-    x->title="File-set Consistency Flag";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1220;
-    x->title="Directory Record Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1400;
-    x->title="Offset of the Next Directory Record";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1410;
-    x->title="Record In-use Flag";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1420;
-    x->title="Offset of Referenced Lower-Level Directory Entity";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1430;
-    x->title="Directory Record Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1432;
-    x->title="Private Record UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1500;
-    x->title="Referenced File ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1504;
-    x->title="MRDR Directory Record Offset";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1510;
-    x->title="Referenced SOP Class UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1511;
-    x->title="Referenced SOP Instance UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1512;
-    x->title="Referenced Transfer Syntax UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x151A;
-    x->title="Referenced Related General SOP Class UID in File";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0004;
-    x->tag[1]=0x1600;
-    x->title="Number of References";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0001;
-    x->title="Length to End";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0005;
-    x->title="Specific Character Set";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0006;
-    x->title="Language Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0008;
-    x->title="Image Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0010;
-    x->title="Recognition Code";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0012;
-    x->title="Instance Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0013;
-    x->title="Instance Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0014;
-    x->title="Instance Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0015;
-    x->title="Instance Coercion DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0016;
-    x->title="SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0018;
-    x->title="SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x001A;
-    x->title="Related General SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x001B;
-    x->title="Original Specialized SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0020;
-    x->title="Study Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0021;
-    x->title="Series Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0022;
-    x->title="Acquisition Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0023;
-    x->title="Content Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0024;
-    x->title="Overlay Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0025;
-    x->title="Curve Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x002A;
-    x->title="Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0030;
-    x->title="Study Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0031;
-    x->title="Series Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0032;
-    x->title="Acquisition Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0033;
-    x->title="Content Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0034;
-    x->title="Overlay Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0035;
-    x->title="Curve Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0040;
-    x->title="Data Set Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0041;
-    x->title="Data Set Subtype";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0042;
-    x->title="Nuclear Medicine Series Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0050;
-    x->title="Accession Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0051;
-    x->title="Issuer of Accession Number Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0052;
-    x->title="Query/Retrieve Level";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0053;
-    x->title="Query/Retrieve View";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0054;
-    x->title="Retrieve AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0055;
-    x->title="Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0056;
-    x->title="Instance Availability";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0058;
-    x->title="Failed SOP Instance UID List";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0060;
-    x->title="Modality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0061;
-    x->title="Modalities in Study";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0062;
-    x->title="SOP Classes in Study";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0064;
-    x->title="Conversion Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0068;
-    x->title="Presentation Intent Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0070;
-    x->title="Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0080;
-    x->title="Institution Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0081;
-    x->title="Institution Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0082;
-    x->title="Institution Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0090;
-    x->title="Referring Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0092;
-    x->title="Referring Physician's Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0094;
-    x->title="Referring Physician's Telephone Numbers";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0096;
-    x->title="Referring Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x009C;
-    x->title="Consulting Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x009D;
-    x->title="Consulting Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0100;
-    x->title="Code Value";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0101;
-    x->title="Extended Code Value";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0102;
-    x->title="Coding Scheme Designator";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0103;
-    x->title="Coding Scheme Version";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0104;
-    x->title="Code Meaning";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0105;
-    x->title="Mapping Resource";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0106;
-    x->title="Context Group Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0107;
-    x->title="Context Group Local Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0108;
-    x->title="Extended Code Meaning";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010B;
-    x->title="Context Group Extension Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010C;
-    x->title="Coding Scheme UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010D;
-    x->title="Context Group Extension Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x010F;
-    x->title="Context Identifier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0110;
-    x->title="Coding Scheme Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0112;
-    x->title="Coding Scheme Registry";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0114;
-    x->title="Coding Scheme External ID";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0115;
-    x->title="Coding Scheme Name";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0116;
-    x->title="Coding Scheme Responsible Organization";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0117;
-    x->title="Context UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0118;
-    x->title="Mapping Resource UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0119;
-    x->title="Long Code Value";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0120;
-    x->title="URN Code Value";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0121;
-    x->title="Equivalent Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0122;
-    x->title="Mapping Resource Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0123;
-    x->title="Context Group Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0124;
-    x->title="Mapping Resource Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0201;
-    x->title="Timezone Offset From UTC";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0300;
-    x->title="Private Data Element Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0301;
-    x->title="Private Group Reference";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0302;
-    x->title="Private Creator Reference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0303;
-    x->title="Block Identifying Information Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0304;
-    x->title="Nonidentifying Private Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0306;
-    x->title="Identifying Private Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0305;
-    x->title="Deidentification Action Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x0307;
-    x->title="Deidentification Action";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1000;
-    x->title="Network ID";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1010;
-    x->title="Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1030;
-    x->title="Study Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1032;
-    x->title="Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x103E;
-    x->title="Series Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x103F;
-    x->title="Series Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1040;
-    x->title="Institutional Department Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1048;
-    x->title="Physician(s) of Record";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1049;
-    x->title="Physician(s) of Record Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1050;
-    x->title="Performing Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1052;
-    x->title="Performing Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1060;
-    x->title="Name of Physician(s) Reading Study";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1062;
-    x->title="Physician(s) Reading Study Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1070;
-    x->title="Operators' Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1072;
-    x->title="Operator Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1080;
-    x->title="Admitting Diagnoses Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1084;
-    x->title="Admitting Diagnoses Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1090;
-    x->title="Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1100;
-    x->title="Referenced Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1110;
-    x->title="Referenced Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1111;
-    x->title="Referenced Performed Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1115;
-    x->title="Referenced Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1120;
-    x->title="Referenced Patient Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1125;
-    x->title="Referenced Visit Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1130;
-    x->title="Referenced Overlay Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1134;
-    x->title="Referenced Stereometric Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x113A;
-    x->title="Referenced Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1140;
-    x->title="Referenced Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1145;
-    x->title="Referenced Curve Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x114A;
-    x->title="Referenced Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x114B;
-    x->title="Referenced Real World Value Mapping Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1150;
-    x->title="Referenced SOP Class UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1155;
-    x->title="Referenced SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x115A;
-    x->title="SOP Classes Supported";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1160;
-    x->title="Referenced Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1161;
-    x->title="Simple Frame List";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1162;
-    x->title="Calculated Frame List";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1163;
-    x->title="Time Range";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1164;
-    x->title="Frame Extraction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1167;
-    x->title="Multi-frame Source SOP Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1190;
-    x->title="Retrieve URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1195;
-    x->title="Transaction UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1196;
-    x->title="Warning Reason";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1197;
-    x->title="Failure Reason";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1198;
-    x->title="Failed SOP Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1199;
-    x->title="Referenced SOP Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x119A;
-    x->title="Other Failures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1200;
-    x->title="Studies Containing Other Referenced Instances Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x1250;
-    x->title="Related Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2110;
-    x->title="Lossy Image Compression (Retired)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2111;
-    x->title="Derivation Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2112;
-    x->title="Source Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2120;
-    x->title="Stage Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2122;
-    x->title="Stage Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2124;
-    x->title="Number of Stages";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2127;
-    x->title="View Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2128;
-    x->title="View Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2129;
-    x->title="Number of Event Timers";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x212A;
-    x->title="Number of Views in Stage";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2130;
-    x->title="Event Elapsed Time(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2132;
-    x->title="Event Timer Name(s)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2133;
-    x->title="Event Timer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2134;
-    x->title="Event Time Offset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2135;
-    x->title="Event Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2142;
-    x->title="Start Trim";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2143;
-    x->title="Stop Trim";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2144;
-    x->title="Recommended Display Frame Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2200;
-    x->title="Transducer Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2204;
-    x->title="Transducer Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2208;
-    x->title="Anatomic Structure";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2218;
-    x->title="Anatomic Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2220;
-    x->title="Anatomic Region Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2228;
-    x->title="Primary Anatomic Structure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2229;
-    x->title="Anatomic Structure, Space or Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2230;
-    x->title="Primary Anatomic Structure Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2240;
-    x->title="Transducer Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2242;
-    x->title="Transducer Position Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2244;
-    x->title="Transducer Orientation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2246;
-    x->title="Transducer Orientation Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2251;
-    x->title="Anatomic Structure Space Or Region Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2253;
-    x->title="Anatomic Portal Of Entrance Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2255;
-    x->title="Anatomic Approach Direction Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2256;
-    x->title="Anatomic Perspective Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2257;
-    x->title="Anatomic Perspective Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2258;
-    x->title="Anatomic Location Of Examining Instrument Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x2259;
-    x->title="Anatomic Location Of Examining Instrument Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x225A;
-    x->title="Anatomic Structure Space Or Region Modifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x225C;
-    x->title="On Axis Background Anatomic Structure Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3001;
-    x->title="Alternate Representation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3010;
-    x->title="Irradiation Event UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3011;
-    x->title="Source Irradiation Event Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x3012;
-    x->title="Radiopharmaceutical Administration Event UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x4000;
-    x->title="Identifying Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9007;
-    x->title="Frame Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9092;
-    x->title="Referenced Image Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9121;
-    x->title="Referenced Raw Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9123;
-    x->title="Creator-Version UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9124;
-    x->title="Derivation Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9154;
-    x->title="Source Image Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9205;
-    x->title="Pixel Presentation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9206;
-    x->title="Volumetric Properties";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9207;
-    x->title="Volume Based Calculation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9208;
-    x->title="Complex Image Component";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9209;
-    x->title="Acquisition Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9215;
-    x->title="Derivation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9237;
-    x->title="Referenced Presentation State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9410;
-    x->title="Referenced Other Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9458;
-    x->title="Frame Display Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9459;
-    x->title="Recommended Display Frame Rate in Float";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0008;
-    x->tag[1]=0x9460;
-    x->title="Skip Frame Range Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0010;
-    x->title="Patient's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0020;
-    x->title="Patient ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0021;
-    x->title="Issuer of Patient ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0022;
-    x->title="Type of Patient ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0024;
-    x->title="Issuer of Patient ID Qualifiers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0026;
-    x->title="Source Patient Group Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0027;
-    x->title="Group of Patients Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0028;
-    x->title="Subject Relative Position in Image";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0030;
-    x->title="Patient's Birth Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0032;
-    x->title="Patient's Birth Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0033;
-    x->title="Patient's Birth Date in Alternative Calendar";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0034;
-    x->title="Patient's Death Date in Alternative Calendar";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0035;
-    x->title="Patient's Alternative Calendar";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0040;
-    x->title="Patient's Sex";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0050;
-    x->title="Patient's Insurance Plan Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0101;
-    x->title="Patient's Primary Language Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0102;
-    x->title="Patient's Primary Language Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0200;
-    x->title="Quality Control Subject";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0201;
-    x->title="Quality Control Subject Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0212;
-    x->title="Strain Description";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0213;
-    x->title="Strain Nomenclature";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0214;
-    x->title="Strain Stock Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0215;
-    x->title="Strain Source Registry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0216;
-    x->title="Strain Stock Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0217;
-    x->title="Strain Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0218;
-    x->title="Strain Additional Information";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x0219;
-    x->title="Strain Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1000;
-    x->title="Other Patient IDs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1001;
-    x->title="Other Patient Names";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1002;
-    x->title="Other Patient IDs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1005;
-    x->title="Patient's Birth Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1010;
-    x->title="Patient's Age";
-    x->vr="AS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1020;
-    x->title="Patient's Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1021;
-    x->title="Patient's Size Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1030;
-    x->title="Patient's Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1040;
-    x->title="Patient's Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1050;
-    x->title="Insurance Plan Identification";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1060;
-    x->title="Patient's Mother's Birth Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1080;
-    x->title="Military Rank";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1081;
-    x->title="Branch of Service";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1090;
-    x->title="Medical Record Locator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x1100;
-    x->title="Referenced Patient Photo Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2000;
-    x->title="Medical Alerts";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2110;
-    x->title="Allergies";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2150;
-    x->title="Country of Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2152;
-    x->title="Region of Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2154;
-    x->title="Patient's Telephone Numbers";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2155;
-    x->title="Patient's Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2160;
-    x->title="Ethnic Group";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2180;
-    x->title="Occupation";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21A0;
-    x->title="Smoking Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21B0;
-    x->title="Additional Patient History";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21C0;
-    x->title="Pregnancy Status";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21D0;
-    x->title="Last Menstrual Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x21F0;
-    x->title="Patient's Religious Preference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2201;
-    x->title="Patient Species Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2202;
-    x->title="Patient Species Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2203;
-    x->title="Patient's Sex Neutered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2210;
-    x->title="Anatomical Orientation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2292;
-    x->title="Patient Breed Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2293;
-    x->title="Patient Breed Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2294;
-    x->title="Breed Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2295;
-    x->title="Breed Registration Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2296;
-    x->title="Breed Registry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2297;
-    x->title="Responsible Person";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2298;
-    x->title="Responsible Person Role";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x2299;
-    x->title="Responsible Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x4000;
-    x->title="Patient Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0010;
-    x->tag[1]=0x9431;
-    x->title="Examined Body Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0010;
-    x->title="Clinical Trial Sponsor Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0020;
-    x->title="Clinical Trial Protocol ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0021;
-    x->title="Clinical Trial Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0030;
-    x->title="Clinical Trial Site ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0031;
-    x->title="Clinical Trial Site Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0040;
-    x->title="Clinical Trial Subject ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0042;
-    x->title="Clinical Trial Subject Reading ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0050;
-    x->title="Clinical Trial Time Point ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0051;
-    x->title="Clinical Trial Time Point Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0060;
-    x->title="Clinical Trial Coordinating Center Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0062;
-    x->title="Patient Identity Removed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0063;
-    x->title="De-identification Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0064;
-    x->title="De-identification Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0071;
-    x->title="Clinical Trial Series ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0072;
-    x->title="Clinical Trial Series Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0081;
-    x->title="Clinical Trial Protocol Ethics Committee Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0082;
-    x->title="Clinical Trial Protocol Ethics Committee Approval Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0083;
-    x->title="Consent for Clinical Trial Use Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0084;
-    x->title="Distribution Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0012;
-    x->tag[1]=0x0085;
-    x->title="Consent for Distribution Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0023;
-    x->title="CAD File Format";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0024;
-    x->title="Component Reference System";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0025;
-    x->title="Component Manufacturing Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0028;
-    x->title="Component Manufacturer";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0030;
-    x->title="Material Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0032;
-    x->title="Material Pipe Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0034;
-    x->title="Material Isolation Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0042;
-    x->title="Material Grade";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0044;
-    x->title="Material Properties Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0045;
-    x->title="Material Properties File Format (Retired)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0046;
-    x->title="Material Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0050;
-    x->title="Component Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0052;
-    x->title="Curvature Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0054;
-    x->title="Outer Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0056;
-    x->title="Inner Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0100;
-    x->title="Component Welder IDs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0101;
-    x->title="Secondary Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0102;
-    x->title="Secondary Review Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0103;
-    x->title="Secondary Review Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0104;
-    x->title="Secondary Reviewer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0105;
-    x->title="Repair ID";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0106;
-    x->title="Multiple Component Approval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0107;
-    x->title="Other Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x0108;
-    x->title="Other Secondary Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1010;
-    x->title="Actual Environmental Conditions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1020;
-    x->title="Expiry Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x1040;
-    x->title="Environmental Conditions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2002;
-    x->title="Evaluator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2004;
-    x->title="Evaluator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2006;
-    x->title="Evaluator Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2008;
-    x->title="Evaluation Attempt";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2012;
-    x->title="Indication Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2014;
-    x->title="Indication Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2016;
-    x->title="Indication Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2018;
-    x->title="Indication Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201A;
-    x->title="Indication Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201C;
-    x->title="Indication Disposition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x201E;
-    x->title="Indication ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2030;
-    x->title="Indication Physical Property Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2032;
-    x->title="Property Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2202;
-    x->title="Coordinate System Number of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2204;
-    x->title="Coordinate System Axes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2206;
-    x->title="Coordinate System Axis Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2208;
-    x->title="Coordinate System Data Set Mapping";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220A;
-    x->title="Coordinate System Axis Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220C;
-    x->title="Coordinate System Axis Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x220E;
-    x->title="Coordinate System Axis Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2210;
-    x->title="Coordinate System Axis Values";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2220;
-    x->title="Coordinate System Transform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2222;
-    x->title="Transform Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2224;
-    x->title="Transform Number of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2226;
-    x->title="Transform Order of Axes";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x2228;
-    x->title="Transformed Axis Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x222A;
-    x->title="Coordinate System Transform Rotation and Scale Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x222C;
-    x->title="Coordinate System Transform Translation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3011;
-    x->title="Internal Detector Frame Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3012;
-    x->title="Number of Frames Integrated";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3020;
-    x->title="Detector Temperature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3022;
-    x->title="Sensor Name";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3024;
-    x->title="Horizontal Offset of Sensor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3026;
-    x->title="Vertical Offset of Sensor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3028;
-    x->title="Sensor Temperature";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3040;
-    x->title="Dark Current Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3050;
-    x->title="Dark Current Counts";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3060;
-    x->title="Gain Correction Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3070;
-    x->title="Air Counts";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3071;
-    x->title="KV Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3072;
-    x->title="MA Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3073;
-    x->title="Number of Frames Used for Integration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3074;
-    x->title="Filter Material Used in Gain Calibration";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3075;
-    x->title="Filter Thickness Used in Gain Calibration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3076;
-    x->title="Date of Gain Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3077;
-    x->title="Time of Gain Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3080;
-    x->title="Bad Pixel Image";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x3099;
-    x->title="Calibration Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4002;
-    x->title="Pulser Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4004;
-    x->title="Pulser Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4006;
-    x->title="Pulser Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4008;
-    x->title="Receiver Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400A;
-    x->title="Amplifier Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400C;
-    x->title="Receiver Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400E;
-    x->title="Pre-Amplifier Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x400F;
-    x->title="Pre-Amplifier Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4010;
-    x->title="Transmit Transducer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4011;
-    x->title="Receive Transducer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4012;
-    x->title="Number of Elements";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4013;
-    x->title="Element Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4014;
-    x->title="Element Dimension A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4015;
-    x->title="Element Dimension B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4016;
-    x->title="Element Pitch A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4017;
-    x->title="Measured Beam Dimension A";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4018;
-    x->title="Measured Beam Dimension B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4019;
-    x->title="Location of Measured Beam Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401A;
-    x->title="Nominal Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401B;
-    x->title="Measured Center Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401C;
-    x->title="Measured Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x401D;
-    x->title="Element Pitch B";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4020;
-    x->title="Pulser Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4022;
-    x->title="Pulse Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4024;
-    x->title="Excitation Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4026;
-    x->title="Modulation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4028;
-    x->title="Damping";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4030;
-    x->title="Receiver Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4031;
-    x->title="Acquired Soundpath Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4032;
-    x->title="Acquisition Compression Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4033;
-    x->title="Acquisition Sample Size";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4034;
-    x->title="Rectifier Smoothing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4035;
-    x->title="DAC Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4036;
-    x->title="DAC Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4038;
-    x->title="DAC Gain Points";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x403A;
-    x->title="DAC Time Points";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x403C;
-    x->title="DAC Amplitude";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4040;
-    x->title="Pre-Amplifier Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4050;
-    x->title="Transmit Transducer Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4051;
-    x->title="Receive Transducer Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4052;
-    x->title="Incident Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4054;
-    x->title="Coupling Technique";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4056;
-    x->title="Coupling Medium";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4057;
-    x->title="Coupling Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4058;
-    x->title="Probe Center Location X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4059;
-    x->title="Probe Center Location Z";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x405A;
-    x->title="Sound Path Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x405C;
-    x->title="Delay Law Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4060;
-    x->title="Gate Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4062;
-    x->title="Gate Threshold";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4064;
-    x->title="Velocity of Sound";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4070;
-    x->title="Calibration Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4072;
-    x->title="Calibration Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4074;
-    x->title="Procedure Version";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4076;
-    x->title="Procedure Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4078;
-    x->title="Procedure Expiration Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407A;
-    x->title="Procedure Last Modified Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407C;
-    x->title="Calibration Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x407E;
-    x->title="Calibration Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4080;
-    x->title="Probe Drive Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4081;
-    x->title="Drive Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4082;
-    x->title="Probe Drive Notes";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4083;
-    x->title="Drive Probe Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4084;
-    x->title="Probe Inductance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4085;
-    x->title="Probe Resistance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4086;
-    x->title="Receive Probe Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4087;
-    x->title="Probe Drive Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4088;
-    x->title="Bridge Resistors";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4089;
-    x->title="Probe Orientation Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408B;
-    x->title="User Selected Gain Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408C;
-    x->title="User Selected Phase";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408D;
-    x->title="User Selected Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x408E;
-    x->title="User Selected Offset Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4091;
-    x->title="Channel Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x4092;
-    x->title="Channel Threshold";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409A;
-    x->title="Scanner Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409B;
-    x->title="Scan Procedure";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409C;
-    x->title="Translation Rate X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409D;
-    x->title="Translation Rate Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x409F;
-    x->title="Channel Overlap";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A0;
-    x->title="Image Quality Indicator Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A1;
-    x->title="Image Quality Indicator Material";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x40A2;
-    x->title="Image Quality Indicator Size";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5002;
-    x->title="LINAC Energy";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5004;
-    x->title="LINAC Output";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5100;
-    x->title="Active Aperture";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5101;
-    x->title="Total Aperture";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5102;
-    x->title="Aperture Elevation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5103;
-    x->title="Main Lobe Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5104;
-    x->title="Main Roof Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5105;
-    x->title="Connector Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5106;
-    x->title="Wedge Model Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5107;
-    x->title="Wedge Angle Float";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5108;
-    x->title="Wedge Roof Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5109;
-    x->title="Wedge Element 1 Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510A;
-    x->title="Wedge Material Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510B;
-    x->title="Wedge Material";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510C;
-    x->title="Wedge Offset Z";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510D;
-    x->title="Wedge Origin Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510E;
-    x->title="Wedge Time Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x510F;
-    x->title="Wedge Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5110;
-    x->title="Wedge Manufacturer Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5111;
-    x->title="Wedge Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5112;
-    x->title="Nominal Beam Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5113;
-    x->title="Wedge Offset X";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5114;
-    x->title="Wedge Offset Y";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5115;
-    x->title="Wedge Total Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5116;
-    x->title="Wedge In Contact Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5117;
-    x->title="Wedge Front Gap";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5118;
-    x->title="Wedge Total Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x5119;
-    x->title="Wedge Front Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511A;
-    x->title="Wedge Rear Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511B;
-    x->title="Wedge Total Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511C;
-    x->title="Wedge In Contact Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511D;
-    x->title="Wedge Chamfer Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511E;
-    x->title="Wedge Curve";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0014;
-    x->tag[1]=0x511F;
-    x->title="Radius Along the Wedge";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0010;
-    x->title="Contrast/Bolus Agent";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0012;
-    x->title="Contrast/Bolus Agent Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0013;
-    x->title="Contrast/Bolus T1 Relaxivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0014;
-    x->title="Contrast/Bolus Administration Route Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0015;
-    x->title="Body Part Examined";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0020;
-    x->title="Scanning Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0021;
-    x->title="Sequence Variant";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0022;
-    x->title="Scan Options";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0023;
-    x->title="MR Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0024;
-    x->title="Sequence Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0025;
-    x->title="Angio Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0026;
-    x->title="Intervention Drug Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0027;
-    x->title="Intervention Drug Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0028;
-    x->title="Intervention Drug Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0029;
-    x->title="Intervention Drug Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x002A;
-    x->title="Additional Drug Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0030;
-    x->title="Radionuclide";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0031;
-    x->title="Radiopharmaceutical";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0032;
-    x->title="Energy Window Centerline";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0033;
-    x->title="Energy Window Total Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0034;
-    x->title="Intervention Drug Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0035;
-    x->title="Intervention Drug Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0036;
-    x->title="Intervention Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0037;
-    x->title="Therapy Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0038;
-    x->title="Intervention Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0039;
-    x->title="Therapy Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x003A;
-    x->title="Intervention Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0040;
-    x->title="Cine Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0042;
-    x->title="Initial Cine Run State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0050;
-    x->title="Slice Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0060;
-    x->title="KVP";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0061;
-    x->title="";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0070;
-    x->title="Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0071;
-    x->title="Acquisition Termination Condition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0072;
-    x->title="Effective Duration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0073;
-    x->title="Acquisition Start Condition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0074;
-    x->title="Acquisition Start Condition Data";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0075;
-    x->title="Acquisition Termination Condition Data";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0080;
-    x->title="Repetition Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0081;
-    x->title="Echo Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0082;
-    x->title="Inversion Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0083;
-    x->title="Number of Averages";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0084;
-    x->title="Imaging Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0085;
-    x->title="Imaged Nucleus";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0086;
-    x->title="Echo Number(s)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0087;
-    x->title="Magnetic Field Strength";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0088;
-    x->title="Spacing Between Slices";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0089;
-    x->title="Number of Phase Encoding Steps";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0090;
-    x->title="Data Collection Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0091;
-    x->title="Echo Train Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0093;
-    x->title="Percent Sampling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0094;
-    x->title="Percent Phase Field of View";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x0095;
-    x->title="Pixel Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1000;
-    x->title="Device Serial Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1002;
-    x->title="Device UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1003;
-    x->title="Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1004;
-    x->title="Plate ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1005;
-    x->title="Generator ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1006;
-    x->title="Grid ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1007;
-    x->title="Cassette ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1008;
-    x->title="Gantry ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1010;
-    x->title="Secondary Capture Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1011;
-    x->title="Hardcopy Creation Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1012;
-    x->title="Date of Secondary Capture";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1014;
-    x->title="Time of Secondary Capture";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1016;
-    x->title="Secondary Capture Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1017;
-    x->title="Hardcopy Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1018;
-    x->title="Secondary Capture Device Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1019;
-    x->title="Secondary Capture Device Software Versions";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x101A;
-    x->title="Hardcopy Device Software Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x101B;
-    x->title="Hardcopy Device Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1020;
-    x->title="Software Version(s)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1022;
-    x->title="Video Image Format Acquired";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1023;
-    x->title="Digital Image Format Acquired";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1030;
-    x->title="Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1040;
-    x->title="Contrast/Bolus Route";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1041;
-    x->title="Contrast/Bolus Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1042;
-    x->title="Contrast/Bolus Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1043;
-    x->title="Contrast/Bolus Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1044;
-    x->title="Contrast/Bolus Total Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1045;
-    x->title="Syringe Counts";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1046;
-    x->title="Contrast Flow Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1047;
-    x->title="Contrast Flow Duration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1048;
-    x->title="Contrast/Bolus Ingredient";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1049;
-    x->title="Contrast/Bolus Ingredient Concentration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1050;
-    x->title="Spatial Resolution";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1060;
-    x->title="Trigger Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1061;
-    x->title="Trigger Source or Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1062;
-    x->title="Nominal Interval";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1063;
-    x->title="Frame Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1064;
-    x->title="Cardiac Framing Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1065;
-    x->title="Frame Time Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1066;
-    x->title="Frame Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1067;
-    x->title="Image Trigger Delay";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1068;
-    x->title="Multiplex Group Time Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1069;
-    x->title="Trigger Time Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106A;
-    x->title="Synchronization Trigger";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106C;
-    x->title="Synchronization Channel";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x106E;
-    x->title="Trigger Sample Position";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1070;
-    x->title="Radiopharmaceutical Route";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1071;
-    x->title="Radiopharmaceutical Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1072;
-    x->title="Radiopharmaceutical Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1073;
-    x->title="Radiopharmaceutical Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1074;
-    x->title="Radionuclide Total Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1075;
-    x->title="Radionuclide Half Life";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1076;
-    x->title="Radionuclide Positron Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1077;
-    x->title="Radiopharmaceutical Specific Activity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1078;
-    x->title="Radiopharmaceutical Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1079;
-    x->title="Radiopharmaceutical Stop DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1080;
-    x->title="Beat Rejection Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1081;
-    x->title="Low R-R Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1082;
-    x->title="High R-R Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1083;
-    x->title="Intervals Acquired";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1084;
-    x->title="Intervals Rejected";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1085;
-    x->title="PVC Rejection";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1086;
-    x->title="Skip Beats";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1088;
-    x->title="Heart Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1090;
-    x->title="Cardiac Number of Images";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1094;
-    x->title="Trigger Window";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1100;
-    x->title="Reconstruction Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1110;
-    x->title="Distance Source to Detector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1111;
-    x->title="Distance Source to Patient";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1114;
-    x->title="Estimated Radiographic Magnification Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1120;
-    x->title="Gantry/Detector Tilt";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1121;
-    x->title="Gantry/Detector Slew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1130;
-    x->title="Table Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1131;
-    x->title="Table Traverse";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1134;
-    x->title="Table Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1135;
-    x->title="Table Vertical Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1136;
-    x->title="Table Lateral Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1137;
-    x->title="Table Longitudinal Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1138;
-    x->title="Table Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x113A;
-    x->title="Table Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1140;
-    x->title="Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1141;
-    x->title="Angular Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1142;
-    x->title="Radial Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1143;
-    x->title="Scan Arc";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1144;
-    x->title="Angular Step";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1145;
-    x->title="Center of Rotation Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1146;
-    x->title="Rotation Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1147;
-    x->title="Field of View Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1149;
-    x->title="Field of View Dimension(s)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1150;
-    x->title="Exposure Time";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1151;
-    x->title="X-Ray Tube Current";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1152;
-    x->title="Exposure";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1153;
-    x->title="Exposure in µAs";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1154;
-    x->title="Average Pulse Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1155;
-    x->title="Radiation Setting";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1156;
-    x->title="Rectification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x115A;
-    x->title="Radiation Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x115E;
-    x->title="Image and Fluoroscopy Area Dose Product";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1160;
-    x->title="Filter Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1161;
-    x->title="Type of Filters";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1162;
-    x->title="Intensifier Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1164;
-    x->title="Imager Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1166;
-    x->title="Grid";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1170;
-    x->title="Generator Power";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1180;
-    x->title="Collimator/grid Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1181;
-    x->title="Collimator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1182;
-    x->title="Focal Distance";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1183;
-    x->title="X Focus Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1184;
-    x->title="Y Focus Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1190;
-    x->title="Focal Spot(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1191;
-    x->title="Anode Target Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A0;
-    x->title="Body Part Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A2;
-    x->title="Compression Force";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x11A4;
-    x->title="Paddle Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1200;
-    x->title="Date of Last Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1201;
-    x->title="Time of Last Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1202;
-    x->title="DateTime of Last Calibration";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1210;
-    x->title="Convolution Kernel";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1240;
-    x->title="Upper/Lower Pixel Values";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1242;
-    x->title="Actual Frame Duration";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1243;
-    x->title="Count Rate";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1244;
-    x->title="Preferred Playback Sequencing";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1250;
-    x->title="Receive Coil Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1251;
-    x->title="Transmit Coil Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1260;
-    x->title="Plate Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1261;
-    x->title="Phosphor Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1271;
-    x->title="Water Equivalent Diameter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1272;
-    x->title="Water Equivalent Diameter Calculation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1300;
-    x->title="Scan Velocity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1301;
-    x->title="Whole Body Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1302;
-    x->title="Scan Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1310;
-    x->title="Acquisition Matrix";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1312;
-    x->title="In-plane Phase Encoding Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1314;
-    x->title="Flip Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1315;
-    x->title="Variable Flip Angle Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1316;
-    x->title="SAR";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1318;
-    x->title="dB/dt";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1320;
-    x->title="B1rms";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1400;
-    x->title="Acquisition Device Processing Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1401;
-    x->title="Acquisition Device Processing Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1402;
-    x->title="Cassette Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1403;
-    x->title="Cassette Size";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1404;
-    x->title="Exposures on Plate";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1405;
-    x->title="Relative X-Ray Exposure";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1411;
-    x->title="Exposure Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1412;
-    x->title="Target Exposure Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1413;
-    x->title="Deviation Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1450;
-    x->title="Column Angulation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1460;
-    x->title="Tomo Layer Height";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1470;
-    x->title="Tomo Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1480;
-    x->title="Tomo Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1490;
-    x->title="Tomo Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1491;
-    x->title="Tomo Class";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1495;
-    x->title="Number of Tomosynthesis Source Images";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1500;
-    x->title="Positioner Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1508;
-    x->title="Positioner Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1510;
-    x->title="Positioner Primary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1511;
-    x->title="Positioner Secondary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1520;
-    x->title="Positioner Primary Angle Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1521;
-    x->title="Positioner Secondary Angle Increment";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1530;
-    x->title="Detector Primary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1531;
-    x->title="Detector Secondary Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1600;
-    x->title="Shutter Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1602;
-    x->title="Shutter Left Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1604;
-    x->title="Shutter Right Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1606;
-    x->title="Shutter Upper Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1608;
-    x->title="Shutter Lower Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1610;
-    x->title="Center of Circular Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1612;
-    x->title="Radius of Circular Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1620;
-    x->title="Vertices of the Polygonal Shutter";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1622;
-    x->title="Shutter Presentation Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1623;
-    x->title="Shutter Overlay Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1624;
-    x->title="Shutter Presentation Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1700;
-    x->title="Collimator Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1702;
-    x->title="Collimator Left Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1704;
-    x->title="Collimator Right Vertical Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1706;
-    x->title="Collimator Upper Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1708;
-    x->title="Collimator Lower Horizontal Edge";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1710;
-    x->title="Center of Circular Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1712;
-    x->title="Radius of Circular Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1720;
-    x->title="Vertices of the Polygonal Collimator";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1800;
-    x->title="Acquisition Time Synchronized";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1801;
-    x->title="Time Source";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1802;
-    x->title="Time Distribution Protocol";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x1803;
-    x->title="NTP Source Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2001;
-    x->title="Page Number Vector";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2002;
-    x->title="Frame Label Vector";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2003;
-    x->title="Frame Primary Angle Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2004;
-    x->title="Frame Secondary Angle Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2005;
-    x->title="Slice Location Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2006;
-    x->title="Display Window Label Vector";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2010;
-    x->title="Nominal Scanned Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2020;
-    x->title="Digitizing Device Transport Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2030;
-    x->title="Rotation of Scanned Film";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2041;
-    x->title="Biopsy Target Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2042;
-    x->title="Target UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2043;
-    x->title="Localizing Cursor Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2044;
-    x->title="Calculated Target Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2045;
-    x->title="Target Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x2046;
-    x->title="Displayed Z Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3100;
-    x->title="IVUS Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3101;
-    x->title="IVUS Pullback Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3102;
-    x->title="IVUS Gated Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3103;
-    x->title="IVUS Pullback Start Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3104;
-    x->title="IVUS Pullback Stop Frame Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x3105;
-    x->title="Lesion Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x4000;
-    x->title="Acquisition Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5000;
-    x->title="Output Power";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5010;
-    x->title="Transducer Data";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5012;
-    x->title="Focus Depth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5020;
-    x->title="Processing Function";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5021;
-    x->title="Postprocessing Function";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5022;
-    x->title="Mechanical Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5024;
-    x->title="Bone Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5026;
-    x->title="Cranial Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5027;
-    x->title="Soft Tissue Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5028;
-    x->title="Soft Tissue-focus Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5029;
-    x->title="Soft Tissue-surface Thermal Index";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5030;
-    x->title="Dynamic Range";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5040;
-    x->title="Total Gain";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5050;
-    x->title="Depth of Scan Field";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5100;
-    x->title="Patient Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5101;
-    x->title="View Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5104;
-    x->title="Projection Eponymous Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5210;
-    x->title="Image Transformation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x5212;
-    x->title="Image Translation Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6000;
-    x->title="Sensitivity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6011;
-    x->title="Sequence of Ultrasound Regions";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6012;
-    x->title="Region Spatial Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6014;
-    x->title="Region Data Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6016;
-    x->title="Region Flags";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6018;
-    x->title="Region Location Min X0";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601A;
-    x->title="Region Location Min Y0";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601C;
-    x->title="Region Location Max X1";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x601E;
-    x->title="Region Location Max Y1";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6020;
-    x->title="Reference Pixel X0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6022;
-    x->title="Reference Pixel Y0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6024;
-    x->title="Physical Units X Direction";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6026;
-    x->title="Physical Units Y Direction";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6028;
-    x->title="Reference Pixel Physical Value X";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602A;
-    x->title="Reference Pixel Physical Value Y";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602C;
-    x->title="Physical Delta X";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x602E;
-    x->title="Physical Delta Y";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6030;
-    x->title="Transducer Frequency";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6031;
-    x->title="Transducer Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6032;
-    x->title="Pulse Repetition Frequency";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6034;
-    x->title="Doppler Correction Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6036;
-    x->title="Steering Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6038;
-    x->title="Doppler Sample Volume X Position (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6039;
-    x->title="Doppler Sample Volume X Position";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603A;
-    x->title="Doppler Sample Volume Y Position (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603B;
-    x->title="Doppler Sample Volume Y Position";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603C;
-    x->title="TM-Line Position X0 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603D;
-    x->title="TM-Line Position X0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603E;
-    x->title="TM-Line Position Y0 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x603F;
-    x->title="TM-Line Position Y0";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6040;
-    x->title="TM-Line Position X1 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6041;
-    x->title="TM-Line Position X1";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6042;
-    x->title="TM-Line Position Y1 (Retired)";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6043;
-    x->title="TM-Line Position Y1";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6044;
-    x->title="Pixel Component Organization";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6046;
-    x->title="Pixel Component Mask";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6048;
-    x->title="Pixel Component Range Start";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604A;
-    x->title="Pixel Component Range Stop";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604C;
-    x->title="Pixel Component Physical Units";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x604E;
-    x->title="Pixel Component Data Type";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6050;
-    x->title="Number of Table Break Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6052;
-    x->title="Table of X Break Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6054;
-    x->title="Table of Y Break Points";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6056;
-    x->title="Number of Table Entries";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6058;
-    x->title="Table of Pixel Values";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x605A;
-    x->title="Table of Parameter Values";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x6060;
-    x->title="R Wave Time Vector";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7000;
-    x->title="Detector Conditions Nominal Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7001;
-    x->title="Detector Temperature";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7004;
-    x->title="Detector Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7005;
-    x->title="Detector Configuration";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7006;
-    x->title="Detector Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7008;
-    x->title="Detector Mode";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700A;
-    x->title="Detector ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700C;
-    x->title="Date of Last Detector Calibration";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x700E;
-    x->title="Time of Last Detector Calibration";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7010;
-    x->title="Exposures on Detector Since Last Calibration";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7011;
-    x->title="Exposures on Detector Since Manufactured";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7012;
-    x->title="Detector Time Since Last Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7014;
-    x->title="Detector Active Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7016;
-    x->title="Detector Activation Offset From Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x701A;
-    x->title="Detector Binning";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7020;
-    x->title="Detector Element Physical Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7022;
-    x->title="Detector Element Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7024;
-    x->title="Detector Active Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7026;
-    x->title="Detector Active Dimension(s)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7028;
-    x->title="Detector Active Origin";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x702A;
-    x->title="Detector Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x702B;
-    x->title="Detector Manufacturer's Model Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7030;
-    x->title="Field of View Origin";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7032;
-    x->title="Field of View Rotation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7034;
-    x->title="Field of View Horizontal Flip";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7036;
-    x->title="Pixel Data Area Origin Relative To FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7038;
-    x->title="Pixel Data Area Rotation Angle Relative To FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7040;
-    x->title="Grid Absorbing Material";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7041;
-    x->title="Grid Spacing Material";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7042;
-    x->title="Grid Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7044;
-    x->title="Grid Pitch";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7046;
-    x->title="Grid Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7048;
-    x->title="Grid Period";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x704C;
-    x->title="Grid Focal Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7050;
-    x->title="Filter Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7052;
-    x->title="Filter Thickness Minimum";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7054;
-    x->title="Filter Thickness Maximum";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7056;
-    x->title="Filter Beam Path Length Minimum";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7058;
-    x->title="Filter Beam Path Length Maximum";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7060;
-    x->title="Exposure Control Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7062;
-    x->title="Exposure Control Mode Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7064;
-    x->title="Exposure Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x7065;
-    x->title="Phototimer Setting";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x8150;
-    x->title="Exposure Time in µS";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x8151;
-    x->title="X-Ray Tube Current in µA";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9004;
-    x->title="Content Qualification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9005;
-    x->title="Pulse Sequence Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9006;
-    x->title="MR Imaging Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9008;
-    x->title="Echo Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9009;
-    x->title="Inversion Recovery";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9010;
-    x->title="Flow Compensation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9011;
-    x->title="Multiple Spin Echo";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9012;
-    x->title="Multi-planar Excitation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9014;
-    x->title="Phase Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9015;
-    x->title="Time of Flight Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9016;
-    x->title="Spoiling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9017;
-    x->title="Steady State Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9018;
-    x->title="Echo Planar Pulse Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9019;
-    x->title="Tag Angle First Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9020;
-    x->title="Magnetization Transfer";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9021;
-    x->title="T2 Preparation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9022;
-    x->title="Blood Signal Nulling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9024;
-    x->title="Saturation Recovery";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9025;
-    x->title="Spectrally Selected Suppression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9026;
-    x->title="Spectrally Selected Excitation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9027;
-    x->title="Spatial Pre-saturation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9028;
-    x->title="Tagging";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9029;
-    x->title="Oversampling Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9030;
-    x->title="Tag Spacing First Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9032;
-    x->title="Geometry of k-Space Traversal";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9033;
-    x->title="Segmented k-Space Traversal";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9034;
-    x->title="Rectilinear Phase Encode Reordering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9035;
-    x->title="Tag Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9036;
-    x->title="Partial Fourier Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9037;
-    x->title="Cardiac Synchronization Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9041;
-    x->title="Receive Coil Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9042;
-    x->title="MR Receive Coil Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9043;
-    x->title="Receive Coil Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9044;
-    x->title="Quadrature Receive Coil";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9045;
-    x->title="Multi-Coil Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9046;
-    x->title="Multi-Coil Configuration";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9047;
-    x->title="Multi-Coil Element Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9048;
-    x->title="Multi-Coil Element Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9049;
-    x->title="MR Transmit Coil Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9050;
-    x->title="Transmit Coil Manufacturer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9051;
-    x->title="Transmit Coil Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9052;
-    x->title="Spectral Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9053;
-    x->title="Chemical Shift Reference";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9054;
-    x->title="Volume Localization Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9058;
-    x->title="MR Acquisition Frequency Encoding Steps";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9059;
-    x->title="De-coupling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9060;
-    x->title="De-coupled Nucleus";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9061;
-    x->title="De-coupling Frequency";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9062;
-    x->title="De-coupling Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9063;
-    x->title="De-coupling Chemical Shift Reference";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9064;
-    x->title="k-space Filtering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9065;
-    x->title="Time Domain Filtering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9066;
-    x->title="Number of Zero Fills";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9067;
-    x->title="Baseline Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9069;
-    x->title="Parallel Reduction Factor In-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9070;
-    x->title="Cardiac R-R Interval Specified";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9073;
-    x->title="Acquisition Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9074;
-    x->title="Frame Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9075;
-    x->title="Diffusion Directionality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9076;
-    x->title="Diffusion Gradient Direction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9077;
-    x->title="Parallel Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9078;
-    x->title="Parallel Acquisition Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9079;
-    x->title="Inversion Times";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9080;
-    x->title="Metabolite Map Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9081;
-    x->title="Partial Fourier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9082;
-    x->title="Effective Echo Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9083;
-    x->title="Metabolite Map Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9084;
-    x->title="Chemical Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9085;
-    x->title="Cardiac Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9087;
-    x->title="Diffusion b-value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9089;
-    x->title="Diffusion Gradient Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9090;
-    x->title="Velocity Encoding Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9091;
-    x->title="Velocity Encoding Minimum Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9092;
-    x->title="Velocity Encoding Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9093;
-    x->title="Number of k-Space Trajectories";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9094;
-    x->title="Coverage of k-Space";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9095;
-    x->title="Spectroscopy Acquisition Phase Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9096;
-    x->title="Parallel Reduction Factor In-plane (Retired)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9098;
-    x->title="Transmitter Frequency";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9100;
-    x->title="Resonant Nucleus";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9101;
-    x->title="Frequency Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9103;
-    x->title="MR Spectroscopy FOV/Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9104;
-    x->title="Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9105;
-    x->title="Slab Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9106;
-    x->title="Mid Slab Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9107;
-    x->title="MR Spatial Saturation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9112;
-    x->title="MR Timing and Related Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9114;
-    x->title="MR Echo Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9115;
-    x->title="MR Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9117;
-    x->title="MR Diffusion Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9118;
-    x->title="Cardiac Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9119;
-    x->title="MR Averages Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9125;
-    x->title="MR FOV/Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9126;
-    x->title="Volume Localization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9127;
-    x->title="Spectroscopy Acquisition Data Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9147;
-    x->title="Diffusion Anisotropy Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9151;
-    x->title="Frame Reference DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9152;
-    x->title="MR Metabolite Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9155;
-    x->title="Parallel Reduction Factor out-of-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9159;
-    x->title="Spectroscopy Acquisition Out-of-plane Phase Steps";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9166;
-    x->title="Bulk Motion Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9168;
-    x->title="Parallel Reduction Factor Second In-plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9169;
-    x->title="Cardiac Beat Rejection Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9170;
-    x->title="Respiratory Motion Compensation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9171;
-    x->title="Respiratory Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9172;
-    x->title="Bulk Motion Compensation Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9173;
-    x->title="Bulk Motion Signal Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9174;
-    x->title="Applicable Safety Standard Agency";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9175;
-    x->title="Applicable Safety Standard Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9176;
-    x->title="Operating Mode Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9177;
-    x->title="Operating Mode Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9178;
-    x->title="Operating Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9179;
-    x->title="Specific Absorption Rate Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9180;
-    x->title="Gradient Output Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9181;
-    x->title="Specific Absorption Rate Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9182;
-    x->title="Gradient Output";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9183;
-    x->title="Flow Compensation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9184;
-    x->title="Tagging Delay";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9185;
-    x->title="Respiratory Motion Compensation Technique Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9186;
-    x->title="Respiratory Signal Source ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9195;
-    x->title="Chemical Shift Minimum Integration Limit in Hz";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9196;
-    x->title="Chemical Shift Maximum Integration Limit in Hz";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9197;
-    x->title="MR Velocity Encoding Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9198;
-    x->title="First Order Phase Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9199;
-    x->title="Water Referenced Phase Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9200;
-    x->title="MR Spectroscopy Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9214;
-    x->title="Respiratory Cycle Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9217;
-    x->title="Velocity Encoding Maximum Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9218;
-    x->title="Tag Spacing Second Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9219;
-    x->title="Tag Angle Second Axis";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9220;
-    x->title="Frame Acquisition Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9226;
-    x->title="MR Image Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9227;
-    x->title="MR Spectroscopy Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9231;
-    x->title="MR Acquisition Phase Encoding Steps in-plane";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9232;
-    x->title="MR Acquisition Phase Encoding Steps out-of-plane";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9234;
-    x->title="Spectroscopy Acquisition Phase Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9236;
-    x->title="Cardiac Cycle Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9239;
-    x->title="Specific Absorption Rate Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9240;
-    x->title="RF Echo Train Length";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9241;
-    x->title="Gradient Echo Train Length";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9250;
-    x->title="Arterial Spin Labeling Contrast";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9251;
-    x->title="MR Arterial Spin Labeling Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9252;
-    x->title="ASL Technique Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9253;
-    x->title="ASL Slab Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9254;
-    x->title="ASL Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9255;
-    x->title="ASL Slab Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9256;
-    x->title="ASL Mid Slab Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9257;
-    x->title="ASL Context";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9258;
-    x->title="ASL Pulse Train Duration";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9259;
-    x->title="ASL Crusher Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925A;
-    x->title="ASL Crusher Flow Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925B;
-    x->title="ASL Crusher Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925C;
-    x->title="ASL Bolus Cut-off Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925D;
-    x->title="ASL Bolus Cut-off Timing Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925E;
-    x->title="ASL Bolus Cut-off Technique";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x925F;
-    x->title="ASL Bolus Cut-off Delay Time";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9260;
-    x->title="ASL Slab Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9295;
-    x->title="Chemical Shift Minimum Integration Limit in ppm";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9296;
-    x->title="Chemical Shift Maximum Integration Limit in ppm";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9297;
-    x->title="Water Reference Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9298;
-    x->title="Echo Peak Position";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9301;
-    x->title="CT Acquisition Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9302;
-    x->title="Acquisition Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9303;
-    x->title="Tube Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9304;
-    x->title="CT Acquisition Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9305;
-    x->title="Revolution Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9306;
-    x->title="Single Collimation Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9307;
-    x->title="Total Collimation Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9308;
-    x->title="CT Table Dynamics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9309;
-    x->title="Table Speed";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9310;
-    x->title="Table Feed per Rotation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9311;
-    x->title="Spiral Pitch Factor";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9312;
-    x->title="CT Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9313;
-    x->title="Data Collection Center (Patient)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9314;
-    x->title="CT Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9315;
-    x->title="Reconstruction Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9316;
-    x->title="Convolution Kernel Group";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9317;
-    x->title="Reconstruction Field of View";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9318;
-    x->title="Reconstruction Target Center (Patient)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9319;
-    x->title="Reconstruction Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9320;
-    x->title="Image Filter";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9321;
-    x->title="CT Exposure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9322;
-    x->title="Reconstruction Pixel Spacing";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9323;
-    x->title="Exposure Modulation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9324;
-    x->title="Estimated Dose Saving";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9325;
-    x->title="CT X-Ray Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9326;
-    x->title="CT Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9327;
-    x->title="Table Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9328;
-    x->title="Exposure Time in ms";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9329;
-    x->title="CT Image Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9330;
-    x->title="X-Ray Tube Current in mA";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9332;
-    x->title="Exposure in mAs";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9333;
-    x->title="Constant Volume Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9334;
-    x->title="Fluoroscopy Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9335;
-    x->title="Distance Source to Data Collection Center";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9337;
-    x->title="Contrast/Bolus Agent Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9338;
-    x->title="Contrast/Bolus Ingredient Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9340;
-    x->title="Contrast Administration Profile Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9341;
-    x->title="Contrast/Bolus Usage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9342;
-    x->title="Contrast/Bolus Agent Administered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9343;
-    x->title="Contrast/Bolus Agent Detected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9344;
-    x->title="Contrast/Bolus Agent Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9345;
-    x->title="CTDIvol";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9346;
-    x->title="CTDI Phantom Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9351;
-    x->title="Calcium Scoring Mass Factor Patient";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9352;
-    x->title="Calcium Scoring Mass Factor Device";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9353;
-    x->title="Energy Weighting Factor";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9360;
-    x->title="CT Additional X-Ray Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9401;
-    x->title="Projection Pixel Calibration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9402;
-    x->title="Distance Source to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9403;
-    x->title="Distance Object to Table Top";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9404;
-    x->title="Object Pixel Spacing in Center of Beam";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9405;
-    x->title="Positioner Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9406;
-    x->title="Table Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9407;
-    x->title="Collimator Shape Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9410;
-    x->title="Planes in Acquisition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9412;
-    x->title="XA/XRF Frame Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9417;
-    x->title="Frame Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9420;
-    x->title="X-Ray Receptor Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9423;
-    x->title="Acquisition Protocol Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9424;
-    x->title="Acquisition Protocol Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9425;
-    x->title="Contrast/Bolus Ingredient Opaque";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9426;
-    x->title="Distance Receptor Plane to Detector Housing";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9427;
-    x->title="Intensifier Active Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9428;
-    x->title="Intensifier Active Dimension(s)";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9429;
-    x->title="Physical Detector Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9430;
-    x->title="Position of Isocenter Projection";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9432;
-    x->title="Field of View Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9433;
-    x->title="Field of View Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9434;
-    x->title="Exposure Control Sensing Regions Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9435;
-    x->title="Exposure Control Sensing Region Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9436;
-    x->title="Exposure Control Sensing Region Left Vertical Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9437;
-    x->title="Exposure Control Sensing Region Right Vertical Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9438;
-    x->title="Exposure Control Sensing Region Upper Horizontal Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9439;
-    x->title="Exposure Control Sensing Region Lower Horizontal Edge";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9440;
-    x->title="Center of Circular Exposure Control Sensing Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9441;
-    x->title="Radius of Circular Exposure Control Sensing Region";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9442;
-    x->title="Vertices of the Polygonal Exposure Control Sensing Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9445;
-    x->title="";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9447;
-    x->title="Column Angulation (Patient)";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9449;
-    x->title="Beam Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9451;
-    x->title="Frame Detector Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9452;
-    x->title="Calculated Anatomy Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9455;
-    x->title="Calibration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9456;
-    x->title="Object Thickness Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9457;
-    x->title="Plane Identification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9461;
-    x->title="Field of View Dimension(s) in Float";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9462;
-    x->title="Isocenter Reference System Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9463;
-    x->title="Positioner Isocenter Primary Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9464;
-    x->title="Positioner Isocenter Secondary Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9465;
-    x->title="Positioner Isocenter Detector Rotation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9466;
-    x->title="Table X Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9467;
-    x->title="Table Y Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9468;
-    x->title="Table Z Position to Isocenter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9469;
-    x->title="Table Horizontal Rotation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9470;
-    x->title="Table Head Tilt Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9471;
-    x->title="Table Cradle Tilt Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9472;
-    x->title="Frame Display Shutter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9473;
-    x->title="Acquired Image Area Dose Product";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9474;
-    x->title="C-arm Positioner Tabletop Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9476;
-    x->title="X-Ray Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9477;
-    x->title="Irradiation Event Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9504;
-    x->title="X-Ray 3D Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9506;
-    x->title="Contributing Sources Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9507;
-    x->title="X-Ray 3D Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9508;
-    x->title="Primary Positioner Scan Arc";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9509;
-    x->title="Secondary Positioner Scan Arc";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9510;
-    x->title="Primary Positioner Scan Start Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9511;
-    x->title="Secondary Positioner Scan Start Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9514;
-    x->title="Primary Positioner Increment";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9515;
-    x->title="Secondary Positioner Increment";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9516;
-    x->title="Start Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9517;
-    x->title="End Acquisition DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9518;
-    x->title="Primary Positioner Increment Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9519;
-    x->title="Secondary Positioner Increment Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9524;
-    x->title="Application Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9525;
-    x->title="Application Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9526;
-    x->title="Application Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9527;
-    x->title="Algorithm Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9528;
-    x->title="Algorithm Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9530;
-    x->title="X-Ray 3D Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9531;
-    x->title="Reconstruction Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9538;
-    x->title="Per Projection Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9541;
-    x->title="Detector Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9542;
-    x->title="X-Ray Acquisition Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9543;
-    x->title="X-Ray Source Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9544;
-    x->title="X-Ray Source Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9545;
-    x->title="Breast Support Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9546;
-    x->title="Breast Support Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9547;
-    x->title="Breast Support X Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9548;
-    x->title="Breast Support Y Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9549;
-    x->title="Breast Support Z Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9550;
-    x->title="Detector Isocenter Primary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9551;
-    x->title="Detector Isocenter Secondary Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9552;
-    x->title="Detector X Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9553;
-    x->title="Detector Y Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9554;
-    x->title="Detector Z Position to Isocenter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9555;
-    x->title="X-Ray Grid Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9556;
-    x->title="X-Ray Filter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9557;
-    x->title="Detector Active Area TLHC Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9558;
-    x->title="Detector Active Area Orientation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9559;
-    x->title="Positioner Primary Angle Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9601;
-    x->title="Diffusion b-matrix Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9602;
-    x->title="Diffusion b-value XX";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9603;
-    x->title="Diffusion b-value XY";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9604;
-    x->title="Diffusion b-value XZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9605;
-    x->title="Diffusion b-value YY";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9606;
-    x->title="Diffusion b-value YZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9607;
-    x->title="Diffusion b-value ZZ";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9621;
-    x->title="Functional MR Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9622;
-    x->title="Functional Settling Phase Frames Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9623;
-    x->title="Functional Sync Pulse";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9624;
-    x->title="Settling Phase Frame";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9701;
-    x->title="Decay Correction DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9715;
-    x->title="Start Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9716;
-    x->title="Start Relative Density Difference Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9717;
-    x->title="Start Cardiac Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9718;
-    x->title="Start Respiratory Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9719;
-    x->title="Termination Counts Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9720;
-    x->title="Termination Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9721;
-    x->title="Termination Relative Density Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9722;
-    x->title="Termination Time Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9723;
-    x->title="Termination Cardiac Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9724;
-    x->title="Termination Respiratory Trigger Count Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9725;
-    x->title="Detector Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9726;
-    x->title="Transverse Detector Separation";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9727;
-    x->title="Axial Detector Dimension";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9729;
-    x->title="Radiopharmaceutical Agent Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9732;
-    x->title="PET Frame Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9733;
-    x->title="PET Detector Motion Details Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9734;
-    x->title="PET Table Dynamics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9735;
-    x->title="PET Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9736;
-    x->title="PET Frame Correction Factors Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9737;
-    x->title="Radiopharmaceutical Usage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9738;
-    x->title="Attenuation Correction Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9739;
-    x->title="Number of Iterations";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9740;
-    x->title="Number of Subsets";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9749;
-    x->title="PET Reconstruction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9751;
-    x->title="PET Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9755;
-    x->title="Time of Flight Information Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9756;
-    x->title="Reconstruction Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9758;
-    x->title="Decay Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9759;
-    x->title="Attenuation Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9760;
-    x->title="Scatter Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9761;
-    x->title="Dead Time Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9762;
-    x->title="Gantry Motion Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9763;
-    x->title="Patient Motion Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9764;
-    x->title="Count Loss Normalization Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9765;
-    x->title="Randoms Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9766;
-    x->title="Non-uniform Radial Sampling Corrected";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9767;
-    x->title="Sensitivity Calibrated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9768;
-    x->title="Detector Normalization Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9769;
-    x->title="Iterative Reconstruction Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9770;
-    x->title="Attenuation Correction Temporal Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9771;
-    x->title="Patient Physiological State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9772;
-    x->title="Patient Physiological State Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9801;
-    x->title="Depth(s) of Focus";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9803;
-    x->title="Excluded Intervals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9804;
-    x->title="Exclusion Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9805;
-    x->title="Exclusion Duration";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9806;
-    x->title="US Image Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9807;
-    x->title="Image Data Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9808;
-    x->title="Data Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9809;
-    x->title="Transducer Scan Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980B;
-    x->title="Aliased Data Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980C;
-    x->title="Position Measuring Device Used";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980D;
-    x->title="Transducer Geometry Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980E;
-    x->title="Transducer Beam Steering Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x980F;
-    x->title="Transducer Application Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0x9810;
-    x->title="Zero Velocity Pixel Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA001;
-    x->title="Contributing Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA002;
-    x->title="Contribution DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0018;
-    x->tag[1]=0xA003;
-    x->title="Contribution Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x000D;
-    x->title="Study Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x000E;
-    x->title="Series Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0010;
-    x->title="Study ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0011;
-    x->title="Series Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0012;
-    x->title="Acquisition Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0013;
-    x->title="Instance Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0014;
-    x->title="Isotope Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0015;
-    x->title="Phase Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0016;
-    x->title="Interval Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0017;
-    x->title="Time Slot Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0018;
-    x->title="Angle Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0019;
-    x->title="Item Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0020;
-    x->title="Patient Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0022;
-    x->title="Overlay Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0024;
-    x->title="Curve Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0026;
-    x->title="LUT Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0030;
-    x->title="Image Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0032;
-    x->title="Image Position (Patient)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0035;
-    x->title="Image Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0037;
-    x->title="Image Orientation (Patient)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0050;
-    x->title="Location";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0052;
-    x->title="Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0060;
-    x->title="Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0062;
-    x->title="Image Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0070;
-    x->title="Image Geometry Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0080;
-    x->title="Masking Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x00AA;
-    x->title="Report Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0100;
-    x->title="Temporal Position Identifier";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0105;
-    x->title="Number of Temporal Positions";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0110;
-    x->title="Temporal Resolution";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0200;
-    x->title="Synchronization Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x0242;
-    x->title="SOP Instance UID of Concatenation Source";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1000;
-    x->title="Series in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1001;
-    x->title="Acquisitions in Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1002;
-    x->title="Images in Acquisition";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1003;
-    x->title="Images in Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1004;
-    x->title="Acquisitions in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1005;
-    x->title="Images in Study";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1020;
-    x->title="Reference";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1040;
-    x->title="Position Reference Indicator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1041;
-    x->title="Slice Location";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1070;
-    x->title="Other Study Numbers";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1200;
-    x->title="Number of Patient Related Studies";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1202;
-    x->title="Number of Patient Related Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1204;
-    x->title="Number of Patient Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1206;
-    x->title="Number of Study Related Series";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1208;
-    x->title="Number of Study Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x1209;
-    x->title="Number of Series Related Instances";
-    x->vr="IS";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0020;
-    //x->tag[1]=0x31xx;
-    //x->title="Source Image IDs";
-    //x->vr="CS";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3401;
-    x->title="Modifying Device ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3402;
-    x->title="Modified Image ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3403;
-    x->title="Modified Image Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3404;
-    x->title="Modifying Device Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3405;
-    x->title="Modified Image Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x3406;
-    x->title="Modified Image Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x4000;
-    x->title="Image Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x5000;
-    x->title="Original Image Identification";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x5002;
-    x->title="Original Image Identification Nomenclature";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9056;
-    x->title="Stack ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9057;
-    x->title="In-Stack Position Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9071;
-    x->title="Frame Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9072;
-    x->title="Frame Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9111;
-    x->title="Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9113;
-    x->title="Plane Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9116;
-    x->title="Plane Orientation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9128;
-    x->title="Temporal Position Index";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9153;
-    x->title="Nominal Cardiac Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9154;
-    x->title="Nominal Cardiac Trigger Time Prior To R-Peak";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9155;
-    x->title="Actual Cardiac Trigger Time Prior To R-Peak";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9156;
-    x->title="Frame Acquisition Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9157;
-    x->title="Dimension Index Values";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9158;
-    x->title="Frame Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9161;
-    x->title="Concatenation UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9162;
-    x->title="In-concatenation Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9163;
-    x->title="In-concatenation Total Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9164;
-    x->title="Dimension Organization UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9165;
-    x->title="Dimension Index Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9167;
-    x->title="Functional Group Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9170;
-    x->title="Unassigned Shared Converted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9171;
-    x->title="Unassigned Per-Frame Converted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9172;
-    x->title="Conversion Source Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9213;
-    x->title="Dimension Index Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9221;
-    x->title="Dimension Organization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9222;
-    x->title="Dimension Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9228;
-    x->title="Concatenation Frame Offset Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9238;
-    x->title="Functional Group Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9241;
-    x->title="Nominal Percentage of Cardiac Phase";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9245;
-    x->title="Nominal Percentage of Respiratory Phase";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9246;
-    x->title="Starting Respiratory Amplitude";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9247;
-    x->title="Starting Respiratory Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9248;
-    x->title="Ending Respiratory Amplitude";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9249;
-    x->title="Ending Respiratory Phase";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9250;
-    x->title="Respiratory Trigger Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9251;
-    x->title="R-R Interval Time Nominal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9252;
-    x->title="Actual Cardiac Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9253;
-    x->title="Respiratory Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9254;
-    x->title="Respiratory Interval Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9255;
-    x->title="Nominal Respiratory Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9256;
-    x->title="Respiratory Trigger Delay Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9257;
-    x->title="Actual Respiratory Trigger Delay Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9301;
-    x->title="Image Position (Volume)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9302;
-    x->title="Image Orientation (Volume)";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9307;
-    x->title="Ultrasound Acquisition Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9308;
-    x->title="Apex Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9309;
-    x->title="Volume to Transducer Mapping Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930A;
-    x->title="Volume to Table Mapping Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930B;
-    x->title="Volume to Transducer Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930C;
-    x->title="Patient Frame of Reference Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930D;
-    x->title="Temporal Position Time Offset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930E;
-    x->title="Plane Position (Volume) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x930F;
-    x->title="Plane Orientation (Volume) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9310;
-    x->title="Temporal Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9311;
-    x->title="Dimension Organization Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9312;
-    x->title="Volume Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9313;
-    x->title="Table Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9421;
-    x->title="Dimension Description Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9450;
-    x->title="Patient Orientation in Frame Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9453;
-    x->title="Frame Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9518;
-    x->title="Acquisition Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9529;
-    x->title="Contributing SOP Instances Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0020;
-    x->tag[1]=0x9536;
-    x->title="Reconstruction Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0001;
-    x->title="Light Path Filter Pass-Through Wavelength";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0002;
-    x->title="Light Path Filter Pass Band";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0003;
-    x->title="Image Path Filter Pass-Through Wavelength";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0004;
-    x->title="Image Path Filter Pass Band";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0005;
-    x->title="Patient Eye Movement Commanded";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0006;
-    x->title="Patient Eye Movement Command Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0007;
-    x->title="Spherical Lens Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0008;
-    x->title="Cylinder Lens Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0009;
-    x->title="Cylinder Axis";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000A;
-    x->title="Emmetropic Magnification";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000B;
-    x->title="Intra Ocular Pressure";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000C;
-    x->title="Horizontal Field of View";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000D;
-    x->title="Pupil Dilated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x000E;
-    x->title="Degree of Dilation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0010;
-    x->title="Stereo Baseline Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0011;
-    x->title="Stereo Baseline Displacement";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0012;
-    x->title="Stereo Horizontal Pixel Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0013;
-    x->title="Stereo Vertical Pixel Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0014;
-    x->title="Stereo Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0015;
-    x->title="Acquisition Device Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0016;
-    x->title="Illumination Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0017;
-    x->title="Light Path Filter Type Stack Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0018;
-    x->title="Image Path Filter Type Stack Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0019;
-    x->title="Lenses Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001A;
-    x->title="Channel Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001B;
-    x->title="Refractive State Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001C;
-    x->title="Mydriatic Agent Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001D;
-    x->title="Relative Image Position Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x001E;
-    x->title="Camera Angle of View";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0020;
-    x->title="Stereo Pairs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0021;
-    x->title="Left Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0022;
-    x->title="Right Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0028;
-    x->title="Stereo Pairs Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0030;
-    x->title="Axial Length of the Eye";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0031;
-    x->title="Ophthalmic Frame Location Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0032;
-    x->title="Reference Coordinates";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0035;
-    x->title="Depth Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0036;
-    x->title="Maximum Depth Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0037;
-    x->title="Along-scan Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0038;
-    x->title="Maximum Along-scan Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0039;
-    x->title="Ophthalmic Image Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0041;
-    x->title="Depth of Transverse Image";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0042;
-    x->title="Mydriatic Agent Concentration Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0048;
-    x->title="Across-scan Spatial Resolution";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0049;
-    x->title="Maximum Across-scan Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x004E;
-    x->title="Mydriatic Agent Concentration";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0055;
-    x->title="Illumination Wave Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0056;
-    x->title="Illumination Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0057;
-    x->title="Illumination Bandwidth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x0058;
-    x->title="Mydriatic Agent Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1007;
-    x->title="Ophthalmic Axial Measurements Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1008;
-    x->title="Ophthalmic Axial Measurements Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1009;
-    x->title="Ophthalmic Axial Measurements Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1010;
-    x->title="Ophthalmic Axial Length Measurements Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1012;
-    x->title="Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1019;
-    x->title="Ophthalmic Axial Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1024;
-    x->title="Lens Status Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1025;
-    x->title="Vitreous Status Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1028;
-    x->title="IOL Formula Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1029;
-    x->title="IOL Formula Detail";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1033;
-    x->title="Keratometer Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1035;
-    x->title="Source of Ophthalmic Axial Length Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1037;
-    x->title="Target Refraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1039;
-    x->title="Refractive Procedure Occurred";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1040;
-    x->title="Refractive Surgery Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1044;
-    x->title="Ophthalmic Ultrasound Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1050;
-    x->title="Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1053;
-    x->title="IOL Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1054;
-    x->title="Predicted Refractive Error";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1059;
-    x->title="Ophthalmic Axial Length Velocity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1065;
-    x->title="Lens Status Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1066;
-    x->title="Vitreous Status Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1090;
-    x->title="IOL Power Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1092;
-    x->title="Lens Constant Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1093;
-    x->title="IOL Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1094;
-    x->title="Lens Constant Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1095;
-    x->title="Implant Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1096;
-    x->title="Keratometry Measurement Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1097;
-    x->title="Implant Part Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1100;
-    x->title="Referenced Ophthalmic Axial Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1101;
-    x->title="Ophthalmic Axial Length Measurements Segment Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1103;
-    x->title="Refractive Error Before Refractive Surgery Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1121;
-    x->title="IOL Power For Exact Emmetropia";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1122;
-    x->title="IOL Power For Exact Target Refraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1125;
-    x->title="Anterior Chamber Depth Definition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1127;
-    x->title="Lens Thickness Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1128;
-    x->title="Anterior Chamber Depth Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1130;
-    x->title="Lens Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1131;
-    x->title="Anterior Chamber Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1132;
-    x->title="Source of Lens Thickness Data Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1133;
-    x->title="Source of Anterior Chamber Depth Data Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1134;
-    x->title="Source of Refractive Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1135;
-    x->title="Source of Refractive Measurements Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1140;
-    x->title="Ophthalmic Axial Length Measurement Modified";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1150;
-    x->title="Ophthalmic Axial Length Data Source Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1153;
-    x->title="Ophthalmic Axial Length Acquisition Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1155;
-    x->title="Signal to Noise Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1159;
-    x->title="Ophthalmic Axial Length Data Source Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1210;
-    x->title="Ophthalmic Axial Length Measurements Total Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1211;
-    x->title="Ophthalmic Axial Length Measurements Segmental Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1212;
-    x->title="Ophthalmic Axial Length Measurements Length Summation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1220;
-    x->title="Ultrasound Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1225;
-    x->title="Optical Ophthalmic Axial Length Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1230;
-    x->title="Ultrasound Selected Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1250;
-    x->title="Ophthalmic Axial Length Selection Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1255;
-    x->title="Optical Selected Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1257;
-    x->title="Selected Segmental Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1260;
-    x->title="Selected Total Ophthalmic Axial Length Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1262;
-    x->title="Ophthalmic Axial Length Quality Metric Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1265;
-    x->title="Ophthalmic Axial Length Quality Metric Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1273;
-    x->title="Ophthalmic Axial Length Quality Metric Type Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1300;
-    x->title="Intraocular Lens Calculations Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1310;
-    x->title="Intraocular Lens Calculations Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1330;
-    x->title="Referenced Ophthalmic Axial Length Measurement QC Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1415;
-    x->title="Ophthalmic Mapping Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1420;
-    x->title="Acquisition Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1423;
-    x->title="Acquisition Method Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1436;
-    x->title="Ophthalmic Thickness Map Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1443;
-    x->title="Ophthalmic Thickness Mapping Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1445;
-    x->title="Retinal Thickness Definition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1450;
-    x->title="Pixel Value Mapping to Coded Concept Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1452;
-    x->title="Mapped Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1454;
-    x->title="Pixel Value Mapping Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1458;
-    x->title="Ophthalmic Thickness Map Quality Threshold Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1460;
-    x->title="Ophthalmic Thickness Map Threshold Quality Rating";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1463;
-    x->title="Anatomic Structure Reference Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1465;
-    x->title="Registration to Localizer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1466;
-    x->title="Registered Localizer Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1467;
-    x->title="Registered Localizer Top Left Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1468;
-    x->title="Registered Localizer Bottom Right Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1470;
-    x->title="Ophthalmic Thickness Map Quality Rating Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1472;
-    x->title="Relevant OPT Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1512;
-    x->title="Transformation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1513;
-    x->title="Transformation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1515;
-    x->title="Ophthalmic Axial Length Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1517;
-    x->title="Ophthalmic FOV";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1518;
-    x->title="Two Dimensional to Three Dimensional Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1525;
-    x->title="Wide Field Ophthalmic Photography Quality Rating Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1526;
-    x->title="Wide Field Ophthalmic Photography Quality Threshold Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1527;
-    x->title="Wide Field Ophthalmic Photography Threshold Quality Rating";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1528;
-    x->title="X Coordinates Center Pixel View Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1529;
-    x->title="Y Coordinates Center Pixel View Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1530;
-    x->title="Number of Map Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0022;
-    x->tag[1]=0x1531;
-    x->title="Two Dimensional to Three Dimensional Map Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0010;
-    x->title="Visual Field Horizontal Extent";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0011;
-    x->title="Visual Field Vertical Extent";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0012;
-    x->title="Visual Field Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0016;
-    x->title="Screening Test Mode Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0018;
-    x->title="Maximum Stimulus Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0020;
-    x->title="Background Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0021;
-    x->title="Stimulus Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0024;
-    x->title="Background Illumination Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0025;
-    x->title="Stimulus Area";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0028;
-    x->title="Stimulus Presentation Time";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0032;
-    x->title="Fixation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0033;
-    x->title="Fixation Monitoring Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0034;
-    x->title="Visual Field Catch Trial Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0035;
-    x->title="Fixation Checked Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0036;
-    x->title="Patient Not Properly Fixated Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0037;
-    x->title="Presented Visual Stimuli Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0038;
-    x->title="Number of Visual Stimuli";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0039;
-    x->title="Excessive Fixation Losses Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0040;
-    x->title="Excessive Fixation Losses";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0042;
-    x->title="Stimuli Retesting Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0044;
-    x->title="Comments on Patient's Performance of Visual Field";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0045;
-    x->title="False Negatives Estimate Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0046;
-    x->title="False Negatives Estimate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0048;
-    x->title="Negative Catch Trials Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0050;
-    x->title="False Negatives Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0051;
-    x->title="Excessive False Negatives Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0052;
-    x->title="Excessive False Negatives";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0053;
-    x->title="False Positives Estimate Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0054;
-    x->title="False Positives Estimate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0055;
-    x->title="Catch Trials Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0056;
-    x->title="Positive Catch Trials Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0057;
-    x->title="Test Point Normals Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0058;
-    x->title="Test Point Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0059;
-    x->title="Global Deviation Probability Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0060;
-    x->title="False Positives Quantity";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0061;
-    x->title="Excessive False Positives Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0062;
-    x->title="Excessive False Positives";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0063;
-    x->title="Visual Field Test Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0064;
-    x->title="Results Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0065;
-    x->title="Age Corrected Sensitivity Deviation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0066;
-    x->title="Global Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0067;
-    x->title="Generalized Defect Sensitivity Deviation Algorithm Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0068;
-    x->title="Localized Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0069;
-    x->title="Patient Reliability Indicator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0070;
-    x->title="Visual Field Mean Sensitivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0071;
-    x->title="Global Deviation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0072;
-    x->title="Local Deviation Probability Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0073;
-    x->title="Localized Deviation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0074;
-    x->title="Short Term Fluctuation Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0075;
-    x->title="Short Term Fluctuation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0076;
-    x->title="Short Term Fluctuation Probability Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0077;
-    x->title="Short Term Fluctuation Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0078;
-    x->title="Corrected Localized Deviation From Normal Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0079;
-    x->title="Corrected Localized Deviation From Normal";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0080;
-    x->title="Corrected Localized Deviation From Normal Probability Calculated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0081;
-    x->title="Corrected Localized Deviation From Normal Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0083;
-    x->title="Global Deviation Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0085;
-    x->title="Localized Deviation Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0086;
-    x->title="Foveal Sensitivity Measured";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0087;
-    x->title="Foveal Sensitivity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0088;
-    x->title="Visual Field Test Duration";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0089;
-    x->title="Visual Field Test Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0090;
-    x->title="Visual Field Test Point X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0091;
-    x->title="Visual Field Test Point Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0092;
-    x->title="Age Corrected Sensitivity Deviation Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0093;
-    x->title="Stimulus Results";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0094;
-    x->title="Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0095;
-    x->title="Retest Stimulus Seen";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0096;
-    x->title="Retest Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0097;
-    x->title="Visual Field Test Point Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0098;
-    x->title="Quantified Defect";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0100;
-    x->title="Age Corrected Sensitivity Deviation Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0102;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0103;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0104;
-    x->title="Generalized Defect Corrected Sensitivity Deviation Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0105;
-    x->title="Minimum Sensitivity Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0106;
-    x->title="Blind Spot Localized";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0107;
-    x->title="Blind Spot X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0108;
-    x->title="Blind Spot Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0110;
-    x->title="Visual Acuity Measurement Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0112;
-    x->title="Refractive Parameters Used on Patient Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0113;
-    x->title="Measurement Laterality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0114;
-    x->title="Ophthalmic Patient Clinical Information Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0115;
-    x->title="Ophthalmic Patient Clinical Information Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0117;
-    x->title="Foveal Point Normative Data Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0118;
-    x->title="Foveal Point Probability Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0120;
-    x->title="Screening Baseline Measured";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0122;
-    x->title="Screening Baseline Measured Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0124;
-    x->title="Screening Baseline Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0126;
-    x->title="Screening Baseline Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0202;
-    x->title="Algorithm Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0306;
-    x->title="Data Set Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0307;
-    x->title="Data Set Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0308;
-    x->title="Data Set Source";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0309;
-    x->title="Data Set Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0317;
-    x->title="Visual Field Test Reliability Global Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0320;
-    x->title="Visual Field Global Results Index Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0325;
-    x->title="Data Observation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0338;
-    x->title="Index Normals Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0341;
-    x->title="Index Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0024;
-    x->tag[1]=0x0344;
-    x->title="Index Probability Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0002;
-    x->title="Samples per Pixel";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0003;
-    x->title="Samples per Pixel Used";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0004;
-    x->title="Photometric Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0005;
-    x->title="Image Dimensions";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0006;
-    x->title="Planar Configuration";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0008;
-    x->title="Number of Frames";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0009;
-    x->title="Frame Increment Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x000A;
-    x->title="Frame Dimension Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0010;
-    x->title="Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0011;
-    x->title="Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0012;
-    x->title="Planes";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0014;
-    x->title="Ultrasound Color Data Present";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0020;
-    x->title="";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0030;
-    x->title="Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0031;
-    x->title="Zoom Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0032;
-    x->title="Zoom Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0034;
-    x->title="Pixel Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0040;
-    x->title="Image Format";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0050;
-    x->title="Manipulated Image";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0051;
-    x->title="Corrected Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x005F;
-    x->title="Compression Recognition Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0060;
-    x->title="Compression Code";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0061;
-    x->title="Compression Originator";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0062;
-    x->title="Compression Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0063;
-    x->title="Compression Description";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0065;
-    x->title="Compression Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0066;
-    x->title="Compression Step Pointers";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0068;
-    x->title="Repeat Interval";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0069;
-    x->title="Bits Grouped";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0070;
-    x->title="Perimeter Table";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0071;
-    x->title="Perimeter Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0080;
-    x->title="Predictor Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0081;
-    x->title="Predictor Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0082;
-    x->title="Predictor Constants";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0090;
-    x->title="Blocked Pixels";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0091;
-    x->title="Block Rows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0092;
-    x->title="Block Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0093;
-    x->title="Row Overlap";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0094;
-    x->title="Column Overlap";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0100;
-    x->title="Bits Allocated";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0101;
-    x->title="Bits Stored";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0102;
-    x->title="High Bit";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0103;
-    x->title="Pixel Representation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0104;
-    x->title="Smallest Valid Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0105;
-    x->title="Largest Valid Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0106;
-    x->title="Smallest Image Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0107;
-    x->title="Largest Image Pixel Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0108;
-    x->title="Smallest Pixel Value in Series";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0109;
-    x->title="Largest Pixel Value in Series";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0110;
-    x->title="Smallest Image Pixel Value in Plane";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0111;
-    x->title="Largest Image Pixel Value in Plane";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0120;
-    x->title="Pixel Padding Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0121;
-    x->title="Pixel Padding Range Limit";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0122;
-    x->title="Float Pixel Padding Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0123;
-    x->title="Double Float Pixel Padding Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0124;
-    x->title="Float Pixel Padding Range Limit";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0125;
-    x->title="Double Float Pixel Padding Range Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0200;
-    x->title="Image Location";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0300;
-    x->title="Quality Control Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0301;
-    x->title="Burned In Annotation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0302;
-    x->title="Recognizable Visual Features";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0303;
-    x->title="Longitudinal Temporal Information Modified";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0304;
-    x->title="Referenced Color Palette Instance UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0400;
-    x->title="Transform Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0401;
-    x->title="Transform Version Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0402;
-    x->title="Number of Transform Steps";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0403;
-    x->title="Sequence of Compressed Data";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0404;
-    x->title="Details of Coefficients";
-    x->vr="AT";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x0;
-    //x->title="Rows For Nth Order Coefficients";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x1;
-    //x->title="Columns For Nth Order Coefficients";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x2;
-    //x->title="Coefficient Coding";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x04x3;
-    //x->title="Coefficient Coding Pointers";
-    //x->vr="AT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0700;
-    x->title="DCT Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0701;
-    x->title="Data Block Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0702;
-    x->title="Data Block";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0710;
-    x->title="Normalization Factor Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0720;
-    x->title="Zonal Map Number Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0721;
-    x->title="Zonal Map Location";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0722;
-    x->title="Zonal Map Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0730;
-    x->title="Adaptive Map Format";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0740;
-    x->title="Code Number Format";
-    x->vr="US";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x0;
-    //x->title="Code Label";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x2;
-    //x->title="Number of Tables";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x3;
-    //x->title="Code Table Location";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x4;
-    //x->title="Bits For Code Word";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x0028;
-    //x->tag[1]=0x08x8;
-    //x->title="Image Data Location";
-    //x->vr="AT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0A02;
-    x->title="Pixel Spacing Calibration Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x0A04;
-    x->title="Pixel Spacing Calibration Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1040;
-    x->title="Pixel Intensity Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1041;
-    x->title="Pixel Intensity Relationship Sign";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1050;
-    x->title="Window Center";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1051;
-    x->title="Window Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1052;
-    x->title="Rescale Intercept";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1053;
-    x->title="Rescale Slope";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1054;
-    x->title="Rescale Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1055;
-    x->title="Window Center & Width Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1056;
-    x->title="VOI LUT Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1080;
-    x->title="Gray Scale";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1090;
-    x->title="Recommended Viewing Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1100;
-    x->title="Gray Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1101;
-    x->title="Red Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1102;
-    x->title="Green Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1103;
-    x->title="Blue Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1104;
-    x->title="Alpha Palette Color Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1111;
-    x->title="Large Red Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1112;
-    x->title="Large Green Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1113;
-    x->title="Large Blue Palette Color Lookup Table Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1199;
-    x->title="Palette Color Lookup Table UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1200;
-    x->title="Gray Lookup Table Data";
-    x->vr="SS or OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1201;
-    x->title="Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1202;
-    x->title="Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1203;
-    x->title="Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1204;
-    x->title="Alpha Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1211;
-    x->title="Large Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1212;
-    x->title="Large Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1213;
-    x->title="Large Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1214;
-    x->title="Large Palette Color Lookup Table UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1221;
-    x->title="Segmented Red Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1222;
-    x->title="Segmented Green Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1223;
-    x->title="Segmented Blue Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1224;
-    x->title="Segmented Alpha Palette Color Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1300;
-    x->title="Breast Implant Present";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1350;
-    x->title="Partial View";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1351;
-    x->title="Partial View Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1352;
-    x->title="Partial View Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x135A;
-    x->title="Spatial Locations Preserved";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1401;
-    x->title="Data Frame Assignment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1402;
-    x->title="Data Path Assignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1403;
-    x->title="Bits Mapped to Color Lookup Table";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1404;
-    x->title="Blending LUT 1 Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1405;
-    x->title="Blending LUT 1 Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1406;
-    x->title="Blending Weight Constant";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1407;
-    x->title="Blending Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1408;
-    x->title="Blending Lookup Table Data";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140B;
-    x->title="Enhanced Palette Color Lookup Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140C;
-    x->title="Blending LUT 2 Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140D;
-    x->title="Blending LUT 2 Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140E;
-    x->title="Data Path ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x140F;
-    x->title="RGB LUT Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x1410;
-    x->title="Alpha LUT Transfer Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2000;
-    x->title="ICC Profile";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2002;
-    x->title="Color Space";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2110;
-    x->title="Lossy Image Compression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2112;
-    x->title="Lossy Image Compression Ratio";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x2114;
-    x->title="Lossy Image Compression Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3000;
-    x->title="Modality LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3002;
-    x->title="LUT Descriptor";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3003;
-    x->title="LUT Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3004;
-    x->title="Modality LUT Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3006;
-    x->title="LUT Data";
-    x->vr="US or OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3010;
-    x->title="VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x3110;
-    x->title="Softcopy VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x4000;
-    x->title="Image Presentation Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x5000;
-    x->title="Bi-Plane Acquisition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6010;
-    x->title="Representative Frame Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6020;
-    x->title="Frame Numbers of Interest (FOI)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6022;
-    x->title="Frame of Interest Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6023;
-    x->title="Frame of Interest Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6030;
-    x->title="Mask Pointer(s)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6040;
-    x->title="R Wave Pointer";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6100;
-    x->title="Mask Subtraction Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6101;
-    x->title="Mask Operation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6102;
-    x->title="Applicable Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6110;
-    x->title="Mask Frame Numbers";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6112;
-    x->title="Contrast Frame Averaging";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6114;
-    x->title="Mask Sub-pixel Shift";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6120;
-    x->title="TID Offset";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x6190;
-    x->title="Mask Operation Explanation";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7000;
-    x->title="Equipment Administrator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7001;
-    x->title="Number of Display Subsystems";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7002;
-    x->title="Current Configuration ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7003;
-    x->title="Display Subsystem ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7004;
-    x->title="Display Subsystem Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7005;
-    x->title="Display Subsystem Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7006;
-    x->title="System Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7007;
-    x->title="System Status Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7008;
-    x->title="Target Luminance Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7009;
-    x->title="Luminance Characteristics ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700A;
-    x->title="Display Subsystem Configuration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700B;
-    x->title="Configuration ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700C;
-    x->title="Configuration Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700D;
-    x->title="Configuration Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700E;
-    x->title="Referenced Target Luminance Characteristics ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x700F;
-    x->title="QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7010;
-    x->title="Display Subsystem QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7011;
-    x->title="Configuration QA Results Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7012;
-    x->title="Measurement Equipment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7013;
-    x->title="Measurement Functions";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7014;
-    x->title="Measurement Equipment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7015;
-    x->title="Visual Evaluation Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7016;
-    x->title="Display Calibration Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7017;
-    x->title="DDL Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7018;
-    x->title="CIExy White Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7019;
-    x->title="Display Function Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701A;
-    x->title="Gamma Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701B;
-    x->title="Number of Luminance Points";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701C;
-    x->title="Luminance Response Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701D;
-    x->title="Target Minimum Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701E;
-    x->title="Target Maximum Luminance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x701F;
-    x->title="Luminance Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7020;
-    x->title="Luminance Response Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7021;
-    x->title="White Point Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7022;
-    x->title="Display Device Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7023;
-    x->title="Display Subsystem Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7024;
-    x->title="Luminance Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7025;
-    x->title="Ambient Light Value Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7026;
-    x->title="Measured Characteristics";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7027;
-    x->title="Luminance Uniformity Result Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7028;
-    x->title="Visual Evaluation Test Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7029;
-    x->title="Test Result";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702A;
-    x->title="Test Result Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702B;
-    x->title="Test Image Validation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702C;
-    x->title="Test Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702D;
-    x->title="Measurement Pattern Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x702E;
-    x->title="Visual Evaluation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x7FE0;
-    x->title="Pixel Data Provider URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9001;
-    x->title="Data Point Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9002;
-    x->title="Data Point Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9003;
-    x->title="Signal Domain Columns";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9099;
-    x->title="Largest Monochrome Pixel Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9108;
-    x->title="Data Representation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9110;
-    x->title="Pixel Measures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9132;
-    x->title="Frame VOI LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9145;
-    x->title="Pixel Value Transformation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9235;
-    x->title="Signal Domain Rows";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9411;
-    x->title="Display Filter Percentage";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9415;
-    x->title="Frame Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9416;
-    x->title="Subtraction Item ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9422;
-    x->title="Pixel Intensity Relationship LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9443;
-    x->title="Frame Pixel Data Properties Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9444;
-    x->title="Geometrical Properties";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9445;
-    x->title="Geometric Maximum Distortion";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9446;
-    x->title="Image Processing Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9454;
-    x->title="Mask Selection Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9474;
-    x->title="LUT Function";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9478;
-    x->title="Mask Visibility Percentage";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9501;
-    x->title="Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9502;
-    x->title="Region Pixel Shift Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9503;
-    x->title="Vertices of the Region";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9505;
-    x->title="Multi-frame Presentation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9506;
-    x->title="Pixel Shift Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9507;
-    x->title="LUT Frame Range";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9520;
-    x->title="Image to Equipment Mapping Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0028;
-    x->tag[1]=0x9537;
-    x->title="Equipment Coordinate System Identification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x000A;
-    x->title="Study Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x000C;
-    x->title="Study Priority ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0012;
-    x->title="Study ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0032;
-    x->title="Study Verified Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0033;
-    x->title="Study Verified Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0034;
-    x->title="Study Read Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x0035;
-    x->title="Study Read Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1000;
-    x->title="Scheduled Study Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1001;
-    x->title="Scheduled Study Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1010;
-    x->title="Scheduled Study Stop Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1011;
-    x->title="Scheduled Study Stop Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1020;
-    x->title="Scheduled Study Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1021;
-    x->title="Scheduled Study Location AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1030;
-    x->title="Reason for Study";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1031;
-    x->title="Requesting Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1032;
-    x->title="Requesting Physician";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1033;
-    x->title="Requesting Service";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1034;
-    x->title="Requesting Service Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1040;
-    x->title="Study Arrival Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1041;
-    x->title="Study Arrival Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1050;
-    x->title="Study Completion Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1051;
-    x->title="Study Completion Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1055;
-    x->title="Study Component Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1060;
-    x->title="Requested Procedure Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1064;
-    x->title="Requested Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x1070;
-    x->title="Requested Contrast Agent";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0032;
-    x->tag[1]=0x4000;
-    x->title="Study Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0004;
-    x->title="Referenced Patient Alias Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0008;
-    x->title="Visit Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0010;
-    x->title="Admission ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0011;
-    x->title="Issuer of Admission ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0014;
-    x->title="Issuer of Admission ID Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0016;
-    x->title="Route of Admissions";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001A;
-    x->title="Scheduled Admission Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001B;
-    x->title="Scheduled Admission Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001C;
-    x->title="Scheduled Discharge Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001D;
-    x->title="Scheduled Discharge Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x001E;
-    x->title="Scheduled Patient Institution Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0020;
-    x->title="Admitting Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0021;
-    x->title="Admitting Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0030;
-    x->title="Discharge Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0032;
-    x->title="Discharge Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0040;
-    x->title="Discharge Diagnosis Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0044;
-    x->title="Discharge Diagnosis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0050;
-    x->title="Special Needs";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0060;
-    x->title="Service Episode ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0061;
-    x->title="Issuer of Service Episode ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0062;
-    x->title="Service Episode Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0064;
-    x->title="Issuer of Service Episode ID Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0100;
-    x->title="Pertinent Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0101;
-    x->title="Pertinent Resources Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0102;
-    x->title="Resource Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0300;
-    x->title="Current Patient Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0400;
-    x->title="Patient's Institution Residence";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0500;
-    x->title="Patient State";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x0502;
-    x->title="Patient Clinical Trial Participation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0038;
-    x->tag[1]=0x4000;
-    x->title="Visit Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0004;
-    x->title="Waveform Originality";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0005;
-    x->title="Number of Waveform Channels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0010;
-    x->title="Number of Waveform Samples";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x001A;
-    x->title="Sampling Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0020;
-    x->title="Multiplex Group Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0200;
-    x->title="Channel Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0202;
-    x->title="Waveform Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0203;
-    x->title="Channel Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0205;
-    x->title="Channel Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0208;
-    x->title="Channel Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0209;
-    x->title="Channel Source Modifiers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x020A;
-    x->title="Source Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x020C;
-    x->title="Channel Derivation Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0210;
-    x->title="Channel Sensitivity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0211;
-    x->title="Channel Sensitivity Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0212;
-    x->title="Channel Sensitivity Correction Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0213;
-    x->title="Channel Baseline";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0214;
-    x->title="Channel Time Skew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0215;
-    x->title="Channel Sample Skew";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0218;
-    x->title="Channel Offset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x021A;
-    x->title="Waveform Bits Stored";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0220;
-    x->title="Filter Low Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0221;
-    x->title="Filter High Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0222;
-    x->title="Notch Filter Frequency";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0223;
-    x->title="Notch Filter Bandwidth";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0230;
-    x->title="Waveform Data Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0231;
-    x->title="Waveform Display Background CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0240;
-    x->title="Waveform Presentation Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0241;
-    x->title="Presentation Group Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0242;
-    x->title="Channel Display Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0244;
-    x->title="Channel Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0245;
-    x->title="Channel Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0246;
-    x->title="Display Shading Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0247;
-    x->title="Fractional Channel Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0248;
-    x->title="Absolute Channel Display Scale";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0300;
-    x->title="Multiplexed Audio Channels Description Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0301;
-    x->title="Channel Identification Code";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x003A;
-    x->tag[1]=0x0302;
-    x->title="Channel Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0001;
-    x->title="Scheduled Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0002;
-    x->title="Scheduled Procedure Step Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0003;
-    x->title="Scheduled Procedure Step Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0004;
-    x->title="Scheduled Procedure Step End Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0005;
-    x->title="Scheduled Procedure Step End Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0006;
-    x->title="Scheduled Performing Physician's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0007;
-    x->title="Scheduled Procedure Step Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0008;
-    x->title="Scheduled Protocol Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0009;
-    x->title="Scheduled Procedure Step ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x000A;
-    x->title="Stage Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x000B;
-    x->title="Scheduled Performing Physician Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0010;
-    x->title="Scheduled Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0011;
-    x->title="Scheduled Procedure Step Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0012;
-    x->title="Pre-Medication";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0020;
-    x->title="Scheduled Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0026;
-    x->title="Order Placer Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0027;
-    x->title="Order Filler Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0031;
-    x->title="Local Namespace Entity ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0032;
-    x->title="Universal Entity ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0033;
-    x->title="Universal Entity ID Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0035;
-    x->title="Identifier Type Code";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0036;
-    x->title="Assigning Facility Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0039;
-    x->title="Assigning Jurisdiction Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x003A;
-    x->title="Assigning Agency or Department Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0100;
-    x->title="Scheduled Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0220;
-    x->title="Referenced Non-Image Composite SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0241;
-    x->title="Performed Station AE Title";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0242;
-    x->title="Performed Station Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0243;
-    x->title="Performed Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0244;
-    x->title="Performed Procedure Step Start Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0245;
-    x->title="Performed Procedure Step Start Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0250;
-    x->title="Performed Procedure Step End Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0251;
-    x->title="Performed Procedure Step End Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0252;
-    x->title="Performed Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0253;
-    x->title="Performed Procedure Step ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0254;
-    x->title="Performed Procedure Step Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0255;
-    x->title="Performed Procedure Type Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0260;
-    x->title="Performed Protocol Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0261;
-    x->title="Performed Protocol Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0270;
-    x->title="Scheduled Step Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0275;
-    x->title="Request Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0280;
-    x->title="Comments on the Performed Procedure Step";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0281;
-    x->title="Performed Procedure Step Discontinuation Reason Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0293;
-    x->title="Quantity Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0294;
-    x->title="Quantity";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0295;
-    x->title="Measuring Units Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0296;
-    x->title="Billing Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0300;
-    x->title="Total Time of Fluoroscopy";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0301;
-    x->title="Total Number of Exposures";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0302;
-    x->title="Entrance Dose";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0303;
-    x->title="Exposed Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0306;
-    x->title="Distance Source to Entrance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0307;
-    x->title="Distance Source to Support";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x030E;
-    x->title="Exposure Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0310;
-    x->title="Comments on Radiation Dose";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0312;
-    x->title="X-Ray Output";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0314;
-    x->title="Half Value Layer";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0316;
-    x->title="Organ Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0318;
-    x->title="Organ Exposed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0320;
-    x->title="Billing Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0321;
-    x->title="Film Consumption Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0324;
-    x->title="Billing Supplies and Devices Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0330;
-    x->title="Referenced Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0340;
-    x->title="Performed Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0400;
-    x->title="Comments on the Scheduled Procedure Step";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0440;
-    x->title="Protocol Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0441;
-    x->title="Content Item Modifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0500;
-    x->title="Scheduled Specimen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x050A;
-    x->title="Specimen Accession Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0512;
-    x->title="Container Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0513;
-    x->title="Issuer of the Container Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0515;
-    x->title="Alternate Container Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0518;
-    x->title="Container Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x051A;
-    x->title="Container Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0520;
-    x->title="Container Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0550;
-    x->title="Specimen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0551;
-    x->title="Specimen Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0552;
-    x->title="Specimen Description Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0553;
-    x->title="Specimen Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0554;
-    x->title="Specimen UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0555;
-    x->title="Acquisition Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0556;
-    x->title="Acquisition Context Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x059A;
-    x->title="Specimen Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0560;
-    x->title="Specimen Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0562;
-    x->title="Issuer of the Specimen Identifier Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0600;
-    x->title="Specimen Short Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0602;
-    x->title="Specimen Detailed Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0610;
-    x->title="Specimen Preparation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0612;
-    x->title="Specimen Preparation Step Content Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x0620;
-    x->title="Specimen Localization Content Item Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x06FA;
-    x->title="Slide Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x071A;
-    x->title="Image Center Point Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x072A;
-    x->title="X Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x073A;
-    x->title="Y Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x074A;
-    x->title="Z Offset in Slide Coordinate System";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08D8;
-    x->title="Pixel Spacing Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08DA;
-    x->title="Coordinate System Axis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x08EA;
-    x->title="Measurement Units Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x09F8;
-    x->title="Vital Stain Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1001;
-    x->title="Requested Procedure ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1002;
-    x->title="Reason for the Requested Procedure";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1003;
-    x->title="Requested Procedure Priority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1004;
-    x->title="Patient Transport Arrangements";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1005;
-    x->title="Requested Procedure Location";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1006;
-    x->title="Placer Order Number / Procedure";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1007;
-    x->title="Filler Order Number / Procedure";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1008;
-    x->title="Confidentiality Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1009;
-    x->title="Reporting Priority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x100A;
-    x->title="Reason for Requested Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1010;
-    x->title="Names of Intended Recipients of Results";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1011;
-    x->title="Intended Recipients of Results Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1012;
-    x->title="Reason For Performed Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1060;
-    x->title="Requested Procedure Description (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1101;
-    x->title="Person Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1102;
-    x->title="Person's Address";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1103;
-    x->title="Person's Telephone Numbers";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1104;
-    x->title="Person's Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x1400;
-    x->title="Requested Procedure Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2001;
-    x->title="Reason for the Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2004;
-    x->title="Issue Date of Imaging Service Request";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2005;
-    x->title="Issue Time of Imaging Service Request";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2006;
-    x->title="Placer Order Number / Imaging Service Request (Retired)";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2007;
-    x->title="Filler Order Number / Imaging Service Request (Retired)";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2008;
-    x->title="Order Entered By";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2009;
-    x->title="Order Enterer's Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2010;
-    x->title="Order Callback Phone Number";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2011;
-    x->title="Order Callback Telecom Information";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2016;
-    x->title="Placer Order Number / Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2017;
-    x->title="Filler Order Number / Imaging Service Request";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x2400;
-    x->title="Imaging Service Request Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x3001;
-    x->title="Confidentiality Constraint on Patient Data Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4001;
-    x->title="General Purpose Scheduled Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4002;
-    x->title="General Purpose Performed Procedure Step Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4003;
-    x->title="General Purpose Scheduled Procedure Step Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4004;
-    x->title="Scheduled Processing Applications Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4005;
-    x->title="Scheduled Procedure Step Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4006;
-    x->title="Multiple Copies Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4007;
-    x->title="Performed Processing Applications Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4009;
-    x->title="Human Performer Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4010;
-    x->title="Scheduled Procedure Step Modification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4011;
-    x->title="Expected Completion DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4015;
-    x->title="Resulting General Purpose Performed Procedure Steps Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4016;
-    x->title="Referenced General Purpose Scheduled Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4018;
-    x->title="Scheduled Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4019;
-    x->title="Performed Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4020;
-    x->title="Input Availability Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4021;
-    x->title="Input Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4022;
-    x->title="Relevant Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4023;
-    x->title="Referenced General Purpose Scheduled Procedure Step Transaction UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4025;
-    x->title="Scheduled Station Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4026;
-    x->title="Scheduled Station Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4027;
-    x->title="Scheduled Station Geographic Location Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4028;
-    x->title="Performed Station Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4029;
-    x->title="Performed Station Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4030;
-    x->title="Performed Station Geographic Location Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4031;
-    x->title="Requested Subsequent Workitem Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4032;
-    x->title="Non-DICOM Output Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4033;
-    x->title="Output Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4034;
-    x->title="Scheduled Human Performers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4035;
-    x->title="Actual Human Performers Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4036;
-    x->title="Human Performer's Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4037;
-    x->title="Human Performer's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4040;
-    x->title="Raw Data Handling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4041;
-    x->title="Input Readiness State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4050;
-    x->title="Performed Procedure Step Start DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4051;
-    x->title="Performed Procedure Step End DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4052;
-    x->title="Procedure Step Cancellation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4070;
-    x->title="Output Destination Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4071;
-    x->title="DICOM Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4072;
-    x->title="STOW-RS Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4073;
-    x->title="Storage URL";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x4074;
-    x->title="XDS Storage Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x8302;
-    x->title="Entrance Dose in mGy";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9092;
-    x->title="Parametric Map Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9094;
-    x->title="Referenced Image Real World Value Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9096;
-    x->title="Real World Value Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9098;
-    x->title="Pixel Value Mapping Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9210;
-    x->title="LUT Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9211;
-    x->title="Real World Value Last Value Mapped";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9212;
-    x->title="Real World Value LUT Data";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9213;
-    x->title="Double Float Real World Value Last Value Mapped";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9214;
-    x->title="Double Float Real World Value First Value Mapped";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9216;
-    x->title="Real World Value First Value Mapped";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9220;
-    x->title="Quantity Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9224;
-    x->title="Real World Value Intercept";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0x9225;
-    x->title="Real World Value Slope";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA007;
-    x->title="Findings Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA010;
-    x->title="Relationship Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA020;
-    x->title="Findings Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA021;
-    x->title="Findings Group UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA022;
-    x->title="Referenced Findings Group UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA023;
-    x->title="Findings Group Recording Date (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA024;
-    x->title="Findings Group Recording Time (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA026;
-    x->title="Findings Source Category Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA027;
-    x->title="Verifying Organization";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA028;
-    x->title="Documenting Organization Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA030;
-    x->title="Verification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA032;
-    x->title="Observation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA040;
-    x->title="Value Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA043;
-    x->title="Concept Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA047;
-    x->title="Measurement Precision Description (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA050;
-    x->title="Continuity Of Content";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA057;
-    x->title="Urgency or Priority Alerts (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA060;
-    x->title="Sequencing Indicator (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA066;
-    x->title="Document Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA067;
-    x->title="Document Author (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA068;
-    x->title="Document Author Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA070;
-    x->title="Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA073;
-    x->title="Verifying Observer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA074;
-    x->title="Object Binary Identifier (Trial)";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA075;
-    x->title="Verifying Observer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA076;
-    x->title="Documenting Observer Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA078;
-    x->title="Author Observer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA07A;
-    x->title="Participant Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA07C;
-    x->title="Custodial Organization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA080;
-    x->title="Participation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA082;
-    x->title="Participation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA084;
-    x->title="Observer Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA085;
-    x->title="Procedure Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA088;
-    x->title="Verifying Observer Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA089;
-    x->title="Object Directory Binary Identifier (Trial)";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA090;
-    x->title="Equivalent CDA Document Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA0B0;
-    x->title="Referenced Waveform Channels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA110;
-    x->title="Date of Document or Verbal Transaction (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA112;
-    x->title="Time of Document Creation or Verbal Transaction (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA120;
-    x->title="DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA121;
-    x->title="Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA122;
-    x->title="Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA123;
-    x->title="Person Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA124;
-    x->title="UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA125;
-    x->title="Report Status ID (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA130;
-    x->title="Temporal Range Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA132;
-    x->title="Referenced Sample Positions";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA136;
-    x->title="Referenced Frame Numbers";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA138;
-    x->title="Referenced Time Offsets";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA13A;
-    x->title="Referenced DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA160;
-    x->title="Text Value";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA161;
-    x->title="Floating Point Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA162;
-    x->title="Rational Numerator Value";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA163;
-    x->title="Rational Denominator Value";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA167;
-    x->title="Observation Category Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA168;
-    x->title="Concept Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA16A;
-    x->title="Bibliographic Citation (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA170;
-    x->title="Purpose of Reference Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA171;
-    x->title="Observation UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA172;
-    x->title="Referenced Observation UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA173;
-    x->title="Referenced Observation Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA174;
-    x->title="Referenced Object Observation Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA180;
-    x->title="Annotation Group Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA192;
-    x->title="Observation Date (Trial)";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA193;
-    x->title="Observation Time (Trial)";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA194;
-    x->title="Measurement Automation (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA195;
-    x->title="Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA224;
-    x->title="Identification Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA290;
-    x->title="Coordinates Set Geometric Type (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA296;
-    x->title="Algorithm Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA297;
-    x->title="Algorithm Description (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA29A;
-    x->title="Pixel Coordinates Set (Trial)";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA300;
-    x->title="Measured Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA301;
-    x->title="Numeric Value Qualifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA307;
-    x->title="Current Observer (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA30A;
-    x->title="Numeric Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA313;
-    x->title="Referenced Accession Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA33A;
-    x->title="Report Status Comment (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA340;
-    x->title="Procedure Context Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA352;
-    x->title="Verbal Source (Trial)";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA353;
-    x->title="Address (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA354;
-    x->title="Telephone Number (Trial)";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA358;
-    x->title="Verbal Source Identifier Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA360;
-    x->title="Predecessor Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA370;
-    x->title="Referenced Request Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA372;
-    x->title="Performed Procedure Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA375;
-    x->title="Current Requested Procedure Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA380;
-    x->title="Report Detail Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA385;
-    x->title="Pertinent Other Evidence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA390;
-    x->title="HL7 Structured Document Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA402;
-    x->title="Observation Subject UID (Trial)";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA403;
-    x->title="Observation Subject Class (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA404;
-    x->title="Observation Subject Type Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA491;
-    x->title="Completion Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA492;
-    x->title="Completion Flag Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA493;
-    x->title="Verification Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA494;
-    x->title="Archive Requested";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA496;
-    x->title="Preliminary Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA504;
-    x->title="Content Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA525;
-    x->title="Identical Documents Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA600;
-    x->title="Observation Subject Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA601;
-    x->title="Observer Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA603;
-    x->title="Procedure Context Flag (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA730;
-    x->title="Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA731;
-    x->title="Relationship Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA732;
-    x->title="Relationship Type Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA744;
-    x->title="Language Code Sequence (Trial)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xA992;
-    x->title="Uniform Resource Locator (Trial)";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xB020;
-    x->title="Waveform Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB00;
-    x->title="Template Identifier";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB06;
-    x->title="Template Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB07;
-    x->title="Template Local Version";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0B;
-    x->title="Template Extension Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0C;
-    x->title="Template Extension Organization UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB0D;
-    x->title="Template Extension Creator UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xDB73;
-    x->title="Referenced Content Item Identifier";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE001;
-    x->title="HL7 Instance Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE004;
-    x->title="HL7 Document Effective Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE006;
-    x->title="HL7 Document Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE008;
-    x->title="Document Class Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE010;
-    x->title="Retrieve URI";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE011;
-    x->title="Retrieve Location UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE020;
-    x->title="Type of Instances";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE021;
-    x->title="DICOM Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE022;
-    x->title="DICOM Media Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE023;
-    x->title="WADO Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE024;
-    x->title="XDS Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE025;
-    x->title="WADO-RS Retrieval Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE030;
-    x->title="Repository Unique ID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0040;
-    x->tag[1]=0xE031;
-    x->title="Home Community ID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0010;
-    x->title="Document Title";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0011;
-    x->title="Encapsulated Document";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0012;
-    x->title="MIME Type of Encapsulated Document";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0013;
-    x->title="Source Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0042;
-    x->tag[1]=0x0014;
-    x->title="List of MIME Types";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0001;
-    x->title="Product Package Identifier";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0002;
-    x->title="Substance Administration Approval";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0003;
-    x->title="Approval Status Further Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0004;
-    x->title="Approval Status DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0007;
-    x->title="Product Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0008;
-    x->title="Product Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0009;
-    x->title="Product Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x000A;
-    x->title="Product Lot Identifier";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x000B;
-    x->title="Product Expiration DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0010;
-    x->title="Substance Administration DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0011;
-    x->title="Substance Administration Notes";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0012;
-    x->title="Substance Administration Device ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0013;
-    x->title="Product Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0044;
-    x->tag[1]=0x0019;
-    x->title="Substance Administration Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0012;
-    x->title="Lens Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0014;
-    x->title="Right Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0015;
-    x->title="Left Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0016;
-    x->title="Unspecified Laterality Lens Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0018;
-    x->title="Cylinder Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0028;
-    x->title="Prism Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0030;
-    x->title="Horizontal Prism Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0032;
-    x->title="Horizontal Prism Base";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0034;
-    x->title="Vertical Prism Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0036;
-    x->title="Vertical Prism Base";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0038;
-    x->title="Lens Segment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0040;
-    x->title="Optical Transmittance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0042;
-    x->title="Channel Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0044;
-    x->title="Pupil Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0046;
-    x->title="Corneal Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0050;
-    x->title="Autorefraction Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0052;
-    x->title="Autorefraction Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0060;
-    x->title="Distance Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0062;
-    x->title="Near Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0063;
-    x->title="Intermediate Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0064;
-    x->title="Other Pupillary Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0070;
-    x->title="Keratometry Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0071;
-    x->title="Keratometry Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0074;
-    x->title="Steep Keratometric Axis Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0075;
-    x->title="Radius of Curvature";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0076;
-    x->title="Keratometric Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0077;
-    x->title="Keratometric Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0080;
-    x->title="Flat Keratometric Axis Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0092;
-    x->title="Background Color";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0094;
-    x->title="Optotype";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0095;
-    x->title="Optotype Presentation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0097;
-    x->title="Subjective Refraction Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0098;
-    x->title="Subjective Refraction Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0100;
-    x->title="Add Near Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0101;
-    x->title="Add Intermediate Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0102;
-    x->title="Add Other Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0104;
-    x->title="Add Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0106;
-    x->title="Viewing Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0121;
-    x->title="Visual Acuity Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0122;
-    x->title="Visual Acuity Right Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0123;
-    x->title="Visual Acuity Left Eye Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0124;
-    x->title="Visual Acuity Both Eyes Open Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0125;
-    x->title="Viewing Distance Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0135;
-    x->title="Visual Acuity Modifiers";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0137;
-    x->title="Decimal Visual Acuity";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0139;
-    x->title="Optotype Detailed Definition";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0145;
-    x->title="Referenced Refractive Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0146;
-    x->title="Sphere Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0147;
-    x->title="Cylinder Power";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0201;
-    x->title="Corneal Topography Surface";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0202;
-    x->title="Corneal Vertex Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0203;
-    x->title="Pupil Centroid X-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0204;
-    x->title="Pupil Centroid Y-Coordinate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0205;
-    x->title="Equivalent Pupil Radius";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0207;
-    x->title="Corneal Topography Map Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0208;
-    x->title="Vertices of the Outline of Pupil";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0210;
-    x->title="Corneal Topography Mapping Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0211;
-    x->title="Maximum Corneal Curvature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0212;
-    x->title="Maximum Corneal Curvature";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0213;
-    x->title="Maximum Corneal Curvature Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0215;
-    x->title="Minimum Keratometric Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0218;
-    x->title="Simulated Keratometric Cylinder Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0220;
-    x->title="Average Corneal Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0224;
-    x->title="Corneal I-S Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0227;
-    x->title="Analyzed Area";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0230;
-    x->title="Surface Regularity Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0232;
-    x->title="Surface Asymmetry Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0234;
-    x->title="Corneal Eccentricity Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0236;
-    x->title="Keratoconus Prediction Index";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0238;
-    x->title="Decimal Potential Visual Acuity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0242;
-    x->title="Corneal Topography Map Quality Evaluation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0244;
-    x->title="Source Image Corneal Processed Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0247;
-    x->title="Corneal Point Location";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0248;
-    x->title="Corneal Point Estimated";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0249;
-    x->title="Axial Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0250;
-    x->title="Tangential Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0251;
-    x->title="Refractive Power";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0252;
-    x->title="Relative Elevation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0046;
-    x->tag[1]=0x0253;
-    x->title="Corneal Wavefront";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0001;
-    x->title="Imaged Volume Width";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0002;
-    x->title="Imaged Volume Height";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0003;
-    x->title="Imaged Volume Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0006;
-    x->title="Total Pixel Matrix Columns";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0007;
-    x->title="Total Pixel Matrix Rows";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0008;
-    x->title="Total Pixel Matrix Origin Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0010;
-    x->title="Specimen Label in Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0011;
-    x->title="Focus Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0012;
-    x->title="Extended Depth of Field";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0013;
-    x->title="Number of Focal Planes";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0014;
-    x->title="Distance Between Focal Planes";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0015;
-    x->title="Recommended Absent Pixel CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0100;
-    x->title="Illuminator Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0102;
-    x->title="Image Orientation (Slide)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0105;
-    x->title="Optical Path Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0106;
-    x->title="Optical Path Identifier";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0107;
-    x->title="Optical Path Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0108;
-    x->title="Illumination Color Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0110;
-    x->title="Specimen Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0111;
-    x->title="Condenser Lens Power";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0112;
-    x->title="Objective Lens Power";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0113;
-    x->title="Objective Lens Numerical Aperture";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0120;
-    x->title="Palette Color Lookup Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0200;
-    x->title="Referenced Image Navigation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0201;
-    x->title="Top Left Hand Corner of Localizer Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0202;
-    x->title="Bottom Right Hand Corner of Localizer Area";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0207;
-    x->title="Optical Path Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021A;
-    x->title="Plane Position (Slide) Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021E;
-    x->title="Column Position In Total Image Pixel Matrix";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x021F;
-    x->title="Row Position In Total Image Pixel Matrix";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0048;
-    x->tag[1]=0x0301;
-    x->title="Pixel Origin Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0004;
-    x->title="Calibration Image";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0010;
-    x->title="Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0012;
-    x->title="Container Component Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0013;
-    x->title="Container Component Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0014;
-    x->title="Device Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0015;
-    x->title="Container Component Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0016;
-    x->title="Device Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0017;
-    x->title="Device Diameter Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0018;
-    x->title="Device Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0019;
-    x->title="Inter-Marker Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001A;
-    x->title="Container Component Material";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001B;
-    x->title="Container Component ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001C;
-    x->title="Container Component Length";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001D;
-    x->title="Container Component Diameter";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x001E;
-    x->title="Container Component Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0050;
-    x->tag[1]=0x0020;
-    x->title="Device Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0001;
-    x->title="Contrast/Bolus Ingredient Percent by Volume";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0002;
-    x->title="OCT Focal Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0003;
-    x->title="Beam Spot Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0004;
-    x->title="Effective Refractive Index";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0006;
-    x->title="OCT Acquisition Domain";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0007;
-    x->title="OCT Optical Center Wavelength";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0008;
-    x->title="Axial Resolution";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0009;
-    x->title="Ranging Depth";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0011;
-    x->title="A-line Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0012;
-    x->title="A-lines Per Frame";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0013;
-    x->title="Catheter Rotational Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0014;
-    x->title="A-line Pixel Spacing";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0016;
-    x->title="Mode of Percutaneous Access Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0025;
-    x->title="Intravascular OCT Frame Type Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0026;
-    x->title="OCT Z Offset Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0027;
-    x->title="Intravascular Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0028;
-    x->title="Intravascular Longitudinal Distance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0029;
-    x->title="Intravascular OCT Frame Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0030;
-    x->title="OCT Z Offset Correction";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0031;
-    x->title="Catheter Direction of Rotation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0033;
-    x->title="Seam Line Location";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0034;
-    x->title="First A-line Location";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0036;
-    x->title="Seam Line Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0038;
-    x->title="Number of Padded A-lines";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x0039;
-    x->title="Interpolation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0052;
-    x->tag[1]=0x003A;
-    x->title="Refractive Index Applied";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0010;
-    x->title="Energy Window Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0011;
-    x->title="Number of Energy Windows";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0012;
-    x->title="Energy Window Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0013;
-    x->title="Energy Window Range Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0014;
-    x->title="Energy Window Lower Limit";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0015;
-    x->title="Energy Window Upper Limit";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0016;
-    x->title="Radiopharmaceutical Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0017;
-    x->title="Residual Syringe Counts";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0018;
-    x->title="Energy Window Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0020;
-    x->title="Detector Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0021;
-    x->title="Number of Detectors";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0022;
-    x->title="Detector Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0030;
-    x->title="Phase Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0031;
-    x->title="Number of Phases";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0032;
-    x->title="Phase Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0033;
-    x->title="Number of Frames in Phase";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0036;
-    x->title="Phase Delay";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0038;
-    x->title="Pause Between Frames";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0039;
-    x->title="Phase Description";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0050;
-    x->title="Rotation Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0051;
-    x->title="Number of Rotations";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0052;
-    x->title="Rotation Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0053;
-    x->title="Number of Frames in Rotation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0060;
-    x->title="R-R Interval Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0061;
-    x->title="Number of R-R Intervals";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0062;
-    x->title="Gated Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0063;
-    x->title="Data Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0070;
-    x->title="Time Slot Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0071;
-    x->title="Number of Time Slots";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0072;
-    x->title="Time Slot Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0073;
-    x->title="Time Slot Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0080;
-    x->title="Slice Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0081;
-    x->title="Number of Slices";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0090;
-    x->title="Angular View Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0100;
-    x->title="Time Slice Vector";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0101;
-    x->title="Number of Time Slices";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0200;
-    x->title="Start Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0202;
-    x->title="Type of Detector Motion";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0210;
-    x->title="Trigger Vector";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0211;
-    x->title="Number of Triggers in Phase";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0220;
-    x->title="View Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0222;
-    x->title="View Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0300;
-    x->title="Radionuclide Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0302;
-    x->title="Administration Route Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0304;
-    x->title="Radiopharmaceutical Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0306;
-    x->title="Calibration Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0308;
-    x->title="Energy Window Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0400;
-    x->title="Image ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0410;
-    x->title="Patient Orientation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0412;
-    x->title="Patient Orientation Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0414;
-    x->title="Patient Gantry Relationship Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0500;
-    x->title="Slice Progression Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x0501;
-    x->title="Scan Progression Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1000;
-    x->title="Series Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1001;
-    x->title="Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1002;
-    x->title="Counts Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1004;
-    x->title="Reprojection Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1006;
-    x->title="SUV Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1100;
-    x->title="Randoms Correction Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1101;
-    x->title="Attenuation Correction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1102;
-    x->title="Decay Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1103;
-    x->title="Reconstruction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1104;
-    x->title="Detector Lines of Response Used";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1105;
-    x->title="Scatter Correction Method";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1200;
-    x->title="Axial Acceptance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1201;
-    x->title="Axial Mash";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1202;
-    x->title="Transverse Mash";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1203;
-    x->title="Detector Element Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1210;
-    x->title="Coincidence Window Width";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1220;
-    x->title="Secondary Counts Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1300;
-    x->title="Frame Reference Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1310;
-    x->title="Primary (Prompts) Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1311;
-    x->title="Secondary Counts Accumulated";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1320;
-    x->title="Slice Sensitivity Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1321;
-    x->title="Decay Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1322;
-    x->title="Dose Calibration Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1323;
-    x->title="Scatter Fraction Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1324;
-    x->title="Dead Time Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1330;
-    x->title="Image Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1400;
-    x->title="Counts Included";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0054;
-    x->tag[1]=0x1401;
-    x->title="Dead Time Correction Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3000;
-    x->title="Histogram Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3002;
-    x->title="Histogram Number of Bins";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3004;
-    x->title="Histogram First Bin Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3006;
-    x->title="Histogram Last Bin Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3008;
-    x->title="Histogram Bin Width";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3010;
-    x->title="Histogram Explanation";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0060;
-    x->tag[1]=0x3020;
-    x->title="Histogram Data";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0001;
-    x->title="Segmentation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0002;
-    x->title="Segment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0003;
-    x->title="Segmented Property Category Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0004;
-    x->title="Segment Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0005;
-    x->title="Segment Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0006;
-    x->title="Segment Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0008;
-    x->title="Segment Algorithm Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0009;
-    x->title="Segment Algorithm Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000A;
-    x->title="Segment Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000B;
-    x->title="Referenced Segment Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000C;
-    x->title="Recommended Display Grayscale Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000D;
-    x->title="Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000E;
-    x->title="Maximum Fractional Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x000F;
-    x->title="Segmented Property Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0010;
-    x->title="Segmentation Fractional Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0011;
-    x->title="Segmented Property Type Modifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0012;
-    x->title="Used Segments Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0020;
-    x->title="Tracking ID";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0062;
-    x->tag[1]=0x0021;
-    x->title="Tracking UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0002;
-    x->title="Deformable Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0003;
-    x->title="Source Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0005;
-    x->title="Deformable Registration Grid Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0007;
-    x->title="Grid Dimensions";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0008;
-    x->title="Grid Resolution";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0009;
-    x->title="Vector Grid Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x000F;
-    x->title="Pre Deformation Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0064;
-    x->tag[1]=0x0010;
-    x->title="Post Deformation Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0001;
-    x->title="Number of Surfaces";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0002;
-    x->title="Surface Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0003;
-    x->title="Surface Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0004;
-    x->title="Surface Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0009;
-    x->title="Surface Processing";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000A;
-    x->title="Surface Processing Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000B;
-    x->title="Surface Processing Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000C;
-    x->title="Recommended Presentation Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000D;
-    x->title="Recommended Presentation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x000E;
-    x->title="Finite Volume";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0010;
-    x->title="Manifold";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0011;
-    x->title="Surface Points Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0012;
-    x->title="Surface Points Normals Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0013;
-    x->title="Surface Mesh Primitives Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0015;
-    x->title="Number of Surface Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0016;
-    x->title="Point Coordinates Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0017;
-    x->title="Point Position Accuracy";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0018;
-    x->title="Mean Point Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0019;
-    x->title="Maximum Point Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001A;
-    x->title="Points Bounding Box Coordinates";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001B;
-    x->title="Axis of Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001C;
-    x->title="Center of Rotation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001E;
-    x->title="Number of Vectors";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x001F;
-    x->title="Vector Dimensionality";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0020;
-    x->title="Vector Accuracy";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0021;
-    x->title="Vector Coordinate Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0023;
-    x->title="Triangle Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0024;
-    x->title="Edge Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0025;
-    x->title="Vertex Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0026;
-    x->title="Triangle Strip Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0027;
-    x->title="Triangle Fan Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0028;
-    x->title="Line Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0029;
-    x->title="Primitive Point Index List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002A;
-    x->title="Surface Count";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002B;
-    x->title="Referenced Surface Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002C;
-    x->title="Referenced Surface Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002D;
-    x->title="Segment Surface Generation Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002E;
-    x->title="Segment Surface Source Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x002F;
-    x->title="Algorithm Family Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0030;
-    x->title="Algorithm Name Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0031;
-    x->title="Algorithm Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0032;
-    x->title="Algorithm Parameters";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0034;
-    x->title="Facet Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0035;
-    x->title="Surface Processing Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0036;
-    x->title="Algorithm Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0037;
-    x->title="Recommended Point Radius";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0038;
-    x->title="Recommended Line Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0040;
-    x->title="Long Primitive Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0041;
-    x->title="Long Triangle Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0042;
-    x->title="Long Edge Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0043;
-    x->title="Long Vertex Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0101;
-    x->title="Track Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0102;
-    x->title="Track Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0103;
-    x->title="Recommended Display CIELab Value List";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0104;
-    x->title="Tracking Algorithm Identification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0105;
-    x->title="Track Set Number";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0106;
-    x->title="Track Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0107;
-    x->title="Track Set Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0108;
-    x->title="Track Set Anatomical Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0121;
-    x->title="Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0124;
-    x->title="Track Set Statistics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0125;
-    x->title="Floating Point Values";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0129;
-    x->title="Track Point Index List";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0130;
-    x->title="Track Statistics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0132;
-    x->title="Measurement Values Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0133;
-    x->title="Diffusion Acquisition Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0066;
-    x->tag[1]=0x0134;
-    x->title="Diffusion Model Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6210;
-    x->title="Implant Size";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6221;
-    x->title="Implant Template Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6222;
-    x->title="Replaced Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6223;
-    x->title="Implant Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6224;
-    x->title="Derivation Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6225;
-    x->title="Original Implant Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6226;
-    x->title="Effective DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6230;
-    x->title="Implant Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6260;
-    x->title="Information From Manufacturer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6265;
-    x->title="Notification From Manufacturer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6270;
-    x->title="Information Issue DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6280;
-    x->title="Information Summary";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62A0;
-    x->title="Implant Regulatory Disapproval Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62A5;
-    x->title="Overall Template Spatial Tolerance";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62C0;
-    x->title="HPGL Document Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62D0;
-    x->title="HPGL Document ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62D5;
-    x->title="HPGL Document Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62E0;
-    x->title="View Orientation Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62F0;
-    x->title="View Orientation Modifier";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x62F2;
-    x->title="HPGL Document Scaling";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6300;
-    x->title="HPGL Document";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6310;
-    x->title="HPGL Contour Pen Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6320;
-    x->title="HPGL Pen Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6330;
-    x->title="HPGL Pen Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6340;
-    x->title="HPGL Pen Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6345;
-    x->title="HPGL Pen Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6346;
-    x->title="Recommended Rotation Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6347;
-    x->title="Bounding Rectangle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6350;
-    x->title="Implant Template 3D Model Surface Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6360;
-    x->title="Surface Model Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6380;
-    x->title="Surface Model Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6390;
-    x->title="Surface Model Scaling Factor";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A0;
-    x->title="Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A4;
-    x->title="Coating Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63A8;
-    x->title="Implant Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63AC;
-    x->title="Fixation Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63B0;
-    x->title="Mating Feature Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63C0;
-    x->title="Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63D0;
-    x->title="Mating Feature Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63E0;
-    x->title="Mating Feature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x63F0;
-    x->title="Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6400;
-    x->title="Mating Feature Degree of Freedom Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6410;
-    x->title="Degree of Freedom ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6420;
-    x->title="Degree of Freedom Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6430;
-    x->title="2D Mating Feature Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6440;
-    x->title="Referenced HPGL Document ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6450;
-    x->title="2D Mating Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6460;
-    x->title="2D Mating Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6470;
-    x->title="2D Degree of Freedom Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6490;
-    x->title="3D Degree of Freedom Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64A0;
-    x->title="Range of Freedom";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64C0;
-    x->title="3D Mating Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64D0;
-    x->title="3D Mating Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x64F0;
-    x->title="2D Degree of Freedom Axis";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6500;
-    x->title="Planning Landmark Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6510;
-    x->title="Planning Landmark Line Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6520;
-    x->title="Planning Landmark Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6530;
-    x->title="Planning Landmark ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6540;
-    x->title="Planning Landmark Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6545;
-    x->title="Planning Landmark Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6550;
-    x->title="2D Point Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6560;
-    x->title="2D Point Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6590;
-    x->title="3D Point Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65A0;
-    x->title="2D Line Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65B0;
-    x->title="2D Line Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65D0;
-    x->title="3D Line Coordinates";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65E0;
-    x->title="2D Plane Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x65F0;
-    x->title="2D Plane Intersection";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6610;
-    x->title="3D Plane Origin";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0068;
-    x->tag[1]=0x6620;
-    x->title="3D Plane Normal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0001;
-    x->title="Graphic Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0002;
-    x->title="Graphic Layer";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0003;
-    x->title="Bounding Box Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0004;
-    x->title="Anchor Point Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0005;
-    x->title="Graphic Annotation Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0006;
-    x->title="Unformatted Text Value";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0008;
-    x->title="Text Object Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0009;
-    x->title="Graphic Object Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0010;
-    x->title="Bounding Box Top Left Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0011;
-    x->title="Bounding Box Bottom Right Hand Corner";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0012;
-    x->title="Bounding Box Text Horizontal Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0014;
-    x->title="Anchor Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0015;
-    x->title="Anchor Point Visibility";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0020;
-    x->title="Graphic Dimensions";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0021;
-    x->title="Number of Graphic Points";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0022;
-    x->title="Graphic Data";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0023;
-    x->title="Graphic Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0024;
-    x->title="Graphic Filled";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0040;
-    x->title="Image Rotation (Retired)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0041;
-    x->title="Image Horizontal Flip";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0042;
-    x->title="Image Rotation";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0050;
-    x->title="Displayed Area Top Left Hand Corner (Trial)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0051;
-    x->title="Displayed Area Bottom Right Hand Corner (Trial)";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0052;
-    x->title="Displayed Area Top Left Hand Corner";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0053;
-    x->title="Displayed Area Bottom Right Hand Corner";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x005A;
-    x->title="Displayed Area Selection Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0060;
-    x->title="Graphic Layer Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0062;
-    x->title="Graphic Layer Order";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0066;
-    x->title="Graphic Layer Recommended Display Grayscale Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0067;
-    x->title="Graphic Layer Recommended Display RGB Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0068;
-    x->title="Graphic Layer Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0080;
-    x->title="Content Label";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0081;
-    x->title="Content Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0082;
-    x->title="Presentation Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0083;
-    x->title="Presentation Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0084;
-    x->title="Content Creator's Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0086;
-    x->title="Content Creator's Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0087;
-    x->title="Alternate Content Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0100;
-    x->title="Presentation Size Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0101;
-    x->title="Presentation Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0102;
-    x->title="Presentation Pixel Aspect Ratio";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0103;
-    x->title="Presentation Pixel Magnification Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0207;
-    x->title="Graphic Group Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0208;
-    x->title="Graphic Group Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0209;
-    x->title="Compound Graphic Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0226;
-    x->title="Compound Graphic Instance ID";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0227;
-    x->title="Font Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0228;
-    x->title="Font Name Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0229;
-    x->title="CSS Font Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0230;
-    x->title="Rotation Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0231;
-    x->title="Text Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0232;
-    x->title="Line Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0233;
-    x->title="Fill Style Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0234;
-    x->title="Graphic Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0241;
-    x->title="Text Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0242;
-    x->title="Horizontal Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0243;
-    x->title="Vertical Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0244;
-    x->title="Shadow Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0245;
-    x->title="Shadow Offset X";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0246;
-    x->title="Shadow Offset Y";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0247;
-    x->title="Shadow Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0248;
-    x->title="Underlined";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0249;
-    x->title="Bold";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0250;
-    x->title="Italic";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0251;
-    x->title="Pattern On Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0252;
-    x->title="Pattern Off Color CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0253;
-    x->title="Line Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0254;
-    x->title="Line Dashing Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0255;
-    x->title="Line Pattern";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0256;
-    x->title="Fill Pattern";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0257;
-    x->title="Fill Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0258;
-    x->title="Shadow Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0261;
-    x->title="Gap Length";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0262;
-    x->title="Diameter of Visibility";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0273;
-    x->title="Rotation Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0274;
-    x->title="Tick Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0278;
-    x->title="Show Tick Label";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0279;
-    x->title="Tick Label Alignment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0282;
-    x->title="Compound Graphic Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0284;
-    x->title="Pattern On Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0285;
-    x->title="Pattern Off Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0287;
-    x->title="Major Ticks Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0288;
-    x->title="Tick Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0289;
-    x->title="Tick Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0294;
-    x->title="Compound Graphic Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0295;
-    x->title="Graphic Group ID";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0306;
-    x->title="Shape Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0308;
-    x->title="Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0309;
-    x->title="Matrix Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030A;
-    x->title="Matrix Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030B;
-    x->title="Frame of Reference to Displayed Coordinate System Transformation Matrix";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030C;
-    x->title="Frame of Reference Transformation Matrix Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030D;
-    x->title="Registration Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x030F;
-    x->title="Fiducial Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0310;
-    x->title="Fiducial Identifier";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0311;
-    x->title="Fiducial Identifier Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0312;
-    x->title="Contour Uncertainty Radius";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0314;
-    x->title="Used Fiducials Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0318;
-    x->title="Graphic Coordinates Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031A;
-    x->title="Fiducial UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031C;
-    x->title="Fiducial Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x031E;
-    x->title="Fiducial Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0401;
-    x->title="Graphic Layer Recommended Display CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0402;
-    x->title="Blending Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0403;
-    x->title="Relative Opacity";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0404;
-    x->title="Referenced Spatial Registration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x0405;
-    x->title="Blending Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1101;
-    x->title="Presentation Display Collection UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1102;
-    x->title="Presentation Sequence Collection UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1103;
-    x->title="Presentation Sequence Position Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1104;
-    x->title="Rendered Image Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1201;
-    x->title="Volumetric Presentation State Input Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1202;
-    x->title="Presentation Input Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1203;
-    x->title="Input Sequence Position Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1204;
-    x->title="Crop";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1205;
-    x->title="Cropping Specification Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1206;
-    x->title="Compositing Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1207;
-    x->title="Volumetric Presentation Input Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1208;
-    x->title="Image Volume Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1301;
-    x->title="Volume Cropping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1302;
-    x->title="Volume Cropping Method";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1303;
-    x->title="Bounding Box Crop";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1304;
-    x->title="Oblique Cropping Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1305;
-    x->title="Plane";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1306;
-    x->title="Plane Normal";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1309;
-    x->title="Cropping Specification Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1501;
-    x->title="Multi-Planar Reconstruction Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1502;
-    x->title="MPR Thickness Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1503;
-    x->title="MPR Slab Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1505;
-    x->title="MPR Top Left Hand Corner";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1507;
-    x->title="MPR View Width Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1508;
-    x->title="MPR View Width";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x150C;
-    x->title="Number of Volumetric Curve Points";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x150D;
-    x->title="Volumetric Curve Points";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1511;
-    x->title="MPR View Height Direction";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1512;
-    x->title="MPR View Height";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1801;
-    x->title="Presentation State Classification Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1802;
-    x->title="Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1803;
-    x->title="Component Input Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1804;
-    x->title="Volumetric Presentation Input Index";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1805;
-    x->title="Presentation State Compositor Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1806;
-    x->title="Weighting Transfer Function Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1807;
-    x->title="Weighting Lookup Table Descriptor";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1808;
-    x->title="Weighting Lookup Table Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1901;
-    x->title="Volumetric Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1903;
-    x->title="Referenced Structured Context Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1904;
-    x->title="Referenced Content Item";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1905;
-    x->title="Volumetric Presentation Input Annotation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1907;
-    x->title="Annotation Clipping";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A01;
-    x->title="Presentation Animation Style";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A03;
-    x->title="Recommended Animation Rate";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A04;
-    x->title="Animation Curve Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0070;
-    x->tag[1]=0x1A05;
-    x->title="Animation Step Size";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0002;
-    x->title="Hanging Protocol Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0004;
-    x->title="Hanging Protocol Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0006;
-    x->title="Hanging Protocol Level";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0008;
-    x->title="Hanging Protocol Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000A;
-    x->title="Hanging Protocol Creation DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000C;
-    x->title="Hanging Protocol Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x000E;
-    x->title="Hanging Protocol User Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0010;
-    x->title="Hanging Protocol User Group Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0012;
-    x->title="Source Hanging Protocol Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0014;
-    x->title="Number of Priors Referenced";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0020;
-    x->title="Image Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0022;
-    x->title="Image Set Selector Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0024;
-    x->title="Image Set Selector Usage Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0026;
-    x->title="Selector Attribute";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0028;
-    x->title="Selector Value Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0030;
-    x->title="Time Based Image Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0032;
-    x->title="Image Set Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0034;
-    x->title="Image Set Selector Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0038;
-    x->title="Relative Time";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003A;
-    x->title="Relative Time Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003C;
-    x->title="Abstract Prior Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x003E;
-    x->title="Abstract Prior Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0040;
-    x->title="Image Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0050;
-    x->title="Selector Attribute VR";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0052;
-    x->title="Selector Sequence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0054;
-    x->title="Selector Sequence Pointer Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0056;
-    x->title="Selector Attribute Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x005E;
-    x->title="Selector AE Value";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x005F;
-    x->title="Selector AS Value";
-    x->vr="AS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0060;
-    x->title="Selector AT Value";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0061;
-    x->title="Selector DA Value";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0062;
-    x->title="Selector CS Value";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0063;
-    x->title="Selector DT Value";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0064;
-    x->title="Selector IS Value";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0065;
-    x->title="Selector OB Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0066;
-    x->title="Selector LO Value";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0067;
-    x->title="Selector OF Value";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0068;
-    x->title="Selector LT Value";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0069;
-    x->title="Selector OW Value";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006A;
-    x->title="Selector PN Value";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006B;
-    x->title="Selector TM Value";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006C;
-    x->title="Selector SH Value";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006D;
-    x->title="Selector UN Value";
-    x->vr="UN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006E;
-    x->title="Selector ST Value";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x006F;
-    x->title="Selector UC Value";
-    x->vr="UC";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0070;
-    x->title="Selector UT Value";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0071;
-    x->title="Selector UR Value";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0072;
-    x->title="Selector DS Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0073;
-    x->title="Selector OD Value";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0074;
-    x->title="Selector FD Value";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0075;
-    x->title="Selector OL Value";
-    x->vr="OL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0076;
-    x->title="Selector FL Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0078;
-    x->title="Selector UL Value";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007A;
-    x->title="Selector US Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007C;
-    x->title="Selector SL Value";
-    x->vr="SL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007E;
-    x->title="Selector SS Value";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x007F;
-    x->title="Selector UI Value";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0080;
-    x->title="Selector Code Sequence Value";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0100;
-    x->title="Number of Screens";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0102;
-    x->title="Nominal Screen Definition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0104;
-    x->title="Number of Vertical Pixels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0106;
-    x->title="Number of Horizontal Pixels";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0108;
-    x->title="Display Environment Spatial Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010A;
-    x->title="Screen Minimum Grayscale Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010C;
-    x->title="Screen Minimum Color Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x010E;
-    x->title="Application Maximum Repaint Time";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0200;
-    x->title="Display Sets Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0202;
-    x->title="Display Set Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0203;
-    x->title="Display Set Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0204;
-    x->title="Display Set Presentation Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0206;
-    x->title="Display Set Presentation Group Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0208;
-    x->title="Partial Data Display Handling";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0210;
-    x->title="Synchronized Scrolling Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0212;
-    x->title="Display Set Scrolling Group";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0214;
-    x->title="Navigation Indicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0216;
-    x->title="Navigation Display Set";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0218;
-    x->title="Reference Display Sets";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0300;
-    x->title="Image Boxes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0302;
-    x->title="Image Box Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0304;
-    x->title="Image Box Layout Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0306;
-    x->title="Image Box Tile Horizontal Dimension";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0308;
-    x->title="Image Box Tile Vertical Dimension";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0310;
-    x->title="Image Box Scroll Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0312;
-    x->title="Image Box Small Scroll Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0314;
-    x->title="Image Box Small Scroll Amount";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0316;
-    x->title="Image Box Large Scroll Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0318;
-    x->title="Image Box Large Scroll Amount";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0320;
-    x->title="Image Box Overlap Priority";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0330;
-    x->title="Cine Relative to Real-Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0400;
-    x->title="Filter Operations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0402;
-    x->title="Filter-by Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0404;
-    x->title="Filter-by Attribute Presence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0406;
-    x->title="Filter-by Operator";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0420;
-    x->title="Structured Display Background CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0421;
-    x->title="Empty Image Box CIELab Value";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0422;
-    x->title="Structured Display Image Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0424;
-    x->title="Structured Display Text Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0427;
-    x->title="Referenced First Frame Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0430;
-    x->title="Image Box Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0432;
-    x->title="Synchronized Image Box List";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0434;
-    x->title="Type of Synchronization";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0500;
-    x->title="Blending Operation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0510;
-    x->title="Reformatting Operation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0512;
-    x->title="Reformatting Thickness";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0514;
-    x->title="Reformatting Interval";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0516;
-    x->title="Reformatting Operation Initial View Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0520;
-    x->title="3D Rendering Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0600;
-    x->title="Sorting Operations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0602;
-    x->title="Sort-by Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0604;
-    x->title="Sorting Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0700;
-    x->title="Display Set Patient Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0702;
-    x->title="VOI Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0704;
-    x->title="Pseudo-Color Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0705;
-    x->title="Pseudo-Color Palette Instance Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0706;
-    x->title="Show Grayscale Inverted";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0710;
-    x->title="Show Image True Size Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0712;
-    x->title="Show Graphic Annotation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0714;
-    x->title="Show Patient Demographics Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0716;
-    x->title="Show Acquisition Techniques Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0717;
-    x->title="Display Set Horizontal Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0072;
-    x->tag[1]=0x0718;
-    x->title="Display Set Vertical Justification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x0120;
-    x->title="Continuation Start Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x0121;
-    x->title="Continuation End Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1000;
-    x->title="Procedure Step State";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1002;
-    x->title="Procedure Step Progress Information Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1004;
-    x->title="Procedure Step Progress";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1006;
-    x->title="Procedure Step Progress Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1008;
-    x->title="Procedure Step Communications URI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100A;
-    x->title="Contact URI";
-    x->vr="UR";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100C;
-    x->title="Contact Display Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x100E;
-    x->title="Procedure Step Discontinuation Reason Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1020;
-    x->title="Beam Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1022;
-    x->title="Beam Task Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1024;
-    x->title="Beam Order Index (Trial)";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1025;
-    x->title="Autosequence Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1026;
-    x->title="Table Top Vertical Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1027;
-    x->title="Table Top Longitudinal Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1028;
-    x->title="Table Top Lateral Adjusted Position";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102A;
-    x->title="Patient Support Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102B;
-    x->title="Table Top Eccentric Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102C;
-    x->title="Table Top Pitch Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x102D;
-    x->title="Table Top Roll Adjusted Angle";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1030;
-    x->title="Delivery Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1032;
-    x->title="Verification Image Timing";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1034;
-    x->title="Double Exposure Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1036;
-    x->title="Double Exposure Ordering";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1038;
-    x->title="Double Exposure Meterset (Trial)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x103A;
-    x->title="Double Exposure Field Delta (Trial)";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1040;
-    x->title="Related Reference RT Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1042;
-    x->title="General Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1044;
-    x->title="Conventional Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1046;
-    x->title="Ion Machine Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1048;
-    x->title="Failed Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104A;
-    x->title="Overridden Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104C;
-    x->title="Conventional Control Point Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x104E;
-    x->title="Ion Control Point Verification Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1050;
-    x->title="Attribute Occurrence Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1052;
-    x->title="Attribute Occurrence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1054;
-    x->title="Attribute Item Selector";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1056;
-    x->title="Attribute Occurrence Private Creator";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1057;
-    x->title="Selector Sequence Pointer Items";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1200;
-    x->title="Scheduled Procedure Step Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1202;
-    x->title="Worklist Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1204;
-    x->title="Procedure Step Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1210;
-    x->title="Scheduled Processing Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1212;
-    x->title="Performed Processing Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1216;
-    x->title="Unified Procedure Step Performed Procedure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1220;
-    x->title="Related Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1222;
-    x->title="Procedure Step Relationship Type";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1224;
-    x->title="Replaced Procedure Step Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1230;
-    x->title="Deletion Lock";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1234;
-    x->title="Receiving AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1236;
-    x->title="Requesting AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1238;
-    x->title="Reason for Cancellation";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1242;
-    x->title="SCP Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1244;
-    x->title="Subscription List Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1246;
-    x->title="Unified Procedure Step List Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1324;
-    x->title="Beam Order Index";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1338;
-    x->title="Double Exposure Meterset";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x133A;
-    x->title="Double Exposure Field Delta";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1401;
-    x->title="Brachy Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1402;
-    x->title="Continuation Start Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1403;
-    x->title="Continuation End Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1404;
-    x->title="Continuation Pulse Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1405;
-    x->title="Channel Delivery Order Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1406;
-    x->title="Referenced Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1407;
-    x->title="Start Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1408;
-    x->title="End Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x1409;
-    x->title="Omitted Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140A;
-    x->title="Reason for Channel Omission";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140B;
-    x->title="Reason for Channel Omission Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140C;
-    x->title="Channel Delivery Order Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140D;
-    x->title="Channel Delivery Continuation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0074;
-    x->tag[1]=0x140E;
-    x->title="Omitted Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0001;
-    x->title="Implant Assembly Template Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0003;
-    x->title="Implant Assembly Template Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0006;
-    x->title="Implant Assembly Template Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0008;
-    x->title="Replaced Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000A;
-    x->title="Implant Assembly Template Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000C;
-    x->title="Original Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x000E;
-    x->title="Derivation Implant Assembly Template Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0010;
-    x->title="Implant Assembly Template Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0020;
-    x->title="Procedure Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0030;
-    x->title="Surgical Technique";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0032;
-    x->title="Component Types Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0034;
-    x->title="Component Type Code Sequence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0036;
-    x->title="Exclusive Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0038;
-    x->title="Mandatory Component Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0040;
-    x->title="Component Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0055;
-    x->title="Component ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0060;
-    x->title="Component Assembly Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0070;
-    x->title="Component 1 Referenced ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0080;
-    x->title="Component 1 Referenced Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x0090;
-    x->title="Component 1 Referenced Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00A0;
-    x->title="Component 2 Referenced ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00B0;
-    x->title="Component 2 Referenced Mating Feature Set ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0076;
-    x->tag[1]=0x00C0;
-    x->title="Component 2 Referenced Mating Feature ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0001;
-    x->title="Implant Template Group Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0010;
-    x->title="Implant Template Group Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0020;
-    x->title="Implant Template Group Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0024;
-    x->title="Implant Template Group Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0026;
-    x->title="Replaced Implant Template Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0028;
-    x->title="Implant Template Group Target Anatomy Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x002A;
-    x->title="Implant Template Group Members Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x002E;
-    x->title="Implant Template Group Member ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0050;
-    x->title="3D Implant Template Group Member Matching Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0060;
-    x->title="3D Implant Template Group Member Matching Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0070;
-    x->title="Implant Template Group Member Matching 2D Coordinates Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x0090;
-    x->title="2D Implant Template Group Member Matching Point";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00A0;
-    x->title="2D Implant Template Group Member Matching Axes";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B0;
-    x->title="Implant Template Group Variation Dimension Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B2;
-    x->title="Implant Template Group Variation Dimension Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B4;
-    x->title="Implant Template Group Variation Dimension Rank Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B6;
-    x->title="Referenced Implant Template Group Member ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0078;
-    x->tag[1]=0x00B8;
-    x->title="Implant Template Group Variation Dimension Rank";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0001;
-    x->title="Surface Scan Acquisition Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0002;
-    x->title="Surface Scan Mode Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0003;
-    x->title="Registration Method Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0004;
-    x->title="Shot Duration Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0005;
-    x->title="Shot Offset Time";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0006;
-    x->title="Surface Point Presentation Value Data";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0007;
-    x->title="Surface Point Color CIELab Value Data";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0008;
-    x->title="UV Mapping Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0009;
-    x->title="Texture Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0010;
-    x->title="U Value Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0011;
-    x->title="V Value Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0012;
-    x->title="Referenced Texture Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0080;
-    x->tag[1]=0x0013;
-    x->title="Referenced Surface Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0001;
-    x->title="Assessment Summary";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0003;
-    x->title="Assessment Summary Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0004;
-    x->title="Assessed SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0005;
-    x->title="Referenced Comparison SOP Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0006;
-    x->title="Number of Assessment Observations";
-    x->vr="UL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0007;
-    x->title="Assessment Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0008;
-    x->title="Observation Significance";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x000A;
-    x->title="Observation Description";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x000C;
-    x->title="Structured Constraint Observation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0010;
-    x->title="Assessed Attribute Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0016;
-    x->title="Assessment Set ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0017;
-    x->title="Assessment Requester Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0018;
-    x->title="Selector Attribute Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0019;
-    x->title="Selector Attribute Keyword";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0021;
-    x->title="Assessment Type Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0022;
-    x->title="Observation Basis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0023;
-    x->title="Assessment Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0032;
-    x->title="Constraint Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0033;
-    x->title="Specification Selection Guidance";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0034;
-    x->title="Constraint Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0035;
-    x->title="Recommended Default Value Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0036;
-    x->title="Constraint Violation Significance";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0082;
-    x->tag[1]=0x0037;
-    x->title="Constraint Violation Condition";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0130;
-    x->title="Storage Media File-set ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0140;
-    x->title="Storage Media File-set UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0200;
-    x->title="Icon Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0904;
-    x->title="Topic Title";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0906;
-    x->title="Topic Subject";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0910;
-    x->title="Topic Author";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0088;
-    x->tag[1]=0x0912;
-    x->title="Topic Keywords";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0410;
-    x->title="SOP Instance Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0420;
-    x->title="SOP Authorization DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0424;
-    x->title="SOP Authorization Comment";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0100;
-    x->tag[1]=0x0426;
-    x->title="Authorization Equipment Certification Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0005;
-    x->title="MAC ID Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0010;
-    x->title="MAC Calculation Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0015;
-    x->title="MAC Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0020;
-    x->title="Data Elements Signed";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0100;
-    x->title="Digital Signature UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0105;
-    x->title="Digital Signature DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0110;
-    x->title="Certificate Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0115;
-    x->title="Certificate of Signer";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0120;
-    x->title="Signature";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0305;
-    x->title="Certified Timestamp Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0310;
-    x->title="Certified Timestamp";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0315;
-    x->title="";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0401;
-    x->title="Digital Signature Purpose Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0402;
-    x->title="Referenced Digital Signature Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0403;
-    x->title="Referenced SOP Instance MAC Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0404;
-    x->title="MAC";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0500;
-    x->title="Encrypted Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0510;
-    x->title="Encrypted Content Transfer Syntax UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0520;
-    x->title="Encrypted Content";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0550;
-    x->title="Modified Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0561;
-    x->title="Original Attributes Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0562;
-    x->title="Attribute Modification DateTime";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0563;
-    x->title="Modifying System";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0564;
-    x->title="Source of Previous Values";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x0400;
-    x->tag[1]=0x0565;
-    x->title="Reason for the Attribute Modification";
-    x->vr="CS";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx0;
-    //x->title="Escape Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx1;
-    //x->title="Run Length Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx2;
-    //x->title="Huffman Table Size";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx3;
-    //x->title="Huffman Table Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx4;
-    //x->title="Shift Table Size";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1000;
-    //x->tag[1]=0xxxx5;
-    //x->title="Shift Table Triplet";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x1010;
-    //x->tag[1]=0xxxxx;
-    //x->title="Zonal Map";
-    //x->vr="US";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0010;
-    x->title="Number of Copies";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x001E;
-    x->title="Printer Configuration Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0020;
-    x->title="Print Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0030;
-    x->title="Medium Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0040;
-    x->title="Film Destination";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0050;
-    x->title="Film Session Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0060;
-    x->title="Memory Allocation";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0061;
-    x->title="Maximum Memory Allocation";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0062;
-    x->title="Color Image Printing Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0063;
-    x->title="Collation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0065;
-    x->title="Annotation Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0067;
-    x->title="Image Overlay Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0069;
-    x->title="Presentation LUT Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x006A;
-    x->title="Image Box Presentation LUT Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A0;
-    x->title="Memory Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A1;
-    x->title="Printing Bit Depth";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A2;
-    x->title="Media Installed Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A4;
-    x->title="Other Media Available Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x00A8;
-    x->title="Supported Image Display Formats Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0500;
-    x->title="Referenced Film Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2000;
-    x->tag[1]=0x0510;
-    x->title="Referenced Stored Print Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0010;
-    x->title="Image Display Format";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0030;
-    x->title="Annotation Display Format ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0040;
-    x->title="Film Orientation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0050;
-    x->title="Film Size ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0052;
-    x->title="Printer Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0054;
-    x->title="Default Printer Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0060;
-    x->title="Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0080;
-    x->title="Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A6;
-    x->title="Default Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A7;
-    x->title="Other Magnification Types Available";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A8;
-    x->title="Default Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x00A9;
-    x->title="Other Smoothing Types Available";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0100;
-    x->title="Border Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0110;
-    x->title="Empty Image Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0120;
-    x->title="Min Density";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0130;
-    x->title="Max Density";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0140;
-    x->title="Trim";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0150;
-    x->title="Configuration Information";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0152;
-    x->title="Configuration Information Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0154;
-    x->title="Maximum Collated Films";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x015E;
-    x->title="Illumination";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0160;
-    x->title="Reflected Ambient Light";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0376;
-    x->title="Printer Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0500;
-    x->title="Referenced Film Session Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0510;
-    x->title="Referenced Image Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2010;
-    x->tag[1]=0x0520;
-    x->title="Referenced Basic Annotation Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0010;
-    x->title="Image Box Position";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0020;
-    x->title="Polarity";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0030;
-    x->title="Requested Image Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0040;
-    x->title="Requested Decimate/Crop Behavior";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0050;
-    x->title="Requested Resolution ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x00A0;
-    x->title="Requested Image Size Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x00A2;
-    x->title="Decimate/Crop Result";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0110;
-    x->title="Basic Grayscale Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0111;
-    x->title="Basic Color Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0130;
-    x->title="Referenced Image Overlay Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2020;
-    x->tag[1]=0x0140;
-    x->title="Referenced VOI LUT Box Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2030;
-    x->tag[1]=0x0010;
-    x->title="Annotation Position";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2030;
-    x->tag[1]=0x0020;
-    x->title="Text String";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0010;
-    x->title="Referenced Overlay Plane Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0011;
-    x->title="Referenced Overlay Plane Groups";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0020;
-    x->title="Overlay Pixel Data Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0060;
-    x->title="Overlay Magnification Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0070;
-    x->title="Overlay Smoothing Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0072;
-    x->title="Overlay or Image Magnification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0074;
-    x->title="Magnify to Number of Columns";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0080;
-    x->title="Overlay Foreground Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0082;
-    x->title="Overlay Background Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0090;
-    x->title="Overlay Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0100;
-    x->title="Threshold Density";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2040;
-    x->tag[1]=0x0500;
-    x->title="Referenced Image Box Sequence (Retired)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0010;
-    x->title="Presentation LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0020;
-    x->title="Presentation LUT Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2050;
-    x->tag[1]=0x0500;
-    x->title="Referenced Presentation LUT Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0010;
-    x->title="Print Job ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0020;
-    x->title="Execution Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0030;
-    x->title="Execution Status Info";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0040;
-    x->title="Creation Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0050;
-    x->title="Creation Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0070;
-    x->title="Originator";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0140;
-    x->title="Destination AE";
-    x->vr="AE";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0160;
-    x->title="Owner ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0170;
-    x->title="Number of Films";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2100;
-    x->tag[1]=0x0500;
-    x->title="Referenced Print Job Sequence (Pull Stored Print)";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0010;
-    x->title="Printer Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0020;
-    x->title="Printer Status Info";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0030;
-    x->title="Printer Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2110;
-    x->tag[1]=0x0099;
-    x->title="Print Queue ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0010;
-    x->title="Queue Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0050;
-    x->title="Print Job Description Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2120;
-    x->tag[1]=0x0070;
-    x->title="Referenced Print Job Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0010;
-    x->title="Print Management Capabilities Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0015;
-    x->title="Printer Characteristics Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0030;
-    x->title="Film Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0040;
-    x->title="Image Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0050;
-    x->title="Annotation Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0060;
-    x->title="Image Overlay Box Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x0080;
-    x->title="Presentation LUT Content Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x00A0;
-    x->title="Proposed Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2130;
-    x->tag[1]=0x00C0;
-    x->title="Original Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0001;
-    x->title="Label Using Information Extracted From Instances";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0002;
-    x->title="Label Text";
-    x->vr="UT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0003;
-    x->title="Label Style Selection";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0004;
-    x->title="Media Disposition";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0005;
-    x->title="Barcode Value";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0006;
-    x->title="Barcode Symbology";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0007;
-    x->title="Allow Media Splitting";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0008;
-    x->title="Include Non-DICOM Objects";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0009;
-    x->title="Include Display Application";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000A;
-    x->title="Preserve Composite Instances After Media Creation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000B;
-    x->title="Total Number of Pieces of Media Created";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000C;
-    x->title="Requested Media Application Profile";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000D;
-    x->title="Referenced Storage Media Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000E;
-    x->title="Failure Attributes";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x000F;
-    x->title="Allow Lossy Compression";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x2200;
-    x->tag[1]=0x0020;
-    x->title="Request Priority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0002;
-    x->title="RT Image Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0003;
-    x->title="RT Image Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0004;
-    x->title="RT Image Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000A;
-    x->title="Reported Values Origin";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000C;
-    x->title="RT Image Plane";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000D;
-    x->title="X-Ray Image Receptor Translation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x000E;
-    x->title="X-Ray Image Receptor Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0010;
-    x->title="RT Image Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0011;
-    x->title="Image Plane Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0012;
-    x->title="RT Image Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0020;
-    x->title="Radiation Machine Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0022;
-    x->title="Radiation Machine SAD";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0024;
-    x->title="Radiation Machine SSD";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0026;
-    x->title="RT Image SID";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0028;
-    x->title="Source to Reference Object Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0029;
-    x->title="Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0030;
-    x->title="Exposure Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0032;
-    x->title="Meterset Exposure";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0034;
-    x->title="Diaphragm Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0040;
-    x->title="Fluence Map Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0041;
-    x->title="Fluence Data Source";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0042;
-    x->title="Fluence Data Scale";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0050;
-    x->title="Primary Fluence Mode Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0051;
-    x->title="Fluence Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3002;
-    x->tag[1]=0x0052;
-    x->title="Fluence Mode ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0001;
-    x->title="DVH Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0002;
-    x->title="Dose Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0004;
-    x->title="Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0005;
-    x->title="Spatial Transform of Dose";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0006;
-    x->title="Dose Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0008;
-    x->title="Normalization Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000A;
-    x->title="Dose Summation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000C;
-    x->title="Grid Frame Offset Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x000E;
-    x->title="Dose Grid Scaling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0010;
-    x->title="RT Dose ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0012;
-    x->title="Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0014;
-    x->title="Tissue Heterogeneity Correction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0040;
-    x->title="DVH Normalization Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0042;
-    x->title="DVH Normalization Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0050;
-    x->title="DVH Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0052;
-    x->title="DVH Dose Scaling";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0054;
-    x->title="DVH Volume Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0056;
-    x->title="DVH Number of Bins";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0058;
-    x->title="DVH Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0060;
-    x->title="DVH Referenced ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0062;
-    x->title="DVH ROI Contribution Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0070;
-    x->title="DVH Minimum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0072;
-    x->title="DVH Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3004;
-    x->tag[1]=0x0074;
-    x->title="DVH Mean Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0002;
-    x->title="Structure Set Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0004;
-    x->title="Structure Set Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0006;
-    x->title="Structure Set Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0008;
-    x->title="Structure Set Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0009;
-    x->title="Structure Set Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0010;
-    x->title="Referenced Frame of Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0012;
-    x->title="RT Referenced Study Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0014;
-    x->title="RT Referenced Series Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0016;
-    x->title="Contour Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0018;
-    x->title="Predecessor Structure Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0020;
-    x->title="Structure Set ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0022;
-    x->title="ROI Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0024;
-    x->title="Referenced Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0026;
-    x->title="ROI Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0028;
-    x->title="ROI Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x002A;
-    x->title="ROI Display Color";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x002C;
-    x->title="ROI Volume";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0030;
-    x->title="RT Related ROI Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0033;
-    x->title="RT ROI Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0036;
-    x->title="ROI Generation Algorithm";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0038;
-    x->title="ROI Generation Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0039;
-    x->title="ROI Contour Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0040;
-    x->title="Contour Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0042;
-    x->title="Contour Geometric Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0044;
-    x->title="Contour Slab Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0045;
-    x->title="Contour Offset Vector";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0046;
-    x->title="Number of Contour Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0048;
-    x->title="Contour Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0049;
-    x->title="Attached Contours";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0050;
-    x->title="Contour Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0080;
-    x->title="RT ROI Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0082;
-    x->title="Observation Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0084;
-    x->title="Referenced ROI Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0085;
-    x->title="ROI Observation Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0086;
-    x->title="RT ROI Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x0088;
-    x->title="ROI Observation Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A0;
-    x->title="Related RT ROI Observations Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A4;
-    x->title="RT ROI Interpreted Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00A6;
-    x->title="ROI Interpreter";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B0;
-    x->title="ROI Physical Properties Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B2;
-    x->title="ROI Physical Property";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B4;
-    x->title="ROI Physical Property Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B6;
-    x->title="ROI Elemental Composition Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B7;
-    x->title="ROI Elemental Composition Atomic Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B8;
-    x->title="ROI Elemental Composition Atomic Mass Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00B9;
-    x->title="Additional RT ROI Identification Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C0;
-    x->title="Frame of Reference Relationship Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C2;
-    x->title="Related Frame of Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C4;
-    x->title="Frame of Reference Transformation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C6;
-    x->title="Frame of Reference Transformation Matrix";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3006;
-    x->tag[1]=0x00C8;
-    x->title="Frame of Reference Transformation Comment";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0010;
-    x->title="Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0012;
-    x->title="Measured Dose Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0014;
-    x->title="Measured Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0016;
-    x->title="Measured Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0020;
-    x->title="Treatment Session Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0021;
-    x->title="Treatment Session Ion Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0022;
-    x->title="Current Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0024;
-    x->title="Treatment Control Point Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0025;
-    x->title="Treatment Control Point Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002A;
-    x->title="Treatment Termination Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002B;
-    x->title="Treatment Termination Code";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x002C;
-    x->title="Treatment Verification Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0030;
-    x->title="Referenced Treatment Record Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0032;
-    x->title="Specified Primary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0033;
-    x->title="Specified Secondary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0036;
-    x->title="Delivered Primary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0037;
-    x->title="Delivered Secondary Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x003A;
-    x->title="Specified Treatment Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x003B;
-    x->title="Delivered Treatment Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0040;
-    x->title="Control Point Delivery Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0041;
-    x->title="Ion Control Point Delivery Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0042;
-    x->title="Specified Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0044;
-    x->title="Delivered Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0045;
-    x->title="Meterset Rate Set";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0046;
-    x->title="Meterset Rate Delivered";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0047;
-    x->title="Scan Spot Metersets Delivered";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0048;
-    x->title="Dose Rate Delivered";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0050;
-    x->title="Treatment Summary Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0052;
-    x->title="Cumulative Dose to Dose Reference";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0054;
-    x->title="First Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0056;
-    x->title="Most Recent Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x005A;
-    x->title="Number of Fractions Delivered";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0060;
-    x->title="Override Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0061;
-    x->title="Parameter Sequence Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0062;
-    x->title="Override Parameter Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0063;
-    x->title="Parameter Item Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0064;
-    x->title="Measured Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0065;
-    x->title="Parameter Pointer";
-    x->vr="AT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0066;
-    x->title="Override Reason";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0068;
-    x->title="Corrected Parameter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x006A;
-    x->title="Correction Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0070;
-    x->title="Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0072;
-    x->title="Calculated Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0074;
-    x->title="Calculated Dose Reference Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0076;
-    x->title="Calculated Dose Reference Dose Value";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0078;
-    x->title="Start Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x007A;
-    x->title="End Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0080;
-    x->title="Referenced Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0082;
-    x->title="Referenced Measured Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0090;
-    x->title="Referenced Calculated Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0092;
-    x->title="Referenced Calculated Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00A0;
-    x->title="Beam Limiting Device Leaf Pairs Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00B0;
-    x->title="Recorded Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00C0;
-    x->title="Recorded Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00D0;
-    x->title="Recorded Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00E0;
-    x->title="Treatment Summary Measured Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F0;
-    x->title="Recorded Snout Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F2;
-    x->title="Recorded Range Shifter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F4;
-    x->title="Recorded Lateral Spreading Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x00F6;
-    x->title="Recorded Range Modulator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0100;
-    x->title="Recorded Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0105;
-    x->title="Source Serial Number";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0110;
-    x->title="Treatment Session Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0116;
-    x->title="Application Setup Check";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0120;
-    x->title="Recorded Brachy Accessory Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0122;
-    x->title="Referenced Brachy Accessory Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0130;
-    x->title="Recorded Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0132;
-    x->title="Specified Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0134;
-    x->title="Delivered Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0136;
-    x->title="Specified Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0138;
-    x->title="Delivered Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x013A;
-    x->title="Specified Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x013C;
-    x->title="Delivered Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0140;
-    x->title="Recorded Source Applicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0142;
-    x->title="Referenced Source Applicator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0150;
-    x->title="Recorded Channel Shield Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0152;
-    x->title="Referenced Channel Shield Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0160;
-    x->title="Brachy Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0162;
-    x->title="Safe Position Exit Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0164;
-    x->title="Safe Position Exit Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0166;
-    x->title="Safe Position Return Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0168;
-    x->title="Safe Position Return Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0171;
-    x->title="Pulse Specific Brachy Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0172;
-    x->title="Pulse Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0173;
-    x->title="Brachy Pulse Control Point Delivered Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0200;
-    x->title="Current Treatment Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0202;
-    x->title="Treatment Status Comment";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0220;
-    x->title="Fraction Group Summary Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0223;
-    x->title="Referenced Fraction Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0224;
-    x->title="Fraction Group Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0230;
-    x->title="Beam Stopper Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0240;
-    x->title="Fraction Status Summary Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0250;
-    x->title="Treatment Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x3008;
-    x->tag[1]=0x0251;
-    x->title="Treatment Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0002;
-    x->title="RT Plan Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0003;
-    x->title="RT Plan Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0004;
-    x->title="RT Plan Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0006;
-    x->title="RT Plan Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0007;
-    x->title="RT Plan Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0009;
-    x->title="Treatment Protocols";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000A;
-    x->title="Plan Intent";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000B;
-    x->title="Treatment Sites";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000C;
-    x->title="RT Plan Geometry";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x000E;
-    x->title="Prescription Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0010;
-    x->title="Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0012;
-    x->title="Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0013;
-    x->title="Dose Reference UID";
-    x->vr="UI";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0014;
-    x->title="Dose Reference Structure Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0015;
-    x->title="Nominal Beam Energy Unit";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0016;
-    x->title="Dose Reference Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0018;
-    x->title="Dose Reference Point Coordinates";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x001A;
-    x->title="Nominal Prior Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0020;
-    x->title="Dose Reference Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0021;
-    x->title="Constraint Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0022;
-    x->title="Delivery Warning Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0023;
-    x->title="Delivery Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0025;
-    x->title="Target Minimum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0026;
-    x->title="Target Prescription Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0027;
-    x->title="Target Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0028;
-    x->title="Target Underdose Volume Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002A;
-    x->title="Organ at Risk Full-volume Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002B;
-    x->title="Organ at Risk Limit Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002C;
-    x->title="Organ at Risk Maximum Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x002D;
-    x->title="Organ at Risk Overdose Volume Fraction";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0040;
-    x->title="Tolerance Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0042;
-    x->title="Tolerance Table Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0043;
-    x->title="Tolerance Table Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0044;
-    x->title="Gantry Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0046;
-    x->title="Beam Limiting Device Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0048;
-    x->title="Beam Limiting Device Tolerance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004A;
-    x->title="Beam Limiting Device Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004B;
-    x->title="Snout Position Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004C;
-    x->title="Patient Support Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004E;
-    x->title="Table Top Eccentric Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x004F;
-    x->title="Table Top Pitch Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0050;
-    x->title="Table Top Roll Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0051;
-    x->title="Table Top Vertical Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0052;
-    x->title="Table Top Longitudinal Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0053;
-    x->title="Table Top Lateral Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0055;
-    x->title="RT Plan Relationship";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0070;
-    x->title="Fraction Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0071;
-    x->title="Fraction Group Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0072;
-    x->title="Fraction Group Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0078;
-    x->title="Number of Fractions Planned";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0079;
-    x->title="Number of Fraction Pattern Digits Per Day";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x007A;
-    x->title="Repeat Fraction Cycle Length";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x007B;
-    x->title="Fraction Pattern";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0080;
-    x->title="Number of Beams";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0082;
-    x->title="Beam Dose Specification Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0084;
-    x->title="Beam Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0086;
-    x->title="Beam Meterset";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0088;
-    x->title="Beam Dose Point Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0089;
-    x->title="Beam Dose Point Equivalent Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008A;
-    x->title="Beam Dose Point SSD";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008B;
-    x->title="Beam Dose Meaning";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008C;
-    x->title="Beam Dose Verification Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008D;
-    x->title="Average Beam Dose Point Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008E;
-    x->title="Average Beam Dose Point Equivalent Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x008F;
-    x->title="Average Beam Dose Point SSD";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0090;
-    x->title="Beam Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0091;
-    x->title="Alternate Beam Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0092;
-    x->title="Alternate Beam Dose Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A0;
-    x->title="Number of Brachy Application Setups";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A2;
-    x->title="Brachy Application Setup Dose Specification Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00A4;
-    x->title="Brachy Application Setup Dose";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B0;
-    x->title="Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B2;
-    x->title="Treatment Machine Name";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B3;
-    x->title="Primary Dosimeter Unit";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B4;
-    x->title="Source-Axis Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B6;
-    x->title="Beam Limiting Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00B8;
-    x->title="RT Beam Limiting Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BA;
-    x->title="Source to Beam Limiting Device Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BB;
-    x->title="Isocenter to Beam Limiting Device Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BC;
-    x->title="Number of Leaf/Jaw Pairs";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00BE;
-    x->title="Leaf Position Boundaries";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C0;
-    x->title="Beam Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C2;
-    x->title="Beam Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C3;
-    x->title="Beam Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C4;
-    x->title="Beam Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C5;
-    x->title="Beam Delivery Duration Limit";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C6;
-    x->title="Radiation Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C7;
-    x->title="High-Dose Technique Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00C8;
-    x->title="Reference Image Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CA;
-    x->title="Planned Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CC;
-    x->title="Imaging Device-Specific Acquisition Parameters";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00CE;
-    x->title="Treatment Delivery Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D0;
-    x->title="Number of Wedges";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D1;
-    x->title="Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D2;
-    x->title="Wedge Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D3;
-    x->title="Wedge Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D4;
-    x->title="Wedge ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D5;
-    x->title="Wedge Angle";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D6;
-    x->title="Wedge Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D7;
-    x->title="Total Wedge Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D8;
-    x->title="Wedge Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00D9;
-    x->title="Isocenter to Wedge Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DA;
-    x->title="Source to Wedge Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DB;
-    x->title="Wedge Thin Edge Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DC;
-    x->title="Bolus ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DD;
-    x->title="Bolus Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00DE;
-    x->title="Effective Wedge Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E0;
-    x->title="Number of Compensators";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E1;
-    x->title="Material ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E2;
-    x->title="Total Compensator Tray Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E3;
-    x->title="Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E4;
-    x->title="Compensator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E5;
-    x->title="Compensator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E6;
-    x->title="Source to Compensator Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E7;
-    x->title="Compensator Rows";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E8;
-    x->title="Compensator Columns";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00E9;
-    x->title="Compensator Pixel Spacing";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EA;
-    x->title="Compensator Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EB;
-    x->title="Compensator Transmission Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EC;
-    x->title="Compensator Thickness Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00ED;
-    x->title="Number of Boli";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EE;
-    x->title="Compensator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00EF;
-    x->title="Compensator Tray ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F0;
-    x->title="Number of Blocks";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F2;
-    x->title="Total Block Tray Factor";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F3;
-    x->title="Total Block Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F4;
-    x->title="Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F5;
-    x->title="Block Tray ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F6;
-    x->title="Source to Block Tray Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F7;
-    x->title="Isocenter to Block Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F8;
-    x->title="Block Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00F9;
-    x->title="Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FA;
-    x->title="Block Divergence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FB;
-    x->title="Block Mounting Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FC;
-    x->title="Block Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x00FE;
-    x->title="Block Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0100;
-    x->title="Block Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0102;
-    x->title="Block Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0104;
-    x->title="Block Number of Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0106;
-    x->title="Block Data";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0107;
-    x->title="Applicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0108;
-    x->title="Applicator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0109;
-    x->title="Applicator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010A;
-    x->title="Applicator Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010C;
-    x->title="Cumulative Dose Reference Coefficient";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x010E;
-    x->title="Final Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0110;
-    x->title="Number of Control Points";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0111;
-    x->title="Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0112;
-    x->title="Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0114;
-    x->title="Nominal Beam Energy";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0115;
-    x->title="Dose Rate Set";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0116;
-    x->title="Wedge Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0118;
-    x->title="Wedge Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011A;
-    x->title="Beam Limiting Device Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011C;
-    x->title="Leaf/Jaw Positions";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011E;
-    x->title="Gantry Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x011F;
-    x->title="Gantry Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0120;
-    x->title="Beam Limiting Device Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0121;
-    x->title="Beam Limiting Device Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0122;
-    x->title="Patient Support Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0123;
-    x->title="Patient Support Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0124;
-    x->title="Table Top Eccentric Axis Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0125;
-    x->title="Table Top Eccentric Angle";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0126;
-    x->title="Table Top Eccentric Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0128;
-    x->title="Table Top Vertical Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0129;
-    x->title="Table Top Longitudinal Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012A;
-    x->title="Table Top Lateral Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012C;
-    x->title="Isocenter Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x012E;
-    x->title="Surface Entry Point";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0130;
-    x->title="Source to Surface Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0131;
-    x->title="Average Beam Dose Point Source to External Contour Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0132;
-    x->title="Source to External Contour Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0133;
-    x->title="External Contour Entry Point";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0134;
-    x->title="Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0140;
-    x->title="Table Top Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0142;
-    x->title="Table Top Pitch Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0144;
-    x->title="Table Top Roll Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0146;
-    x->title="Table Top Roll Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0148;
-    x->title="Head Fixation Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014A;
-    x->title="Gantry Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014C;
-    x->title="Gantry Pitch Rotation Direction";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x014E;
-    x->title="Gantry Pitch Angle Tolerance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0150;
-    x->title="Fixation Eye";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0151;
-    x->title="Chair Head Frame Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0152;
-    x->title="Head Fixation Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0153;
-    x->title="Chair Head Frame Position Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0154;
-    x->title="Fixation Light Azimuthal Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0155;
-    x->title="Fixation Light Polar Angle Tolerance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0180;
-    x->title="Patient Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0182;
-    x->title="Patient Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0183;
-    x->title="Patient Setup Label";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0184;
-    x->title="Patient Additional Position";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0190;
-    x->title="Fixation Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0192;
-    x->title="Fixation Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0194;
-    x->title="Fixation Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0196;
-    x->title="Fixation Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0198;
-    x->title="Fixation Device Position";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0199;
-    x->title="Fixation Device Pitch Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x019A;
-    x->title="Fixation Device Roll Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A0;
-    x->title="Shielding Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A2;
-    x->title="Shielding Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A4;
-    x->title="Shielding Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A6;
-    x->title="Shielding Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01A8;
-    x->title="Shielding Device Position";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B0;
-    x->title="Setup Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B2;
-    x->title="Setup Technique Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B4;
-    x->title="Setup Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B6;
-    x->title="Setup Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01B8;
-    x->title="Setup Device Label";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01BA;
-    x->title="Setup Device Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01BC;
-    x->title="Setup Device Parameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D0;
-    x->title="Setup Reference Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D2;
-    x->title="Table Top Vertical Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D4;
-    x->title="Table Top Longitudinal Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x01D6;
-    x->title="Table Top Lateral Setup Displacement";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0200;
-    x->title="Brachy Treatment Technique";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0202;
-    x->title="Brachy Treatment Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0206;
-    x->title="Treatment Machine Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0210;
-    x->title="Source Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0212;
-    x->title="Source Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0214;
-    x->title="Source Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0216;
-    x->title="Source Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0218;
-    x->title="Active Source Diameter";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021A;
-    x->title="Active Source Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021B;
-    x->title="Source Model ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x021C;
-    x->title="Source Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0222;
-    x->title="Source Encapsulation Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0224;
-    x->title="Source Encapsulation Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0226;
-    x->title="Source Isotope Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0228;
-    x->title="Source Isotope Half Life";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0229;
-    x->title="Source Strength Units";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022A;
-    x->title="Reference Air Kerma Rate";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022B;
-    x->title="Source Strength";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022C;
-    x->title="Source Strength Reference Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x022E;
-    x->title="Source Strength Reference Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0230;
-    x->title="Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0232;
-    x->title="Application Setup Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0234;
-    x->title="Application Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0236;
-    x->title="Application Setup Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0238;
-    x->title="Application Setup Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0240;
-    x->title="Template Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0242;
-    x->title="Template Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0244;
-    x->title="Template Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0250;
-    x->title="Total Reference Air Kerma";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0260;
-    x->title="Brachy Accessory Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0262;
-    x->title="Brachy Accessory Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0263;
-    x->title="Brachy Accessory Device ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0264;
-    x->title="Brachy Accessory Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0266;
-    x->title="Brachy Accessory Device Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x026A;
-    x->title="Brachy Accessory Device Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x026C;
-    x->title="Brachy Accessory Device Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0280;
-    x->title="Channel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0282;
-    x->title="Channel Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0284;
-    x->title="Channel Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0286;
-    x->title="Channel Total Time";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0288;
-    x->title="Source Movement Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x028A;
-    x->title="Number of Pulses";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x028C;
-    x->title="Pulse Repetition Interval";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0290;
-    x->title="Source Applicator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0291;
-    x->title="Source Applicator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0292;
-    x->title="Source Applicator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0294;
-    x->title="Source Applicator Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0296;
-    x->title="Source Applicator Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0298;
-    x->title="Source Applicator Manufacturer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x029C;
-    x->title="Source Applicator Wall Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x029E;
-    x->title="Source Applicator Wall Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A0;
-    x->title="Source Applicator Step Size";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A2;
-    x->title="Transfer Tube Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02A4;
-    x->title="Transfer Tube Length";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B0;
-    x->title="Channel Shield Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B2;
-    x->title="Channel Shield Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B3;
-    x->title="Channel Shield ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B4;
-    x->title="Channel Shield Name";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02B8;
-    x->title="Channel Shield Nominal Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02BA;
-    x->title="Channel Shield Nominal Transmission";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02C8;
-    x->title="Final Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D0;
-    x->title="Brachy Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D2;
-    x->title="Control Point Relative Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D4;
-    x->title="Control Point 3D Position";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02D6;
-    x->title="Cumulative Time Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E0;
-    x->title="Compensator Divergence";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E1;
-    x->title="Compensator Mounting Position";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E2;
-    x->title="Source to Compensator Distance";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E3;
-    x->title="Total Compensator Tray Water-Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E4;
-    x->title="Isocenter to Compensator Tray Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E5;
-    x->title="Compensator Column Offset";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E6;
-    x->title="Isocenter to Compensator Distances";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E7;
-    x->title="Compensator Relative Stopping Power Ratio";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02E8;
-    x->title="Compensator Milling Tool Diameter";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02EA;
-    x->title="Ion Range Compensator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x02EB;
-    x->title="Compensator Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0302;
-    x->title="Radiation Mass Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0304;
-    x->title="Radiation Atomic Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0306;
-    x->title="Radiation Charge State";
-    x->vr="SS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0308;
-    x->title="Scan Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0309;
-    x->title="Modulated Scan Mode Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030A;
-    x->title="Virtual Source-Axis Distances";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030C;
-    x->title="Snout Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030D;
-    x->title="Snout Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x030F;
-    x->title="Snout ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0312;
-    x->title="Number of Range Shifters";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0314;
-    x->title="Range Shifter Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0316;
-    x->title="Range Shifter Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0318;
-    x->title="Range Shifter ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0320;
-    x->title="Range Shifter Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0322;
-    x->title="Range Shifter Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0330;
-    x->title="Number of Lateral Spreading Devices";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0332;
-    x->title="Lateral Spreading Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0334;
-    x->title="Lateral Spreading Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0336;
-    x->title="Lateral Spreading Device ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0338;
-    x->title="Lateral Spreading Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x033A;
-    x->title="Lateral Spreading Device Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x033C;
-    x->title="Lateral Spreading Device Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0340;
-    x->title="Number of Range Modulators";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0342;
-    x->title="Range Modulator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0344;
-    x->title="Range Modulator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0346;
-    x->title="Range Modulator ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0348;
-    x->title="Range Modulator Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x034A;
-    x->title="Range Modulator Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x034C;
-    x->title="Beam Current Modulation ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0350;
-    x->title="Patient Support Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0352;
-    x->title="Patient Support ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0354;
-    x->title="Patient Support Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0355;
-    x->title="Tray Accessory Code";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0356;
-    x->title="Fixation Light Azimuthal Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0358;
-    x->title="Fixation Light Polar Angle";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x035A;
-    x->title="Meterset Rate";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0360;
-    x->title="Range Shifter Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0362;
-    x->title="Range Shifter Setting";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0364;
-    x->title="Isocenter to Range Shifter Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0366;
-    x->title="Range Shifter Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0370;
-    x->title="Lateral Spreading Device Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0372;
-    x->title="Lateral Spreading Device Setting";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0374;
-    x->title="Isocenter to Lateral Spreading Device Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0380;
-    x->title="Range Modulator Settings Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0382;
-    x->title="Range Modulator Gating Start Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0384;
-    x->title="Range Modulator Gating Stop Value";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0386;
-    x->title="Range Modulator Gating Start Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0388;
-    x->title="Range Modulator Gating Stop Water Equivalent Thickness";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x038A;
-    x->title="Isocenter to Range Modulator Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0390;
-    x->title="Scan Spot Tune ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0391;
-    x->title="Scan Spot Prescribed Indices";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0392;
-    x->title="Number of Scan Spot Positions";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0393;
-    x->title="Scan Spot Reordered";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0394;
-    x->title="Scan Spot Position Map";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0395;
-    x->title="Scan Spot Reordering Allowed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0396;
-    x->title="Scan Spot Meterset Weights";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0398;
-    x->title="Scanning Spot Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x039A;
-    x->title="Number of Paintings";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A0;
-    x->title="Ion Tolerance Table Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A2;
-    x->title="Ion Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A4;
-    x->title="Ion Beam Limiting Device Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A6;
-    x->title="Ion Block Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03A8;
-    x->title="Ion Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03AA;
-    x->title="Ion Wedge Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x03AC;
-    x->title="Ion Wedge Position Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0401;
-    x->title="Referenced Setup Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0402;
-    x->title="Setup Image Comment";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0410;
-    x->title="Motion Synchronization Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0412;
-    x->title="Control Point Orientation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0420;
-    x->title="General Accessory Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0421;
-    x->title="General Accessory ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0422;
-    x->title="General Accessory Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0423;
-    x->title="General Accessory Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0424;
-    x->title="General Accessory Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0425;
-    x->title="Source to General Accessory Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0431;
-    x->title="Applicator Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0432;
-    x->title="Applicator Aperture Shape";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0433;
-    x->title="Applicator Opening";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0434;
-    x->title="Applicator Opening X";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0435;
-    x->title="Applicator Opening Y";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0436;
-    x->title="Source to Applicator Mounting Position Distance";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0440;
-    x->title="Number of Block Slab Items";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0441;
-    x->title="Block Slab Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0442;
-    x->title="Block Slab Thickness";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0443;
-    x->title="Block Slab Number";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0450;
-    x->title="Device Motion Control Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0451;
-    x->title="Device Motion Execution Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0452;
-    x->title="Device Motion Observation Mode";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0453;
-    x->title="Device Motion Parameter Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0501;
-    x->title="Distal Depth Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0502;
-    x->title="Distal Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0503;
-    x->title="Nominal Range Modulation Fractions";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0504;
-    x->title="Nominal Range Modulated Region Depths";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0505;
-    x->title="Depth Dose Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0506;
-    x->title="Delivered Depth Dose Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0507;
-    x->title="Delivered Distal Depth Fraction";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0508;
-    x->title="Delivered Distal Depth";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0509;
-    x->title="Delivered Nominal Range Modulation Fractions";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0510;
-    x->title="Delivered Nominal Range Modulated Region Depths";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0511;
-    x->title="Delivered Reference Dose Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300A;
-    x->tag[1]=0x0512;
-    x->title="Reference Dose Definition";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0002;
-    x->title="Referenced RT Plan Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0004;
-    x->title="Referenced Beam Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0006;
-    x->title="Referenced Beam Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0007;
-    x->title="Referenced Reference Image Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0008;
-    x->title="Start Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0009;
-    x->title="End Cumulative Meterset Weight";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000A;
-    x->title="Referenced Brachy Application Setup Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000C;
-    x->title="Referenced Brachy Application Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x000E;
-    x->title="Referenced Source Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0020;
-    x->title="Referenced Fraction Group Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0022;
-    x->title="Referenced Fraction Group Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0040;
-    x->title="Referenced Verification Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0042;
-    x->title="Referenced Reference Image Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0050;
-    x->title="Referenced Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0051;
-    x->title="Referenced Dose Reference Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0055;
-    x->title="Brachy Referenced Dose Reference Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0060;
-    x->title="Referenced Structure Set Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x006A;
-    x->title="Referenced Patient Setup Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0080;
-    x->title="Referenced Dose Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00A0;
-    x->title="Referenced Tolerance Table Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00B0;
-    x->title="Referenced Bolus Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00C0;
-    x->title="Referenced Wedge Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00D0;
-    x->title="Referenced Compensator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00E0;
-    x->title="Referenced Block Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F0;
-    x->title="Referenced Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F2;
-    x->title="Referenced Control Point Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F4;
-    x->title="Referenced Start Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x00F6;
-    x->title="Referenced Stop Control Point Index";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0100;
-    x->title="Referenced Range Shifter Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0102;
-    x->title="Referenced Lateral Spreading Device Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0104;
-    x->title="Referenced Range Modulator Number";
-    x->vr="IS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0111;
-    x->title="Omitted Beam Task Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0112;
-    x->title="Reason for Omission";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300C;
-    x->tag[1]=0x0113;
-    x->title="Reason for Omission Description";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0002;
-    x->title="Approval Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0004;
-    x->title="Review Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0005;
-    x->title="Review Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x300E;
-    x->tag[1]=0x0008;
-    x->title="Reviewer Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4000;
-    x->tag[1]=0x0010;
-    x->title="Arbitrary";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4000;
-    x->tag[1]=0x4000;
-    x->title="Text Comments";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0040;
-    x->title="Results ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0042;
-    x->title="Results ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0050;
-    x->title="Referenced Interpretation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x00FF;
-    x->title="Report Production Status (Trial)";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0100;
-    x->title="Interpretation Recorded Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0101;
-    x->title="Interpretation Recorded Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0102;
-    x->title="Interpretation Recorder";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0103;
-    x->title="Reference to Recorded Sound";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0108;
-    x->title="Interpretation Transcription Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0109;
-    x->title="Interpretation Transcription Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010A;
-    x->title="Interpretation Transcriber";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010B;
-    x->title="Interpretation Text";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x010C;
-    x->title="Interpretation Author";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0111;
-    x->title="Interpretation Approver Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0112;
-    x->title="Interpretation Approval Date";
-    x->vr="DA";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0113;
-    x->title="Interpretation Approval Time";
-    x->vr="TM";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0114;
-    x->title="Physician Approving Interpretation";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0115;
-    x->title="Interpretation Diagnosis Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0117;
-    x->title="Interpretation Diagnosis Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0118;
-    x->title="Results Distribution List Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0119;
-    x->title="Distribution Name";
-    x->vr="PN";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x011A;
-    x->title="Distribution Address";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0200;
-    x->title="Interpretation ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0202;
-    x->title="Interpretation ID Issuer";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0210;
-    x->title="Interpretation Type ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0212;
-    x->title="Interpretation Status ID";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x0300;
-    x->title="Impressions";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4008;
-    x->tag[1]=0x4000;
-    x->title="Results Comments";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0001;
-    x->title="Low Energy Detectors";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0002;
-    x->title="High Energy Detectors";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x0004;
-    x->title="Detector Geometry Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1001;
-    x->title="Threat ROI Voxel Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1004;
-    x->title="Threat ROI Base";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1005;
-    x->title="Threat ROI Extents";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1006;
-    x->title="Threat ROI Bitmap";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1007;
-    x->title="Route Segment ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1008;
-    x->title="Gantry Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1009;
-    x->title="OOI Owner Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x100A;
-    x->title="Route Segment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1010;
-    x->title="Potential Threat Object ID";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1011;
-    x->title="Threat Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1012;
-    x->title="Threat Category";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1013;
-    x->title="Threat Category Description";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1014;
-    x->title="ATD Ability Assessment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1015;
-    x->title="ATD Assessment Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1016;
-    x->title="ATD Assessment Probability";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1017;
-    x->title="Mass";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1018;
-    x->title="Density";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1019;
-    x->title="Z Effective";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101A;
-    x->title="Boarding Pass ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101B;
-    x->title="Center of Mass";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101C;
-    x->title="Center of PTO";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101D;
-    x->title="Bounding Polygon";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101E;
-    x->title="Route Segment Start Location ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x101F;
-    x->title="Route Segment End Location ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1020;
-    x->title="Route Segment Location ID Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1021;
-    x->title="Abort Reason";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1023;
-    x->title="Volume of PTO";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1024;
-    x->title="Abort Flag";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1025;
-    x->title="Route Segment Start Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1026;
-    x->title="Route Segment End Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1027;
-    x->title="TDR Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1028;
-    x->title="International Route Segment";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1029;
-    x->title="Threat Detection Algorithm and Version";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x102A;
-    x->title="Assigned Location";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x102B;
-    x->title="Alarm Decision Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1031;
-    x->title="Alarm Decision";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1033;
-    x->title="Number of Total Objects";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1034;
-    x->title="Number of Alarm Objects";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1037;
-    x->title="PTO Representation Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1038;
-    x->title="ATD Assessment Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1039;
-    x->title="TIP Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x103A;
-    x->title="Version";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1041;
-    x->title="OOI Owner Creation Time";
-    x->vr="DT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1042;
-    x->title="OOI Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1043;
-    x->title="OOI Size";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1044;
-    x->title="Acquisition Status";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1045;
-    x->title="Basis Materials Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1046;
-    x->title="Phantom Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1047;
-    x->title="OOI Owner Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1048;
-    x->title="Scan Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1051;
-    x->title="Itinerary ID";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1052;
-    x->title="Itinerary ID Type";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1053;
-    x->title="Itinerary ID Assigning Authority";
-    x->vr="LO";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1054;
-    x->title="Route ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1055;
-    x->title="Route ID Assigning Authority";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1056;
-    x->title="Inbound Arrival Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1058;
-    x->title="Carrier ID";
-    x->vr="SH";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1059;
-    x->title="Carrier ID Assigning Authority";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1060;
-    x->title="Source Orientation";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1061;
-    x->title="Source Position";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1062;
-    x->title="Belt Height";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1064;
-    x->title="Algorithm Routing Code Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1067;
-    x->title="Transport Classification";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1068;
-    x->title="OOI Type Descriptor";
-    x->vr="LT";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1069;
-    x->title="Total Processing Time";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106C;
-    x->title="Detector Calibration Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106D;
-    x->title="Additional Screening Performed";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106E;
-    x->title="Additional Inspection Selection Criteria";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x106F;
-    x->title="Additional Inspection Method Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1070;
-    x->title="AIT Device Type";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1071;
-    x->title="QR Measurements Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1072;
-    x->title="Target Material Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1073;
-    x->title="SNR Threshold";
-    x->vr="FD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1075;
-    x->title="Image Scale Representation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1076;
-    x->title="Referenced PTO Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1077;
-    x->title="Referenced TDR Instance Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1078;
-    x->title="PTO Location Description";
-    x->vr="ST";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x1079;
-    x->title="Anomaly Locator Indicator Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107A;
-    x->title="Anomaly Locator Indicator";
-    x->vr="FL";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107B;
-    x->title="PTO Region Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107C;
-    x->title="Inspection Selection Criteria";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107D;
-    x->title="Secondary Inspection Method Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4010;
-    x->tag[1]=0x107E;
-    x->title="PRCS to RCS Orientation";
-    x->vr="DS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x4FFE;
-    x->tag[1]=0x0001;
-    x->title="MAC Parameters Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0005;
-    //x->title="Curve Dimensions";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0010;
-    //x->title="Number of Points";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0020;
-    //x->title="Type of Data";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0022;
-    //x->title="Curve Description";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0030;
-    //x->title="Axis Units";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0040;
-    //x->title="Axis Labels";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0103;
-    //x->title="Data Value Representation";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0104;
-    //x->title="Minimum Coordinate Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0105;
-    //x->title="Maximum Coordinate Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0106;
-    //x->title="Curve Range";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0110;
-    //x->title="Curve Data Descriptor";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0112;
-    //x->title="Coordinate Start Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x0114;
-    //x->title="Coordinate Step Value";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x1001;
-    //x->title="Curve Activation Layer";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2000;
-    //x->title="Audio Type";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2002;
-    //x->title="Audio Sample Format";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2004;
-    //x->title="Number of Channels";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2006;
-    //x->title="Number of Samples";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2008;
-    //x->title="Sample Rate";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200A;
-    //x->title="Total Time";
-    //x->vr="UL";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200C;
-    //x->title="Audio Sample Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x200E;
-    //x->title="Audio Comments";
-    //x->vr="LT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2500;
-    //x->title="Curve Label";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2600;
-    //x->title="Curve Referenced Overlay Sequence";
-    //x->vr="SQ";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x2610;
-    //x->title="Curve Referenced Overlay Group";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x50xx;
-    //x->tag[1]=0x3000;
-    //x->title="Curve Data";
-    //x->vr="OB";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5200;
-    x->tag[1]=0x9229;
-    x->title="Shared Functional Groups Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5200;
-    x->tag[1]=0x9230;
-    x->title="Per-frame Functional Groups Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0100;
-    x->title="Waveform Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0110;
-    x->title="Channel Minimum Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x0112;
-    x->title="Channel Maximum Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1004;
-    x->title="Waveform Bits Allocated";
-    x->vr="US";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1006;
-    x->title="Waveform Sample Interpretation";
-    x->vr="CS";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x100A;
-    x->title="Waveform Padding Value";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5400;
-    x->tag[1]=0x1010;
-    x->title="Waveform Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5600;
-    x->tag[1]=0x0010;
-    x->title="First Order Phase Correction Angle";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x5600;
-    x->tag[1]=0x0020;
-    x->title="Spectroscopy Data";
-    x->vr="OF";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0010;
-    //x->title="Overlay Rows";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0011;
-    //x->title="Overlay Columns";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0012;
-    //x->title="Overlay Planes";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0015;
-    //x->title="Number of Frames in Overlay";
-    //x->vr="IS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0022;
-    //x->title="Overlay Description";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0040;
-    //x->title="Overlay Type";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0045;
-    //x->title="Overlay Subtype";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0050;
-    //x->title="Overlay Origin";
-    //x->vr="SS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0051;
-    //x->title="Image Frame Origin";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0052;
-    //x->title="Overlay Plane Origin";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0060;
-    //x->title="Overlay Compression Code";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0061;
-    //x->title="Overlay Compression Originator";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0062;
-    //x->title="Overlay Compression Label";
-    //x->vr="SH";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0063;
-    //x->title="Overlay Compression Description";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0066;
-    //x->title="Overlay Compression Step Pointers";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0068;
-    //x->title="Overlay Repeat Interval";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0069;
-    //x->title="Overlay Bits Grouped";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0100;
-    //x->title="Overlay Bits Allocated";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0102;
-    //x->title="Overlay Bit Position";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0110;
-    //x->title="Overlay Format";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0200;
-    //x->title="Overlay Location";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0800;
-    //x->title="Overlay Code Label";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0802;
-    //x->title="Overlay Number of Tables";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0803;
-    //x->title="Overlay Code Table Location";
-    //x->vr="AT";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x0804;
-    //x->title="Overlay Bits For Code Word";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1001;
-    //x->title="Overlay Activation Layer";
-    //x->vr="CS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1100;
-    //x->title="Overlay Descriptor - Gray";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1101;
-    //x->title="Overlay Descriptor - Red";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1102;
-    //x->title="Overlay Descriptor - Green";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1103;
-    //x->title="Overlay Descriptor - Blue";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1200;
-    //x->title="Overlays - Gray";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1201;
-    //x->title="Overlays - Red";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1202;
-    //x->title="Overlays - Green";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1203;
-    //x->title="Overlays - Blue";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1301;
-    //x->title="ROI Area";
-    //x->vr="IS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1302;
-    //x->title="ROI Mean";
-    //x->vr="DS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1303;
-    //x->title="ROI Standard Deviation";
-    //x->vr="DS";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x1500;
-    //x->title="Overlay Label";
-    //x->vr="LO";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x3000;
-    //x->title="Overlay Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x60xx;
-    //x->tag[1]=0x4000;
-    //x->title="Overlay Comments";
-    //x->vr="LT";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0008;
-    x->title="Float Pixel Data";
-    x->vr="OF";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0009;
-    x->title="Double Float Pixel Data";
-    x->vr="OD";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0010;
-    x->title="Pixel Data";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0020;
-    x->title="Coefficients SDVN";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0030;
-    x->title="Coefficients SDHN";
-    x->vr="OW";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0x7FE0;
-    x->tag[1]=0x0040;
-    x->title="Coefficients SDDN";
-    x->vr="OW";
-    lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0010;
-    //x->title="Variable Pixel Data";
-    //x->vr="OB";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0011;
-    //x->title="Variable Next Data Group";
-    //x->vr="US";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0020;
-    //x->title="Variable Coefficients SDVN";
-    //x->vr="OW";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0030;
-    //x->title="Variable Coefficients SDHN";
-    //x->vr="OW";
-    //lib.append(x);
-    //x = new Reference();
-    //x->tag[0]=0x7Fxx;
-    //x->tag[1]=0x0040;
-    //x->title="Variable Coefficients SDDN";
-    //x->vr="OW";
-    //lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFA;
-    x->tag[1]=0xFFFA;
-    x->title="Digital Signatures Sequence";
-    x->vr="SQ";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFC;
-    x->tag[1]=0xFFFC;
-    x->title="Data Set Trailing Padding";
-    x->vr="OB";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE000;
-    x->title="Item";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE00D;
-    x->title="Item Delimitation Item";
-    x->vr="";
-    lib.append(x);
-    x = new Reference();
-    x->tag[0]=0xFFFE;
-    x->tag[1]=0xE0DD;
-    x->title="Sequence Delimitation Item";
-    x->vr="";
-    lib.append(x);
 }
 
 database::~database() {
-	for (int i = 0; i < lib.size(); i++) {
-		delete lib[i];
-	}
-	lib.clear();
 }
 
-Reference database::binSearch(unsigned short int one, unsigned short int two,
-                              int min, int max) {
-    if (min == (max+min)/2) {
-        return *lib[min];
-    }
-
-    if (lib[(max+min)/2]->tag[0] > one) {
-        return binSearch(one, two, min, (max+min)/2);
-    }
-    else if (lib[(max+min)/2]->tag[0] < one) {
-        return binSearch(one, two, (max+min)/2, max);
-    }
-    else {
-        if (lib[(max+min)/2]->tag[1] > two) {
-            return binSearch(one, two, min, (max+min)/2);
-        }
-        else if (lib[(max+min)/2]->tag[1] < two) {
-            return binSearch(one, two, (max+min)/2, max);
-        }
-        else {
-            return *lib[(max+min)/2];
-        }
-    }
-}
\ No newline at end of file
+// Returns the entry matching the tag, or the closest one below it if the tag
+// is not in the dictionary
+const Reference *database::binSearch(unsigned short int one, unsigned short int two) const {
+	int min = 0, max = dictionarySize-1, mid;
+	unsigned int key = ((unsigned int)one << 16) + two, midKey;
+	
+	while (min < max) {
+		mid = (min+max+1)/2;
+		midKey = ((unsigned int)dictionary[mid].tag[0] << 16) + dictionary[mid].tag[1];
+		
+		if (midKey <= key)
+			min = mid;
+		else
+			max = mid-1;
+	}
+	
+	return &dictionary[min];
+}
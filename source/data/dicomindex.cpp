@@ -0,0 +1,126 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI dicomindex.cpp
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+
+#include "dicomindex.h"
+
+#define DICOM_INDEX_VERSION 2
+
+QString DICOMIndex::indexPath(QString gui_location, QString dir) {
+	QByteArray key = QCryptographicHash::hash(QDir(dir).absolutePath().toUtf8(), QCryptographicHash::Md5);
+	return gui_location+"/database/dicom_index/"+QString::fromLatin1(key.toHex())+".dcmidx";
+}
+
+int DICOMIndex::loadIndex(QString path) {
+	files.clear();
+	
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return 101;
+	
+	QDataStream in(&file);
+	QByteArray magic;
+	qint32 version, count;
+	in >> magic >> version;
+	if (magic != "DCMINDEX" || version != DICOM_INDEX_VERSION) {
+		file.close();
+		return 102;
+	}
+	
+	QString indexDir;
+	in >> indexDir >> count;
+	for (int i = 0; i < count && in.status() == QDataStream::Ok; i++) {
+		QString name;
+		DICOMIndexEntry entry;
+		in >> name >> entry.size >> entry.modified >> entry.modality >> entry.seriesUID
+		   >> entry.z >> entry.error;
+		files[name] = entry;
+	}
+	file.close();
+	
+	if (in.status() != QDataStream::Ok) {
+		files.clear();
+		return 103;
+	}
+	
+	dir = indexDir;
+	return 0;
+}
+
+int DICOMIndex::saveIndex(QString path) {
+	QFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+		return 101;
+	
+	QDataStream out(&file);
+	out << QByteArray("DCMINDEX") << qint32(DICOM_INDEX_VERSION) << dir << qint32(files.size());
+	for (QMap <QString, DICOMIndexEntry>::const_iterator it = files.constBegin(); it != files.constEnd(); ++it)
+		out << it.key() << it.value().size << it.value().modified << it.value().modality
+			<< it.value().seriesUID << it.value().z << it.value().error;
+	
+	file.close();
+	return 0;
+}
+
+bool DICOMIndex::isCurrent(QString file, const QFileInfo &info) const {
+	QMap <QString, DICOMIndexEntry>::const_iterator it = files.constFind(file);
+	return it != files.constEnd() && it.value().size == info.size() &&
+		   it.value().modified == info.lastModified().toMSecsSinceEpoch();
+}
+
+// Fill in an entry from a parsed file, dicom is NULL if it failed to parse
+DICOMIndexEntry DICOMIndex::makeEntry(QString file, DICOM *dicom, QString error) {
+	DICOMIndexEntry entry;
+	QFileInfo info(file);
+	entry.size = info.size();
+	entry.modified = info.lastModified().toMSecsSinceEpoch();
+	entry.error = error;
+	
+	if (dicom != NULL) {
+		unsigned short int tags[2][2] = {{0x0008, 0x0060}, {0x0020, 0x000E}};
+		QString *values[2] = {&entry.modality, &entry.seriesUID};
+		for (int i = 0; i < 2; i++) {
+			Attribute *att = dicom->getEntry(tags[i][0], tags[i][1]);
+			if (att->tag[0] == tags[i][0] && att->tag[1] == tags[i][1] && att->vf != NULL)
+				*values[i] = QString::fromLatin1((char*)att->vf, att->vl).remove(QChar('\0')).trimmed();
+		}
+		entry.z = dicom->z;
+	}
+	
+	return entry;
+}
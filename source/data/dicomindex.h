@@ -0,0 +1,71 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI dicomindex.h
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+
+#ifndef DICOMINDEX_H
+#define DICOMINDEX_H
+
+#include "DICOM.h"
+
+// What was found in one file of a scanned directory, enough to tell whether it is
+// worth parsing again and which series it belongs to
+struct DICOMIndexEntry {
+	qint64 size = -1;
+	qint64 modified = 0; // Last modified time in ms since epoch
+	QString modality; // Empty if the file could not be parsed
+	QString seriesUID;
+	double z = 0; // Slice position, to order the series without parsing it
+	QString error; // Why the file was rejected as CT, empty if it wasn't
+};
+
+// A per directory cache of DICOMIndexEntry kept under database/dicom_index/, so
+// re-opening a folder only has to look at the files that changed
+class DICOMIndex {
+public:
+	QString dir; // Directory this index describes
+	QMap <QString, DICOMIndexEntry> files; // Keyed by absolute file path
+	
+	static QString indexPath(QString gui_location, QString dir);
+	int loadIndex(QString path);
+	int saveIndex(QString path);
+	
+	bool isCurrent(QString file, const QFileInfo &info) const; // Same size and time as when indexed
+	static DICOMIndexEntry makeEntry(QString file, DICOM *dicom, QString error);
+};
+
+#endif
@@ -62,21 +62,9 @@ Dose::Dose(const Dose &d)
         cz.append(d.cz[i]);
     }
 
-    // Go through and fill the same doses and errors
-    val.resize(x);
-    err.resize(x);
-    for (int i = 0; i < d.x; i++) {
-        val[i].resize(y);
-        err[i].resize(y);
-        for (int j = 0; j < d.y; j++) {
-            val[i][j].resize(z);
-            err[i][j].resize(z);
-            for (int k = 0; k < d.z; k++) {
-                val[i][j][k] = d.val[i][j][k];
-                err[i][j][k] = d.err[i][j][k];
-            }
-        }
-    }
+    // Share the same doses and errors, which are copied on the first write
+    val = d.val;
+    err = d.err;
 }
 
 Dose::Dose(QString path, int n)
@@ -213,26 +201,12 @@ void Dose::readIn(QString path, int n) {
         *input >> y;
         *input >> z;
 
-        // Resize x appropriately
+        // Resize everything appropriately
         cx.resize(x+1);
-        val.resize(x);
-        err.resize(x);
-
-
-        // Resize y appropriately
         cy.resize(y+1);
-        for (int i = 0; i < x; i++) {
-            val[i].resize(y);
-            err[i].resize(y);
-        }
-
-        // Resize z appropriately
         cz.resize(z+1);
-        for (int i = 0; i < x; i++)
-            for (int j = 0; j < y; j++) {
-                val[i][j].resize(z);
-                err[i][j].resize(z);
-            }
+        val.resize(x, y, z);
+        err.resize(x, y, z);
 
         emit madeProgress(increment*0.01); // Update progress bar
 
@@ -309,25 +283,12 @@ void Dose::readBIn(QString path, int n) {
         *input >> y;
         *input >> z;
 
-        // Resize x appropriately
+        // Resize everything appropriately
         cx.resize(x+1);
-        val.resize(x);
-        err.resize(x);
-
-        // Resize y appropriately
         cy.resize(y+1);
-        for (int i = 0; i < x; i++) {
-            val[i].resize(y);
-            err[i].resize(y);
-        }
-
-        // Resize z appropriately
         cz.resize(z+1);
-        for (int i = 0; i < x; i++)
-            for (int j = 0; j < y; j++) {
-                val[i][j].resize(z);
-                err[i][j].resize(z);
-            }
+        val.resize(x, y, z);
+        err.resize(x, y, z);
 
         emit madeProgress(increment*0.01); // Update progress bar
 
@@ -381,6 +342,10 @@ void Dose::readOut(QString path, int n) {
     QTextStream *input;
     file = new QFile(path);
 
+    // Stripped doses only view their parent data, compact them before output
+    val.compact();
+    err.compact();
+
     // Determine the increment size of the status bar this 3ddose file gets
     double increment = 100.0/double(n);
 
@@ -451,6 +416,10 @@ void Dose::readBOut(QString path, int n) {
     QDataStream *input;
     file = new QFile(path);
 
+    // Stripped doses only view their parent data, compact them before output
+    val.compact();
+    err.compact();
+
     // Determine the increment size of the status bar this 3ddose file gets
     double increment = 100.0/double(n);
 
@@ -538,25 +507,9 @@ int Dose::strip() {
     cy.remove(0);
     cz.remove(0);
 
-    for (int i = 0; i < x; i++) {
-        for (int j = 0; j < y; j++) {
-            // Remove the first and last z value of each (x,y) line
-            val[i][j].remove(z-1);
-            val[i][j].remove(0);
-            err[i][j].remove(z-1);
-            err[i][j].remove(0);
-        }
-        // Remove the first and last y value of each x line
-        val[i].remove(y-1);
-        val[i].remove(0);
-        err[i].remove(y-1);
-        err[i].remove(0);
-    }
-    // Remove the first and last x values
-    val.remove(x-1);
-    val.remove(0);
-    err.remove(x-1);
-    err.remove(0);
+    // Keep a view of the inner voxels rather than copying them
+    val = val.crop(1, 1, 1, x-2, y-2, z-2);
+    err = err.crop(1, 1, 1, x-2, y-2, z-2);
 
     // Resize the variables that keep track of size
     x -= 2;
@@ -963,24 +916,24 @@ void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, doub
 	std::sort(data->begin(), data->end(), DV_sorter);
 }
 
-void Dose::getDV(QVector <DV> *data, EGSPhant* mask, double* volume, int n) {
+void Dose::getDV(QVector <DV> *data, EGSMask* mask, int s, double* volume, int n) {
     double increment = 95.0/double(n)/double(z);
-	double xVal, yVal, zVal;
 	double xLen, yLen, zLen;
-	double vol = (*volume) = 0;
+	double vol = (*volume) = 0, w; // w is the fraction of the voxel in the structure
+	QVector <int> ix, iy, iz;
+	getMaskIndices(mask, &ix, &iy, &iz);
 	data->clear();
     for (int k = 0; k < z; k++) {
-		zVal = (cz[k]+cz[k+1])/2.0;
 		zLen = (cz[k+1]-cz[k]);
 		emit madeProgress(increment); // Update progress bar
+		if (iz[k] < 0) continue;
         for (int j = 0; j < y; j++) {
-			yVal = (cy[j]+cy[j+1])/2.0;
 			yLen = (cy[j+1]-cy[j]);
+			if (iy[j] < 0) continue;
             for (int i = 0; i < x; i++) {
-				xVal = (cx[i]+cx[i+1])/2.0;
-				if (mask->getMedia(xVal, yVal, zVal) == 50) {
+				if (ix[i] >= 0 && (w = mask->fraction(ix[i], iy[j], iz[k], s)) > 0) {
 					xLen = (cx[i+1]-cx[i]);
-					vol = xLen*yLen*zLen;
+					vol = xLen*yLen*zLen*w;
 					(*volume) += vol;
 					data->append({val[i][j][k], err[i][j][k], vol});
 				}
@@ -992,37 +945,29 @@ void Dose::getDV(QVector <DV> *data, EGSPhant* mask, double* volume, int n) {
 	std::sort(data->begin(), data->end(), DV_sorter);
 }
 
-void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSPhant* mask, double* volume, int n) {
+void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSMask* mask, int s, double* volume, int n) {
     double increment = 95.0/double(n)/double(z);
 	double xVal, yVal, zVal;
 	double xLen, yLen, zLen;
-	double vol = (*volume) = 0;
+	double vol = (*volume) = 0, w; // w is the fraction of the voxel in the structure
+	QVector <int> ix, iy, iz;
+	getMaskIndices(mask, &ix, &iy, &iz);
 	data->clear();
     for (int k = 0; k < z; k++) {
 		zVal = (cz[k]+cz[k+1])/2.0;
 		zLen = (cz[k+1]-cz[k]);
 		emit madeProgress(increment); // Update progress bar
+		if (iz[k] < 0) continue;
         for (int j = 0; j < y; j++) {
 			yVal = (cy[j]+cy[j+1])/2.0;
 			yLen = (cy[j+1]-cy[j]);
+			if (iy[j] < 0) continue;
             for (int i = 0; i < x; i++) {
 				xVal = (cx[i]+cx[i+1])/2.0;
-				
-				if (allowedChars.contains(media->getMedia(xVal, yVal, zVal)) ||
-					mask->getMedia(xVal, yVal, zVal) == 50)
-					qDebug() << "Phantom media" << media->getMedia(xVal, yVal, zVal)
-							 << "- Mask media" << mask->getMedia(xVal, yVal, zVal);
-						 
-				if (allowedChars.contains(media->getMedia(xVal, yVal, zVal)))
-					qDebug() << "\tProstate media";
-				if (mask->getMedia(xVal, yVal, zVal) == 50)
-					qDebug() << "\tMask satisfaction";
-						 
-				if (allowedChars.contains(media->getMedia(xVal, yVal, zVal)) &&
-					mask->getMedia(xVal, yVal, zVal) == 50) {
-					qDebug() << "\t\tWe are in";
+				if (ix[i] >= 0 && (w = mask->fraction(ix[i], iy[j], iz[k], s)) > 0 &&
+					allowedChars.contains(media->getMedia(xVal, yVal, zVal))) {
 					xLen = (cx[i+1]-cx[i]);
-					vol = xLen*yLen*zLen;
+					vol = xLen*yLen*zLen*w;
 					(*volume) += vol;
 					data->append({val[i][j][k], err[i][j][k], vol});
 				}
@@ -1094,27 +1039,27 @@ void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, doub
 	std::sort(data->begin(), data->end(), DV_sorter);
 }
 
-void Dose::getDV(QVector <DV> *data, EGSPhant* mask, double* volume, double minDose, double maxDose, int n) {
+void Dose::getDV(QVector <DV> *data, EGSMask* mask, int s, double* volume, double minDose, double maxDose, int n) {
 	if (minDose >= maxDose)
 		maxDose = std::numeric_limits<double>::max(); // Set maxDose to max possible dose
     double increment = 95.0/double(n)/double(z);
-	double xVal, yVal, zVal;
 	double xLen, yLen, zLen;
-	double vol = (*volume) = 0;
+	double vol = (*volume) = 0, w; // w is the fraction of the voxel in the structure
+	QVector <int> ix, iy, iz;
+	getMaskIndices(mask, &ix, &iy, &iz);
 	data->clear();
     for (int k = 0; k < z; k++) {
-		zVal = (cz[k]+cz[k+1])/2.0;
 		zLen = (cz[k+1]-cz[k]);
 		emit madeProgress(increment); // Update progress bar
+		if (iz[k] < 0) continue;
         for (int j = 0; j < y; j++) {
-			yVal = (cy[j]+cy[j+1])/2.0;
 			yLen = (cy[j+1]-cy[j]);
+			if (iy[j] < 0) continue;
             for (int i = 0; i < x; i++) {
 				if (minDose <= val[i][j][k] && val[i][j][k] <= maxDose) {
-					xVal = (cx[i]+cx[i+1])/2.0;
-					if (mask->getMedia(xVal, yVal, zVal) == 50) {
+					if (ix[i] >= 0 && (w = mask->fraction(ix[i], iy[j], iz[k], s)) > 0) {
 						xLen = (cx[i+1]-cx[i]);
-						vol = xLen*yLen*zLen;
+						vol = xLen*yLen*zLen*w;
 						(*volume) += vol;
 						data->append({val[i][j][k], err[i][j][k], vol});
 					}
@@ -1127,28 +1072,32 @@ void Dose::getDV(QVector <DV> *data, EGSPhant* mask, double* volume, double minD
 	std::sort(data->begin(), data->end(), DV_sorter);
 }
 
-void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSPhant* mask, double* volume, double minDose, double maxDose, int n) {
+void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSMask* mask, int s, double* volume, double minDose, double maxDose, int n) {
 	if (minDose >= maxDose)
 		maxDose = std::numeric_limits<double>::max(); // Set maxDose to max possible dose
     double increment = 95.0/double(n)/double(z);
 	double xVal, yVal, zVal;
 	double xLen, yLen, zLen;
-	double vol = (*volume) = 0;
+	double vol = (*volume) = 0, w; // w is the fraction of the voxel in the structure
+	QVector <int> ix, iy, iz;
+	getMaskIndices(mask, &ix, &iy, &iz);
 	data->clear();
     for (int k = 0; k < z; k++) {
 		zVal = (cz[k]+cz[k+1])/2.0;
 		zLen = (cz[k+1]-cz[k]);
 		emit madeProgress(increment); // Update progress bar
+		if (iz[k] < 0) continue;
         for (int j = 0; j < y; j++) {
 			yVal = (cy[j]+cy[j+1])/2.0;
 			yLen = (cy[j+1]-cy[j]);
+			if (iy[j] < 0) continue;
             for (int i = 0; i < x; i++) {
 				if (minDose <= val[i][j][k] && val[i][j][k] <= maxDose) {
 					xVal = (cx[i]+cx[i+1])/2.0;
-					if (allowedChars.contains(media->getMedia(xVal, yVal, zVal)) &&
-						mask->getMedia(xVal, yVal, zVal) == 50) {
+					if (ix[i] >= 0 && (w = mask->fraction(ix[i], iy[j], iz[k], s)) > 0 &&
+						allowedChars.contains(media->getMedia(xVal, yVal, zVal))) {
 						xLen = (cx[i+1]-cx[i]);
-						vol = xLen*yLen*zLen;
+						vol = xLen*yLen*zLen*w;
 						(*volume) += vol;
 						data->append({val[i][j][k], err[i][j][k], vol});
 					}
@@ -1161,14 +1110,13 @@ void Dose::getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSP
 	std::sort(data->begin(), data->end(), DV_sorter);
 }
 
-void Dose::getDVs(QVector <QVector <DV> > *data, QVector <EGSPhant*> *masks, QVector <double> *volume) {
+void Dose::getDVs(QVector <QVector <DV> > *data, EGSMask* mask, QVector <int> *structs, QVector <double> *volume) {
 	emit nameProgress("Filtering data"); // Change progress bar name
 	
-	if (data->size() != masks->size() && data->size() != volume->size())
-		return; // Quit if mask and data array size do not align
+	if (data->size() != structs->size() || data->size() != volume->size())
+		return; // Quit if structure and data array size do not align
 	
 	double increment = 55.0/double(z);
-	double xVal, yVal, zVal;
 	double xLen, yLen, zLen;
 	double vol;
 	DV dataPoint;
@@ -1178,21 +1126,66 @@ void Dose::getDVs(QVector <QVector <DV> > *data, QVector <EGSPhant*> *masks, QVe
 		(*data)[i].clear();
 	}
 	
+	QVector <int> ix, iy, iz;
+	getMaskIndices(mask, &ix, &iy, &iz);
+	
+	// List the outputs fed by each label, so each voxel is a single label lookup
+	QVector <QVector <int> > labelData(mask->overlap.size());
+	for (int l = 0; l < mask->overlap.size(); l++)
+		for (int n = 0; n < structs->size(); n++)
+			if (0 <= (*structs)[n] && (*structs)[n] < mask->overlap[l].size() &&
+				mask->overlap[l].testBit((*structs)[n]))
+				labelData[l] << n;
+	
+	// Structures with partial volumes are weighted by their fractions instead, which
+	// also adds the voxels they partly cover without holding the voxel centre
+	QVector <bool> weighted(structs->size(), false);
+	QBitArray partialVoxel(mask->label.size());
+	bool anyWeighted = false;
+	for (int n = 0; n < structs->size(); n++) {
+		int s = (*structs)[n];
+		if (0 <= s && s < mask->partial.size() && !mask->partial[s].isEmpty()) {
+			weighted[n] = anyWeighted = true;
+			for (QHash <int, unsigned char>::const_iterator it = mask->partial[s].constBegin(); it != mask->partial[s].constEnd(); ++it)
+				partialVoxel.setBit(it.key());
+		}
+	}
+	
     for (int k = 0; k < z; k++) {
-		zVal = (cz[k]+cz[k+1])/2.0;
 		zLen = (cz[k+1]-cz[k]);
 		emit madeProgress(increment); // Update progress bar
+		if (iz[k] < 0) continue;
         for (int j = 0; j < y; j++) {
-			yVal = (cy[j]+cy[j+1])/2.0;
 			yLen = (cy[j+1]-cy[j]);
+			if (iy[j] < 0) continue;
             for (int i = 0; i < x; i++) {
-				xVal = (cx[i]+cx[i+1])/2.0;
+				if (ix[i] < 0) continue;
+				int v = ix[i]+mask->nx*(iy[j]+mask->ny*iz[k]);
+				const QVector <int> &targets = labelData[mask->label[v]];
+				bool partial = anyWeighted && partialVoxel.testBit(v);
+				if (targets.isEmpty() && !partial) continue;
+				
 				xLen = (cx[i+1]-cx[i]);
 				vol = xLen*yLen*zLen;
 				dataPoint = {val[i][j][k], err[i][j][k], vol};
-				for (int n = 0; n < masks->size(); n++) {
-					if ((*masks)[n]->getMedia(xVal, yVal, zVal) == 50) {
-						(*volume)[n] += vol;
+				if (!partial) {
+					for (int n = 0; n < targets.size(); n++) {
+						(*volume)[targets[n]] += vol;
+						(*data)[targets[n]].append(dataPoint);
+					}
+					continue;
+				}
+				
+				for (int n = 0; n < structs->size(); n++) {
+					if (weighted[n])
+						dataPoint.vol = vol*mask->fraction(v, (*structs)[n]);
+					else if (targets.contains(n))
+						dataPoint.vol = vol;
+					else
+						continue;
+					
+					if (dataPoint.vol > 0) {
+						(*volume)[n] += dataPoint.vol;
 						(*data)[n].append(dataPoint);
 					}
 				}
@@ -1205,6 +1198,19 @@ void Dose::getDVs(QVector <QVector <DV> > *data, QVector <EGSPhant*> *masks, QVe
 		std::sort((*data)[i].begin(), (*data)[i].end(), DV_sorter);
 }
 
+void Dose::getMaskIndices(EGSMask* mask, QVector <int> *ix, QVector <int> *iy, QVector <int> *iz) {
+	ix->resize(x);
+	iy->resize(y);
+	iz->resize(z);
+	
+	for (int i = 0; i < x; i++)
+		(*ix)[i] = mask->getIndex("x axis", (cx[i]+cx[i+1])/2.0);
+	for (int j = 0; j < y; j++)
+		(*iy)[j] = mask->getIndex("y axis", (cy[j]+cy[j+1])/2.0);
+	for (int k = 0; k < z; k++)
+		(*iz)[k] = mask->getIndex("z axis", (cz[k]+cz[k+1])/2.0);
+}
+
 QString Dose::getMetricCSV(QVector <DV> *data, double volume, QString name, QString DxStr, QString DccStr, QString VxStr, QString pDStr) {
 	QString names, units, average, uncertainty, voxels, volumes, minimum, maximum;
 	QStringList Dx, Vx, Dcc, temp;
@@ -41,6 +41,7 @@
 #define DOSE_H
 
 #include "egsphant.h"
+#include "egsmask.h"
 
 // This class holds dose, error, and volume for basic histogram construction
 struct DV {
@@ -67,8 +68,8 @@ public:
 
     int x, y, z; // The number of x, y and z voxels
     QVector <double> cx, cy, cz; // The actual x, y and z coordinates
-    QVector < QVector < QVector <double> > > val; // The values
-    QVector < QVector < QVector <double> > > err; // The fractional errors
+    Volume <double> val; // The values
+    Volume <double> err; // The fractional errors
 	
     // Interpolate the dose and error of the point (xp, yp, zp), function passes
     // value to val and error to err, and return val
@@ -117,15 +118,18 @@ public:
 	// Get sorted dose data for making DVH plots and tallying volume, with all possible filter parameters being their own function
 	void getDV(QVector <DV> *data, double* volume, int n = 1);
 	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, double* volume, int n = 1);
-	void getDV(QVector <DV> *data, EGSPhant* mask, double* volume, int n = 1);
-	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSPhant* mask, double* volume, int n = 1);
+	void getDV(QVector <DV> *data, EGSMask* mask, int s, double* volume, int n = 1);
+	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSMask* mask, int s, double* volume, int n = 1);
 	void getDV(QVector <DV> *data, double* volume, double minDose, double maxDose, int n = 1);
 	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, double* volume, double minDose, double maxDose, int n = 1);
-	void getDV(QVector <DV> *data, EGSPhant* mask, double* volume, double minDose, double maxDose, int n = 1);
-	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSPhant* mask, double* volume, double minDose, double maxDose, int n = 1);
+	void getDV(QVector <DV> *data, EGSMask* mask, int s, double* volume, double minDose, double maxDose, int n = 1);
+	void getDV(QVector <DV> *data, EGSPhant* media, QString allowedChars, EGSMask* mask, int s, double* volume, double minDose, double maxDose, int n = 1);
 	
-	// Get sorted dose data for final metric extraction using masks
-	void getDVs(QVector <QVector <DV> > *data, QVector <EGSPhant*> *masks, QVector <double> *volume);
+	// Get sorted dose data for final metric extraction using mask structures structs
+	void getDVs(QVector <QVector <DV> > *data, EGSMask* mask, QVector <int> *structs, QVector <double> *volume);
+	
+	// Map the dose voxel centres onto mask voxel indices, -1 when outside the mask
+	void getMaskIndices(EGSMask* mask, QVector <int> *ix, QVector <int> *iy, QVector <int> *iz);
 	
 	// Generate metric outputs
 	QString getMetricCSV(QVector <DV> *data, double volume, QString name, QString DxStr, QString DccStr, QString VxStr, QString pDStr);
@@ -0,0 +1,571 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsmask.cpp
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+#include "egsmask.h"
+
+EGSMask::EGSMask() {
+	nx = ny = nz = 0;
+	lastLabel = 0;
+}
+
+// Make an empty label volume from an EGSPhant
+void EGSMask::makeMask(EGSPhant* phant, QVector <QString> names) {
+	nx = phant->nx;
+	ny = phant->ny;
+	nz = phant->nz;
+	x = phant->x;
+	y = phant->y;
+	z = phant->z;
+	structs = names;
+	
+	// Every voxel starts in label 0, which is in no structure
+	label.fill(0, nx*ny*nz);
+	overlap.clear();
+	labelHash.clear();
+	overlap.append(QBitArray(structs.size()));
+	labelHash.insert(overlap[0], 0);
+	lastSet = overlap[0];
+	lastLabel = 0;
+	partial = QVector <QHash <int, unsigned char> > (structs.size());
+}
+
+int EGSMask::addLabel(const QBitArray& set) {
+	if (set == lastSet)
+		return lastLabel;
+	
+	QHash <QBitArray, unsigned short>::const_iterator it = labelHash.constFind(set);
+	if (it != labelHash.constEnd()) {
+		lastLabel = it.value();
+	}
+	else { // New combination of structures
+		if (overlap.size() >= maxLabels)
+			return -1;
+		lastLabel = overlap.size();
+		overlap.append(set);
+		labelHash.insert(set, lastLabel);
+	}
+	lastSet = set;
+	
+	return lastLabel;
+}
+
+int EGSMask::addMask(EGSPhant* mask, int s) {
+	QBitArray set;
+	int v, l;
+	
+	for (int k = 0; k < nz && k < mask->nz; k++)
+		for (int j = 0; j < ny && j < mask->ny; j++)
+			for (int i = 0; i < nx && i < mask->nx; i++)
+				if (mask->m[i][j][k] == 50) {
+					v = i+nx*(j+ny*k);
+					set = overlap[label[v]];
+					set.setBit(s);
+					if ((l = addLabel(set)) < 0)
+						return 103;
+					label[v] = l;
+				}
+	
+	return 0;
+}
+
+void EGSMask::keepStructs(QVector <int> keep) {
+	QVector <QString> newStructs;
+	QVector <QBitArray> newOverlap;
+	QHash <QBitArray, unsigned short> newHash;
+	QVector <QHash <int, unsigned char> > newPartial(keep.size());
+	QVector <unsigned short> remap(overlap.size());
+	QBitArray set(keep.size());
+	
+	for (int n = 0; n < keep.size(); n++) {
+		newStructs << structs[keep[n]];
+		if (keep[n] < partial.size())
+			newPartial[n] = partial[keep[n]];
+	}
+	
+	// Project every label onto the kept structures
+	for (int l = 0; l < overlap.size(); l++) {
+		for (int n = 0; n < keep.size(); n++)
+			set.setBit(n, overlap[l].testBit(keep[n]));
+		
+		if (!newHash.contains(set)) {
+			newHash.insert(set, newOverlap.size());
+			newOverlap.append(set);
+		}
+		remap[l] = newHash[set];
+	}
+	
+	for (int v = 0; v < label.size(); v++)
+		label[v] = remap[label[v]];
+	
+	structs = newStructs;
+	overlap = newOverlap;
+	partial = newPartial;
+	labelHash = newHash;
+	lastSet = QBitArray();
+	lastLabel = 0;
+}
+
+int EGSMask::resample(const QVector <int> &ix, const QVector <int> &iy, const QVector <int> &iz) {
+	int new_nx = ix.size()-1, new_ny = iy.size()-1, new_nz = iz.size()-1;
+	if (new_nx < 1 || new_ny < 1 || new_nz < 1)
+		return 0;
+	int ns = structs.size();
+	
+	// The structures of each label
+	QVector <QVector <int> > labelStructs(overlap.size());
+	for (int l = 0; l < overlap.size(); l++)
+		for (int s = 0; s < ns; s++)
+			if (overlap[l].testBit(s))
+				labelStructs[l] << s;
+	
+	// Where partial volumes differ from the labels, by new voxel, as a volume to add
+	QVector <int> toI(nx), toJ(ny), toK(nz);
+	for (int I = 0; I < new_nx; I++)
+		for (int i = ix[I]; i < ix[I+1]; i++)
+			toI[i] = I;
+	for (int J = 0; J < new_ny; J++)
+		for (int j = iy[J]; j < iy[J+1]; j++)
+			toJ[j] = J;
+	for (int K = 0; K < new_nz; K++)
+		for (int k = iz[K]; k < iz[K+1]; k++)
+			toK[k] = K;
+	
+	QVector <QHash <int, double> > correction(ns);
+	for (int s = 0; s < partial.size() && s < ns; s++)
+		for (QHash <int, unsigned char>::const_iterator it = partial[s].constBegin(); it != partial[s].constEnd(); ++it) {
+			int v = it.key(), i = v%nx, j = (v/nx)%ny, k = v/(nx*ny);
+			double dv = (x[i+1]-x[i])*(y[j+1]-y[j])*(z[k+1]-z[k]);
+			correction[s][toI[i]+new_nx*(toJ[j]+new_ny*toK[k])] += dv*(it.value()/255.0-(inStruct(v, s) ? 1 : 0));
+		}
+	
+	// Each thread labels whole slices with its own labels, swapped for mask labels
+	// in slice order afterwards like the mask built with the phantom
+	QVector <unsigned short> new_label(new_nx*new_ny*new_nz, 0);
+	QVector <QVector <QBitArray> > sliceSets(new_nz);
+	QVector <QVector <QHash <int, unsigned char> > > slicePartial(new_nz);
+	QVector <int> slices(new_nz);
+	for (int k = 0; k < new_nz; k++)
+		slices[k] = k;
+	QAtomicInt tooManyLabels(0);
+	
+	QtConcurrent::blockingMap(slices, [&](int &K) {
+		QVector <QBitArray> &sets = sliceSets[K];
+		QHash <QBitArray, unsigned short> setLabel;
+		QVector <QHash <int, unsigned char> > &newPartial = slicePartial[K];
+		newPartial.resize(ns);
+		QVector <double> cover(ns);
+		QBitArray set(ns);
+		double dv, dyz, totalVol;
+		
+		for (int J = 0; J < new_ny; J++) {
+			for (int I = 0; I < new_nx; I++) {
+				int V = I+new_nx*(J+new_ny*K);
+				cover.fill(0);
+				totalVol = 0;
+				for (int k = iz[K]; k < iz[K+1]; k++)
+					for (int j = iy[J]; j < iy[J+1]; j++) {
+						dyz = (y[j+1]-y[j])*(z[k+1]-z[k]);
+						for (int i = ix[I]; i < ix[I+1]; i++) {
+							dv = (x[i+1]-x[i])*dyz;
+							const QVector <int> &in = labelStructs.at(label.at(i+nx*(j+ny*k)));
+							for (int n = 0; n < in.size(); n++)
+								cover[in[n]] += dv;
+							totalVol += dv;
+						}
+					}
+				if (totalVol <= 0)
+					continue;
+				
+				bool any = false;
+				for (int s = 0; s < ns; s++) {
+					double f = cover[s];
+					if (!correction.at(s).isEmpty())
+						f += correction.at(s).value(V);
+					f = qBound(0.0, f/totalVol, 1.0);
+					unsigned char frac = qRound(f*255);
+					set.setBit(s, f >= 0.5);
+					any = any || f >= 0.5;
+					if (frac != (f >= 0.5 ? 255 : 0))
+						newPartial[s].insert(V, frac);
+				}
+				
+				if (any) {
+					if (!setLabel.contains(set)) {
+						if (sets.size() >= maxLabels-1) { // No label left for it
+							tooManyLabels.store(1);
+							continue;
+						}
+						sets << set;
+						setLabel[set] = sets.size();
+					}
+					new_label[V] = setLabel[set];
+				}
+			}
+		}
+	});
+	if (tooManyLabels.load())
+		return 103;
+	
+	QVector <double> new_x, new_y, new_z;
+	for (int i = 0; i <= new_nx; i++)
+		new_x.append(x[ix[i]]);
+	for (int i = 0; i <= new_ny; i++)
+		new_y.append(y[iy[i]]);
+	for (int i = 0; i <= new_nz; i++)
+		new_z.append(z[iz[i]]);
+	
+	nx = new_nx;
+	ny = new_ny;
+	nz = new_nz;
+	x = new_x;
+	y = new_y;
+	z = new_z;
+	label = new_label;
+	
+	overlap.clear();
+	labelHash.clear();
+	overlap.append(QBitArray(ns));
+	labelHash.insert(overlap[0], 0);
+	lastSet = overlap[0];
+	lastLabel = 0;
+	partial = QVector <QHash <int, unsigned char> > (ns);
+	
+	for (int K = 0; K < nz; K++) {
+		QVector <unsigned short> global(sliceSets[K].size()+1, 0);
+		for (int l = 0; l < sliceSets[K].size(); l++) {
+			int g = addLabel(sliceSets[K][l]);
+			if (g < 0)
+				return 103;
+			global[l+1] = g;
+		}
+		
+		if (sliceSets[K].size())
+			for (int V = nx*ny*K; V < nx*ny*(K+1); V++)
+				label[V] = global[label[V]];
+		
+		for (int s = 0; s < ns; s++)
+			partial[s].unite(slicePartial[K][s]);
+	}
+	
+	emit madeProgress(100);
+	return 0;
+}
+
+// Output gz label volume, a text header followed by little endian labels
+int EGSMask::saveEGSMaskFile(QString path) {
+	ogzstream ogout(path.toStdString().c_str());
+	std::ostream* out = (std::ostream*)(&ogout);
+	
+	if (!out->good())
+		return 101;
+	
+	(*out) << "EGSMASK 2\n";
+	
+	// Structure names, one per line as they may contain spaces
+	(*out) << structs.size() << "\n";
+	for (int i = 0; i < structs.size(); i++)
+		(*out) << structs[i].toStdString() << "\n";
+	
+	// dimensions
+	(*out) << nx << " " << ny << " " << nz << "\n";
+	
+	// Boundaries
+	for (int i=0; i < nx; i++)
+		(*out) << x[i] << " ";
+	(*out) << x.last() << "\n";
+	
+	for (int i=0; i < ny; i++)
+		(*out) << y[i] << " ";
+	(*out) << y.last() << "\n";
+	
+	for (int i=0; i < nz; i++)
+		(*out) << z[i] << " ";
+	(*out) << z.last() << "\n";
+	
+	// Overlap table, the structure count followed by the structure indices
+	(*out) << overlap.size() << "\n";
+	for (int l = 0; l < overlap.size(); l++) {
+		(*out) << overlap[l].count(true);
+		for (int s = 0; s < overlap[l].size(); s++)
+			if (overlap[l].testBit(s))
+				(*out) << " " << s;
+		(*out) << "\n";
+	}
+	
+	// Labels
+	double increment = 100./double(nz); // 100%
+	QVector <unsigned short> slice(nx*ny);
+	for (int k = 0; k < nz; k++) {
+		for (int v = 0; v < nx*ny; v++)
+			slice[v] = qToLittleEndian(label[v+nx*ny*k]);
+		out->write((const char*)slice.constData(), nx*ny*sizeof(unsigned short));
+		emit madeProgress(increment);
+	}
+	
+	// Partial volumes of each structure, the voxel count followed by the little
+	// endian voxel indices and their fractions in increasing voxel order
+	for (int s = 0; s < structs.size(); s++) {
+		QList <int> voxels;
+		if (s < partial.size())
+			voxels = partial[s].keys();
+		std::sort(voxels.begin(), voxels.end());
+		
+		QVector <qint32> index(voxels.size());
+		QVector <unsigned char> frac(voxels.size());
+		for (int n = 0; n < voxels.size(); n++) {
+			index[n] = qToLittleEndian(qint32(voxels[n]));
+			frac[n] = partial[s][voxels[n]];
+		}
+		(*out) << voxels.size() << "\n";
+		out->write((const char*)index.constData(), index.size()*sizeof(qint32));
+		out->write((const char*)frac.constData(), frac.size());
+	}
+	
+	ogout.close();
+	
+	return 0;
+}
+
+int EGSMask::loadEGSMaskFile(QString path, bool namesOnly) {
+	igzstream ogin(path.toStdString().c_str());
+	std::istream* data = (std::istream*)(&ogin);
+	std::string line;
+	
+	if (!data->good())
+		return 101;
+	
+	std::getline(*data, line);
+	if (line.compare(0, 7, "EGSMASK"))
+		return 102;
+	int version = QString(line.c_str()).section(' ', 1, 1).toInt(); // Version 1 has no partial volumes
+	
+	int n;
+	*data >> n;
+	data->ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	
+	structs.clear(); // in case of reload
+	for (int i = 0; i < n; i++) {
+		std::getline(*data, line);
+		structs.append(QString(line.c_str()));
+	}
+	
+	if (namesOnly) { // Drop any previously loaded labels
+		label.clear();
+		overlap.clear();
+		partial.clear();
+		labelHash.clear();
+		nx = ny = nz = 0;
+		return 0;
+	}
+	
+	/* read in all bounds */
+	double bound;
+	
+	*data >> nx >> ny >> nz;
+	
+	x.clear(); // in case of reload
+	for (int i=0; i < nx+1; i++) {
+		*data >> bound;
+		x.append(bound);
+	}
+	y.clear(); // in case of reload
+	for (int i=0; i < ny+1; i++) {
+		*data >> bound;
+		y.append(bound);
+	}
+	z.clear(); // in case of reload
+	for (int i=0; i < nz+1; i++) {
+		*data >> bound;
+		z.append(bound);
+	}
+	
+	/* read in the overlap table */
+	int nl, c, s;
+	*data >> nl;
+	
+	overlap.clear();
+	labelHash.clear();
+	for (int l = 0; l < nl; l++) {
+		QBitArray set(n);
+		*data >> c;
+		for (int i = 0; i < c; i++) {
+			*data >> s;
+			if (s >= 0 && s < n)
+				set.setBit(s);
+		}
+		overlap.append(set);
+		labelHash.insert(set, l);
+	}
+	data->ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+	lastSet = QBitArray();
+	lastLabel = 0;
+	
+	/* read in the labels */
+	double increment = 100.0/double(nz); // 100%
+	label.resize(nx*ny*nz);
+	for (int k = 0; k < nz; k++) {
+		data->read((char*)(label.data()+nx*ny*k), nx*ny*sizeof(unsigned short));
+		for (int v = nx*ny*k; v < nx*ny*(k+1); v++)
+			label[v] = qFromLittleEndian(label[v]);
+		emit madeProgress(increment); // Update progress bar
+	}
+	
+	if (data->fail())
+		return 102;
+	
+	// Guard against labels outside of the table in a corrupt file
+	for (int v = 0; v < label.size(); v++)
+		if (label[v] >= overlap.size())
+			return 102;
+	
+	/* read in the partial volumes */
+	partial = QVector <QHash <int, unsigned char> > (n);
+	if (version >= 2) {
+		for (int i = 0; i < n; i++) {
+			*data >> c;
+			data->ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+			if (data->fail() || c < 0 || c > label.size())
+				return 102;
+			
+			QVector <qint32> index(c);
+			QVector <unsigned char> frac(c);
+			data->read((char*)index.data(), c*sizeof(qint32));
+			data->read((char*)frac.data(), c);
+			if (data->fail())
+				return 102;
+			
+			partial[i].reserve(c);
+			for (int v = 0; v < c; v++) {
+				index[v] = qFromLittleEndian(index[v]);
+				if (index[v] < 0 || index[v] >= label.size())
+					return 102;
+				partial[i].insert(index[v], frac[v]);
+			}
+		}
+	}
+	
+	return 0;
+}
+
+int EGSMask::loadMaskFiles(QString dir, QString name, bool namesOnly) {
+	if (QFile::exists(dir+name+".egsmask.gz"))
+		return loadEGSMaskFile(dir+name+".egsmask.gz", namesOnly);
+	
+	// Fall back on the old format of one mask phantom per structure
+	QStringList files;
+	QDirIterator it (dir, {QString(name)+".*.mask.egsphant.gz"},
+					 QDir::NoFilter, QDirIterator::Subdirectories);
+	while(it.hasNext()) {
+		it.next();
+		files << it.fileName();
+	}
+	
+	QVector <QString> names;
+	for (int i = 0; i < files.size(); i++)
+		names << files[i].mid(name.size()+1, files[i].size()-name.size()-18);
+	
+	structs = names;
+	label.clear();
+	overlap.clear();
+	partial.clear();
+	labelHash.clear();
+	nx = ny = nz = 0;
+	if (!files.size())
+		return 101;
+	if (namesOnly)
+		return 0;
+	
+	EGSPhant temp;
+	for (int i = 0; i < files.size(); i++) {
+		temp.loadgzEGSPhantFile(dir+files[i]);
+		if (i == 0)
+			makeMask(&temp, names);
+		if (addMask(&temp, i))
+			return 103;
+		emit madeProgress(100.0/double(files.size()));
+	}
+	
+	return 0;
+}
+
+int EGSMask::getIndex(QString axis, double p) {
+	const QVector <double>* b;
+	
+	if (!axis.compare("x axis"))
+		b = &x;
+	else if (!axis.compare("y axis"))
+		b = &y;
+	else if (!axis.compare("z axis"))
+		b = &z;
+	else
+		return -1;
+	
+	if (b->size() < 2 || p < b->first() || p > b->last())
+		return -1; // We are not within our bounds
+	
+	// First voxel whose upper boundary is not below p
+	return std::lower_bound(b->constBegin()+1, b->constEnd(), p)-(b->constBegin()+1);
+}
+
+int EGSMask::getVoxel(double px, double py, double pz) {
+	int ix = getIndex("x axis", px), iy = getIndex("y axis", py), iz = getIndex("z axis", pz);
+	
+	if (ix < 0 || iy < 0 || iz < 0)
+		return -1;
+	
+	return ix+nx*(iy+ny*iz);
+}
+
+bool EGSMask::inStruct(double px, double py, double pz, int s) {
+	int v = getVoxel(px, py, pz);
+	
+	if (v < 0 || s < 0 || s >= structs.size())
+		return false;
+	
+	return inStruct(v, s);
+}
+
+double EGSMask::fraction(int v, int s) {
+	if (s < partial.size() && !partial[s].isEmpty()) {
+		QHash <int, unsigned char>::const_iterator it = partial[s].constFind(v);
+		if (it != partial[s].constEnd())
+			return it.value()/255.0;
+	}
+	
+	return inStruct(v, s) ? 1.0 : 0.0;
+}
@@ -0,0 +1,115 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsmask.h
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+#ifndef EGSMASK_H
+#define EGSMASK_H
+
+#include <QtWidgets>
+#include <iostream>
+#include <math.h>
+#include "egsphant.h"
+#include "libraries/gzstream.h"
+
+// This class holds every structure mask of a phantom in a single label
+// volume, each voxel stores a label and each label maps to the set of
+// (possibly overlapping) structures that contain it
+class EGSMask : public QObject {
+	Q_OBJECT
+
+signals:
+	void madeProgress(double percent); // Update the progress bar
+
+public:
+	EGSMask();
+
+	int nx, ny, nz; // these hold the number of voxels
+	QVector <double> x, y, z; // these hold the boundaries of the above voxels
+	QVector <QString> structs; // this holds the structure names
+	QVector <unsigned short> label; // this holds the voxel labels, indexed i+nx*(j+ny*k)
+	QVector <QBitArray> overlap; // this holds the structures of each label, label 0 is no structure
+	QVector <QHash <int, unsigned char> > partial; // this holds the fractions (of 255) of structure s that differ from the labels
+	
+	// Make an empty label volume with the geometry of phant
+	void makeMask(EGSPhant* phant, QVector <QString> names);
+	
+	// Labels are unsigned short, so there can be at most this many structure sets
+	static const int maxLabels = 65536;
+	
+	// Get the label of a structure set, adding it to the overlap table if it is new,
+	// or -1 if the table is full
+	int addLabel(const QBitArray& set);
+	
+	// Add an old style mask phantom (TARGET media is in the structure) as structure s,
+	// 103 if there are too many structure sets
+	int addMask(EGSPhant* mask, int s);
+	
+	// Only keep the listed structures, merging labels that become identical
+	void keepStructs(QVector <int> keep);
+	
+	// Merge the voxels between the boundary indices ix, iy and iz into one (see
+	// EGSPhant::resample), each in the structures covering at least half of it with
+	// the fractions they cover kept as partial volumes, 103 if there are too many
+	// structure sets
+	int resample(const QVector <int> &ix, const QVector <int> &iy, const QVector <int> &iz);
+	
+	// Save or load the label volume, or all the masks of phantom name in dir, which
+	// falls back on old per structure mask phantoms, only the names are read if namesOnly
+	int saveEGSMaskFile(QString path);
+	int loadEGSMaskFile(QString path, bool namesOnly = false);
+	int loadMaskFiles(QString dir, QString name, bool namesOnly = false);
+	
+	// Index lookups, using the same bounds convention as EGSPhant::getMedia
+	int getIndex(QString axis, double p);
+	int getVoxel(double px, double py, double pz);
+	
+	// Is voxel (i,j,k), flat voxel index v or point p in structure s
+	bool inStruct(int i, int j, int k, int s) {return overlap[label[i+nx*(j+ny*k)]].testBit(s);}
+	bool inStruct(int v, int s) {return overlap[label[v]].testBit(s);}
+	bool inStruct(double px, double py, double pz, int s);
+	
+	// Fraction of voxel (i,j,k) or flat voxel index v in structure s, used to weight its volume
+	double fraction(int i, int j, int k, int s) {return fraction(i+nx*(j+ny*k), s);}
+	double fraction(int v, int s);
+
+private:
+	QHash <QBitArray, unsigned short> labelHash; // overlap table lookup
+	QBitArray lastSet; // last structure set passed to addLabel
+	unsigned short lastLabel; // and its label, neighbouring voxels tend to repeat it
+};
+
+#endif
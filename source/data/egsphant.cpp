@@ -40,10 +40,19 @@
 
 EGSPhant::EGSPhant() {
     nx = ny = nz = 0;
+	picCache.setMaxCost(256*1024); // 256 MB of rendered slices
+	slabCache.setMaxCost(512*1024); // 512 MB of chunked phantom slabs
+	chunkSlab = 1;
 }
 
 // Output gz egsphant
 void EGSPhant::savegzEGSPhantFilePlus(QString path) { // Progress percentages assume GUI construction
+	// Cropped phantoms only view their parent data, so compact them before they
+	// are written out and let the parent data go
+	loadAllSlabs();
+	m.compact();
+	d.compact();
+	
 	// Ripped fairly whole-cloth from egs_brachy
 	ogzstream ogout(path.toStdString().c_str());
 	std::ostream* out = (std::ostream*)(&ogout);
@@ -104,6 +113,9 @@ void EGSPhant::savegzEGSPhantFilePlus(QString path) { // Progress percentages as
 
 // Output gz mask
 void EGSPhant::savegzEGSPhantFile(QString path) {
+	loadAllSlabs();
+	m.compact();
+	
 	// Ripped fairly whole-cloth from egs_brachy
 	ogzstream ogout(path.toStdString().c_str());
 	std::ostream* out = (std::ostream*)(&ogout);
@@ -153,6 +165,76 @@ void EGSPhant::savegzEGSPhantFile(QString path) {
 	}
 }
 
+// Output chunked egsphant
+int EGSPhant::saveChunkedEGSPhantFile(QString path, int slabSize) {
+	if (slabSize < 1)
+		slabSize = 1;
+	loadAllSlabs();
+	
+	QFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+		return 101;
+	
+	QDataStream out(&file);
+	out.setByteOrder(QDataStream::LittleEndian);
+	
+	// Header
+	out.writeRawData("EGSCHUNK", 8);
+	out << qint32(1) << qint32(nx) << qint32(ny) << qint32(nz) << qint32(slabSize);
+	out << qint32(media.size());
+	for (int i = 0; i < media.size(); i++)
+		out << media[i].toLatin1();
+	for (int i = 0; i <= nx; i++)
+		out << x[i];
+	for (int i = 0; i <= ny; i++)
+		out << y[i];
+	for (int i = 0; i <= nz; i++)
+		out << z[i];
+	out << maxDensity;
+	
+	// Leave room for the index and fill it in once the slab sizes are known
+	int nSlabs = (nz+slabSize-1)/slabSize;
+	out << qint32(nSlabs);
+	qint64 indexPos = file.pos();
+	QVector <qint64> offset(nSlabs+1, 0);
+	for (int s = 0; s <= nSlabs; s++)
+		out << offset[s];
+	
+	// Slabs, media followed by densities
+	for (int s = 0; s < nSlabs; s++) {
+		int kf = qMin(nz, (s+1)*slabSize);
+		QByteArray raw;
+		raw.reserve(nx*ny*(kf-s*slabSize)*9);
+		{
+			QDataStream slab(&raw, QIODevice::WriteOnly);
+			slab.setByteOrder(QDataStream::LittleEndian);
+			for (int k = s*slabSize; k < kf; k++)
+				for (int j = 0; j < ny; j++)
+					for (int i = 0; i < nx; i++)
+						slab << qint8(m[i][j][k]);
+			for (int k = s*slabSize; k < kf; k++)
+				for (int j = 0; j < ny; j++)
+					for (int i = 0; i < nx; i++)
+						slab << d[i][j][k];
+		}
+		
+		offset[s] = file.pos();
+		QByteArray block = qCompress(raw);
+		out.writeRawData(block.constData(), block.size());
+	}
+	offset[nSlabs] = file.pos();
+	
+	file.seek(indexPos);
+	for (int s = 0; s <= nSlabs; s++)
+		out << offset[s];
+	
+	if (out.status() != QDataStream::Ok)
+		return 102;
+	
+	file.close();
+	return 0;
+}
+
 // Make a mask template from another EGSPhant
 void EGSPhant::makeMask(EGSPhant* mask) {
     nx = mask->nx;
@@ -162,23 +244,15 @@ void EGSPhant::makeMask(EGSPhant* mask) {
 	y = mask->y;
 	z = mask->z;
     maxDensity = mask->maxDensity;
-	{
-		// Set all media to OTHER
-		QVector <char> mz(nz, 49);
-		QVector <QVector <char> > my(ny, mz);
-		QVector <QVector <QVector <char> > > mx(nx, my);
-		m = mx;
-		
-		// Remove densities from here as they aren't needed for masks
-		//QVector <double> dz(nz, 0);
-		//QVector <QVector <double> > dy(ny, dz);
-		//QVector <QVector <QVector <double> > > dx(nx, dy);
-		//d = dx;
-	}
+	m.resize(nx, ny, nz, 49); // Set all media to OTHER
+	picCache.clear();
+	// Densities aren't needed for masks
     media << "OTHER" << "TARGET";
 }
 
 void EGSPhant::loadEGSPhantFile(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
     QFile file(path);
 
     // Increment size of the status bar
@@ -214,16 +288,8 @@ void EGSPhant::loadEGSPhantFile(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        m.resize(nx, ny, nz, 0);
+        d.resize(nx, ny, nz, 0);
 
         // read in all the boundaries of the phantom
         input.skipWhiteSpace();
@@ -255,6 +321,8 @@ void EGSPhant::loadEGSPhantFile(QString path) {
 }
 
 void EGSPhant::loadEGSPhantFilePlus(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
     QFile file(path);
 
     // Increment size of the status bar
@@ -289,16 +357,8 @@ void EGSPhant::loadEGSPhantFilePlus(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        m.resize(nx, ny, nz, 0);
+        d.resize(nx, ny, nz, 0);
 
         // read in all the boundaries of the phantom
         input.skipWhiteSpace();
@@ -345,6 +405,8 @@ void EGSPhant::loadEGSPhantFilePlus(QString path) {
 }
 
 void EGSPhant::loadbEGSPhantFile(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
     QFile file(path);
 
     // Increment size of the status bar
@@ -383,16 +445,8 @@ void EGSPhant::loadbEGSPhantFile(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        m.resize(nx, ny, nz, 0);
+        d.resize(nx, ny, nz, 0);
 
         // read in all the boundaries of the phantom
         for (int i = 0; i <= nx; i++) {
@@ -423,6 +477,8 @@ void EGSPhant::loadbEGSPhantFile(QString path) {
 }
 
 void EGSPhant::loadbEGSPhantFilePlus(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
     QFile file(path);
 
     // Increment size of the status bar
@@ -461,16 +517,8 @@ void EGSPhant::loadbEGSPhantFilePlus(QString path) {
         z.fill(0,nz+1);
 
         // resize the 3D matrix to hold all densities
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        m.resize(nx, ny, nz, 0);
+        d.resize(nx, ny, nz, 0);
 
         // read in all the boundaries of the phantom
         for (int i = 0; i <= nx; i++) {
@@ -514,6 +562,8 @@ void EGSPhant::loadbEGSPhantFilePlus(QString path) {
 }
 
 void EGSPhant::loadgzEGSPhantFile(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
 	// Ripped fairly whole-cloth from egs_brachy
 	igzstream ogin(path.toStdString().c_str());
 	std::istream* data = (std::istream*)(&ogin);
@@ -559,12 +609,7 @@ void EGSPhant::loadgzEGSPhantFile(QString path) {
 			z.append(bound);
 		}
 		
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-        }
+        m.resize(nx, ny, nz, 0);
 				
 		/* now we've got all geometry information so construct our geom */
 		// read in region media and set them in the geometry
@@ -582,6 +627,8 @@ void EGSPhant::loadgzEGSPhantFile(QString path) {
 }
 
 void EGSPhant::loadgzEGSPhantFilePlus(QString path) {	
+	picCache.clear(); // in case of reload
+	closeChunks();
 	// Ripped fairly whole-cloth from egs_brachy
 	igzstream ogin(path.toStdString().c_str());
 	std::istream* data = (std::istream*)(&ogin);
@@ -627,16 +674,8 @@ void EGSPhant::loadgzEGSPhantFilePlus(QString path) {
 			z.append(bound);
 		}
 		
-        {
-            QVector <char> mz(nz, 0);
-            QVector <QVector <char> > my(ny, mz);
-            QVector <QVector <QVector <char> > > mx(nx, my);
-            m = mx;
-            QVector <double> dz(nz, 0);
-            QVector <QVector <double> > dy(ny, dz);
-            QVector <QVector <QVector <double> > > dx(nx, dy);
-            d = dx;
-        }
+        m.resize(nx, ny, nz, 0);
+        d.resize(nx, ny, nz, 0);
 				
 		/* now we've got all geometry information so construct our geom */
 		// read in region media and set them in the geometry
@@ -669,6 +708,185 @@ void EGSPhant::loadgzEGSPhantFilePlus(QString path) {
 	}
 }
 
+int EGSPhant::loadChunkedEGSPhantFile(QString path) {
+	picCache.clear(); // in case of reload
+	closeChunks();
+	
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return 101;
+	
+	QDataStream in(&file);
+	in.setByteOrder(QDataStream::LittleEndian);
+	
+	char magic[8];
+	qint32 version, n[4], nMedia, nSlabs;
+	if (in.readRawData(magic, 8) != 8 || memcmp(magic, "EGSCHUNK", 8))
+		return 102;
+	in >> version >> n[0] >> n[1] >> n[2] >> n[3] >> nMedia;
+	if (version != 1 || n[0] < 1 || n[1] < 1 || n[2] < 1 || n[3] < 1 || nMedia < 0)
+		return 102;
+	
+	nx = n[0];
+	ny = n[1];
+	nz = n[2];
+	media.resize(nMedia);
+	for (int i = 0; i < nMedia; i++) {
+		QByteArray name;
+		in >> name;
+		media[i] = QString::fromLatin1(name);
+	}
+	
+	x.fill(0,nx+1);
+	y.fill(0,ny+1);
+	z.fill(0,nz+1);
+	for (int i = 0; i <= nx; i++)
+		in >> x[i];
+	for (int i = 0; i <= ny; i++)
+		in >> y[i];
+	for (int i = 0; i <= nz; i++)
+		in >> z[i];
+	in >> maxDensity;
+	
+	in >> nSlabs;
+	if (nSlabs != (nz+n[3]-1)/n[3])
+		return 102;
+	chunkOffset.fill(0,nSlabs+1);
+	for (int s = 0; s <= nSlabs; s++)
+		in >> chunkOffset[s];
+	
+	if (in.status() != QDataStream::Ok) {
+		chunkOffset.clear();
+		return 102;
+	}
+	
+	// Voxel data stays on disk until it is asked for
+	m = Volume <char> ();
+	d = Volume <double> ();
+	chunkSlab = n[3];
+	chunkPath = path;
+	emit madeProgress(100);
+	return 0;
+}
+
+QString EGSPhant::chunkedPath(QString path) {
+	if (path.endsWith(".egsphant.gz"))
+		return path.left(path.size()-12)+".egschunk";
+	if (path.endsWith(".begsphant"))
+		return path.left(path.size()-10)+".egschunk";
+	if (path.endsWith(".egsphant"))
+		return path.left(path.size()-9)+".egschunk";
+	return path+".egschunk";
+}
+
+bool EGSPhant::loadChunkedSidecar(QString path) {
+	QString chunk = chunkedPath(path);
+	if (!QFile::exists(chunk) || QFileInfo(chunk).lastModified() < QFileInfo(path).lastModified())
+		return false;
+	
+	return !loadChunkedEGSPhantFile(chunk);
+}
+
+bool EGSPhant::isChunked() {
+	return !chunkPath.isEmpty();
+}
+
+void EGSPhant::setSlabBudget(int MB) {
+	QMutexLocker lock(&slabMutex);
+	slabCache.setMaxCost(MB*1024);
+}
+
+void EGSPhant::closeChunks() {
+	QMutexLocker lock(&slabMutex);
+	slabCache.clear();
+	chunkOffset.clear();
+	chunkPath.clear();
+}
+
+QSharedPointer <EGSSlab> EGSPhant::getSlab(int s) {
+	QMutexLocker lock(&slabMutex);
+	QSharedPointer <EGSSlab>* cached = slabCache.object(s);
+	if (cached)
+		return *cached;
+	
+	QSharedPointer <EGSSlab> slab(new EGSSlab);
+	int nk = qMin(nz, (s+1)*chunkSlab)-s*chunkSlab, size = nx*ny*nk;
+	slab->m.fill(-1, size);
+	slab->d.fill(-1, size);
+	
+	// Read and inflate just this slab, a bad slab reads as out of bounds
+	QFile file(chunkPath);
+	if (file.open(QIODevice::ReadOnly) && file.seek(chunkOffset[s])) {
+		QByteArray raw = qUncompress(file.read(chunkOffset[s+1]-chunkOffset[s]));
+		if (raw.size() == size*9) {
+			memcpy(slab->m.data(), raw.constData(), size);
+			QDataStream in(raw);
+			in.setByteOrder(QDataStream::LittleEndian);
+			in.skipRawData(size);
+			for (int n = 0; n < size; n++)
+				in >> slab->d[n];
+		}
+	}
+	
+	slabCache.insert(s, new QSharedPointer <EGSSlab> (slab), size*9/1024+1);
+	return slab;
+}
+
+void EGSPhant::loadAllSlabs() {
+	if (!isChunked())
+		return;
+	
+	Volume <char> tempM(nx, ny, nz, 0);
+	Volume <double> tempD(nx, ny, nz, 0);
+	double increment = 100.0/double(chunkOffset.size()-1);
+	for (int s = 0; s < chunkOffset.size()-1; s++) {
+		QSharedPointer <EGSSlab> slab = getSlab(s);
+		int nk = qMin(nz, (s+1)*chunkSlab)-s*chunkSlab;
+		for (int k = 0; k < nk; k++)
+			for (int j = 0; j < ny; j++)
+				for (int i = 0; i < nx; i++) {
+					tempM[i][j][s*chunkSlab+k] = slab->m[i+nx*(j+ny*k)];
+					tempD[i][j][s*chunkSlab+k] = slab->d[i+nx*(j+ny*k)];
+				}
+		emit madeProgress(increment); // Update progress bar
+	}
+	
+	closeChunks();
+	m = tempM;
+	d = tempD;
+}
+
+char EGSPhant::mediaAt(int ix, int iy, int iz) {
+	if (isChunked())
+		return getSlab(iz/chunkSlab)->m[ix+nx*(iy+ny*(iz%chunkSlab))];
+	return m.at(ix, iy, iz);
+}
+
+double EGSPhant::densityAt(int ix, int iy, int iz) {
+	if (isChunked())
+		return getSlab(iz/chunkSlab)->d[ix+nx*(iy+ny*(iz%chunkSlab))];
+	return d.at(ix, iy, iz);
+}
+
+void EGSPhant::getSlice(int iz, QVector <char> *med, QVector <double> *den) {
+	med->resize(nx*ny);
+	den->resize(nx*ny);
+	
+	if (isChunked()) {
+		QSharedPointer <EGSSlab> slab = getSlab(iz/chunkSlab);
+		int offset = nx*ny*(iz%chunkSlab);
+		std::copy(slab->m.constBegin()+offset, slab->m.constBegin()+offset+nx*ny, med->begin());
+		std::copy(slab->d.constBegin()+offset, slab->d.constBegin()+offset+nx*ny, den->begin());
+		return;
+	}
+	
+	for (int j = 0; j < ny; j++)
+		for (int i = 0; i < nx; i++) {
+			(*med)[i+nx*j] = m.at(i, j, iz);
+			(*den)[i+nx*j] = d.sizeX() ? d.at(i, j, iz) : 0; // Masks have no densities
+		}
+}
+
 char EGSPhant::getMedia(double px, double py, double pz) {
     int ix, iy, iz;
     ix = iy = iz = -1;
@@ -709,7 +927,7 @@ char EGSPhant::getMedia(double px, double py, double pz) {
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return m[ix][iy][iz];
+        return mediaAt(ix, iy, iz);
     }
 
     return -1; // We are not within our bounds
@@ -755,7 +973,7 @@ double EGSPhant::getDensity(double px, double py, double pz) {
 
     // This is to insure that no area outside the vectors is accessed
     if (ix < nx && ix >= 0 && iy < ny && iy >= 0 && iz < nz && iz >= 0) {
-        return d[ix][iy][iz];
+        return densityAt(ix, iy, iz);
     }
 
     return -1; // We are not within our bounds
@@ -764,7 +982,7 @@ double EGSPhant::getDensity(double px, double py, double pz) {
 double EGSPhant::getDensity(int px, int py, int pz) {
     // This is to insure that no area outside the vectors is accessed
     if (px < nx && px >= 0 && py < ny && py >= 0 && pz < nz && pz >= 0) {
-        return d[px][py][pz];
+        return densityAt(px, py, pz);
     }
 
     return -1; // We are not within our bounds
@@ -773,7 +991,9 @@ double EGSPhant::getDensity(int px, int py, int pz) {
 void EGSPhant::setDensity(int px, int py, int pz, double density) {
     // This is to insure that no area outside the vectors is accessed
     if (px < nx && px >= 0 && py < ny && py >= 0 && pz < nz && pz >= 0) {
+		loadAllSlabs(); // Chunked phantoms are read only
         d[px][py][pz] = density;
+		picCache.clear();
     }
 }
 
@@ -816,6 +1036,8 @@ int EGSPhant::getIndex(QString axis, double p) {
 
 
 void EGSPhant::redefineBounds(double xi, double yi, double zi, double xf, double yf, double zf) {
+	loadAllSlabs();
+	
 	// Get the new boundary limits
 	int xi2 = getIndex("x axis", xi);
 	int yi2 = getIndex("y axis", yi);
@@ -824,29 +1046,27 @@ void EGSPhant::redefineBounds(double xi, double yi, double zi, double xf, double
 	int yf2 = getIndex("y axis", yf);
 	int zf2 = getIndex("z axis", zf);
 	
-	// Check f is larger than i
-	if (xf2 <= xi2 || yf2 <= yi2 || zf2 <= zi2)
-		return;
-	
-	// Bring boundaries to within egsphant limits
+	// Bring boundaries outside of the egsphant to its first or last voxel
 	if (xi2 < 0)
-		xi2 = 0;
+		xi2 = xi < x.first() ? 0 : nx;
 	if (yi2 < 0)
-		yi2 = 0;
+		yi2 = yi < y.first() ? 0 : ny;
 	if (zi2 < 0)
-		zi2 = 0;
+		zi2 = zi < z.first() ? 0 : nz;
 	if (xf2 < 0)
-		xf2 = nx;
+		xf2 = xf < x.first() ? -1 : nx-1;
 	if (yf2 < 0)
-		yf2 = ny;
+		yf2 = yf < y.first() ? -1 : ny-1;
 	if (zf2 < 0)
-		zf2 = nz;
+		zf2 = zf < z.first() ? -1 : nz-1;
+	
+	// Check f is not below i, ie, some of the egsphant is kept
+	if (xf2 < xi2 || yf2 < yi2 || zf2 < zi2)
+		return;
 	
 	// Create the new data variables
     int new_nx = xf2-xi2+1, new_ny = yf2-yi2+1, new_nz = zf2-zi2+1;
     QVector <double> new_x, new_y, new_z;
-    QVector <QVector <QVector <char> > > new_m;
-    QVector <QVector <QVector <double> > > new_d;
 	
 	for (int i = xi2; i <= xf2+1; i++)
 		new_x.append(x[i]);
@@ -854,123 +1074,275 @@ void EGSPhant::redefineBounds(double xi, double yi, double zi, double xf, double
 		new_y.append(y[i]);
 	for (int i = zi2; i <= zf2+1; i++)
 		new_z.append(z[i]);
+	
+	// Now replace all data with the new indices, m and d become views into
+	// the old data and are only copied when written to
+    nx = new_nx;
+	ny = new_ny;
+	nz = new_nz;
+    x = new_x;
+	y = new_y;
+	z = new_z;
+    m = m.crop(xi2, yi2, zi2, nx, ny, nz);
+    d = d.crop(xi2, yi2, zi2, nx, ny, nz);
+	picCache.clear();
+}
 
-	// create the new 3D matrices to hold subdata
-	{
-		QVector <char> mz(new_nz, 0);
-		QVector <QVector <char> > my(new_ny, mz);
-		QVector <QVector <QVector <char> > > mx(new_nx, my);
-		new_m = mx;
-		QVector <double> dz(new_nz, 0);
-		QVector <QVector <double> > dy(new_ny, dz);
-		QVector <QVector <QVector <double> > > dx(new_nx, dy);
-		new_d = dx;
+QVector <int> EGSPhant::mergedBounds(const QVector <double> &b, int factor, double size) {
+	QVector <int> index;
+	int n = b.size()-1;
+	
+	index << 0;
+	for (int i = 0; i < n; i = index.last()) {
+		int next = i+1;
+		if (size > 0) // Keep adding voxels while it gets closer to size
+			while (next < n && fabs(b[next+1]-b[i]-size) < fabs(b[next]-b[i]-size))
+				next++;
+		else
+			next = qMin(i+qMax(factor, 1), n);
+		index << next;
 	}
 	
-	for (int k = zi2; k <= zf2; k++)
-		for (int j = yi2; j <= yf2; j++)
-			for (int i = xi2; i <= xf2; i++) {
-				new_m[i-xi2][j-yi2][k-zi2] = m[i][j][k];
-				new_d[i-xi2][j-yi2][k-zi2] = d[i][j][k];
+	return index;
+}
+
+void EGSPhant::resample(const QVector <int> &ix, const QVector <int> &iy, const QVector <int> &iz) {
+	loadAllSlabs();
+	
+	int new_nx = ix.size()-1, new_ny = iy.size()-1, new_nz = iz.size()-1;
+	if (new_nx < 1 || new_ny < 1 || new_nz < 1)
+		return;
+	
+	Volume <char> new_m(new_nx, new_ny, new_nz, 0);
+	Volume <double> new_d(new_nx, new_ny, new_nz, 0);
+	
+	// Each thread fills whole slices of the new phantom
+	QVector <int> slices(new_nz);
+	for (int k = 0; k < new_nz; k++)
+		slices[k] = k;
+	
+	QtConcurrent::blockingMap(slices, [&](int &K) {
+		double mass[256], vol[256], dv, dyz, totalMass, totalVol;
+		QVector <unsigned char> found; // Media in the current voxel, in the order they were found
+		std::fill(mass, mass+256, 0);
+		std::fill(vol, vol+256, 0);
+		
+		for (int J = 0; J < new_ny; J++) {
+			for (int I = 0; I < new_nx; I++) {
+				totalMass = totalVol = 0;
+				for (int k = iz[K]; k < iz[K+1]; k++)
+					for (int j = iy[J]; j < iy[J+1]; j++) {
+						dyz = (y[j+1]-y[j])*(z[k+1]-z[k]);
+						for (int i = ix[I]; i < ix[I+1]; i++) {
+							unsigned char c = m.at(i,j,k);
+							dv = (x[i+1]-x[i])*dyz;
+							if (vol[c] == 0)
+								found << c;
+							mass[c] += d.at(i,j,k)*dv;
+							vol[c] += dv;
+							totalMass += d.at(i,j,k)*dv;
+							totalVol += dv;
+						}
+					}
+				
+				// The medium with the most mass, or volume if there is no mass at all
+				unsigned char best = found[0];
+				for (int n = 1; n < found.size(); n++)
+					if (totalMass > 0 ? mass[found[n]] > mass[best] : vol[found[n]] > vol[best])
+						best = found[n];
+				for (int n = 0; n < found.size(); n++)
+					mass[found[n]] = vol[found[n]] = 0;
+				found.clear();
+				
+				new_m[I][J][K] = best;
+				new_d[I][J][K] = totalVol > 0 ? totalMass/totalVol : 0;
 			}
+		}
+	});
 	
-	// Now replace all data with the new indices
-    nx = new_nx;
+	QVector <double> new_x, new_y, new_z;
+	for (int i = 0; i <= new_nx; i++)
+		new_x.append(x[ix[i]]);
+	for (int i = 0; i <= new_ny; i++)
+		new_y.append(y[iy[i]]);
+	for (int i = 0; i <= new_nz; i++)
+		new_z.append(z[iz[i]]);
+	
+	nx = new_nx;
 	ny = new_ny;
 	nz = new_nz;
-    x = new_x;
+	x = new_x;
 	y = new_y;
 	z = new_z;
-    m = new_m;
-    d = new_d;
+	m = new_m;
+	d = new_d;
+	
+	maxDensity = 0;
+	for (int k = 0; k < nz; k++)
+		for (int j = 0; j < ny; j++)
+			for (int i = 0; i < nx; i++)
+				maxDensity = qMax(maxDensity, d.at(i,j,k));
+	picCache.clear();
+	
+	emit madeProgress(100);
 }
 
 QImage EGSPhant::getEGSPhantPicMed(QString axis, double ai, double af,
                                    double bi, double bf, double d, int res) {
-    // Create a temporary image
     int width  = (af-ai)*res; // Reversed on the image
     int height = (bf-bi)*res; // Reversed on the image
-    QImage image(height, width, QImage::Format_ARGB32_Premultiplied);
-    double hInc, wInc, cInc;
-    double h, w;
-	int c;
-	char med;
-	QString indeces("123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
-
-    // Calculate the size (in cm) of pixels, and then the range for grayscaling
-    wInc = 1/double(res);
-    hInc = 1/double(res);
-    cInc = 255.0/double(media.size()+1);
-
-    for (int i = 0; i < height; i++)
-        for (int j = 0; j < width; j++) {
-            // determine the location of the current pixel in the phantom
-            h = (double(bi)) + hInc * double(i);
-            w = (double(ai)) + wInc * double(j);
-
-            // get the media, which differs based on axis through which image is
-            // sliced
-            if (!axis.compare("x axis")) {
-                med = getMedia(d, h, w);
-            }
-            else if (!axis.compare("y axis")) {
-                med = getMedia(h, d, w);
-            }
-            else if (!axis.compare("z axis")) {
-                med = getMedia(h, w, d);
-            }
-			
-			c = (indeces.indexOf(med)+1)*cInc;
-
-            // finally, paint the pixel
-            image.setPixel(i, j, qRgb(c, c, c));
-        }
-
-    return image; // return the image created
+	
+    return getEGSPhantPic(axis, bi, ai, 1/double(res), height, width, d, false);
 }
 
 QImage EGSPhant::getEGSPhantPicDen(QString axis, double ai, double af,
                                    double bi, double bf, double d, int res,
 								   double di, double df) {
-    // Create a temporary image
     int width  = (af-ai)*res; // Reversed on the image
     int height = (bf-bi)*res; // Reversed on the image
-    QImage image(height, width, QImage::Format_ARGB32_Premultiplied);
-    double hInc, wInc, cInc;
-    double h, w, den = 0;
-	int	c;
-
-    // Calculate the size (in cm) of pixels, and then the range for grayscaling
-    wInc = 1/double(res);
-    hInc = 1/double(res);
-    cInc = 255.0/(df-di);
-
-    for (int i = 0; i < height; i++)
-        for (int j = 0; j < width; j++) {
-            // determine the location of the current pixel in the phantom
-            h = (double(bi)) + hInc * double(i);
-            w = (double(ai)) + wInc * double(j);
-
-            // get the density, which differs based on axis through which image
-            // os sliced
-            if (!axis.compare("x axis")) {
-                den = getDensity(d, h, w);
-            }
-            else if (!axis.compare("y axis")) {
-                den = getDensity(h, d, w);
-            }
-            else if (!axis.compare("z axis")) {
-                den = getDensity(h, w, d);
-            }
+	
+    return getEGSPhantPic(axis, bi, ai, 1/double(res), height, width, d, true, di, df);
+}
+
+QImage EGSPhant::getEGSPhantPic(QString axis, double hi, double wi, double step, int hCount,
+                                int wCount, double d, bool den, double di, double df,
+                                bool flip) {
+	// Get the slice index and the boundaries of the two in-plane axes
+	const QVector <double> *hb, *wb;
+	int slice, a;
+    if (!axis.compare("x axis")) {
+		slice = boundIndex(x, d);
+		hb = &y;
+		wb = &z;
+		a = 0;
+	}
+    else if (!axis.compare("y axis")) {
+		slice = boundIndex(y, d);
+		hb = &x;
+		wb = &z;
+		a = 1;
+	}
+    else if (!axis.compare("z axis")) {
+		slice = boundIndex(z, d);
+		hb = &x;
+		wb = &y;
+		a = 2;
+	}
+	else {
+		return QImage();
+	}
+	
+	// Every depth within a voxel renders the same, so key the cache by slice index
+	QString key = QString("%1 %2 %3 %4 %5 %6 %7 %8").arg(a).arg(slice).arg(hi,0,'g',17)
+				  .arg(wi,0,'g',17).arg(step,0,'g',17).arg(hCount).arg(wCount).arg(flip);
+	if (den)
+		key += QString(" %1 %2").arg(di,0,'g',17).arg(df,0,'g',17);
+	
+	QImage* cached = picCache.object(key);
+	if (cached)
+		return *cached;
+	
+	// Map pixels onto voxel indices once for the whole image
+	QVector <int> hIndex(hCount), wIndex(wCount);
+	for (int i = 0; i < hCount; i++)
+		hIndex[i] = boundIndex(*hb, hi + step * double(i));
+	for (int j = 0; j < wCount; j++)
+		wIndex[j] = boundIndex(*wb, wi + step * double(j));
+	
+	// Media colour lookup table, any char that is not a medium is black
+	QRgb mediaColour[256];
+	QString indeces("123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+	double cInc = den ? 255.0/(df-di) : 255.0/double(media.size()+1);
+	int c;
+	for (int n = 0; n < 256; n++)
+		mediaColour[n] = qRgb(0, 0, 0);
+	for (int n = 0; n < indeces.size(); n++) {
+		c = (n+1)*cInc;
+		mediaColour[(unsigned char)(indeces.at(n).toLatin1())] = qRgb(c, c, c);
+	}
+	
+	int cols = flip ? wCount : hCount, rows = flip ? hCount : wCount;
+    QImage image(cols, rows, QImage::Format_ARGB32_Premultiplied);
+	if (image.isNull())
+		return image;
+	
+	uchar* bits = image.bits();
+	int bytesPerLine = image.bytesPerLine();
+	const Volume <char> &cm = m;
+	const Volume <double> &cd = this->d; // d is the depth here
+	
+	// Chunked phantoms read the slabs the slice touches here, outside the threads
+	bool chunked = isChunked();
+	QVector <QSharedPointer <EGSSlab> > slabs;
+	if (chunked && slice >= 0) {
+		slabs.resize(chunkOffset.size()-1);
+		if (a == 2)
+			slabs[slice/chunkSlab] = getSlab(slice/chunkSlab);
+		else
+			for (int j = 0; j < wCount; j++)
+				if (wIndex[j] >= 0 && slabs[wIndex[j]/chunkSlab].isNull())
+					slabs[wIndex[j]/chunkSlab] = getSlab(wIndex[j]/chunkSlab);
+	}
+	
+	// Split the rows across the thread pool, each writing straight into its scanline
+	QVector <int> rowIndex(rows);
+	for (int r = 0; r < rows; r++)
+		rowIndex[r] = r;
+	
+	QtConcurrent::blockingMap(rowIndex, [&](int &r) {
+		QRgb* line = (QRgb*)(bits + r*bytesPerLine);
+		int h, w, i, j, k, col;
+		double den2;
+		
+		for (int n = 0; n < cols; n++) {
+			h = flip ? hIndex[rows-1-r] : hIndex[n];
+			w = flip ? wIndex[n] : wIndex[r];
+			
+			if (slice < 0 || h < 0 || w < 0) { // Outside of the phantom
+				line[n] = qRgb(0, 0, 0);
+				continue;
+			}
 			
-			// if c is out of bounds, set it to zero
-			// else if c is below the minimum density, set it to minimum density
-			// else if c is above the maximum density, set it to maximum density
-			c = ((den==-1)?0:(den<di?di:(den>df?df:den)))*cInc;
+			i = a == 0 ? slice : h;
+			j = a == 0 ? h : (a == 1 ? slice : w);
+			k = a == 2 ? slice : w;
+			
+			if (chunked) {
+				const EGSSlab* slab = slabs[k/chunkSlab].data();
+				int v = i+nx*(j+ny*(k%chunkSlab));
+				if (den) {
+					den2 = slab->d[v];
+					col = (den2<di?di:(den2>df?df:den2))*cInc;
+					line[n] = qRgb(col, col, col);
+				}
+				else {
+					line[n] = mediaColour[(unsigned char)(slab->m[v])];
+				}
+			}
+			else if (den) {
+				den2 = cd[i][j][k];
+				col = (den2<di?di:(den2>df?df:den2))*cInc;
+				line[n] = qRgb(col, col, col);
+			}
+			else {
+				line[n] = mediaColour[(unsigned char)(cm[i][j][k])];
+			}
+		}
+	});
+	
+	picCache.insert(key, new QImage(image), cols*rows*4/1024+1);
+	
+    return image; // return the image created
+}
 
-            // finally, paint the pixel
-            image.setPixel(i, j, qRgb(c, c, c));
-        }
+void EGSPhant::clearPicCache() {
+	picCache.clear();
+}
 
-    return image; // return the image created
-}
\ No newline at end of file
+int EGSPhant::boundIndex(const QVector <double> &b, double p) {
+	if (b.size() < 2 || p < b.first() || p > b.last())
+		return -1; // We are not within our bounds
+	
+	// First voxel whose upper boundary is not below p, as in getMedia
+	return std::lower_bound(b.constBegin()+1, b.constEnd(), p)-(b.constBegin()+1);
+}
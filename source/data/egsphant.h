@@ -40,9 +40,17 @@
 #define EGSPHANT_H
 
 #include <QtWidgets>
+#include <QtConcurrent>
 #include <iostream>
 #include <math.h>
 #include "libraries/gzstream.h"
+#include "volume.h"
+
+// One z slab of a chunked phantom, with voxel (i,j,k) at i+nx*(j+ny*k)
+struct EGSSlab {
+	QVector <char> m;
+	QVector <double> d;
+};
 
 class EGSPhant : public QObject {
     Q_OBJECT
@@ -55,8 +63,8 @@ public:
 
     int nx, ny, nz; // these hold the number of voxels
     QVector <double> x, y, z; // these hold the boundaries of the above voxels
-    QVector <QVector <QVector <char> > > m; // this holds all the media
-    QVector <QVector <QVector <double> > > d; // this holds all the densities
+    Volume <char> m; // this holds all the media
+    Volume <double> d; // this holds all the densities
     QVector <QString> media; // this holds all the possible media
     double maxDensity;
 	
@@ -70,10 +78,35 @@ public:
     void savegzEGSPhantFile(QString path);
 	void savegzEGSPhantFilePlus(QString path);
 	
+	// Chunked phantoms (.egschunk) store the header, bounds and a slab index up
+	// front, followed by independently compressed z slabs, so loading only reads
+	// the header and slabs are then read on demand within a memory budget
+	int saveChunkedEGSPhantFile(QString path, int slabSize = 8);
+	int loadChunkedEGSPhantFile(QString path);
+	static QString chunkedPath(QString path); // The .egschunk sidecar of an egsphant
+	bool loadChunkedSidecar(QString path); // Load the sidecar of path if it is up to date
+	bool isChunked();
+	void setSlabBudget(int MB);
+	void loadAllSlabs(); // Read every slab into m and d, ending lazy loading
+	
+	// Voxel access that works for both loaded and chunked phantoms, safe to use
+	// from several threads as long as the phantom is not being modified
+	char mediaAt(int ix, int iy, int iz);
+	double densityAt(int ix, int iy, int iz);
+	void getSlice(int iz, QVector <char> *med, QVector <double> *den); // Indexed i+nx*j
+	
 	void setDensity(int px, int py, int pz, double density);
 	
 	void redefineBounds(double xi, double yi, double zi, double xf, double yf, double zf);
 	
+	// Boundary indices of b grouping every factor voxels, or voxels making up widths
+	// closest to size (cm) if it is positive
+	static QVector <int> mergedBounds(const QVector <double> &b, int factor, double size = 0);
+	
+	// Merge the voxels between the boundary indices ix, iy and iz into one, with the
+	// medium having the most mass and the density conserving it
+	void resample(const QVector <int> &ix, const QVector <int> &iy, const QVector <int> &iz);
+	
 	void makeMask(EGSPhant* mask); // Useful for later analysis
 
     char getMedia(double px, double py, double pz);
@@ -86,6 +119,26 @@ public:
 							 double di, double df);
     QImage getEGSPhantPicMed(QString axis, double ai, double af,
                              double bi, double bf, double d, int res);
+	
+	// Render the slice at depth d along axis, pixel (i,j) samples in-plane coordinates
+	// (hi+i*step, wi+j*step), or (hi+(hCount-1-j)*step, wi+i*step) if flip, using the
+	// density window [di,df] if den, rendered slices are cached until the phantom changes
+    QImage getEGSPhantPic(QString axis, double hi, double wi, double step, int hCount,
+                          int wCount, double d, bool den, double di = 0, double df = 0,
+                          bool flip = false);
+	void clearPicCache(); // Needed after writing m or d directly
+	
+private:
+	QCache <QString, QImage> picCache; // Rendered slices, cost is in kB
+	int boundIndex(const QVector <double> &b, double p); // getMedia index convention
+	
+	QString chunkPath; // Empty unless this is a chunked phantom
+	int chunkSlab; // Slices per slab
+	QVector <qint64> chunkOffset; // File offsets of each slab, plus the end of file
+	QCache <int, QSharedPointer <EGSSlab> > slabCache; // Cost is in kB
+	QMutex slabMutex; // Guards slabCache
+	QSharedPointer <EGSSlab> getSlab(int s);
+	void closeChunks();
 };
 
 #endif
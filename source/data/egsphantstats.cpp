@@ -0,0 +1,300 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsphantstats.cpp
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+
+#include "egsphantstats.h"
+
+EGSPhantStats::EGSPhantStats() {
+	nx = ny = nz = 0;
+	minDensity = maxDensity = 0;
+}
+
+void EGSPhantStats::growBox(QVector <int> *b, int i, int j, int k) {
+	if (b->isEmpty()) {
+		*b = QVector <int> ({i, i, j, j, k, k});
+		return;
+	}
+	
+	if (i < (*b)[0]) (*b)[0] = i;
+	if (i > (*b)[1]) (*b)[1] = i;
+	if (j < (*b)[2]) (*b)[2] = j;
+	if (j > (*b)[3]) (*b)[3] = j;
+	if (k < (*b)[4]) (*b)[4] = k;
+	if (k > (*b)[5]) (*b)[5] = k;
+}
+
+void EGSPhantStats::mergeBox(QVector <int> *b, const QVector <int> &o) {
+	if (o.isEmpty())
+		return;
+	
+	growBox(b, o[0], o[2], o[4]);
+	growBox(b, o[1], o[3], o[5]);
+}
+
+int EGSPhantStats::compute(EGSPhant* phant, int slabSize) {
+	if (phant->nx < 1 || phant->ny < 1 || phant->nz < 1)
+		return 101;
+	if (slabSize < 1)
+		slabSize = 1;
+	
+	nx = phant->nx;
+	ny = phant->ny;
+	nz = phant->nz;
+	media = phant->media;
+	int nMed = media.size();
+	
+	// Map media chars straight onto media indices, -1 for anything else
+	QString indeces("123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+	int medIndex[256];
+	for (int n = 0; n < 256; n++)
+		medIndex[n] = -1;
+	for (int n = 0; n < nMed && n < indeces.size(); n++)
+		medIndex[(unsigned char)(indeces.at(n).toLatin1())] = n;
+	
+	// Air and vacuum are left out of the body bounding box
+	QVector <bool> air(nMed, false);
+	for (int n = 0; n < nMed; n++)
+		air[n] = media[n].startsWith("AIR", Qt::CaseInsensitive) ||
+				 media[n].startsWith("VACUUM", Qt::CaseInsensitive);
+	
+	const QVector <double> &bx = phant->x, &by = phant->y, &bz = phant->z;
+	
+	// Each slab is tallied separately in the thread pool
+	QVector <Slab> slabs((nz+slabSize-1)/slabSize);
+	for (int s = 0; s < slabs.size(); s++) {
+		slabs[s].k0 = s*slabSize;
+		slabs[s].k1 = qMin(nz, (s+1)*slabSize);
+	}
+	
+	auto tally = [&](Slab &s) {
+		s.count.fill(0, nMed);
+		s.volume.fill(0, nMed);
+		s.mass.fill(0, nMed);
+		s.box.resize(nMed);
+		s.minDensity = s.maxDensity = -1;
+		
+		QVector <char> med;
+		QVector <double> den;
+		int n, v, bin;
+		double dz, dyz, vol;
+		
+		for (int k = s.k0; k < s.k1; k++) {
+			phant->getSlice(k, &med, &den);
+			dz = bz[k+1]-bz[k];
+			
+			for (int j = 0; j < ny; j++) {
+				dyz = (by[j+1]-by[j])*dz;
+				for (int i = 0; i < nx; i++) {
+					v = i+nx*j;
+					n = medIndex[(unsigned char)(med[v])];
+					if (n < 0)
+						continue;
+					
+					vol = (bx[i+1]-bx[i])*dyz;
+					s.count[n]++;
+					s.volume[n] += vol;
+					s.mass[n] += vol*den[v];
+					growBox(&s.box[n], i, j, k);
+					if (!air[n])
+						growBox(&s.bodyBox, i, j, k);
+					
+					bin = den[v] > 0 ? int(den[v]/STATS_BIN_WIDTH) : 0;
+					if (bin >= s.histogram.size())
+						s.histogram.resize(bin+1);
+					s.histogram[bin]++;
+					
+					if (s.minDensity < 0 || den[v] < s.minDensity)
+						s.minDensity = den[v];
+					if (den[v] > s.maxDensity)
+						s.maxDensity = den[v];
+				}
+			}
+		}
+	};
+	
+	// Run a thread pool's worth of slabs at a time so progress can be reported
+	int batch = qMax(1, QThread::idealThreadCount());
+	double increment = 90.0/double(slabs.size());
+	for (int s = 0; s < slabs.size(); s += batch) {
+		int sf = qMin(slabs.size(), s+batch);
+		QtConcurrent::blockingMap(slabs.begin()+s, slabs.begin()+sf, tally);
+		emit madeProgress(increment*(sf-s));
+	}
+	
+	// Merge the slabs
+	count.fill(0, nMed);
+	volume.fill(0, nMed);
+	mass.fill(0, nMed);
+	box.fill(QVector <int> (), nMed);
+	bodyBox.clear();
+	histogram.clear();
+	minDensity = maxDensity = -1;
+	
+	for (int s = 0; s < slabs.size(); s++) {
+		for (int n = 0; n < nMed; n++) {
+			count[n] += slabs[s].count[n];
+			volume[n] += slabs[s].volume[n];
+			mass[n] += slabs[s].mass[n];
+			mergeBox(&box[n], slabs[s].box[n]);
+		}
+		mergeBox(&bodyBox, slabs[s].bodyBox);
+		
+		if (slabs[s].histogram.size() > histogram.size())
+			histogram.resize(slabs[s].histogram.size());
+		for (int b = 0; b < slabs[s].histogram.size(); b++)
+			histogram[b] += slabs[s].histogram[b];
+		
+		if (slabs[s].minDensity >= 0 && (minDensity < 0 || slabs[s].minDensity < minDensity))
+			minDensity = slabs[s].minDensity;
+		if (slabs[s].maxDensity > maxDensity)
+			maxDensity = slabs[s].maxDensity;
+	}
+	
+	emit madeProgress(10);
+	return 0;
+}
+
+int EGSPhantStats::saveStatsFile(QString path) {
+	QFile file(path);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+		return 101;
+	
+	QTextStream out(&file);
+	out << "EGSSTATS 1\n";
+	out << nx << " " << ny << " " << nz << "\n";
+	out << media.size() << "\n";
+	
+	// One medium per line, name count volume mass and bounding box
+	for (int n = 0; n < media.size(); n++) {
+		out << media[n] << " " << count[n] << " " << QString::number(volume[n], 'g', 17) << " "
+			<< QString::number(mass[n], 'g', 17);
+		for (int b = 0; b < 6; b++)
+			out << " " << (box[n].isEmpty() ? -1 : box[n][b]);
+		out << "\n";
+	}
+	
+	out << "body";
+	for (int b = 0; b < 6; b++)
+		out << " " << (bodyBox.isEmpty() ? -1 : bodyBox[b]);
+	out << "\n";
+	
+	out << QString::number(minDensity, 'g', 17) << " " << QString::number(maxDensity, 'g', 17) << "\n";
+	out << histogram.size() << "\n";
+	for (int b = 0; b < histogram.size(); b++)
+		out << histogram[b] << (b+1 < histogram.size() ? " " : "");
+	out << "\n";
+	
+	file.close();
+	return 0;
+}
+
+int EGSPhantStats::loadStatsFile(QString path) {
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+		return 101;
+	
+	QTextStream in(&file);
+	if (in.readLine().trimmed().compare("EGSSTATS 1"))
+		return 102;
+	
+	QString word;
+	int nMed, nBins;
+	in >> nx >> ny >> nz >> nMed;
+	if (nMed < 0)
+		return 102;
+	
+	media.resize(nMed);
+	count.fill(0, nMed);
+	volume.fill(0, nMed);
+	mass.fill(0, nMed);
+	box.fill(QVector <int> (), nMed);
+	for (int n = 0; n < nMed; n++) {
+		in >> media[n] >> count[n] >> volume[n] >> mass[n];
+		QVector <int> b(6);
+		for (int i = 0; i < 6; i++)
+			in >> b[i];
+		if (b[0] >= 0)
+			box[n] = b;
+	}
+	
+	in >> word;
+	if (word.compare("body"))
+		return 102;
+	bodyBox.resize(6);
+	for (int i = 0; i < 6; i++)
+		in >> bodyBox[i];
+	if (bodyBox[0] < 0)
+		bodyBox.clear();
+	
+	in >> minDensity >> maxDensity >> nBins;
+	if (nBins < 0)
+		return 102;
+	histogram.fill(0, nBins);
+	for (int b = 0; b < nBins; b++)
+		in >> histogram[b];
+	
+	if (in.status() != QTextStream::Ok)
+		return 102;
+	
+	return 0;
+}
+
+QString EGSPhantStats::statsPath(QString path) {
+	QString chunk = EGSPhant::chunkedPath(path); // Same base name as the chunked sidecar
+	return chunk.left(chunk.size()-9)+".egsstats";
+}
+
+bool EGSPhantStats::loadStatsSidecar(QString path, EGSPhant* phant) {
+	QString stats = statsPath(path);
+	if (!QFile::exists(stats) || QFileInfo(stats).lastModified() < QFileInfo(path).lastModified())
+		return false;
+	
+	if (loadStatsFile(stats))
+		return false;
+	
+	// Make sure it still describes this phantom
+	return nx == phant->nx && ny == phant->ny && nz == phant->nz && media == phant->media;
+}
+
+QVector <int> EGSPhantStats::presentMedia() {
+	QVector <int> present;
+	for (int n = 0; n < count.size(); n++)
+		if (count[n])
+			present << n;
+	return present;
+}
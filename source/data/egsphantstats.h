@@ -0,0 +1,92 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsphantstats.h
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+
+#ifndef EGSPHANTSTATS_H
+#define EGSPHANTSTATS_H
+
+#include "egsphant.h"
+
+#define STATS_BIN_WIDTH 0.01 // Density histogram bin width in g/cm^3
+
+// Summary of the media composition of an EGSPhant, gathered in one parallel
+// pass over z slabs and kept in a small text sidecar (.egsstats)
+class EGSPhantStats : public QObject {
+    Q_OBJECT
+
+signals:
+	void madeProgress(double percent); // Update the progress bar
+
+public:
+	EGSPhantStats();
+	
+	int nx, ny, nz; // Size of the phantom these stats describe
+	QVector <QString> media; // Media names, in EGSPHANT_CHARS order
+	QVector <qint64> count; // Voxels per medium
+	QVector <double> volume; // Volume per medium (cm^3)
+	QVector <double> mass; // Mass per medium (g)
+	QVector <QVector <int> > box; // Per medium {imin, imax, jmin, jmax, kmin, kmax}, empty if absent
+	QVector <int> bodyBox; // Bounding box of all non-air voxels, empty if there are none
+	double minDensity, maxDensity;
+	QVector <qint64> histogram; // Voxels per density bin of STATS_BIN_WIDTH, starting at 0
+	
+	int compute(EGSPhant* phant, int slabSize = 8);
+	int saveStatsFile(QString path);
+	int loadStatsFile(QString path);
+	static QString statsPath(QString path); // The .egsstats sidecar of an egsphant
+	bool loadStatsSidecar(QString path, EGSPhant* phant); // Load the sidecar if it is up to date
+	
+	QVector <int> presentMedia(); // Indices of media with at least one voxel
+	
+private:
+	// Partial results of one slab, merged once all slabs are done
+	struct Slab {
+		int k0, k1;
+		QVector <qint64> count;
+		QVector <double> volume, mass;
+		QVector <QVector <int> > box;
+		QVector <int> bodyBox;
+		QVector <qint64> histogram;
+		double minDensity, maxDensity;
+	};
+	
+	static void growBox(QVector <int> *b, int i, int j, int k);
+	static void mergeBox(QVector <int> *b, const QVector <int> &o);
+};
+
+#endif
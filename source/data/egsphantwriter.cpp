@@ -0,0 +1,220 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsphantwriter
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+#include "egsphantwriter.h"
+#include <zlib.h>
+
+EGSPhantWriter::EGSPhantWriter(QString path) : file(path), spill(path+".XXXXXX") {
+	nz = nextSlice = 0;
+	started = done = failed = false;
+}
+
+EGSPhantWriter::~EGSPhantWriter() {
+	if (started && !done)
+		abort();
+}
+
+int EGSPhantWriter::begin(EGSPhant* phant) {
+	if (!file.open(QIODevice::WriteOnly))
+		return 101;
+	if (!spill.open()) {
+		file.close();
+		file.remove();
+		return 101;
+	}
+	
+	nz = phant->nz;
+	spillPos.fill(-1, nz);
+	spillSize.fill(0, nz);
+	
+	// Same header as savegzEGSPhantFilePlus
+	std::ostringstream out;
+	out << phant->media.size() << "\n";
+	for (int i = 0; i < phant->media.size(); i++)
+		out << phant->media[i].toStdString() << "\n";
+	for (int i = 0; i < phant->media.size(); i++)
+		out << " 0.5";
+	out << "\n";
+	
+	out << phant->nx << " " << phant->ny << " " << phant->nz << "\n";
+	for (int i = 0; i < phant->nx; i++)
+		out << phant->x[i] << " ";
+	out << phant->x.last() << "\n";
+	for (int i = 0; i < phant->ny; i++)
+		out << phant->y[i] << " ";
+	out << phant->y.last() << "\n";
+	for (int i = 0; i < phant->nz; i++)
+		out << phant->z[i] << " ";
+	out << phant->z.last() << "\n";
+	
+	QByteArray header = gzipMember(out.str());
+	if (file.write(header) != header.size())
+		failed = true;
+	
+	started = true;
+	start();
+	return 0;
+}
+
+void EGSPhantWriter::addSlice(EGSPhant* phant, int k) {
+	if (!started)
+		return;
+	
+	std::ostringstream med, den;
+	for (int j = 0; j < phant->ny; j++)
+		for (int i = 0; i < phant->nx; i++)
+			med << phant->m.at(i,j,k);
+	
+	if (k == 0) // End of the media
+		den << "\n";
+	for (int j = 0; j < phant->ny; j++)
+		for (int i = 0; i < phant->nx; i++)
+			den << phant->d.at(i,j,k) << " ";
+	
+	QByteArray medGz = gzipMember(med.str()), denGz = gzipMember(den.str());
+	
+	QMutexLocker lock(&mutex);
+	if (medGz.isEmpty() || denGz.isEmpty())
+		failed = true;
+	media[k] = medGz;
+	density[k] = denGz;
+	added.wakeAll();
+}
+
+void EGSPhantWriter::run() {
+	QList <QByteArray> next;
+	QMap <int, QByteArray> den;
+	
+	forever {
+		mutex.lock();
+		while (!done && !media.contains(nextSlice) && density.isEmpty())
+			added.wait(&mutex);
+		while (media.contains(nextSlice+next.size()))
+			next << media.take(nextSlice+next.size());
+		den.swap(density);
+		bool stop = done && next.isEmpty() && den.isEmpty(); // Nothing more is coming
+		mutex.unlock();
+		if (stop)
+			break;
+		
+		// Write outside of the lock so that slices keep coming in
+		bool ok = true;
+		for (QMap <int, QByteArray>::const_iterator it = den.constBegin(); it != den.constEnd(); ++it) {
+			spillPos[it.key()] = spill.pos();
+			spillSize[it.key()] = it.value().size();
+			ok = ok && spill.write(it.value()) == it.value().size();
+		}
+		for (int n = 0; n < next.size(); n++, nextSlice++)
+			ok = ok && file.write(next[n]) == next[n].size();
+		next.clear();
+		den.clear();
+		
+		if (!ok) {
+			QMutexLocker lock(&mutex);
+			failed = true;
+		}
+	}
+}
+
+int EGSPhantWriter::finish() {
+	if (!started)
+		return 101;
+	
+	mutex.lock();
+	done = true;
+	added.wakeAll();
+	mutex.unlock();
+	wait();
+	
+	if (nextSlice != nz) // A slice never came
+		failed = true;
+	
+	// The densities, one slice at a time
+	for (int k = 0; k < nz && !failed; k++) {
+		if (spillPos[k] < 0 || !spill.seek(spillPos[k])) {
+			failed = true;
+			break;
+		}
+		QByteArray member = spill.read(spillSize[k]);
+		if (member.size() != spillSize[k] || file.write(member) != member.size())
+			failed = true;
+	}
+	spill.close();
+	spill.remove();
+	file.close();
+	
+	if (failed) {
+		file.remove();
+		return 102;
+	}
+	return 0;
+}
+
+void EGSPhantWriter::abort() {
+	mutex.lock();
+	done = true;
+	media.clear();
+	density.clear();
+	added.wakeAll();
+	mutex.unlock();
+	wait();
+	
+	spill.close();
+	spill.remove();
+	file.close();
+	file.remove();
+}
+
+QByteArray EGSPhantWriter::gzipMember(const std::string &text) {
+	z_stream strm;
+	memset(&strm, 0, sizeof(strm));
+	if (deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS+16, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		return QByteArray();
+	
+	QByteArray out;
+	out.resize(deflateBound(&strm, text.size()));
+	strm.next_in = (Bytef*)text.data();
+	strm.avail_in = text.size();
+	strm.next_out = (Bytef*)out.data();
+	strm.avail_out = out.size();
+	int ret = deflate(&strm, Z_FINISH);
+	out.resize(out.size()-strm.avail_out);
+	deflateEnd(&strm);
+	
+	return ret == Z_STREAM_END ? out : QByteArray();
+}
@@ -0,0 +1,91 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI egsphantwriter
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+#ifndef EGSPHANTWRITER_H
+#define EGSPHANTWRITER_H
+
+#include <QtWidgets>
+#include <sstream>
+#include "egsphant.h"
+
+// Writes a gz egsphant (as EGSPhant::savegzEGSPhantFilePlus does) while the phantom
+// is still being built.  Each finished z slice is formatted and compressed by the
+// thread that finished it into gzip members of its own, as a gzip file may be many
+// concatenated members, and a writer thread appends the media members to the file
+// in z order.  The density members are spilled to a temporary file beside it as
+// they come, and copied over in z order once all of the media are written.
+class EGSPhantWriter : public QThread {
+public:
+	EGSPhantWriter(QString path);
+	~EGSPhantWriter();
+	
+	// Write the header of phant, which must have its final geometry and media, and
+	// start the writer thread, 101 if the file could not be opened
+	int begin(EGSPhant* phant);
+	
+	// Add slice k of phant once it will not change anymore, from any thread
+	void addSlice(EGSPhant* phant, int k);
+	
+	// Wait for every slice and copy the densities over, 0 if the whole file was written
+	int finish();
+	
+	// Stop writing and remove the file
+	void abort();
+	
+	// Compress text into a single gzip member
+	static QByteArray gzipMember(const std::string &text);
+	
+protected:
+	void run();
+	
+private:
+	// Only used by the writer thread while it runs
+	QFile file;
+	QTemporaryFile spill; // Density members
+	QVector <qint64> spillPos, spillSize; // Of each slice in spill, -1 until written
+	int nz;
+	int nextSlice; // The next slice of media to write
+	bool started;
+	
+	QMutex mutex; // Guards everything below
+	QWaitCondition added;
+	bool done, failed;
+	QMap <int, QByteArray> media, density; // Compressed slices not written yet
+};
+
+#endif
@@ -0,0 +1,148 @@
+/*
+################################################################################
+#
+#  egs_brachy_GUI volume.h
+#  Copyright (C) 2021 Shannon Jarvis, Martin Martinov, and Rowan Thomson
+#
+#  This file is part of egs_brachy_GUI
+#
+#  egs_brachy_GUI is free software: you can redistribute it and/or modify it
+#  under the terms of the GNU Affero General Public License as published
+#  by the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  egs_brachy_GUI is distributed in the hope that it will be useful, but
+#  WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+#  Affero General Public License for more details:
+#  <http://www.gnu.org/licenses/>.
+#
+################################################################################
+#
+#  When egs_brachy is used for publications, please cite our paper:
+#  M. J. P. Chamberland, R. E. P. Taylor, D. W. O. Rogers, and R. M. Thomson,
+#  egs brachy: a versatile and fast Monte Carlo code for brachytherapy,
+#  Phys. Med. Biol. 61, 8214-8231 (2016).
+#
+#  When egs_brachy_GUI is used for publications, please cite our paper:
+#  To Be Announced
+#
+################################################################################
+#
+#  Author:        Shannon Jarvis
+#                 Martin Martinov (martinov@physics.carleton.ca)
+#
+#  Contributors:  Rowan Thomson (rthomson@physics.carleton.ca)
+#
+################################################################################
+*/
+
+#ifndef VOLUME_H
+#define VOLUME_H
+
+#include <QtCore>
+#include <algorithm>
+
+// A 3D array indexed as v[i][j][k], stored as a single buffer with k varying
+// fastest.  Copies and crops share the buffer of their parent and only refer
+// to a box within it, so they are free.  The first write through a shared
+// volume copies its box into its own compact buffer first (copy-on-write).
+template <class T> class Volume {
+	struct Buffer : public QSharedData {
+		QVector <T> v;
+	};
+	
+public:
+	// Returned by v[i], so that v[i][j] is a pointer to the k line at (i,j)
+	template <class P> class Plane {
+	public:
+		Plane(P p, int sj) : p(p), sj(sj) {}
+		P operator[](int j) const {return p + j*sj;}
+	private:
+		P p;
+		int sj;
+	};
+	
+	Volume() : ni(0), nj(0), nk(0), si(0), sj(0), ptr(0) {}
+	Volume(int x, int y, int z, const T &fill = T()) : ptr(0) {resize(x, y, z, fill);}
+	
+	// Allocate a new compact buffer of size x*y*z filled with fill
+	void resize(int x, int y, int z, const T &fill = T()) {
+		buf = new Buffer;
+		buf->v.fill(fill, x*y*z);
+		ni = x;
+		nj = y;
+		nk = z;
+		sj = nk;
+		si = nj*nk;
+		ptr = buf->v.data();
+	}
+	
+	int sizeX() const {return ni;}
+	int sizeY() const {return nj;}
+	int sizeZ() const {return nk;}
+	
+	// Element access, the non-const versions detach shared data first
+	Plane <T*> operator[](int i) {
+		detach();
+		return Plane <T*> (ptr + i*si, sj);
+	}
+	Plane <const T*> operator[](int i) const {
+		return Plane <const T*> (ptr + i*si, sj);
+	}
+	const T &at(int i, int j, int k) const {
+		return ptr[i*si + j*sj + k];
+	}
+	
+	// Return a view of the box of size (x,y,z) starting at voxel (i,j,k),
+	// which shares this volume's data and so costs nothing
+	Volume crop(int i, int j, int k, int x, int y, int z) const {
+		Volume view(*this);
+		view.ptr = ptr + i*si + j*sj + k;
+		view.ni = x;
+		view.nj = y;
+		view.nk = z;
+		return view;
+	}
+	
+	// True if the data spans the whole buffer in order, ie, it is not a crop
+	bool isCompact() const {
+		return !buf || (ptr == buf->v.constData() && si == nj*nk && sj == nk &&
+						buf->v.size() == ni*nj*nk);
+	}
+	
+	// Copy the data into a buffer of its own, releasing the parent volume
+	void compact() {
+		if (isCompact())
+			return;
+		copyOut();
+	}
+	
+	// Copy shared data now, which has to be done before several threads write
+	// through the non-const accessors at once
+	void detach() {
+		if (buf && buf->ref.load() != 1)
+			copyOut();
+	}
+	
+private:
+	QExplicitlySharedDataPointer <Buffer> buf;
+	int ni, nj, nk; // Size of the box
+	int si, sj; // Strides of the parent buffer in i and j
+	T* ptr; // Pointer to element (0,0,0) of the box
+	
+	void copyOut() {
+		QExplicitlySharedDataPointer <Buffer> temp(new Buffer);
+		temp->v.resize(ni*nj*nk);
+		T* out = temp->v.data();
+		for (int i = 0; i < ni; i++)
+			for (int j = 0; j < nj; j++)
+				out = std::copy(ptr + i*si + j*sj, ptr + i*si + j*sj + nk, out);
+		buf = temp;
+		sj = nk;
+		si = nj*nk;
+		ptr = buf->v.data();
+	}
+};
+
+#endif
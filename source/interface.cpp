@@ -619,6 +619,9 @@ void Interface::phantomDeleteFile() {
 	// Delete all associated files
 	QFile(data->localDirPhants[i]+matchingNames[0]->text()).remove();
 	QFile(data->localDirPhants[i]+fileName+".log").remove();
+	QFile(data->localDirPhants[i]+fileName+".egschunk").remove();
+	QFile(data->localDirPhants[i]+fileName+".egsstats").remove();
+	QFile(data->gui_location+"/database/mask/"+fileName+".egsmask.gz").remove();
 	
 	QDirIterator files (data->gui_location+"/database/mask/", {QString(fileName)+".*.egsphant.gz"},
 						QDir::NoFilter, QDirIterator::Subdirectories);
@@ -1248,9 +1251,12 @@ void Interface::createProgress(){
 	progLayout = new QGridLayout();
 	progLabel = new QLabel();
 	progress = new QProgressBar();
+	progCancel = new QPushButton(tr("Cancel"));
+	progCancel->hide();
 	
     progLayout->addWidget(progLabel, 0, 0);
     progLayout->addWidget(progress, 1, 0);
+    progLayout->addWidget(progCancel, 2, 0, Qt::AlignRight);
     progWin->setLayout(progLayout);
     progWin->resize(300, 0);
     progress->setRange(0, 100);
@@ -1265,6 +1271,10 @@ void Interface::connectProgress(){
 		 this, SLOT(finishedProgress()));
     connect(data, SIGNAL(newProgressName(QString)),
 		 this, SLOT(nameProgress(QString)));
+    connect(data, SIGNAL(cancellable(bool)),
+		 progCancel, SLOT(setVisible(bool)));
+    connect(progCancel, SIGNAL(clicked()),
+		 data, SLOT(cancelProgress()));
 }
 
 void Interface::deleteProgress(){
@@ -1274,6 +1284,7 @@ void Interface::deleteProgress(){
 
 void Interface::resetProgress(QString title){
     progress->reset();
+    progCancel->hide();
     *progLevel = 0;
 	progLabel->setText("Loading...");
     progWin->setWindowTitle(title);
@@ -1297,6 +1308,7 @@ void Interface::nameProgress(QString text){
 }
 
 void Interface::finishedProgress(){
+    progCancel->hide();
     progWin->hide();	
 }
 
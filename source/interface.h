@@ -229,6 +229,7 @@ public:
 	QLabel *progLabel;
     QGridLayout *progLayout;
     QProgressBar *progress;
+	QPushButton *progCancel; // Only shown for jobs that can be cancelled
 	
 	void createProgress();
 	void connectProgress();
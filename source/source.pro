@@ -4,7 +4,9 @@
 
 QT += widgets
 QT += charts
+QT += concurrent
 LIBS += -lz
+CONFIG += c++14
 TEMPLATE = app
 TARGET = ../eb_gui
 INCLUDEPATH += .
@@ -24,8 +26,13 @@ DEFINES += QT_DEPRECATED_WARNINGS
 HEADERS += data.h \
            interface.h \
            data/DICOM.h \
+           data/dicomindex.h \
            data/dose.h \
+           data/egsmask.h \
            data/egsphant.h \
+           data/egsphantwriter.h \
+           data/egsphantstats.h \
+           data/volume.h \
            data/input.h \
            GUI/appInterface.h \
            GUI/doseInterface.h \
@@ -38,8 +45,12 @@ SOURCES += data.cpp \
            main.cpp \
            data/database.cpp \
            data/DICOM.cpp \
+           data/dicomindex.cpp \
            data/dose.cpp \
+           data/egsmask.cpp \
            data/egsphant.cpp \
+           data/egsphantwriter.cpp \
+           data/egsphantstats.cpp \
            data/input.cpp \
            GUI/appInterface.cpp \
            GUI/doseInterface.cpp \